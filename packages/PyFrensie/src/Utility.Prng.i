@@ -34,6 +34,7 @@ Prng.RandomNumberGenerator proxy class.
 
 // Frensie Includes
 #include "PyFrensie_PythonTypeTraits.hpp"
+#include "Utility_RandomNumberGeneratorType.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 %}
 
@@ -189,6 +190,14 @@ Deletes the fake stream and reinstates the original random number stream. Note
 that the original random number stream state will be reset as well.
 "
 
+%feature("docstring")
+Utility::RandomNumberGenerator::setGeneratorType
+"
+Sets the type of generator (linear congruential or counter-based) that will be
+used by the random number streams. Call 'createStreams' after setting the type
+to reset the existing streams.
+"
+
 // Typemap which will allow use of NumPy arrays, lists or tuples to set
 // the fake stream
 %typemap(in) const std::vector<double>& fake_stream (std::vector<double> temp)
@@ -207,6 +216,9 @@ that the original random number stream state will be reset as well.
   $1 = (PyArray_Check($input) || PySequence_Check($input)) ? 1 : 0;
 }
 
+// Include the RandomNumberGeneratorType
+%include "Utility_RandomNumberGeneratorType.hpp"
+
 // Include the RandomNumberGenerator
 %include "Utility_RandomNumberGenerator.hpp"
 
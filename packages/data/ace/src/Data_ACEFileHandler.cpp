@@ -8,6 +8,11 @@
 
 // Std Lib Includes
 #include <stdexcept>
+#include <fstream>
+#include <algorithm>
+#include <sstream>
+#include <functional>
+#include <cstdint>
 
 // Boost Includes
 #include <boost/filesystem.hpp>
@@ -16,12 +21,30 @@
 // FRENSIE Includes
 #include "Data_ACEFileHandler.hpp"
 #include "Data_ACEHelperWrappers.hpp"
+#include "Utility_LoggingMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 
 namespace Data{
 
+// Initialize static member data
+std::mutex ACEFileHandler::s_fortran_io_mutex;
+
+const unsigned ACEFileHandler::s_table_cache_version = 1;
+
+boost::filesystem::path ACEFileHandler::s_table_cache_directory;
+
+// The table cache file magic string
+static const char s_table_cache_magic[8] = {'F','R','N','S','A','C','E','C'};
+
 // Constructor
+/*! \details The ACE table is read using the ace_helpers fortran module. This
+ * constructor can be called concurrently but the tables will be read
+ * one at a time. If a table cache directory has been set, the table will be
+ * loaded from its binary copy in the cache when the ACE file has not changed
+ * since the copy was made. Otherwise the table will be read from the ACE file
+ * and a binary copy will be added to the cache.
+ */
 ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_path,
 				const std::string& table_name,
 				const size_t table_start_line,
@@ -38,7 +61,8 @@ ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_pa
     d_atomic_weight_ratios(),
     d_nxs(),
     d_jxs(),
-    d_xss( new std::vector<double> )
+    d_xss( new std::vector<double> ),
+    d_loaded_from_cache( false )
 {
   // Convert to the preferred path format
   d_ace_library_name.make_preferred();
@@ -47,15 +71,83 @@ ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_pa
                       std::runtime_error,
                       "ACE file " << d_ace_library_name.string() <<
                       " does not exist!" );
-  
-  this->openACEFile( d_ace_library_name.string(), is_ascii );
-  this->readACETable( table_name, table_start_line );
+
+  // Check if the table has been cached
+  boost::filesystem::path cache_file_path;
+  std::string cache_key;
+
+  if( is_ascii && !ACEFileHandler::getTableCacheDirectory().empty() )
+  {
+    cache_key = this->createTableCacheKey( table_name, table_start_line );
+
+    cache_file_path =
+      ACEFileHandler::getTableCacheFilePath( table_name, cache_key );
+
+    d_loaded_from_cache =
+      this->readTableFromCache( cache_file_path, cache_key );
+  }
+
+  if( !d_loaded_from_cache )
+  {
+    {
+      std::lock_guard<std::mutex> lock( s_fortran_io_mutex );
+
+      this->openACEFile( d_ace_library_name.string(), is_ascii );
+      this->readACETable( table_name, table_start_line );
+    }
+
+    if( !cache_file_path.empty() )
+      this->writeTableToCache( cache_file_path, cache_key );
+  }
 }
 
 // Destructor
 ACEFileHandler::~ACEFileHandler()
 {}
 
+// Set the directory where binary copies of the tables will be cached
+/*! \details The directory will be created if it does not exist. The cache
+ * directory should be set before any tables are loaded. Repeated runs that
+ * use the same ACE tables can share a cache directory to skip the (slow)
+ * parsing of the ACE text files.
+ */
+void ACEFileHandler::setTableCacheDirectory(
+                            const boost::filesystem::path& cache_directory )
+{
+  // Make sure that the cache directory is valid
+  testPrecondition( !cache_directory.empty() );
+
+  if( !boost::filesystem::exists( cache_directory ) )
+    boost::filesystem::create_directories( cache_directory );
+
+  TEST_FOR_EXCEPTION( !boost::filesystem::is_directory( cache_directory ),
+                      std::runtime_error,
+                      "The ACE table cache directory ("
+                      << cache_directory.string() << ") is not a valid "
+                      "directory path!" );
+
+  s_table_cache_directory = cache_directory;
+  s_table_cache_directory.make_preferred();
+}
+
+// Unset the table cache directory (tables will not be cached)
+void ACEFileHandler::unsetTableCacheDirectory()
+{
+  s_table_cache_directory.clear();
+}
+
+// Get the table cache directory (empty if tables are not cached)
+boost::filesystem::path ACEFileHandler::getTableCacheDirectory()
+{
+  return s_table_cache_directory;
+}
+
+// Check if the table was loaded from the table cache
+bool ACEFileHandler::wasTableLoadedFromCache() const
+{
+  return d_loaded_from_cache;
+}
+
 // Open an ACE library file
 void ACEFileHandler::openACEFile( const std::string& file_name,
 				  const bool is_ascii )
@@ -162,6 +254,208 @@ void ACEFileHandler::readACETable( const std::string& table_name,
   closeFileUsingFortran( d_ace_file_id );
 }
 
+// Create the table cache key
+/*! \details The key identifies the ACE file and the table in it. The key
+ * will change if the ACE file is modified.
+ */
+std::string ACEFileHandler::createTableCacheKey(
+                                       const std::string& table_name,
+                                       const size_t table_start_line ) const
+{
+  std::ostringstream oss;
+
+  oss << "v" << s_table_cache_version << "|"
+      << boost::filesystem::canonical( d_ace_library_name ).string() << "|"
+      << boost::filesystem::file_size( d_ace_library_name ) << "|"
+      << boost::filesystem::last_write_time( d_ace_library_name ) << "|"
+      << table_name << "|"
+      << table_start_line;
+
+  return oss.str();
+}
+
+// Get the table cache file path
+boost::filesystem::path ACEFileHandler::getTableCacheFilePath(
+                                             const std::string& table_name,
+                                             const std::string& cache_key )
+{
+  std::ostringstream oss;
+
+  oss << table_name << "_" << std::hex
+      << std::hash<std::string>()( cache_key ) << ".acebin";
+
+  boost::filesystem::path cache_file_path =
+    ACEFileHandler::getTableCacheDirectory();
+
+  cache_file_path /= oss.str();
+
+  return cache_file_path;
+}
+
+// Read the table from the table cache
+/*! \details If the cache file does not exist, was created from a different
+ * ACE file or is corrupt, false will be returned.
+ */
+bool ACEFileHandler::readTableFromCache(
+                              const boost::filesystem::path& cache_file_path,
+                              const std::string& cache_key )
+{
+  std::ifstream cache_file( cache_file_path.string(), std::ios::binary );
+
+  if( !cache_file )
+    return false;
+
+  // Read a raw value
+  auto read_raw = [&cache_file]( void* value, const size_t bytes ){
+    cache_file.read( static_cast<char*>( value ), bytes );
+    return (bool)cache_file; };
+
+  // Read a string
+  auto read_string = [&read_raw]( std::string& value ){
+    uint64_t size;
+
+    if( !read_raw( &size, sizeof(size) ) )
+      return false;
+
+    value.resize( size );
+
+    return size == 0 || read_raw( &value[0], size ); };
+
+  // Check the header
+  char magic[sizeof(s_table_cache_magic)];
+  std::string stored_cache_key;
+
+  if( !read_raw( magic, sizeof(magic) ) ||
+      !std::equal( magic, magic+sizeof(magic), s_table_cache_magic ) ||
+      !read_string( stored_cache_key ) ||
+      stored_cache_key != cache_key )
+    return false;
+
+  // Read the table
+  std::string table_name, processing_date, comment, material_id;
+  double atomic_weight_ratio, temperature;
+  uint64_t number_of_zaids, xss_size;
+
+  if( !read_string( table_name ) ||
+      !read_string( processing_date ) ||
+      !read_string( comment ) ||
+      !read_string( material_id ) ||
+      !read_raw( &atomic_weight_ratio, sizeof(double) ) ||
+      !read_raw( &temperature, sizeof(double) ) ||
+      !read_raw( &number_of_zaids, sizeof(uint64_t) ) ||
+      number_of_zaids > 16 )
+    return false;
+
+  std::vector<unsigned> raw_zaids( number_of_zaids );
+  std::vector<double> atomic_weight_ratios( number_of_zaids );
+
+  if( (number_of_zaids > 0 &&
+       (!read_raw( raw_zaids.data(), number_of_zaids*sizeof(unsigned) ) ||
+        !read_raw( atomic_weight_ratios.data(),
+                   number_of_zaids*sizeof(double) ))) ||
+      !read_raw( d_nxs.data(), d_nxs.size()*sizeof(int) ) ||
+      !read_raw( d_jxs.data(), d_jxs.size()*sizeof(int) ) ||
+      !read_raw( &xss_size, sizeof(uint64_t) ) ||
+      xss_size != (uint64_t)d_nxs[0] )
+    return false;
+
+  // The xss array is read with a single call
+  d_xss->resize( xss_size );
+
+  if( !read_raw( d_xss->data(), xss_size*sizeof(double) ) )
+    return false;
+
+  d_ace_table_name = table_name;
+  d_ace_table_processing_date = processing_date;
+  d_ace_table_comment = comment;
+  d_ace_table_material_id = material_id;
+  d_atomic_weight_ratio = atomic_weight_ratio;
+  d_temperature = temperature*Utility::Units::MeV;
+  d_zaids.assign( raw_zaids.begin(), raw_zaids.end() );
+  d_atomic_weight_ratios = atomic_weight_ratios;
+
+  return true;
+}
+
+// Write the table to the table cache
+/*! \details The table is written to a temporary file which is then renamed
+ * so that processes sharing the cache never see a partially written file.
+ * A warning will be logged if the table cannot be cached.
+ */
+void ACEFileHandler::writeTableToCache(
+                              const boost::filesystem::path& cache_file_path,
+                              const std::string& cache_key ) const
+{
+  boost::filesystem::path tmp_cache_file_path = cache_file_path;
+  tmp_cache_file_path +=
+    boost::filesystem::unique_path( ".%%%%-%%%%-%%%%.tmp" );
+
+  bool table_written;
+
+  {
+    std::ofstream cache_file( tmp_cache_file_path.string(), std::ios::binary );
+
+    // Write a raw value
+    auto write_raw = [&cache_file]( const void* value, const size_t bytes ){
+      cache_file.write( static_cast<const char*>( value ), bytes ); };
+
+    // Write a string
+    auto write_string = [&write_raw]( const std::string& value ){
+      uint64_t size = value.size();
+
+      write_raw( &size, sizeof(size) );
+      write_raw( value.data(), size ); };
+
+    write_raw( s_table_cache_magic, sizeof(s_table_cache_magic) );
+    write_string( cache_key );
+    write_string( d_ace_table_name );
+    write_string( d_ace_table_processing_date );
+    write_string( d_ace_table_comment );
+    write_string( d_ace_table_material_id );
+
+    const double temperature = d_temperature.value();
+    const uint64_t number_of_zaids = d_zaids.size();
+
+    write_raw( &d_atomic_weight_ratio, sizeof(double) );
+    write_raw( &temperature, sizeof(double) );
+    write_raw( &number_of_zaids, sizeof(uint64_t) );
+
+    for( size_t i = 0; i < d_zaids.size(); ++i )
+    {
+      const unsigned raw_zaid = d_zaids[i].toRaw();
+
+      write_raw( &raw_zaid, sizeof(unsigned) );
+    }
+
+    write_raw( d_atomic_weight_ratios.data(),
+               d_atomic_weight_ratios.size()*sizeof(double) );
+    write_raw( d_nxs.data(), d_nxs.size()*sizeof(int) );
+    write_raw( d_jxs.data(), d_jxs.size()*sizeof(int) );
+
+    const uint64_t xss_size = d_xss->size();
+
+    write_raw( &xss_size, sizeof(uint64_t) );
+    write_raw( d_xss->data(), xss_size*sizeof(double) );
+
+    table_written = (bool)cache_file;
+  }
+
+  boost::system::error_code error;
+
+  if( table_written )
+    boost::filesystem::rename( tmp_cache_file_path, cache_file_path, error );
+
+  if( !table_written || error )
+  {
+    boost::filesystem::remove( tmp_cache_file_path, error );
+
+    FRENSIE_LOG_TAGGED_WARNING( "ACEFileHandler",
+                                "Could not cache ACE table "
+                                << d_ace_table_name << " in "
+                                << cache_file_path.string() << "!" );
+  }
+}
+
 // Get the library name
 const boost::filesystem::path& ACEFileHandler::getLibraryName() const
 {
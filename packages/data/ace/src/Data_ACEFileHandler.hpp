@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <string>
 #include <memory>
+#include <mutex>
 
 // Boost Includes
 #include <boost/filesystem/path.hpp>
@@ -63,6 +64,19 @@ public:
   //! Destructor
   ~ACEFileHandler();
 
+  //! Set the directory where binary copies of the tables will be cached
+  static void setTableCacheDirectory(
+                         const boost::filesystem::path& cache_directory );
+
+  //! Unset the table cache directory (tables will not be cached)
+  static void unsetTableCacheDirectory();
+
+  //! Get the table cache directory (empty if tables are not cached)
+  static boost::filesystem::path getTableCacheDirectory();
+
+  //! Check if the table was loaded from the table cache
+  bool wasTableLoadedFromCache() const;
+
   //! Get the library name
   const boost::filesystem::path& getLibraryName() const;
 
@@ -109,6 +123,33 @@ private:
   void readACETable( const std::string& table_name,
 		     const size_t table_start_line );
 
+  // Create the table cache key
+  std::string createTableCacheKey( const std::string& table_name,
+                                   const size_t table_start_line ) const;
+
+  // Get the table cache file path
+  static boost::filesystem::path getTableCacheFilePath(
+                                             const std::string& table_name,
+                                             const std::string& cache_key );
+
+  // Read the table from the table cache
+  bool readTableFromCache( const boost::filesystem::path& cache_file_path,
+                           const std::string& cache_key );
+
+  // Write the table to the table cache
+  void writeTableToCache( const boost::filesystem::path& cache_file_path,
+                          const std::string& cache_key ) const;
+
+  // The table cache format version
+  static const unsigned s_table_cache_version;
+
+  // The table cache directory
+  static boost::filesystem::path s_table_cache_directory;
+
+  // The ace_helpers fortran module mutex (every handler uses the same
+  // fortran unit so only one table can be read at a time)
+  static std::mutex s_fortran_io_mutex;
+
   // The ace file id used by the ace_helpers fortran module (always set to 1)
   int d_ace_file_id;
 
@@ -147,6 +188,9 @@ private:
 
   // The ace table XSS array
   std::shared_ptr<std::vector<double> > d_xss;
+
+  // Records if the table was loaded from the table cache
+  bool d_loaded_from_cache;
 };
 
 } // end Data namespace
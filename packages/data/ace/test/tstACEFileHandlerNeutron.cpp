@@ -11,6 +11,9 @@
 #include <memory>
 #include <iostream>
 
+// Boost Includes
+#include <boost/filesystem.hpp>
+
 // FRENSIE Includes
 #include "Data_ACEFileHandler.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
@@ -91,6 +94,70 @@ FRENSIE_UNIT_TEST( ACEFileHandler, constructor_get_neutron )
   FRENSIE_CHECK_EQUAL( xss->back(), 102 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a table can be loaded from the table cache
+FRENSIE_UNIT_TEST( ACEFileHandler, constructor_table_cache )
+{
+  boost::filesystem::path cache_directory =
+    boost::filesystem::temp_directory_path();
+  cache_directory /=
+    boost::filesystem::unique_path( "ace_table_cache_%%%%-%%%%" );
+
+  Data::ACEFileHandler::setTableCacheDirectory( cache_directory );
+
+  FRENSIE_CHECK( boost::filesystem::is_directory( cache_directory ) );
+  FRENSIE_CHECK_EQUAL( Data::ACEFileHandler::getTableCacheDirectory().string(),
+                       cache_directory.string() );
+
+  std::string table_name( "1001.70c" );
+
+  // The first handler will read the ACE file and cache the table
+  Data::ACEFileHandler ace_file_handler( test_neutron_ace_file_name,
+                                         table_name,
+                                         test_neutron_ace_file_start_line );
+
+  FRENSIE_CHECK( !ace_file_handler.wasTableLoadedFromCache() );
+
+  // The second handler will load the cached table
+  Data::ACEFileHandler cached_ace_file_handler( test_neutron_ace_file_name,
+                                                table_name,
+                                                test_neutron_ace_file_start_line );
+
+  FRENSIE_CHECK( cached_ace_file_handler.wasTableLoadedFromCache() );
+  FRENSIE_CHECK_EQUAL( cached_ace_file_handler.getTableName(), table_name );
+  FRENSIE_CHECK_EQUAL( cached_ace_file_handler.getTableAtomicWeightRatio(),
+                       ace_file_handler.getTableAtomicWeightRatio() );
+  FRENSIE_CHECK_EQUAL( cached_ace_file_handler.getTableTemperature(),
+                       ace_file_handler.getTableTemperature() );
+  FRENSIE_CHECK_EQUAL( cached_ace_file_handler.getTableProcessingDate(),
+                       ace_file_handler.getTableProcessingDate() );
+  FRENSIE_CHECK_EQUAL( cached_ace_file_handler.getTableComment(),
+                       ace_file_handler.getTableComment() );
+  FRENSIE_CHECK_EQUAL( cached_ace_file_handler.getTableMatId(),
+                       ace_file_handler.getTableMatId() );
+  FRENSIE_CHECK_EQUAL( cached_ace_file_handler.getTableZAIDs().size(),
+                       ace_file_handler.getTableZAIDs().size() );
+  FRENSIE_CHECK_EQUAL( cached_ace_file_handler.getTableNXSArray(),
+                       ace_file_handler.getTableNXSArray() );
+  FRENSIE_CHECK_EQUAL( cached_ace_file_handler.getTableJXSArray(),
+                       ace_file_handler.getTableJXSArray() );
+  FRENSIE_CHECK_EQUAL( *cached_ace_file_handler.getTableXSSArray(),
+                       *ace_file_handler.getTableXSSArray() );
+
+  Data::ACEFileHandler::unsetTableCacheDirectory();
+
+  FRENSIE_CHECK( Data::ACEFileHandler::getTableCacheDirectory().empty() );
+
+  // Without a cache directory the table will be read from the ACE file
+  Data::ACEFileHandler uncached_ace_file_handler( test_neutron_ace_file_name,
+                                                  table_name,
+                                                  test_neutron_ace_file_start_line );
+
+  FRENSIE_CHECK( !uncached_ace_file_handler.wasTableLoadedFromCache() );
+
+  boost::filesystem::remove_all( cache_directory );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
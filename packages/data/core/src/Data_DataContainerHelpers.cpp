@@ -6,8 +6,15 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <cstring>
+
+// Boost Includes
+#include <boost/filesystem/operations.hpp>
+
 // FRENSIE Includes
 #include "Data_DataContainerHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 
 namespace Data{
 
@@ -72,6 +79,457 @@ bool isInterpPolicyValid( const std::string value )
     return false;
 }
 
+// Add a threshold energy index to a flat array archive
+/*! \details The index will be stored as a single value array with the
+ * name "name_threshold_index".
+ */
+void addThresholdIndexToFlatArrayArchive( const std::string& name,
+                                          const unsigned threshold_index,
+                                          Utility::FlatArrayOArchive& archive )
+{
+  archive.addArray( name+"_threshold_index",
+                    std::vector<double>( 1, threshold_index ) );
+}
+
+// Add the subshell arrays to a flat array archive
+/*! \details Each array will be stored with the name "name_subshell".
+ */
+void addSubshellArraysToFlatArrayArchive(
+               const std::string& name,
+               const std::map<unsigned,std::vector<double> >& subshell_arrays,
+               Utility::FlatArrayOArchive& archive )
+{
+  for( auto&& subshell_array : subshell_arrays )
+  {
+    archive.addArray( name+"_"+std::to_string( subshell_array.first ),
+                      subshell_array.second );
+  }
+}
+
+// Add the subshell threshold energy indices to a flat array archive
+void addSubshellThresholdIndicesToFlatArrayArchive(
+                 const std::string& name,
+                 const std::map<unsigned,unsigned>& subshell_threshold_indices,
+                 Utility::FlatArrayOArchive& archive )
+{
+  for( auto&& subshell_index : subshell_threshold_indices )
+  {
+    addThresholdIndexToFlatArrayArchive(
+                         name+"_"+std::to_string( subshell_index.first ),
+                         subshell_index.second,
+                         archive );
+  }
+}
+
+// Add the indexed arrays to a flat array archive
+/*! \details The arrays will be stored as a table with the array index used as
+ * the grid value (see Utility::FlatArrayOArchive::addTable).
+ */
+void addIndexedArraysToFlatArrayArchive(
+                      const std::string& name,
+                      const std::vector<std::vector<double> >& indexed_arrays,
+                      Utility::FlatArrayOArchive& archive )
+{
+  std::map<double,std::vector<double> > table;
+
+  for( size_t i = 0; i < indexed_arrays.size(); ++i )
+    table.emplace_hint( table.end(), i, indexed_arrays[i] );
+
+  archive.addTable( name, table );
+}
+
+// Add the subshell indexed arrays to a flat array archive
+/*! \details Each set of indexed arrays will be stored with the name
+ * "name_subshell".
+ */
+void addSubshellIndexedArraysToFlatArrayArchive(
+    const std::string& name,
+    const std::map<unsigned,std::vector<std::vector<double> > >& subshell_indexed_arrays,
+    Utility::FlatArrayOArchive& archive )
+{
+  for( auto&& subshell_arrays : subshell_indexed_arrays )
+  {
+    addIndexedArraysToFlatArrayArchive(
+                             name+"_"+std::to_string( subshell_arrays.first ),
+                             subshell_arrays.second,
+                             archive );
+  }
+}
+
+// Add the subshell tables to a flat array archive
+/*! \details Each table will be stored with the name "name_subshell".
+ */
+void addSubshellTablesToFlatArrayArchive(
+    const std::string& name,
+    const std::map<unsigned,std::map<double,std::vector<double> > >& subshell_tables,
+    Utility::FlatArrayOArchive& archive )
+{
+  for( auto&& subshell_table : subshell_tables )
+  {
+    archive.addTable( name+"_"+std::to_string( subshell_table.first ),
+                      subshell_table.second );
+  }
+}
+
+// Add a string to a flat array archive
+/*! \details The characters of the string will be packed into an array of
+ * doubles. The first value of the array stores the number of characters.
+ */
+void addStringToFlatArrayArchive( const std::string& name,
+                                  const std::string& value,
+                                  Utility::FlatArrayOArchive& archive )
+{
+  std::vector<double> packed_value(
+                           1 + (value.size() + sizeof(double) - 1)/sizeof(double),
+                           0.0 );
+
+  packed_value.front() = value.size();
+
+  if( value.size() > 0 )
+    std::memcpy( packed_value.data() + 1, value.data(), value.size() );
+
+  archive.addArray( name, packed_value );
+}
+
+// Get a string from a flat array archive
+std::string getStringFromFlatArrayArchive(
+                                     const std::string& name,
+                                     const Utility::FlatArrayIArchive& archive )
+{
+  Utility::ArrayView<const double> packed_value = archive.getArray( name );
+
+  TEST_FOR_EXCEPTION( packed_value.size() == 0 ||
+                      packed_value.front() < 0.0 ||
+                      (packed_value.size() - 1)*sizeof(double) <
+                      (size_t)packed_value.front(),
+                      std::runtime_error,
+                      "The string " << name << " stored in the flat array "
+                      "archive is invalid!" );
+
+  return std::string( reinterpret_cast<const char*>( packed_value.data() + 1 ),
+                      (size_t)packed_value.front() );
+}
+
+// Add a data field to a flat array archive
+void addDataFieldToFlatArrayArchive( const std::string& name,
+                                     const std::vector<double>& array,
+                                     Utility::FlatArrayOArchive& archive )
+{
+  archive.addArray( name, array );
+}
+
+// Add a data field to a flat array archive
+void addDataFieldToFlatArrayArchive(
+               const std::string& name,
+               const std::map<unsigned,std::vector<double> >& subshell_arrays,
+               Utility::FlatArrayOArchive& archive )
+{
+  addSubshellArraysToFlatArrayArchive( name, subshell_arrays, archive );
+}
+
+// Add a data field to a flat array archive
+void addDataFieldToFlatArrayArchive(
+                         const std::string& name,
+                         const std::map<double,std::vector<double> >& table,
+                         Utility::FlatArrayOArchive& archive )
+{
+  archive.addTable( name, table );
+}
+
+// Add a data field to a flat array archive
+void addDataFieldToFlatArrayArchive(
+    const std::string& name,
+    const std::map<unsigned,std::map<double,std::vector<double> > >& subshell_tables,
+    Utility::FlatArrayOArchive& archive )
+{
+  addSubshellTablesToFlatArrayArchive( name, subshell_tables, archive );
+}
+
+// Add a data field to a flat array archive
+void addDataFieldToFlatArrayArchive(
+                      const std::string& name,
+                      const std::vector<std::vector<double> >& indexed_arrays,
+                      Utility::FlatArrayOArchive& archive )
+{
+  addIndexedArraysToFlatArrayArchive( name, indexed_arrays, archive );
+}
+
+// Add a data field to a flat array archive
+void addDataFieldToFlatArrayArchive(
+    const std::string& name,
+    const std::map<unsigned,std::vector<std::vector<double> > >& subshell_indexed_arrays,
+    Utility::FlatArrayOArchive& archive )
+{
+  addSubshellIndexedArraysToFlatArrayArchive( name,
+                                              subshell_indexed_arrays,
+                                              archive );
+}
+
+// Add a data field to a flat array archive
+void addDataFieldToFlatArrayArchive( const std::string& name,
+                                     const unsigned threshold_index,
+                                     Utility::FlatArrayOArchive& archive )
+{
+  addThresholdIndexToFlatArrayArchive( name, threshold_index, archive );
+}
+
+// Add a data field to a flat array archive
+void addDataFieldToFlatArrayArchive(
+                 const std::string& name,
+                 const std::map<unsigned,unsigned>& subshell_threshold_indices,
+                 Utility::FlatArrayOArchive& archive )
+{
+  addSubshellThresholdIndicesToFlatArrayArchive( name,
+                                                 subshell_threshold_indices,
+                                                 archive );
+}
+
+// Copy a data field from a flat array archive
+/*! \details The data field will not be modified if the array is not stored
+ * in the archive.
+ */
+void copyDataFieldFromFlatArrayArchive(
+                                     const std::string& name,
+                                     const Utility::FlatArrayIArchive& archive,
+                                     std::vector<double>& array )
+{
+  if( archive.hasArray( name ) )
+  {
+    Utility::ArrayView<const double> array_view = archive.getArray( name );
+
+    array.assign( array_view.begin(), array_view.end() );
+  }
+}
+
+// Copy a data field from a flat array archive
+/*! \details Only the subshells that are already in the map will be copied.
+ */
+void copyDataFieldFromFlatArrayArchive(
+                     const std::string& name,
+                     const Utility::FlatArrayIArchive& archive,
+                     std::map<unsigned,std::vector<double> >& subshell_arrays )
+{
+  for( auto&& subshell_array : subshell_arrays )
+  {
+    copyDataFieldFromFlatArrayArchive(
+                              name+"_"+std::to_string( subshell_array.first ),
+                              archive,
+                              subshell_array.second );
+  }
+}
+
+// Copy a data field from a flat array archive
+/*! \details The data field will not be modified if the table is not stored
+ * in the archive.
+ */
+void copyDataFieldFromFlatArrayArchive(
+                                const std::string& name,
+                                const Utility::FlatArrayIArchive& archive,
+                                std::map<double,std::vector<double> >& table )
+{
+  if( archive.hasTable( name ) )
+  {
+    table.clear();
+
+    for( auto&& row : archive.getTable( name ) )
+    {
+      table.emplace_hint( table.end(),
+                          row.first,
+                          std::vector<double>( row.second.begin(),
+                                               row.second.end() ) );
+    }
+  }
+}
+
+// Copy a data field from a flat array archive
+/*! \details Only the subshells that are already in the map will be copied.
+ */
+void copyDataFieldFromFlatArrayArchive(
+    const std::string& name,
+    const Utility::FlatArrayIArchive& archive,
+    std::map<unsigned,std::map<double,std::vector<double> > >& subshell_tables )
+{
+  for( auto&& subshell_table : subshell_tables )
+  {
+    copyDataFieldFromFlatArrayArchive(
+                              name+"_"+std::to_string( subshell_table.first ),
+                              archive,
+                              subshell_table.second );
+  }
+}
+
+// Copy a data field from a flat array archive
+/*! \details The data field will not be modified if the table is not stored
+ * in the archive.
+ */
+void copyDataFieldFromFlatArrayArchive(
+                             const std::string& name,
+                             const Utility::FlatArrayIArchive& archive,
+                             std::vector<std::vector<double> >& indexed_arrays )
+{
+  if( archive.hasTable( name ) )
+  {
+    std::map<double,Utility::ArrayView<const double> > table =
+      archive.getTable( name );
+
+    indexed_arrays.clear();
+    indexed_arrays.reserve( table.size() );
+
+    for( auto&& row : table )
+    {
+      indexed_arrays.emplace_back( row.second.begin(), row.second.end() );
+    }
+  }
+}
+
+// Copy a data field from a flat array archive
+/*! \details Only the subshells that are already in the map will be copied.
+ */
+void copyDataFieldFromFlatArrayArchive(
+    const std::string& name,
+    const Utility::FlatArrayIArchive& archive,
+    std::map<unsigned,std::vector<std::vector<double> > >& subshell_indexed_arrays )
+{
+  for( auto&& subshell_arrays : subshell_indexed_arrays )
+  {
+    copyDataFieldFromFlatArrayArchive(
+                             name+"_"+std::to_string( subshell_arrays.first ),
+                             archive,
+                             subshell_arrays.second );
+  }
+}
+
+// Copy a data field from a flat array archive
+/*! \details The data field will not be modified if the threshold index is
+ * not stored in the archive.
+ */
+void copyDataFieldFromFlatArrayArchive(
+                                     const std::string& name,
+                                     const Utility::FlatArrayIArchive& archive,
+                                     unsigned& threshold_index )
+{
+  const std::string array_name = name+"_threshold_index";
+
+  if( archive.hasArray( array_name ) )
+  {
+    Utility::ArrayView<const double> array_view =
+      archive.getArray( array_name );
+
+    TEST_FOR_EXCEPTION( array_view.size() != 1,
+                        std::runtime_error,
+                        "The threshold index " << array_name << " stored in "
+                        "the flat array archive is invalid!" );
+
+    threshold_index = array_view.front();
+  }
+}
+
+// Copy a data field from a flat array archive
+/*! \details Only the subshells that are already in the map will be copied.
+ */
+void copyDataFieldFromFlatArrayArchive(
+                        const std::string& name,
+                        const Utility::FlatArrayIArchive& archive,
+                        std::map<unsigned,unsigned>& subshell_threshold_indices )
+{
+  for( auto&& subshell_index : subshell_threshold_indices )
+  {
+    copyDataFieldFromFlatArrayArchive(
+                              name+"_"+std::to_string( subshell_index.first ),
+                              archive,
+                              subshell_index.second );
+  }
+}
+
+// Clear a data field that is stored in a flat array archive
+/*! \details The memory held by the array will be released.
+ */
+void clearFlatArrayDataField( std::vector<double>& array )
+{
+  std::vector<double>().swap( array );
+}
+
+// Clear a data field that is stored in a flat array archive
+/*! \details The subshells will be kept so that the subshell arrays can be
+ * copied back from the archive.
+ */
+void clearFlatArrayDataField(
+                     std::map<unsigned,std::vector<double> >& subshell_arrays )
+{
+  for( auto&& subshell_array : subshell_arrays )
+    clearFlatArrayDataField( subshell_array.second );
+}
+
+// Clear a data field that is stored in a flat array archive
+void clearFlatArrayDataField( std::map<double,std::vector<double> >& table )
+{
+  table.clear();
+}
+
+// Clear a data field that is stored in a flat array archive
+/*! \details The subshells will be kept so that the subshell tables can be
+ * copied back from the archive.
+ */
+void clearFlatArrayDataField(
+    std::map<unsigned,std::map<double,std::vector<double> > >& subshell_tables )
+{
+  for( auto&& subshell_table : subshell_tables )
+    subshell_table.second.clear();
+}
+
+// Clear a data field that is stored in a flat array archive
+void clearFlatArrayDataField(
+                            std::vector<std::vector<double> >& indexed_arrays )
+{
+  std::vector<std::vector<double> >().swap( indexed_arrays );
+}
+
+// Clear a data field that is stored in a flat array archive
+/*! \details The subshells will be kept so that the subshell indexed arrays
+ * can be copied back from the archive.
+ */
+void clearFlatArrayDataField(
+    std::map<unsigned,std::vector<std::vector<double> > >& subshell_indexed_arrays )
+{
+  for( auto&& subshell_arrays : subshell_indexed_arrays )
+    clearFlatArrayDataField( subshell_arrays.second );
+}
+
+// Clear a data field that is stored in a flat array archive
+void clearFlatArrayDataField( unsigned& threshold_index )
+{
+  threshold_index = 0u;
+}
+
+// Clear a data field that is stored in a flat array archive
+/*! \details The subshells will be kept so that the subshell threshold
+ * indices can be copied back from the archive.
+ */
+void clearFlatArrayDataField(
+                       std::map<unsigned,unsigned>& subshell_threshold_indices )
+{
+  for( auto&& subshell_index : subshell_threshold_indices )
+    clearFlatArrayDataField( subshell_index.second );
+}
+
+// Return the flat array archive exported from a data file if it exists
+/*! \details The flat array archive must have the same name as the data file
+ * with the .frfa extension (e.g. epr_82_native.frfa for epr_82_native.xml).
+ * The data file path will be returned if there is no flat array archive.
+ */
+boost::filesystem::path resolveFlatArrayArchivePath(
+                                const boost::filesystem::path& data_file_path )
+{
+  boost::filesystem::path flat_array_archive_path = data_file_path;
+  flat_array_archive_path.replace_extension(
+                                  Utility::FlatArrayIArchive::getExtension() );
+
+  if( boost::filesystem::exists( flat_array_archive_path ) )
+    return flat_array_archive_path;
+  else
+    return data_file_path;
+}
+
 } // end Data namespace
 
 //---------------------------------------------------------------------------//
@@ -14,12 +14,14 @@
 
 // Boost Includes
 #include <boost/serialization/nvp.hpp>
+#include <boost/filesystem/path.hpp>
 
 // FRENSIE Includes
 #include "Utility_Tuple.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
 #include "Utility_Vector.hpp"
+#include "Utility_FlatArrayArchive.hpp"
 
 //! Macro for use with the boost serialization library
 #define DATA_MAKE_NVP( archive, data_field_prefix, data_field_base_name ) \
@@ -29,6 +31,10 @@
 #define DATA_MAKE_NVP_DEFAULT( archive, data_field_base_name ) \
   DATA_MAKE_NVP( archive, d_, data_field_base_name )
 
+//! Macro for exporting a data field to a flat array archive
+#define DATA_ADD_FLAT_ARRAY_DEFAULT( archive, data_field_base_name ) \
+  archive.addArray( #data_field_base_name, d_ ## data_field_base_name )
+
 namespace Data{
 
   // Test preconditions for energy grids
@@ -75,6 +81,179 @@ namespace Data{
   // Test if the InterpPolicy is valid
   bool isInterpPolicyValid( const std::string value );
 
+  // Add a threshold energy index to a flat array archive
+  void addThresholdIndexToFlatArrayArchive(
+                                       const std::string& name,
+                                       const unsigned threshold_index,
+                                       Utility::FlatArrayOArchive& archive );
+
+  // Add the subshell arrays to a flat array archive
+  void addSubshellArraysToFlatArrayArchive(
+               const std::string& name,
+               const std::map<unsigned,std::vector<double> >& subshell_arrays,
+               Utility::FlatArrayOArchive& archive );
+
+  // Add the subshell threshold energy indices to a flat array archive
+  void addSubshellThresholdIndicesToFlatArrayArchive(
+                 const std::string& name,
+                 const std::map<unsigned,unsigned>& subshell_threshold_indices,
+                 Utility::FlatArrayOArchive& archive );
+
+  // Add the indexed arrays to a flat array archive
+  void addIndexedArraysToFlatArrayArchive(
+                      const std::string& name,
+                      const std::vector<std::vector<double> >& indexed_arrays,
+                      Utility::FlatArrayOArchive& archive );
+
+  // Add the subshell indexed arrays to a flat array archive
+  void addSubshellIndexedArraysToFlatArrayArchive(
+    const std::string& name,
+    const std::map<unsigned,std::vector<std::vector<double> > >& subshell_indexed_arrays,
+    Utility::FlatArrayOArchive& archive );
+
+  // Add the subshell tables to a flat array archive
+  void addSubshellTablesToFlatArrayArchive(
+    const std::string& name,
+    const std::map<unsigned,std::map<double,std::vector<double> > >& subshell_tables,
+    Utility::FlatArrayOArchive& archive );
+
+  // Add a string to a flat array archive
+  void addStringToFlatArrayArchive( const std::string& name,
+                                    const std::string& value,
+                                    Utility::FlatArrayOArchive& archive );
+
+  // Get a string from a flat array archive
+  std::string getStringFromFlatArrayArchive(
+                                    const std::string& name,
+                                    const Utility::FlatArrayIArchive& archive );
+
+  // Add a data field to a flat array archive
+  void addDataFieldToFlatArrayArchive( const std::string& name,
+                                       const std::vector<double>& array,
+                                       Utility::FlatArrayOArchive& archive );
+
+  // Add a data field to a flat array archive
+  void addDataFieldToFlatArrayArchive(
+               const std::string& name,
+               const std::map<unsigned,std::vector<double> >& subshell_arrays,
+               Utility::FlatArrayOArchive& archive );
+
+  // Add a data field to a flat array archive
+  void addDataFieldToFlatArrayArchive(
+                         const std::string& name,
+                         const std::map<double,std::vector<double> >& table,
+                         Utility::FlatArrayOArchive& archive );
+
+  // Add a data field to a flat array archive
+  void addDataFieldToFlatArrayArchive(
+    const std::string& name,
+    const std::map<unsigned,std::map<double,std::vector<double> > >& subshell_tables,
+    Utility::FlatArrayOArchive& archive );
+
+  // Add a data field to a flat array archive
+  void addDataFieldToFlatArrayArchive(
+                      const std::string& name,
+                      const std::vector<std::vector<double> >& indexed_arrays,
+                      Utility::FlatArrayOArchive& archive );
+
+  // Add a data field to a flat array archive
+  void addDataFieldToFlatArrayArchive(
+    const std::string& name,
+    const std::map<unsigned,std::vector<std::vector<double> > >& subshell_indexed_arrays,
+    Utility::FlatArrayOArchive& archive );
+
+  // Add a data field to a flat array archive
+  void addDataFieldToFlatArrayArchive( const std::string& name,
+                                       const unsigned threshold_index,
+                                       Utility::FlatArrayOArchive& archive );
+
+  // Add a data field to a flat array archive
+  void addDataFieldToFlatArrayArchive(
+                 const std::string& name,
+                 const std::map<unsigned,unsigned>& subshell_threshold_indices,
+                 Utility::FlatArrayOArchive& archive );
+
+  // Copy a data field from a flat array archive
+  void copyDataFieldFromFlatArrayArchive(
+                                     const std::string& name,
+                                     const Utility::FlatArrayIArchive& archive,
+                                     std::vector<double>& array );
+
+  // Copy a data field from a flat array archive
+  void copyDataFieldFromFlatArrayArchive(
+                     const std::string& name,
+                     const Utility::FlatArrayIArchive& archive,
+                     std::map<unsigned,std::vector<double> >& subshell_arrays );
+
+  // Copy a data field from a flat array archive
+  void copyDataFieldFromFlatArrayArchive(
+                               const std::string& name,
+                               const Utility::FlatArrayIArchive& archive,
+                               std::map<double,std::vector<double> >& table );
+
+  // Copy a data field from a flat array archive
+  void copyDataFieldFromFlatArrayArchive(
+    const std::string& name,
+    const Utility::FlatArrayIArchive& archive,
+    std::map<unsigned,std::map<double,std::vector<double> > >& subshell_tables );
+
+  // Copy a data field from a flat array archive
+  void copyDataFieldFromFlatArrayArchive(
+                            const std::string& name,
+                            const Utility::FlatArrayIArchive& archive,
+                            std::vector<std::vector<double> >& indexed_arrays );
+
+  // Copy a data field from a flat array archive
+  void copyDataFieldFromFlatArrayArchive(
+    const std::string& name,
+    const Utility::FlatArrayIArchive& archive,
+    std::map<unsigned,std::vector<std::vector<double> > >& subshell_indexed_arrays );
+
+  // Copy a data field from a flat array archive
+  void copyDataFieldFromFlatArrayArchive(
+                                     const std::string& name,
+                                     const Utility::FlatArrayIArchive& archive,
+                                     unsigned& threshold_index );
+
+  // Copy a data field from a flat array archive
+  void copyDataFieldFromFlatArrayArchive(
+                       const std::string& name,
+                       const Utility::FlatArrayIArchive& archive,
+                       std::map<unsigned,unsigned>& subshell_threshold_indices );
+
+  // Clear a data field that is stored in a flat array archive
+  void clearFlatArrayDataField( std::vector<double>& array );
+
+  // Clear a data field that is stored in a flat array archive
+  void clearFlatArrayDataField(
+                    std::map<unsigned,std::vector<double> >& subshell_arrays );
+
+  // Clear a data field that is stored in a flat array archive
+  void clearFlatArrayDataField( std::map<double,std::vector<double> >& table );
+
+  // Clear a data field that is stored in a flat array archive
+  void clearFlatArrayDataField(
+    std::map<unsigned,std::map<double,std::vector<double> > >& subshell_tables );
+
+  // Clear a data field that is stored in a flat array archive
+  void clearFlatArrayDataField(
+                           std::vector<std::vector<double> >& indexed_arrays );
+
+  // Clear a data field that is stored in a flat array archive
+  void clearFlatArrayDataField(
+    std::map<unsigned,std::vector<std::vector<double> > >& subshell_indexed_arrays );
+
+  // Clear a data field that is stored in a flat array archive
+  void clearFlatArrayDataField( unsigned& threshold_index );
+
+  // Clear a data field that is stored in a flat array archive
+  void clearFlatArrayDataField(
+                      std::map<unsigned,unsigned>& subshell_threshold_indices );
+
+  // Return the flat array archive exported from a data file if it exists
+  boost::filesystem::path resolveFlatArrayArchivePath(
+                               const boost::filesystem::path& data_file_path );
+
 } // end Data namespace
 
 //---------------------------------------------------------------------------//
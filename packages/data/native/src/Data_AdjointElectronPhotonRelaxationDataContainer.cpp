@@ -13,6 +13,7 @@
 #include <typeinfo>
 
 // FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
 #include "Data_AdjointElectronPhotonRelaxationDataContainer.hpp"
 #include "Data_DataContainerHelpers.hpp"
 #include "Utility_SortAlgorithms.hpp"
@@ -39,6 +40,13 @@ void AdjointElectronPhotonRelaxationDataContainer::loadFromFileImpl(
 {
   std::string extension = archive_name_with_path.extension().string();
 
+  if( extension == Utility::FlatArrayIArchive::getExtension() )
+  {
+    this->importFromFlatArrayArchive( archive_name_with_path );
+
+    return;
+  }
+
   // The bpis pointer must be NULL. Depending on the libraries that have been
   // loaded (e.g. utility_grid) the bpis might be initialized to a non-NULL
   // value
@@ -80,6 +88,271 @@ const char* AdjointElectronPhotonRelaxationDataContainer::getArchiveName() const
   return s_archive_name.c_str();
 }
 
+// Apply a visitor to the data fields that are stored in flat arrays
+/*! \details The visitor will be called with the flat array name and the data
+ * field (e.g. visitor( "photon_energy_grid", d_photon_energy_grid )). The same
+ * list of data fields is used to export and import a flat array archive.
+ */
+template<typename ContainerType, typename Visitor>
+void AdjointElectronPhotonRelaxationDataContainer::visitFlatArrayDataFields(
+                                                   ContainerType& container,
+                                                   Visitor&& visitor )
+{
+  // Photon data
+  visitor( "compton_profile_momentum_grids",
+           container.d_compton_profile_momentum_grids );
+  visitor( "compton_profiles", container.d_compton_profiles );
+  visitor( "occupation_number_momentum_grids",
+           container.d_occupation_number_momentum_grids );
+  visitor( "occupation_numbers", container.d_occupation_numbers );
+  visitor( "waller_hartree_scattering_function_momentum_grid",
+           container.d_waller_hartree_scattering_function_momentum_grid );
+  visitor( "waller_hartree_scattering_function",
+           container.d_waller_hartree_scattering_function );
+  visitor( "waller_hartree_atomic_form_factor_momentum_grid",
+           container.d_waller_hartree_atomic_form_factor_momentum_grid );
+  visitor( "waller_hartree_atomic_form_factor",
+           container.d_waller_hartree_atomic_form_factor );
+  visitor( "waller_hartree_squared_atomic_form_factor_squared_momentum_grid",
+           container.d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid );
+  visitor( "waller_hartree_squared_atomic_form_factor",
+           container.d_waller_hartree_squared_atomic_form_factor );
+  visitor( "adjoint_photon_energy_grid",
+           container.d_adjoint_photon_energy_grid );
+  visitor( "adjoint_waller_hartree_incoherent_max_energy_grid",
+           container.d_adjoint_waller_hartree_incoherent_max_energy_grid );
+  visitor( "adjoint_waller_hartree_incoherent_cross_section",
+           container.d_adjoint_waller_hartree_incoherent_cross_section );
+  visitor( "adjoint_impulse_approx_incoherent_max_energy_grid",
+           container.d_adjoint_impulse_approx_incoherent_max_energy_grid );
+  visitor( "adjoint_impulse_approx_incoherent_cross_section",
+           container.d_adjoint_impulse_approx_incoherent_cross_section );
+  visitor( "adjoint_impulse_approx_incoherent_cross_section",
+           container.d_adjoint_impulse_approx_incoherent_cross_section_threshold_index );
+  visitor( "adjoint_doppler_broadened_impulse_approx_incoherent_max_energy_grid",
+           container.d_adjoint_doppler_broadened_impulse_approx_incoherent_max_energy_grid );
+  visitor( "adjoint_doppler_broadened_impulse_approx_incoherent_cross_section",
+           container.d_adjoint_doppler_broadened_impulse_approx_incoherent_cross_section );
+  visitor( "adjoint_doppler_broadened_impulse_approx_incoherent_cross_section",
+           container.d_adjoint_doppler_broadened_impulse_approx_incoherent_cross_section_threshold_index );
+  visitor( "adjoint_impulse_approx_subshell_incoherent_max_energy_grids",
+           container.d_adjoint_impulse_approx_subshell_incoherent_max_energy_grids );
+  visitor( "adjoint_impulse_approx_subshell_incoherent_cross_sections",
+           container.d_adjoint_impulse_approx_subshell_incoherent_cross_sections );
+  visitor( "adjoint_impulse_approx_subshell_incoherent_cross_sections",
+           container.d_adjoint_impulse_approx_subshell_incoherent_cross_section_threshold_indices );
+  visitor( "adjoint_doppler_broadened_impulse_approx_subshell_incoherent_max_energy_grids",
+           container.d_adjoint_doppler_broadened_impulse_approx_subshell_incoherent_max_energy_grids );
+  visitor( "adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_sections",
+           container.d_adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_sections );
+  visitor( "adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_sections",
+           container.d_adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_section_threshold_indices );
+  visitor( "waller_hartree_coherent_cross_section",
+           container.d_waller_hartree_coherent_cross_section );
+  visitor( "adjoint_waller_hatree_total_max_energy_grid",
+           container.d_adjoint_waller_hatree_total_max_energy_grid );
+  visitor( "adjoint_waller_hatree_total_cross_section",
+           container.d_adjoint_waller_hatree_total_cross_section );
+  visitor( "adjoint_impulse_approx_total_max_energy_grid",
+           container.d_adjoint_impulse_approx_total_max_energy_grid );
+  visitor( "adjoint_impulse_approx_total_cross_section",
+           container.d_adjoint_impulse_approx_total_cross_section );
+  visitor( "adjoint_doppler_broadened_impulse_approx_total_max_energy_grid",
+           container.d_adjoint_doppler_broadened_impulse_approx_total_max_energy_grid );
+  visitor( "adjoint_doppler_broadened_impulse_approx_total_cross_section",
+           container.d_adjoint_doppler_broadened_impulse_approx_total_cross_section );
+  visitor( "waller_hartree_total_cross_section",
+           container.d_waller_hartree_total_cross_section );
+  visitor( "impulse_approx_total_cross_section",
+           container.d_impulse_approx_total_cross_section );
+  visitor( "adjoint_pair_production_energy_distribution_grid",
+           container.d_adjoint_pair_production_energy_distribution_grid );
+  visitor( "adjoint_pair_production_energy_distribution",
+           container.d_adjoint_pair_production_energy_distribution );
+  visitor( "adjoint_pair_production_norm_constant_grid",
+           container.d_adjoint_pair_production_norm_constant_grid );
+  visitor( "adjoint_pair_production_norm_constant",
+           container.d_adjoint_pair_production_norm_constant );
+  visitor( "adjoint_triplet_production_energy_distribution_grid",
+           container.d_adjoint_triplet_production_energy_distribution_grid );
+  visitor( "adjoint_triplet_production_energy_distribution",
+           container.d_adjoint_triplet_production_energy_distribution );
+  visitor( "adjoint_triplet_production_norm_constant_grid",
+           container.d_adjoint_triplet_production_norm_constant_grid );
+  visitor( "adjoint_triplet_production_norm_constant",
+           container.d_adjoint_triplet_production_norm_constant );
+  visitor( "adjoint_photon_bremsstrahlung_energy_grid",
+           container.d_adjoint_photon_bremsstrahlung_energy_grid );
+  visitor( "adjoint_photon_bremsstrahlung_energy",
+           container.d_adjoint_photon_bremsstrahlung_energy );
+  visitor( "adjoint_photon_bremsstrahlung_pdf",
+           container.d_adjoint_photon_bremsstrahlung_pdf );
+  visitor( "adjoint_bremsstrahlung_photon_cross_section",
+           container.d_adjoint_bremsstrahlung_photon_cross_section );
+  visitor( "adjoint_bremsstrahlung_photon_cross_section",
+           container.d_adjoint_bremsstrahlung_photon_cross_section_threshold_index );
+
+  // Electron data
+  visitor( "adjoint_angular_energy_grid",
+           container.d_adjoint_angular_energy_grid );
+  visitor( "adjoint_cutoff_elastic_angles",
+           container.d_adjoint_cutoff_elastic_angles );
+  visitor( "adjoint_cutoff_elastic_pdf",
+           container.d_adjoint_cutoff_elastic_pdf );
+  visitor( "adjoint_moment_preserving_cross_section_reductions",
+           container.d_adjoint_moment_preserving_cross_section_reductions );
+  visitor( "adjoint_moment_preserving_elastic_discrete_angles",
+           container.d_adjoint_moment_preserving_elastic_discrete_angles );
+  visitor( "adjoint_moment_preserving_elastic_weights",
+           container.d_adjoint_moment_preserving_elastic_weights );
+  visitor( "adjoint_electroionization_energy_grid",
+           container.d_adjoint_electroionization_energy_grid );
+  visitor( "adjoint_electroionization_recoil_energy",
+           container.d_adjoint_electroionization_recoil_energy );
+  visitor( "adjoint_electroionization_recoil_pdf",
+           container.d_adjoint_electroionization_recoil_pdf );
+  visitor( "adjoint_electron_bremsstrahlung_energy_grid",
+           container.d_adjoint_electron_bremsstrahlung_energy_grid );
+  visitor( "adjoint_electron_bremsstrahlung_energy",
+           container.d_adjoint_electron_bremsstrahlung_energy );
+  visitor( "adjoint_electron_bremsstrahlung_pdf",
+           container.d_adjoint_electron_bremsstrahlung_pdf );
+  visitor( "adjoint_atomic_excitation_energy_grid",
+           container.d_adjoint_atomic_excitation_energy_grid );
+  visitor( "adjoint_atomic_excitation_energy_gain",
+           container.d_adjoint_atomic_excitation_energy_gain );
+  visitor( "adjoint_electron_energy_grid",
+           container.d_adjoint_electron_energy_grid );
+  visitor( "adjoint_cutoff_elastic_cross_section",
+           container.d_adjoint_cutoff_elastic_cross_section );
+  visitor( "adjoint_cutoff_elastic_cross_section",
+           container.d_adjoint_cutoff_elastic_cross_section_threshold_index );
+  visitor( "adjoint_screened_rutherford_elastic_cross_section",
+           container.d_adjoint_screened_rutherford_elastic_cross_section );
+  visitor( "adjoint_screened_rutherford_elastic_cross_section",
+           container.d_adjoint_screened_rutherford_elastic_cross_section_threshold_index );
+  visitor( "adjoint_total_elastic_cross_section",
+           container.d_adjoint_total_elastic_cross_section );
+  visitor( "adjoint_total_elastic_cross_section",
+           container.d_adjoint_total_elastic_cross_section_threshold_index );
+  visitor( "adjoint_electroionization_subshell_cross_section",
+           container.d_adjoint_electroionization_subshell_cross_section );
+  visitor( "adjoint_electroionization_subshell_cross_section",
+           container.d_adjoint_electroionization_subshell_cross_section_threshold_index );
+  visitor( "adjoint_bremsstrahlung_electron_cross_section",
+           container.d_adjoint_bremsstrahlung_electron_cross_section );
+  visitor( "adjoint_bremsstrahlung_electron_cross_section",
+           container.d_adjoint_bremsstrahlung_electron_cross_section_threshold_index );
+  visitor( "adjoint_atomic_excitation_cross_section",
+           container.d_adjoint_atomic_excitation_cross_section );
+  visitor( "adjoint_atomic_excitation_cross_section",
+           container.d_adjoint_atomic_excitation_cross_section_threshold_index );
+  visitor( "forward_bremsstrahlung_electron_cross_section",
+           container.d_forward_bremsstrahlung_electron_cross_section );
+  visitor( "forward_bremsstrahlung_electron_cross_section",
+           container.d_forward_bremsstrahlung_electron_cross_section_threshold_index );
+  visitor( "forward_electroionization_electron_cross_section",
+           container.d_forward_electroionization_electron_cross_section );
+  visitor( "forward_electroionization_electron_cross_section",
+           container.d_forward_electroionization_electron_cross_section_threshold_index );
+  visitor( "forward_atomic_excitation_electron_cross_section",
+           container.d_forward_atomic_excitation_electron_cross_section );
+  visitor( "forward_atomic_excitation_electron_cross_section",
+           container.d_forward_atomic_excitation_electron_cross_section_threshold_index );
+}
+
+// Export the grids and tables to a flat array archive (.frfa)
+/*! \details The exported arrays can be memory-mapped with a
+ * Utility::FlatArrayIArchive and accessed as views without deserializing the
+ * container. Each array is stored under the name of the corresponding data
+ * field (e.g. "adjoint_photon_energy_grid"). Subshell data fields are stored
+ * with the subshell appended to the name, threshold energy indices are stored
+ * as single value arrays, tabulated secondary distributions are stored as
+ * tables and the adjoint incoherent max energy grids and cross sections are
+ * stored as tables indexed by the energy grid index (see
+ * Utility::FlatArrayOArchive::addTable).
+ *
+ * The remaining data fields (e.g. the subshells, the binding energies and the
+ * interpolation policies) are serialized with a binary archive and stored in
+ * the "metadata" array so that the container can be loaded from the flat
+ * array archive.
+ */
+void AdjointElectronPhotonRelaxationDataContainer::exportToFlatArrayArchive(
+                         const boost::filesystem::path& archive_name_with_path,
+                         const bool overwrite ) const
+{
+  Utility::FlatArrayOArchive archive;
+
+  AdjointElectronPhotonRelaxationDataContainer::visitFlatArrayDataFields( *this,
+       [&archive]( const std::string& name, const auto& data_field ){
+         addDataFieldToFlatArrayArchive( name, data_field, archive );
+       } );
+
+  // Serialize the data fields that are not stored in flat arrays
+  AdjointElectronPhotonRelaxationDataContainer metadata( *this );
+
+  AdjointElectronPhotonRelaxationDataContainer::visitFlatArrayDataFields( metadata,
+       []( const std::string&, auto& data_field ){
+         clearFlatArrayDataField( data_field );
+       } );
+
+  std::ostringstream oss;
+
+  const boost::archive::detail::basic_pointer_oserializer* bpos =
+    this->resetBposPointer<std::vector<double> >( ".bin" );
+
+  {
+    boost::archive::binary_oarchive metadata_archive( oss );
+
+    metadata_archive << boost::serialization::make_nvp(
+                                             this->getArchiveName(), metadata );
+  }
+
+  this->restoreBposPointer<std::vector<double> >( ".bin", bpos );
+
+  addStringToFlatArrayArchive( "metadata", oss.str(), archive );
+
+  archive.write( archive_name_with_path, overwrite );
+}
+
+// Import the data from a flat array archive (.frfa)
+/*! \details The data fields that are stored in flat arrays are copied from
+ * the memory-mapped archive (see
+ * AdjointElectronPhotonRelaxationDataContainer::exportToFlatArrayArchive).
+ */
+void AdjointElectronPhotonRelaxationDataContainer::importFromFlatArrayArchive(
+                        const boost::filesystem::path& archive_name_with_path )
+{
+  Utility::FlatArrayIArchive archive( archive_name_with_path );
+
+  TEST_FOR_EXCEPTION( !archive.hasArray( "metadata" ),
+                      std::runtime_error,
+                      "Cannot load the data container from the flat array "
+                      "archive " << archive_name_with_path.string() <<
+                      " because it does not store the metadata!" );
+
+  // Load the data fields that are not stored in flat arrays
+  std::istringstream iss( getStringFromFlatArrayArchive( "metadata", archive ) );
+
+  const boost::archive::detail::basic_pointer_iserializer* bpis =
+    this->resetBpisPointer<std::vector<double> >( ".bin" );
+
+  {
+    boost::archive::binary_iarchive metadata_archive( iss );
+
+    metadata_archive >> boost::serialization::make_nvp(
+                                                this->getArchiveName(), *this );
+  }
+
+  this->restoreBpisPointer<std::vector<double> >( ".bin", bpis );
+
+  // Copy the data fields that are stored in flat arrays
+  AdjointElectronPhotonRelaxationDataContainer::visitFlatArrayDataFields( *this,
+       [&archive]( const std::string& name, auto& data_field ){
+         copyDataFieldFromFlatArrayArchive( name, archive, data_field );
+       } );
+}
+
 //---------------------------------------------------------------------------//
 // Get Notes
 //---------------------------------------------------------------------------//
@@ -38,6 +38,13 @@ void ElectronPhotonRelaxationDataContainer::loadFromFileImpl(
 {
   std::string extension = archive_name_with_path.extension().string();
 
+  if( extension == Utility::FlatArrayIArchive::getExtension() )
+  {
+    this->importFromFlatArrayArchive( archive_name_with_path );
+
+    return;
+  }
+
   // The bpis pointer must be NULL. Depending on the libraries that have been
   // loaded (e.g. utility_grid) the bpis might be initialized to a non-NULL
   // value
@@ -79,6 +86,230 @@ const char* ElectronPhotonRelaxationDataContainer::getArchiveName() const
   return s_archive_name.c_str();
 }
 
+// Apply a visitor to the data fields that are stored in flat arrays
+/*! \details The visitor will be called with the flat array name and the data
+ * field (e.g. visitor( "photon_energy_grid", d_photon_energy_grid )). The same
+ * list of data fields is used to export and import a flat array archive.
+ */
+template<typename ContainerType, typename Visitor>
+void ElectronPhotonRelaxationDataContainer::visitFlatArrayDataFields(
+                                                   ContainerType& container,
+                                                   Visitor&& visitor )
+{
+  // Relaxation data
+  visitor( "relaxation_particle_energies",
+           container.d_relaxation_particle_energies );
+  visitor( "relaxation_probabilities", container.d_relaxation_probabilities );
+
+  // Photon data
+  visitor( "compton_profile_momentum_grids",
+           container.d_compton_profile_momentum_grids );
+  visitor( "compton_profiles", container.d_compton_profiles );
+  visitor( "occupation_number_momentum_grids",
+           container.d_occupation_number_momentum_grids );
+  visitor( "occupation_numbers", container.d_occupation_numbers );
+  visitor( "waller_hartree_scattering_function_momentum_grid",
+           container.d_waller_hartree_scattering_function_momentum_grid );
+  visitor( "waller_hartree_scattering_function",
+           container.d_waller_hartree_scattering_function );
+  visitor( "waller_hartree_atomic_form_factor_momentum_grid",
+           container.d_waller_hartree_atomic_form_factor_momentum_grid );
+  visitor( "waller_hartree_atomic_form_factor",
+           container.d_waller_hartree_atomic_form_factor );
+  visitor( "waller_hartree_squared_atomic_form_factor_squared_momentum_grid",
+           container.d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid );
+  visitor( "waller_hartree_squared_atomic_form_factor",
+           container.d_waller_hartree_squared_atomic_form_factor );
+  visitor( "photon_energy_grid", container.d_photon_energy_grid );
+  visitor( "average_photon_heating_numbers",
+           container.d_average_photon_heating_numbers );
+  visitor( "waller_hartree_incoherent_cross_section",
+           container.d_waller_hartree_incoherent_cross_section );
+  visitor( "waller_hartree_incoherent_cross_section",
+           container.d_waller_hartree_incoherent_cross_section_threshold_index );
+  visitor( "impulse_approx_incoherent_cross_section",
+           container.d_impulse_approx_incoherent_cross_section );
+  visitor( "impulse_approx_incoherent_cross_section",
+           container.d_impulse_approx_incoherent_cross_section_threshold_index );
+  visitor( "impulse_approx_subshell_incoherent_cross_sections",
+           container.d_impulse_approx_subshell_incoherent_cross_sections );
+  visitor( "impulse_approx_subshell_incoherent_cross_sections",
+           container.d_impulse_approx_subshell_incoherent_cross_section_threshold_indices );
+  visitor( "waller_hartree_coherent_cross_section",
+           container.d_waller_hartree_coherent_cross_section );
+  visitor( "waller_hartree_coherent_cross_section",
+           container.d_waller_hartree_coherent_cross_section_threshold_index );
+  visitor( "pair_production_cross_section",
+           container.d_pair_production_cross_section );
+  visitor( "pair_production_cross_section",
+           container.d_pair_production_cross_section_threshold_index );
+  visitor( "triplet_production_cross_section",
+           container.d_triplet_production_cross_section );
+  visitor( "triplet_production_cross_section",
+           container.d_triplet_production_cross_section_threshold_index );
+  visitor( "photoelectric_cross_section",
+           container.d_photoelectric_cross_section );
+  visitor( "photoelectric_cross_section",
+           container.d_photoelectric_cross_section_threshold_index );
+  visitor( "subshell_photoelectric_cross_sections",
+           container.d_subshell_photoelectric_cross_sections );
+  visitor( "subshell_photoelectric_cross_sections",
+           container.d_subshell_photoelectric_cross_section_threshold_indices );
+  visitor( "waller_hartree_total_cross_section",
+           container.d_waller_hartree_total_cross_section );
+  visitor( "impulse_approx_total_cross_section",
+           container.d_impulse_approx_total_cross_section );
+
+  // Electron data
+  visitor( "angular_energy_grid", container.d_angular_energy_grid );
+  visitor( "cutoff_elastic_angles", container.d_cutoff_elastic_angles );
+  visitor( "cutoff_elastic_pdf", container.d_cutoff_elastic_pdf );
+  visitor( "moment_preserving_elastic_discrete_angles",
+           container.d_moment_preserving_elastic_discrete_angles );
+  visitor( "moment_preserving_elastic_weights",
+           container.d_moment_preserving_elastic_weights );
+  visitor( "moment_preserving_cross_section_reductions",
+           container.d_moment_preserving_cross_section_reductions );
+  visitor( "electroionization_energy_grid",
+           container.d_electroionization_energy_grid );
+  visitor( "electroionization_recoil_energy",
+           container.d_electroionization_recoil_energy );
+  visitor( "electroionization_recoil_pdf",
+           container.d_electroionization_recoil_pdf );
+  visitor( "electroionization_outgoing_energy",
+           container.d_electroionization_outgoing_energy );
+  visitor( "electroionization_outgoing_pdf",
+           container.d_electroionization_outgoing_pdf );
+  visitor( "bremsstrahlung_energy_grid",
+           container.d_bremsstrahlung_energy_grid );
+  visitor( "bremsstrahlung_photon_energy",
+           container.d_bremsstrahlung_photon_energy );
+  visitor( "bremsstrahlung_photon_pdf",
+           container.d_bremsstrahlung_photon_pdf );
+  visitor( "atomic_excitation_energy_grid",
+           container.d_atomic_excitation_energy_grid );
+  visitor( "atomic_excitation_energy_loss",
+           container.d_atomic_excitation_energy_loss );
+  visitor( "electron_energy_grid", container.d_electron_energy_grid );
+  visitor( "total_electron_cross_section",
+           container.d_total_electron_cross_section );
+  visitor( "cutoff_elastic_cross_section",
+           container.d_cutoff_elastic_cross_section );
+  visitor( "cutoff_elastic_cross_section",
+           container.d_cutoff_elastic_cross_section_threshold_index );
+  visitor( "screened_rutherford_elastic_cross_section",
+           container.d_screened_rutherford_elastic_cross_section );
+  visitor( "screened_rutherford_elastic_cross_section",
+           container.d_screened_rutherford_elastic_cross_section_threshold_index );
+  visitor( "total_elastic_cross_section",
+           container.d_total_elastic_cross_section );
+  visitor( "total_elastic_cross_section",
+           container.d_total_elastic_cross_section_threshold_index );
+  visitor( "electroionization_subshell_cross_section",
+           container.d_electroionization_subshell_cross_section );
+  visitor( "electroionization_subshell_cross_section",
+           container.d_electroionization_subshell_cross_section_threshold_index );
+  visitor( "bremsstrahlung_cross_section",
+           container.d_bremsstrahlung_cross_section );
+  visitor( "bremsstrahlung_cross_section",
+           container.d_bremsstrahlung_cross_section_threshold_index );
+  visitor( "atomic_excitation_cross_section",
+           container.d_atomic_excitation_cross_section );
+  visitor( "atomic_excitation_cross_section",
+           container.d_atomic_excitation_cross_section_threshold_index );
+}
+
+// Export the grids and tables to a flat array archive (.frfa)
+/*! \details The exported arrays can be memory-mapped with a
+ * Utility::FlatArrayIArchive and accessed as views without deserializing the
+ * container. Each array is stored under the name of the corresponding data
+ * field (e.g. "photon_energy_grid"). Subshell data fields are stored with the
+ * subshell appended to the name (e.g. "subshell_photoelectric_cross_sections_1"),
+ * threshold energy indices are stored as single value arrays and tabulated
+ * secondary distributions are stored as tables (see
+ * Utility::FlatArrayOArchive::addTable).
+ *
+ * The remaining data fields (e.g. the subshells, the binding energies and the
+ * interpolation policies) are serialized with a binary archive and stored in
+ * the "metadata" array so that the container can be loaded from the flat
+ * array archive.
+ */
+void ElectronPhotonRelaxationDataContainer::exportToFlatArrayArchive(
+                         const boost::filesystem::path& archive_name_with_path,
+                         const bool overwrite ) const
+{
+  Utility::FlatArrayOArchive archive;
+
+  ElectronPhotonRelaxationDataContainer::visitFlatArrayDataFields( *this,
+       [&archive]( const std::string& name, const auto& data_field ){
+         addDataFieldToFlatArrayArchive( name, data_field, archive );
+       } );
+
+  // Serialize the data fields that are not stored in flat arrays
+  ElectronPhotonRelaxationDataContainer metadata( *this );
+
+  ElectronPhotonRelaxationDataContainer::visitFlatArrayDataFields( metadata,
+       []( const std::string&, auto& data_field ){
+         clearFlatArrayDataField( data_field );
+       } );
+
+  std::ostringstream oss;
+
+  const boost::archive::detail::basic_pointer_oserializer* bpos =
+    this->resetBposPointer<std::vector<double> >( ".bin" );
+
+  {
+    boost::archive::binary_oarchive metadata_archive( oss );
+
+    metadata_archive << boost::serialization::make_nvp(
+                                             this->getArchiveName(), metadata );
+  }
+
+  this->restoreBposPointer<std::vector<double> >( ".bin", bpos );
+
+  addStringToFlatArrayArchive( "metadata", oss.str(), archive );
+
+  archive.write( archive_name_with_path, overwrite );
+}
+
+// Import the data from a flat array archive (.frfa)
+/*! \details The data fields that are stored in flat arrays are copied from
+ * the memory-mapped archive (see
+ * ElectronPhotonRelaxationDataContainer::exportToFlatArrayArchive).
+ */
+void ElectronPhotonRelaxationDataContainer::importFromFlatArrayArchive(
+                        const boost::filesystem::path& archive_name_with_path )
+{
+  Utility::FlatArrayIArchive archive( archive_name_with_path );
+
+  TEST_FOR_EXCEPTION( !archive.hasArray( "metadata" ),
+                      std::runtime_error,
+                      "Cannot load the data container from the flat array "
+                      "archive " << archive_name_with_path.string() <<
+                      " because it does not store the metadata!" );
+
+  // Load the data fields that are not stored in flat arrays
+  std::istringstream iss( getStringFromFlatArrayArchive( "metadata", archive ) );
+
+  const boost::archive::detail::basic_pointer_iserializer* bpis =
+    this->resetBpisPointer<std::vector<double> >( ".bin" );
+
+  {
+    boost::archive::binary_iarchive metadata_archive( iss );
+
+    metadata_archive >> boost::serialization::make_nvp(
+                                                this->getArchiveName(), *this );
+  }
+
+  this->restoreBpisPointer<std::vector<double> >( ".bin", bpis );
+
+  // Copy the data fields that are stored in flat arrays
+  ElectronPhotonRelaxationDataContainer::visitFlatArrayDataFields( *this,
+       [&archive]( const std::string& name, auto& data_field ){
+         copyDataFieldFromFlatArrayArchive( name, archive, data_field );
+       } );
+}
+
 //---------------------------------------------------------------------------//
 // GET NOTES
 //---------------------------------------------------------------------------//
@@ -48,6 +48,11 @@ public:
   //! The database name used in an archive
   const char* getArchiveName() const override;
 
+  //! Export the grids and tables to a flat array archive (.frfa)
+  void exportToFlatArrayArchive(
+                         const boost::filesystem::path& archive_name_with_path,
+                         const bool overwrite = true ) const;
+
 //---------------------------------------------------------------------------//
 // GET NOTES
 //---------------------------------------------------------------------------//
@@ -969,6 +974,15 @@ private:
 
   BOOST_SERIALIZATION_SPLIT_MEMBER();
 
+  // Apply a visitor to the data fields that are stored in flat arrays
+  template<typename ContainerType, typename Visitor>
+  static void visitFlatArrayDataFields( ContainerType& container,
+                                        Visitor&& visitor );
+
+  // Import the data from a flat array archive (.frfa)
+  void importFromFlatArrayArchive(
+                       const boost::filesystem::path& archive_name_with_path );
+
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
@@ -2565,6 +2565,102 @@ FRENSIE_UNIT_TEST( AdjointElectronPhotonRelaxationDataContainer,
   FRENSIE_CHECK_EQUAL( epr_data_container_copy.getForwardAtomicExcitationElectronCrossSectionThresholdEnergyIndex(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the data can be imported from a flat array archive
+FRENSIE_UNIT_TEST( AdjointElectronPhotonRelaxationDataContainer,
+                   export_importData_flat_array )
+{
+  const std::string test_flat_array_archive_name( "test_aepr_data_container.frfa" );
+
+  epr_data_container.exportToFlatArrayArchive( test_flat_array_archive_name );
+
+  const Data::AdjointElectronPhotonRelaxationDataContainer
+    epr_data_container_copy( test_flat_array_archive_name );
+
+  // Table Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getNotes(),
+                       epr_data_container.getNotes() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicNumber(),
+                       epr_data_container.getAtomicNumber() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicWeight(),
+                       epr_data_container.getAtomicWeight() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMaxElectronEnergy(),
+                       epr_data_container.getMaxElectronEnergy() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointIncoherentEvaluationTolerance(),
+                       epr_data_container.getAdjointIncoherentEvaluationTolerance() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getCutoffAngleCosine(),
+                       epr_data_container.getCutoffAngleCosine() );
+
+  // Relaxation Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshells(),
+                       epr_data_container.getSubshells() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellOccupancy( 1 ),
+                       epr_data_container.getSubshellOccupancy( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellBindingEnergy( 1 ),
+                       epr_data_container.getSubshellBindingEnergy( 1 ) );
+
+  // Photon Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getComptonProfileMomentumGrid( 1 ),
+                       epr_data_container.getComptonProfileMomentumGrid( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getOccupationNumber( 1 ),
+                       epr_data_container.getOccupationNumber( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeAtomicFormFactor(),
+                       epr_data_container.getWallerHartreeAtomicFormFactor() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointPhotonEnergyGrid(),
+                       epr_data_container.getAdjointPhotonEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointWallerHartreeIncoherentMaxEnergyGrid(),
+                       epr_data_container.getAdjointWallerHartreeIncoherentMaxEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointWallerHartreeIncoherentCrossSection(),
+                       epr_data_container.getAdjointWallerHartreeIncoherentCrossSection() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointImpulseApproxSubshellIncoherentMaxEnergyGrid( 1 ),
+                       epr_data_container.getAdjointImpulseApproxSubshellIncoherentMaxEnergyGrid( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointImpulseApproxSubshellIncoherentCrossSection( 1 ),
+                       epr_data_container.getAdjointImpulseApproxSubshellIncoherentCrossSection( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointWallerHartreeTotalCrossSection(),
+                       epr_data_container.getAdjointWallerHartreeTotalCrossSection() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getImpulseApproxTotalCrossSection(),
+                       epr_data_container.getImpulseApproxTotalCrossSection() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointPairProductionEnergyDistribution(),
+                       epr_data_container.getAdjointPairProductionEnergyDistribution() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointTripletProductionEnergyDistributionNormConstant(),
+                       epr_data_container.getAdjointTripletProductionEnergyDistributionNormConstant() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointPhotonBremsstrahlungPDF( 1.0 ),
+                       epr_data_container.getAdjointPhotonBremsstrahlungPDF( 1.0 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointBremsstrahlungPhotonCrossSectionThresholdEnergyIndex(),
+                       epr_data_container.getAdjointBremsstrahlungPhotonCrossSectionThresholdEnergyIndex() );
+
+  // Electron Tests
+  FRENSIE_CHECK( epr_data_container_copy.hasAdjointMomentPreservingData() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectronTwoDInterpPolicy(),
+                       epr_data_container.getElectronTwoDInterpPolicy() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointElasticAngularEnergyGrid(),
+                       epr_data_container.getAdjointElasticAngularEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointCutoffElasticAngles( 1.0 ),
+                       epr_data_container.getAdjointCutoffElasticAngles( 1.0 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointMomentPreservingCrossSectionReduction(),
+                       epr_data_container.getAdjointMomentPreservingCrossSectionReduction() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointMomentPreservingElasticWeights( 1.0 ),
+                       epr_data_container.getAdjointMomentPreservingElasticWeights( 1.0 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointElectroionizationEnergyGrid( 1u ),
+                       epr_data_container.getAdjointElectroionizationEnergyGrid( 1u ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointElectroionizationRecoilEnergy( 1u, 1.0 ),
+                       epr_data_container.getAdjointElectroionizationRecoilEnergy( 1u, 1.0 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointElectronBremsstrahlungPDF( 1.0 ),
+                       epr_data_container.getAdjointElectronBremsstrahlungPDF( 1.0 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointAtomicExcitationEnergyGain(),
+                       epr_data_container.getAdjointAtomicExcitationEnergyGain() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointElectronEnergyGrid(),
+                       epr_data_container.getAdjointElectronEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointTotalElasticCrossSection(),
+                       epr_data_container.getAdjointTotalElasticCrossSection() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointElectroionizationCrossSection( 1u ),
+                       epr_data_container.getAdjointElectroionizationCrossSection( 1u ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointElectroionizationCrossSectionThresholdEnergyIndex( 1u ),
+                       epr_data_container.getAdjointElectroionizationCrossSectionThresholdEnergyIndex( 1u ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getForwardAtomicExcitationElectronCrossSection(),
+                       epr_data_container.getForwardAtomicExcitationElectronCrossSection() );
+}
+
 //---------------------------------------------------------------------------//
 // end tstAdjointElectronPhotonRelaxationDataContainer.cpp
 //---------------------------------------------------------------------------//
@@ -13,6 +13,7 @@
 // FRENSIE Includes
 #include "Data_ElectronPhotonRelaxationVolatileDataContainer.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_FlatArrayArchive.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -2171,6 +2172,131 @@ FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
                        0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the data can be exported to a flat array archive
+FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
+                   exportToFlatArrayArchive )
+{
+  const std::string test_flat_array_archive_name( "test_epr_data_container.frfa" );
+
+  epr_data_container.exportToFlatArrayArchive( test_flat_array_archive_name );
+
+  Utility::FlatArrayIArchive archive( test_flat_array_archive_name );
+
+  FRENSIE_CHECK_EQUAL( archive.getArray( "photon_energy_grid" ),
+                       epr_data_container.getPhotonEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( archive.getArray( "pair_production_cross_section" ),
+                       epr_data_container.getPairProductionCrossSection() );
+  FRENSIE_CHECK_EQUAL( archive.getArray( "pair_production_cross_section_threshold_index" ),
+                       std::vector<double>( 1, epr_data_container.getPairProductionCrossSectionThresholdEnergyIndex() ) );
+  FRENSIE_CHECK_EQUAL( archive.getArray( "subshell_photoelectric_cross_sections_1" ),
+                       epr_data_container.getSubshellPhotoelectricCrossSection( 1 ) );
+  FRENSIE_CHECK_EQUAL( archive.getArray( "electron_energy_grid" ),
+                       epr_data_container.getElectronEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( archive.getArray( "electroionization_subshell_cross_section_1" ),
+                       epr_data_container.getElectroionizationCrossSection( 1 ) );
+  FRENSIE_CHECK( archive.hasTable( "bremsstrahlung_photon_pdf" ) );
+  FRENSIE_CHECK_EQUAL( archive.getTable( "bremsstrahlung_photon_pdf" )[1.0],
+                       epr_data_container.getBremsstrahlungPhotonPDF( 1.0 ) );
+  FRENSIE_CHECK( archive.hasTable( "electroionization_recoil_pdf_1" ) );
+  FRENSIE_CHECK_EQUAL( archive.getTable( "electroionization_recoil_pdf_1" )[1.0],
+                       epr_data_container.getElectroionizationRecoilPDF( 1u, 1.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the data can be imported from a flat array archive
+FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
+                   export_importData_flat_array )
+{
+  const std::string test_flat_array_archive_name( "test_epr_data_container.frfa" );
+
+  epr_data_container.exportToFlatArrayArchive( test_flat_array_archive_name );
+
+  const Data::ElectronPhotonRelaxationDataContainer
+    epr_data_container_copy( test_flat_array_archive_name );
+
+  // Table Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getNotes(), notes );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicNumber(),
+                       epr_data_container.getAtomicNumber() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicWeight(),
+                       epr_data_container.getAtomicWeight() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMinPhotonEnergy(),
+                       epr_data_container.getMinPhotonEnergy() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMaxElectronEnergy(),
+                       epr_data_container.getMaxElectronEnergy() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getCutoffAngleCosine(),
+                       epr_data_container.getCutoffAngleCosine() );
+
+  // Relaxation Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshells(),
+                       epr_data_container.getSubshells() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellOccupancy( 1 ),
+                       epr_data_container.getSubshellOccupancy( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellBindingEnergy( 1 ),
+                       epr_data_container.getSubshellBindingEnergy( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellRelaxationTransitions( 1 ),
+                       epr_data_container.getSubshellRelaxationTransitions( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellRelaxationVacancies( 1 ),
+                       epr_data_container.getSubshellRelaxationVacancies( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellRelaxationParticleEnergies( 1 ),
+                       epr_data_container.getSubshellRelaxationParticleEnergies( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellRelaxationProbabilities( 1 ),
+                       epr_data_container.getSubshellRelaxationProbabilities( 1 ) );
+
+  // Photon Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getComptonProfileMomentumGrid( 1 ),
+                       epr_data_container.getComptonProfileMomentumGrid( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getComptonProfile( 1 ),
+                       epr_data_container.getComptonProfile( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeScatteringFunction(),
+                       epr_data_container.getWallerHartreeScatteringFunction() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPhotonEnergyGrid(),
+                       epr_data_container.getPhotonEnergyGrid() );
+  FRENSIE_CHECK( epr_data_container_copy.hasAveragePhotonHeatingNumbers() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAveragePhotonHeatingNumbers(),
+                       epr_data_container.getAveragePhotonHeatingNumbers() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPairProductionCrossSection(),
+                       epr_data_container.getPairProductionCrossSection() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPairProductionCrossSectionThresholdEnergyIndex(),
+                       epr_data_container.getPairProductionCrossSectionThresholdEnergyIndex() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellPhotoelectricCrossSection( 1 ),
+                       epr_data_container.getSubshellPhotoelectricCrossSection( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellPhotoelectricCrossSectionThresholdEnergyIndex( 1 ),
+                       epr_data_container.getSubshellPhotoelectricCrossSectionThresholdEnergyIndex( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getImpulseApproxTotalCrossSection(),
+                       epr_data_container.getImpulseApproxTotalCrossSection() );
+
+  // Electron Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectronTwoDInterpPolicy(),
+                       epr_data_container.getElectronTwoDInterpPolicy() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElasticAngularEnergyGrid(),
+                       epr_data_container.getElasticAngularEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getCutoffElasticAngles( 1.0 ),
+                       epr_data_container.getCutoffElasticAngles( 1.0 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getCutoffElasticPDF( 1.0 ),
+                       epr_data_container.getCutoffElasticPDF( 1.0 ) );
+  FRENSIE_CHECK( epr_data_container_copy.hasMomentPreservingData() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMomentPreservingElasticDiscreteAngles( 1.0 ),
+                       epr_data_container.getMomentPreservingElasticDiscreteAngles( 1.0 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectroionizationEnergyGrid( 1u ),
+                       epr_data_container.getElectroionizationEnergyGrid( 1u ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectroionizationRecoilPDF( 1u, 1.0 ),
+                       epr_data_container.getElectroionizationRecoilPDF( 1u, 1.0 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getBremsstrahlungPhotonEnergy( 1.0 ),
+                       epr_data_container.getBremsstrahlungPhotonEnergy( 1.0 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicExcitationEnergyLoss(),
+                       epr_data_container.getAtomicExcitationEnergyLoss() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectronEnergyGrid(),
+                       epr_data_container.getElectronEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getTotalElasticCrossSection(),
+                       epr_data_container.getTotalElasticCrossSection() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectroionizationCrossSection( 1u ),
+                       epr_data_container.getElectroionizationCrossSection( 1u ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getBremsstrahlungCrossSectionThresholdEnergyIndex(),
+                       epr_data_container.getBremsstrahlungCrossSectionThresholdEnergyIndex() );
+}
+
 //---------------------------------------------------------------------------//
 // end tstElectronPhotonRelaxationDataContainer.cpp
 //---------------------------------------------------------------------------//
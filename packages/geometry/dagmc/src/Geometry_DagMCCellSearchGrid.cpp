@@ -0,0 +1,393 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_DagMCCellSearchGrid.cpp
+//! \author Alex Robinson
+//! \brief  The DagMC cell search grid class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <cstdlib>
+#include <new>
+
+// FRENSIE Includes
+#include "Geometry_DagMCCellSearchGrid.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const size_t DagMCCellSearchGrid::s_max_bins_per_dimension = 64;
+
+// Constructor
+/*! \details The number of bins in each dimension will be the cube root of
+ * the number of cells (limited to 64 bins per dimension). The DagMC OBB
+ * tree must be initialized before the grid is constructed. Each of the
+ * requested threads will record its lookup statistics separately.
+ */
+DagMCCellSearchGrid::DagMCCellSearchGrid(
+                                       moab::DagMC* dagmc_instance,
+                                       const DagMCCellHandler& cell_handler )
+  : d_bins(),
+    d_all_cells(),
+    d_number_of_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() ),
+    d_thread_lookup_statistics(
+              createThreadLookupStatistics( d_number_of_threads + 1 ),
+              ThreadLookupStatisticsDeleter( d_number_of_threads + 1 ) )
+{
+  // Make sure that the dagmc instance is valid
+  testPrecondition( dagmc_instance );
+
+  // Get the bounding boxes of the cells
+  CellHandleArray bounded_cells, unbounded_cells;
+  std::vector<double> lower_corners, upper_corners;
+
+  for( moab::Range::const_iterator cell_handle_it = cell_handler.begin();
+       cell_handle_it != cell_handler.end();
+       ++cell_handle_it )
+  {
+    double lower_corner[3], upper_corner[3];
+
+    moab::ErrorCode return_value =
+      dagmc_instance->getobb( *cell_handle_it, lower_corner, upper_corner );
+
+    if( return_value == moab::MB_SUCCESS )
+    {
+      bounded_cells.push_back( *cell_handle_it );
+
+      lower_corners.insert( lower_corners.end(), lower_corner, lower_corner+3 );
+      upper_corners.insert( upper_corners.end(), upper_corner, upper_corner+3 );
+    }
+    else
+      unbounded_cells.push_back( *cell_handle_it );
+  }
+
+  // Calculate the grid bounds
+  for( unsigned d = 0; d < 3; ++d )
+  {
+    d_lower_bounds[d] = std::numeric_limits<double>::max();
+    d_upper_bounds[d] = std::numeric_limits<double>::lowest();
+  }
+
+  for( size_t i = 0; i < bounded_cells.size(); ++i )
+  {
+    for( unsigned d = 0; d < 3; ++d )
+    {
+      d_lower_bounds[d] = std::min( d_lower_bounds[d], lower_corners[3*i+d] );
+      d_upper_bounds[d] = std::max( d_upper_bounds[d], upper_corners[3*i+d] );
+    }
+  }
+
+  // Calculate the grid bins
+  size_t bins_per_dimension =
+    (size_t)std::ceil( std::cbrt( (double)bounded_cells.size() ) );
+
+  bins_per_dimension = std::max( bins_per_dimension, (size_t)1 );
+  bins_per_dimension = std::min( bins_per_dimension,
+                                 s_max_bins_per_dimension );
+
+  for( unsigned d = 0; d < 3; ++d )
+  {
+    if( bounded_cells.empty() )
+    {
+      d_lower_bounds[d] = 0.0;
+      d_upper_bounds[d] = 0.0;
+    }
+
+    if( d_upper_bounds[d] > d_lower_bounds[d] )
+    {
+      d_number_of_bins[d] = bins_per_dimension;
+      d_bin_widths[d] =
+        (d_upper_bounds[d] - d_lower_bounds[d])/bins_per_dimension;
+    }
+    else
+    {
+      d_number_of_bins[d] = 1;
+      d_bin_widths[d] = 1.0;
+    }
+  }
+
+  d_bins.resize( d_number_of_bins[0]*d_number_of_bins[1]*d_number_of_bins[2] );
+
+  // Order the bounded cells by the volume of their bounding boxes
+  std::vector<double> bounding_box_volumes( bounded_cells.size() );
+
+  for( size_t i = 0; i < bounded_cells.size(); ++i )
+  {
+    bounding_box_volumes[i] =
+      (upper_corners[3*i] - lower_corners[3*i])*
+      (upper_corners[3*i+1] - lower_corners[3*i+1])*
+      (upper_corners[3*i+2] - lower_corners[3*i+2]);
+  }
+
+  std::vector<size_t> cell_order( bounded_cells.size() );
+  std::iota( cell_order.begin(), cell_order.end(), 0 );
+
+  std::stable_sort( cell_order.begin(),
+                    cell_order.end(),
+                    [&bounding_box_volumes]( const size_t a, const size_t b )
+                    { return bounding_box_volumes[a] < bounding_box_volumes[b]; } );
+
+  // Add the bounded cells to the bins that their bounding boxes overlap
+  for( size_t i = 0; i < cell_order.size(); ++i )
+  {
+    const size_t cell_index = cell_order[i];
+
+    size_t lower_bin_indices[3], upper_bin_indices[3];
+
+    for( unsigned d = 0; d < 3; ++d )
+    {
+      lower_bin_indices[d] =
+        this->calculateBinIndex( lower_corners[3*cell_index+d], d );
+
+      upper_bin_indices[d] =
+        this->calculateBinIndex( upper_corners[3*cell_index+d], d );
+    }
+
+    for( size_t k = lower_bin_indices[2]; k <= upper_bin_indices[2]; ++k )
+    {
+      for( size_t j = lower_bin_indices[1]; j <= upper_bin_indices[1]; ++j )
+      {
+        for( size_t l = lower_bin_indices[0]; l <= upper_bin_indices[0]; ++l )
+        {
+          d_bins[l + d_number_of_bins[0]*(j + d_number_of_bins[1]*k)].push_back( bounded_cells[cell_index] );
+        }
+      }
+    }
+
+    d_all_cells.push_back( bounded_cells[cell_index] );
+  }
+
+  // Cells without a bounding box are candidates everywhere
+  for( size_t i = 0; i < d_bins.size(); ++i )
+  {
+    d_bins[i].insert( d_bins[i].end(),
+                      unbounded_cells.begin(),
+                      unbounded_cells.end() );
+  }
+
+  d_all_cells.insert( d_all_cells.end(),
+                      unbounded_cells.begin(),
+                      unbounded_cells.end() );
+}
+
+// Get the candidate cells that may contain the point
+/*! \details All cells will be returned if the point is outside of the grid.
+ */
+auto DagMCCellSearchGrid::getCandidateCellHandles(
+                      const double position[3] ) const -> const CellHandleArray&
+{
+  if( this->isPointInGrid( position ) )
+  {
+    return d_bins[this->calculateBinIndex( position[0], 0 ) +
+                  d_number_of_bins[0]*(this->calculateBinIndex( position[1], 1 ) +
+                  d_number_of_bins[1]*this->calculateBinIndex( position[2], 2 ))];
+  }
+  else
+    return d_all_cells;
+}
+
+// Check if a point is inside of the grid
+bool DagMCCellSearchGrid::isPointInGrid( const double position[3] ) const
+{
+  for( unsigned d = 0; d < 3; ++d )
+  {
+    if( position[d] < d_lower_bounds[d] || position[d] > d_upper_bounds[d] )
+      return false;
+  }
+
+  return true;
+}
+
+// Get the number of bins in the grid
+size_t DagMCCellSearchGrid::getNumberOfBins() const
+{
+  return d_bins.size();
+}
+
+// Get the number of bins in a dimension
+size_t DagMCCellSearchGrid::getNumberOfBins( const unsigned dimension ) const
+{
+  // Make sure that the dimension is valid
+  testPrecondition( dimension < 3 );
+
+  return d_number_of_bins[dimension];
+}
+
+// Record the result of a cell lookup
+/*! \details Each thread only updates its own statistics so no atomic
+ * read-modify-write operations are needed. Threads that do not have their
+ * own statistics (e.g. more threads than were requested when the grid was
+ * constructed) share the last element, which is updated atomically.
+ */
+void DagMCCellSearchGrid::recordLookup(
+                                  const bool candidate_cell_found,
+                                  const size_t number_of_cells_tested ) const
+{
+  const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
+  if( thread_id < d_number_of_threads )
+  {
+    ThreadLookupStatistics& statistics =
+      d_thread_lookup_statistics[thread_id];
+
+    statistics.number_of_lookups.store(
+               statistics.number_of_lookups.load( std::memory_order_relaxed )+1,
+               std::memory_order_relaxed );
+
+    if( candidate_cell_found )
+    {
+      statistics.number_of_hits.store(
+                  statistics.number_of_hits.load( std::memory_order_relaxed )+1,
+                  std::memory_order_relaxed );
+    }
+
+    statistics.number_of_cells_tested.store(
+          statistics.number_of_cells_tested.load( std::memory_order_relaxed )+
+          number_of_cells_tested,
+          std::memory_order_relaxed );
+  }
+  else
+  {
+    ThreadLookupStatistics& statistics =
+      d_thread_lookup_statistics[d_number_of_threads];
+
+    statistics.number_of_lookups.fetch_add( 1, std::memory_order_relaxed );
+
+    if( candidate_cell_found )
+      statistics.number_of_hits.fetch_add( 1, std::memory_order_relaxed );
+
+    statistics.number_of_cells_tested.fetch_add( number_of_cells_tested,
+                                                 std::memory_order_relaxed );
+  }
+}
+
+// Get the number of cell lookups
+unsigned long long DagMCCellSearchGrid::getNumberOfLookups() const
+{
+  return this->sumThreadLookupStatistic(
+                                 &ThreadLookupStatistics::number_of_lookups );
+}
+
+// Get the number of cell lookups resolved by the candidate cells
+unsigned long long DagMCCellSearchGrid::getNumberOfHits() const
+{
+  return this->sumThreadLookupStatistic(
+                                    &ThreadLookupStatistics::number_of_hits );
+}
+
+// Get the fraction of cell lookups resolved by the candidate cells
+double DagMCCellSearchGrid::getHitRate() const
+{
+  const unsigned long long number_of_lookups = this->getNumberOfLookups();
+
+  if( number_of_lookups > 0 )
+    return ((double)this->getNumberOfHits())/number_of_lookups;
+  else
+    return 0.0;
+}
+
+// Get the average number of cells tested per lookup
+double DagMCCellSearchGrid::getAverageNumberOfCellsTested() const
+{
+  const unsigned long long number_of_lookups = this->getNumberOfLookups();
+
+  if( number_of_lookups > 0 )
+  {
+    return ((double)this->sumThreadLookupStatistic(
+                         &ThreadLookupStatistics::number_of_cells_tested ))/
+      number_of_lookups;
+  }
+  else
+    return 0.0;
+}
+
+// Print a summary of the search grid
+void DagMCCellSearchGrid::printSummary( std::ostream& os ) const
+{
+  os << "Cell Search Grid Summary..." << "\n"
+     << "  Number of bins: " << d_number_of_bins[0] << "x"
+     << d_number_of_bins[1] << "x" << d_number_of_bins[2] << "\n"
+     << "  Number of cell lookups: " << this->getNumberOfLookups() << "\n"
+     << "  Hit rate: " << this->getHitRate() << "\n"
+     << "  Average number of cells tested: "
+     << this->getAverageNumberOfCellsTested() << std::endl;
+}
+
+// Calculate the bin index in a dimension
+/*! \details Coordinates outside of the grid will be assigned to the nearest
+ * bin.
+ */
+size_t DagMCCellSearchGrid::calculateBinIndex( const double coordinate,
+                                               const unsigned dimension ) const
+{
+  if( coordinate <= d_lower_bounds[dimension] )
+    return 0;
+
+  size_t bin_index = (size_t)std::floor(
+      (coordinate - d_lower_bounds[dimension])/d_bin_widths[dimension] );
+
+  return std::min( bin_index, d_number_of_bins[dimension] - 1 );
+}
+
+// Sum a thread lookup statistic over all threads
+unsigned long long DagMCCellSearchGrid::sumThreadLookupStatistic(
+                        std::atomic<unsigned long long>
+                        ThreadLookupStatistics::* statistic ) const
+{
+  unsigned long long sum = 0;
+
+  for( unsigned i = 0; i <= d_number_of_threads; ++i )
+  {
+    sum += (d_thread_lookup_statistics[i].*statistic).load(
+                                                   std::memory_order_relaxed );
+  }
+
+  return sum;
+}
+
+// Destroy the statistics and free their memory
+void DagMCCellSearchGrid::ThreadLookupStatisticsDeleter::operator()(
+                                   ThreadLookupStatistics* statistics ) const
+{
+  for( unsigned i = 0; i < number_of_statistics; ++i )
+    statistics[i].~ThreadLookupStatistics();
+
+  free( statistics );
+}
+
+// Create the (aligned) thread lookup statistics array
+/*! \details Operator new[] is not required to respect the extended alignment
+ * of the statistics before C++17 so the memory is allocated with
+ * posix_memalign.
+ */
+auto DagMCCellSearchGrid::createThreadLookupStatistics(
+                                         const unsigned number_of_statistics )
+  -> ThreadLookupStatistics*
+{
+  void* statistics_memory = NULL;
+
+  if( posix_memalign( &statistics_memory,
+                      alignof(ThreadLookupStatistics),
+                      number_of_statistics*sizeof(ThreadLookupStatistics) ) != 0 )
+    throw std::bad_alloc();
+
+  ThreadLookupStatistics* statistics =
+    static_cast<ThreadLookupStatistics*>( statistics_memory );
+
+  for( unsigned i = 0; i < number_of_statistics; ++i )
+    new (statistics + i) ThreadLookupStatistics;
+
+  return statistics;
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_DagMCCellSearchGrid.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_DagMCCellSearchGrid.hpp
+//! \author Alex Robinson
+//! \brief  The DagMC cell search grid class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_DAGMC_CELL_SEARCH_GRID_HPP
+#define GEOMETRY_DAGMC_CELL_SEARCH_GRID_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <iostream>
+
+// Moab Includes
+#include <DagMC.hpp>
+
+// FRENSIE Includes
+#include "Geometry_DagMCCellHandler.hpp"
+
+namespace Geometry{
+
+/*! The DagMC cell search grid class
+ *
+ * \details A uniform grid is laid over the axis-aligned bounding boxes of
+ * the cells. Each grid bin stores the cells whose bounding boxes overlap the
+ * bin, ordered by the volume of the bounding box (smallest first). Cells
+ * without a bounding box are appended to every bin. The grid can be
+ * queried for the candidate cells that may contain a point so that only a
+ * few point-in-volume tests are needed to find the cell that contains a
+ * point. The grid is not modified after construction and can be shared by
+ * all threads. The lookup statistics are recorded by each thread separately
+ * and combined when they are requested.
+ */
+class DagMCCellSearchGrid
+{
+
+public:
+
+  //! The cell handle array type
+  typedef std::vector<moab::EntityHandle> CellHandleArray;
+
+  //! Constructor
+  DagMCCellSearchGrid( moab::DagMC* dagmc_instance,
+                       const DagMCCellHandler& cell_handler );
+
+  //! Destructor
+  ~DagMCCellSearchGrid()
+  { /* ... */ }
+
+  //! Get the candidate cells that may contain the point
+  const CellHandleArray& getCandidateCellHandles(
+                                           const double position[3] ) const;
+
+  //! Check if a point is inside of the grid
+  bool isPointInGrid( const double position[3] ) const;
+
+  //! Get the number of bins in the grid
+  size_t getNumberOfBins() const;
+
+  //! Get the number of bins in a dimension
+  size_t getNumberOfBins( const unsigned dimension ) const;
+
+  //! Record the result of a cell lookup
+  void recordLookup( const bool candidate_cell_found,
+                     const size_t number_of_cells_tested ) const;
+
+  //! Get the number of cell lookups
+  unsigned long long getNumberOfLookups() const;
+
+  //! Get the number of cell lookups resolved by the candidate cells
+  unsigned long long getNumberOfHits() const;
+
+  //! Get the fraction of cell lookups resolved by the candidate cells
+  double getHitRate() const;
+
+  //! Get the average number of cells tested per lookup
+  double getAverageNumberOfCellsTested() const;
+
+  //! Print a summary of the search grid
+  void printSummary( std::ostream& os ) const;
+
+private:
+
+  // The lookup statistics of a thread (padded to avoid false sharing)
+  struct alignas(64) ThreadLookupStatistics
+  {
+    // Constructor
+    ThreadLookupStatistics()
+      : number_of_lookups( 0 ),
+        number_of_hits( 0 ),
+        number_of_cells_tested( 0 )
+    { /* ... */ }
+
+    // The number of lookups
+    std::atomic<unsigned long long> number_of_lookups;
+
+    // The number of lookups resolved by the candidate cells
+    std::atomic<unsigned long long> number_of_hits;
+
+    // The number of cells tested
+    std::atomic<unsigned long long> number_of_cells_tested;
+  };
+
+  // The thread lookup statistics array deleter
+  struct ThreadLookupStatisticsDeleter
+  {
+    // Constructor
+    ThreadLookupStatisticsDeleter( const unsigned number_of_statistics = 0 )
+      : number_of_statistics( number_of_statistics )
+    { /* ... */ }
+
+    // Destroy the statistics and free their memory
+    void operator()( ThreadLookupStatistics* statistics ) const;
+
+    // The number of statistics
+    unsigned number_of_statistics;
+  };
+
+  // Create the (aligned) thread lookup statistics array
+  static ThreadLookupStatistics* createThreadLookupStatistics(
+                                        const unsigned number_of_statistics );
+
+  // Calculate the bin index in a dimension
+  size_t calculateBinIndex( const double coordinate,
+                            const unsigned dimension ) const;
+
+  // Sum a thread lookup statistic over all threads
+  unsigned long long sumThreadLookupStatistic(
+                        std::atomic<unsigned long long>
+                        ThreadLookupStatistics::* statistic ) const;
+
+  // The max number of bins in each dimension
+  static const size_t s_max_bins_per_dimension;
+
+  // The lower bounds of the grid
+  double d_lower_bounds[3];
+
+  // The upper bounds of the grid
+  double d_upper_bounds[3];
+
+  // The bin widths
+  double d_bin_widths[3];
+
+  // The number of bins in each dimension
+  size_t d_number_of_bins[3];
+
+  // The candidate cells in each bin
+  std::vector<CellHandleArray> d_bins;
+
+  // The candidate cells for points outside of the grid (all cells)
+  CellHandleArray d_all_cells;
+
+  // The number of threads with their own lookup statistics
+  unsigned d_number_of_threads;
+
+  // The lookup statistics of each thread (the last element is shared by
+  // any threads that do not have their own statistics)
+  mutable std::unique_ptr<ThreadLookupStatistics[],ThreadLookupStatisticsDeleter>
+  d_thread_lookup_statistics;
+};
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_DAGMC_CELL_SEARCH_GRID_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_DagMCCellSearchGrid.hpp
+//---------------------------------------------------------------------------//
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <exception>
+#include <sstream>
 #include <unordered_set>
 
 // FRENSIE Includes
@@ -37,6 +38,8 @@ DagMCModel::DagMCModel( const DagMCModelProperties& model_properties,
   : d_dagmc( NULL ),
     d_cell_handler(),
     d_surface_handler(),
+    d_cell_search_grid(),
+    d_surface_cell_adjacency_table(),
     d_termination_cells(),
     d_reflecting_surfaces(),
     d_model_properties( new DagMCModelProperties( model_properties ) )
@@ -114,6 +117,17 @@ void DagMCModel::initialize( const bool suppress_dagmc_output )
   EXCEPTION_CATCH_RETHROW( InvalidDagMCGeometry,
                            "Unable to extract the reflecting surfaces!" );
 
+  // Construct the cell search grid
+  this->constructCellSearchGrid();
+
+  // Construct the surface-cell adjacency table
+  try{
+    this->constructSurfaceCellAdjacencyTable();
+  }
+  EXCEPTION_CATCH_RETHROW( InvalidDagMCGeometry,
+                           "Unable to construct the surface-cell adjacency "
+                           "table!" );
+
   FRENSIE_LOG_NOTIFICATION( "done!" );
   FRENSIE_FLUSH_ALL_LOGS();
 }
@@ -269,6 +283,49 @@ void DagMCModel::constructEntityHandlers()
   }
 }
 
+// Construct the cell search grid
+/*! \details The cell search grid is used to narrow down the cells that
+ * must be tested when searching for the cell that contains a point.
+ */
+void DagMCModel::constructCellSearchGrid()
+{
+  d_cell_search_grid.reset(
+                        new DagMCCellSearchGrid( d_dagmc, *d_cell_handler ) );
+}
+
+// Construct the surface-cell adjacency table
+/*! \details Only surfaces that bound exactly two cells will be stored in the
+ * table. The cell on the other side of any other surface must be found
+ * with a DagMC query.
+ */
+void DagMCModel::constructSurfaceCellAdjacencyTable()
+{
+  d_surface_cell_adjacency_table.clear();
+  
+  moab::Interface* moab_instance = d_dagmc->moab_instance();
+
+  for( moab::Range::const_iterator surface_handle_it =
+         d_surface_handler->begin();
+       surface_handle_it != d_surface_handler->end();
+       ++surface_handle_it )
+  {
+    std::vector<moab::EntityHandle> parent_cells;
+
+    moab::ErrorCode return_value =
+      moab_instance->get_parent_meshsets( *surface_handle_it, parent_cells );
+
+    TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                        InvalidDagMCGeometry,
+                        moab::ErrorCodeStr[return_value] );
+
+    if( parent_cells.size() == 2 )
+    {
+      d_surface_cell_adjacency_table[*surface_handle_it] =
+        std::make_pair( parent_cells[0], parent_cells[1] );
+    }
+  }
+}
+
 // Extract the termination cells
 void DagMCModel::extractTerminationCells()
 {
@@ -942,6 +999,34 @@ void DagMCModel::getSurfaceIdsWithPropertyValue(
   }
 }
 
+// Print a summary of the model
+void DagMCModel::printSummary( std::ostream& os ) const
+{
+  os << "DagMC Model Summary..." << "\n"
+     << "  Model: " << this->getName() << "\n"
+     << "  Number of cells: " << d_cell_handler->getNumberOfCells() << "\n"
+     << "  Number of surfaces: "
+     << d_surface_handler->getNumberOfSurfaces() << "\n"
+     << "  Number of termination cells: " << d_termination_cells.size()
+     << "\n"
+     << "  Number of reflecting surfaces: " << d_reflecting_surfaces.size()
+     << "\n"
+     << "  Number of surfaces in adjacency table: "
+     << d_surface_cell_adjacency_table.size() << "\n";
+
+  d_cell_search_grid->printSummary( os );
+}
+
+// Log a summary of the model
+void DagMCModel::logSummary() const
+{
+  std::ostringstream oss;
+
+  this->printSummary( oss );
+
+  FRENSIE_LOG_NOTIFICATION( oss.str() );
+}
+
 // Print model details
 std::string DagMCModel::getName() const
 {
@@ -960,6 +1045,34 @@ const Geometry::DagMCSurfaceHandler& DagMCModel::getSurfaceHandler() const
   return *d_surface_handler;
 }
 
+// Return the cell search grid
+const Geometry::DagMCCellSearchGrid& DagMCModel::getCellSearchGrid() const
+{
+  return *d_cell_search_grid;
+}
+
+// Return the cell on the other side of a surface (0 if unknown)
+/*! \details The adjacency table is not modified after the model has been
+ * initialized so it can be queried by any number of threads.
+ */
+moab::EntityHandle DagMCModel::getAdjacentCellHandle(
+                                const moab::EntityHandle cell_handle,
+                                const moab::EntityHandle surface_handle ) const
+{
+  SurfaceCellAdjacencyTable::const_iterator adjacent_cells_it =
+    d_surface_cell_adjacency_table.find( surface_handle );
+
+  if( adjacent_cells_it != d_surface_cell_adjacency_table.end() )
+  {
+    if( adjacent_cells_it->second.first == cell_handle )
+      return adjacent_cells_it->second.second;
+    else if( adjacent_cells_it->second.second == cell_handle )
+      return adjacent_cells_it->second.first;
+  }
+
+  return 0;
+}
+
 // Return the reflecting surfaces
 const DagMCNavigator::ReflectingSurfaceIdHandleMap&
 DagMCModel::getReflectingSurfaceIdHandleMap() const
@@ -22,6 +22,7 @@
 #include "Geometry_DagMCModelProperties.hpp"
 #include "Geometry_DagMCCellHandler.hpp"
 #include "Geometry_DagMCSurfaceHandler.hpp"
+#include "Geometry_DagMCCellSearchGrid.hpp"
 #include "Geometry_DagMCNavigator.hpp"
 #include "Geometry_PointLocation.hpp"
 #include "Geometry_AdvancedModel.hpp"
@@ -116,6 +117,12 @@ public:
   //! Check if the model has been initialized
   bool isInitialized() const final override;
 
+  //! Print a summary of the model
+  void printSummary( std::ostream& os ) const;
+
+  //! Log a summary of the model
+  void logSummary() const;
+
 protected:
 
   //! Initialize the model just-in-time
@@ -162,6 +169,12 @@ private:
   // Extract the reflecting surfaces
   void extractReflectingSurfaces();
 
+  // Construct the cell search grid
+  void constructCellSearchGrid();
+
+  // Construct the surface-cell adjacency table
+  void constructSurfaceCellAdjacencyTable();
+
   // Get the property values associated with a property name
   void getPropertyValues( const std::string& property,
                           PropertyValuesArray& values ) const;
@@ -210,6 +223,14 @@ private:
   //! Return the surface handler
   const Geometry::DagMCSurfaceHandler& getSurfaceHandler() const;
 
+  //! Return the cell search grid
+  const Geometry::DagMCCellSearchGrid& getCellSearchGrid() const;
+
+  //! Return the cell on the other side of a surface (0 if unknown)
+  moab::EntityHandle getAdjacentCellHandle(
+                                const moab::EntityHandle cell_handle,
+                                const moab::EntityHandle surface_handle ) const;
+
   //! Return the reflecting surfaces
   const DagMCNavigator::ReflectingSurfaceIdHandleMap&
   getReflectingSurfaceIdHandleMap() const;
@@ -245,6 +266,13 @@ private:
   // The DagMC surface handle
   std::unique_ptr<const Geometry::DagMCSurfaceHandler> d_surface_handler;
 
+  // The DagMC cell search grid
+  std::unique_ptr<const Geometry::DagMCCellSearchGrid> d_cell_search_grid;
+
+  // The surface-cell adjacency table (surface handle -> cell handles)
+  typedef std::unordered_map<moab::EntityHandle,std::pair<moab::EntityHandle,moab::EntityHandle> > SurfaceCellAdjacencyTable;
+  SurfaceCellAdjacencyTable d_surface_cell_adjacency_table;
+
   // The termination cells
   CellIdSet d_termination_cells;
 
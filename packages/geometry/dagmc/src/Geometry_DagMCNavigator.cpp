@@ -22,9 +22,15 @@ namespace Geometry{
 
 // Initialize static member data
 const double DagMCNavigator::s_boundary_tol = 1e-5;
+const size_t DagMCNavigator::s_crossing_cache_size;
 
 // Default constructor
 DagMCNavigator::DagMCNavigator()
+  : d_crossing_cache(),
+    d_next_crossing_cache_index( 0 ),
+    d_number_of_boundary_crossings( 0 ),
+    d_number_of_cached_boundary_crossings( 0 ),
+    d_number_of_tabulated_boundary_crossings( 0 )
 { /* ... */ }
 
 // Constructor
@@ -33,19 +39,31 @@ DagMCNavigator::DagMCNavigator(
           const Navigator::AdvanceCompleteCallback& advance_complete_callback )
   : Navigator( advance_complete_callback ),
     d_dagmc_model( dagmc_model ),
-    d_internal_ray()
+    d_internal_ray(),
+    d_crossing_cache(),
+    d_next_crossing_cache_index( 0 ),
+    d_number_of_boundary_crossings( 0 ),
+    d_number_of_cached_boundary_crossings( 0 ),
+    d_number_of_tabulated_boundary_crossings( 0 )
 {
   // Make sure that the dagmc instance is valid
   testPrecondition( dagmc_model.get() );
 }
 
 // Copy constructor
-/*! \details This constructor should only be used by the clone method.
+/*! \details This constructor should only be used by the clone method. The
+ * crossing cache will be copied but the boundary crossing statistics will
+ * not.
  */
 DagMCNavigator::DagMCNavigator( const DagMCNavigator& other )
   : Navigator( other ),
     d_dagmc_model( other.d_dagmc_model ),
-    d_internal_ray( other.d_internal_ray )
+    d_internal_ray( other.d_internal_ray ),
+    d_crossing_cache( other.d_crossing_cache ),
+    d_next_crossing_cache_index( other.d_next_crossing_cache_index ),
+    d_number_of_boundary_crossings( 0 ),
+    d_number_of_cached_boundary_crossings( 0 ),
+    d_number_of_tabulated_boundary_crossings( 0 )
 { /* ... */ }
 
 // Get the point location w.r.t. a given cell
@@ -519,22 +537,49 @@ PointLocation DagMCNavigator::getPointLocationWithCellHandle(
 }
 
 // Get the boundary cell handle
+/*! \details The most recent boundary crossings will be checked first,
+ * followed by the model's surface-cell adjacency table. DagMC will only be
+ * queried if the boundary cell cannot be found in either.
+ */
 moab::EntityHandle DagMCNavigator::getBoundaryCellHandle(
                        const moab::EntityHandle cell_handle,
                        const moab::EntityHandle boundary_surface_handle ) const
 {
-  moab::EntityHandle boundary_cell_handle;
+  ++d_number_of_boundary_crossings;
 
-  moab::ErrorCode return_value =
-    d_dagmc_model->getRawDagMCInstance().next_vol( boundary_surface_handle,
-                                                   cell_handle,
-                                                   boundary_cell_handle );
+  // Check the crossing cache
+  for( size_t i = 0; i < s_crossing_cache_size; ++i )
+  {
+    const BoundaryCrossing& crossing = d_crossing_cache[i];
 
-  TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
-		      DagMCGeometryError,
-		      moab::ErrorCodeStr[return_value] );
+    if( crossing.surface_handle == boundary_surface_handle &&
+        crossing.cell_handle == cell_handle )
+    {
+      ++d_number_of_cached_boundary_crossings;
 
-  TEST_FOR_EXCEPTION(
+      return crossing.boundary_cell_handle;
+    }
+  }
+
+  // Check the adjacency table
+  moab::EntityHandle boundary_cell_handle =
+    d_dagmc_model->getAdjacentCellHandle( cell_handle,
+                                          boundary_surface_handle );
+
+  if( boundary_cell_handle != 0 )
+    ++d_number_of_tabulated_boundary_crossings;
+  else
+  {
+    moab::ErrorCode return_value =
+      d_dagmc_model->getRawDagMCInstance().next_vol( boundary_surface_handle,
+                                                     cell_handle,
+                                                     boundary_cell_handle );
+
+    TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                        DagMCGeometryError,
+                        moab::ErrorCodeStr[return_value] );
+
+    TEST_FOR_EXCEPTION(
                boundary_cell_handle == 0,
                DagMCGeometryError,
                "Could not find the boundary cell! Here are the details...\n"
@@ -542,10 +587,47 @@ moab::EntityHandle DagMCNavigator::getBoundaryCellHandle(
                << d_dagmc_model->getCellHandler().getCellId( cell_handle ) << "\n"
                "  Boundary Surface: "
                << d_dagmc_model->getSurfaceHandler().getSurfaceId( boundary_surface_handle ) );
+  }
+
+  // Cache the crossing (the oldest crossing will be replaced)
+  BoundaryCrossing& crossing = d_crossing_cache[d_next_crossing_cache_index];
+
+  crossing.cell_handle = cell_handle;
+  crossing.surface_handle = boundary_surface_handle;
+  crossing.boundary_cell_handle = boundary_cell_handle;
+
+  d_next_crossing_cache_index =
+    (d_next_crossing_cache_index + 1) % s_crossing_cache_size;
 
   return boundary_cell_handle;
 }
 
+// Check if the ray is inside of the cell
+bool DagMCNavigator::isRayInCell( const Length position[3],
+                                  const double direction[3],
+                                  const moab::EntityHandle cell_handle ) const
+{
+  PointLocation test_point_location;
+
+  try{
+    test_point_location =
+      this->getPointLocationWithCellHandle( position,
+                                            direction,
+                                            cell_handle );
+  }
+  EXCEPTION_CATCH_RETHROW( DagMCGeometryError,
+                           "Could not find the location of the ray with "
+                           "respect to cell "
+                           << d_dagmc_model->getCellHandler().getCellId( cell_handle ) <<
+                           "! Here are the details...\n"
+                           "  Position: "
+                           << this->arrayToString( position ) << "\n"
+                           "  Direction: "
+                           << this->arrayToString( direction ) );
+
+  return test_point_location == POINT_INSIDE_CELL;
+}
+
 // Find the cell handle that contains the ray
 moab::EntityHandle DagMCNavigator::findCellHandleContainingRay(
                                            const Length position[3],
@@ -557,39 +639,58 @@ moab::EntityHandle DagMCNavigator::findCellHandleContainingRay(
 
   moab::EntityHandle cell_handle = 0;
 
-  // Test all of the cells
-  moab::Range::const_iterator cell_handle_it = d_dagmc_model->getCellHandler().begin();
+  // Test the candidate cells from the cell search grid first
+  const DagMCCellSearchGrid& cell_search_grid =
+    d_dagmc_model->getCellSearchGrid();
 
-  while( cell_handle_it != d_dagmc_model->getCellHandler().end() )
-  {
-    PointLocation test_point_location;
+  const DagMCCellSearchGrid::CellHandleArray& candidate_cell_handles =
+    cell_search_grid.getCandidateCellHandles(
+                                        Utility::reinterpretAsRaw(position) );
 
-    try{
-      test_point_location =
-        this->getPointLocationWithCellHandle( position,
-                                              direction,
-                                              *cell_handle_it );
-    }
-    EXCEPTION_CATCH_RETHROW( DagMCGeometryError,
-                             "Could not find the location of the ray with "
-                             "respect to cell "
-                             << d_dagmc_model->getCellHandler().getCellId( *cell_handle_it ) <<
-                             "! Here are the details...\n"
-                             "  Position: "
-                             << this->arrayToString( position ) << "\n"
-                             "  Direction: "
-                             << this->arrayToString( direction ) );
+  size_t number_of_cells_tested = 0;
 
-    if( test_point_location == POINT_INSIDE_CELL )
+  for( size_t i = 0; i < candidate_cell_handles.size(); ++i )
+  {
+    ++number_of_cells_tested;
+
+    if( this->isRayInCell( position,
+                           direction,
+                           candidate_cell_handles[i] ) )
     {
-      cell_handle = *cell_handle_it;
+      cell_handle = candidate_cell_handles[i];
 
       break;
     }
+  }
+
+  const bool candidate_cell_found = (cell_handle != 0);
+
+  // Test all of the cells if the candidate cells are incomplete (this
+  // should only happen if a bounding box is not conservative)
+  if( !candidate_cell_found &&
+      candidate_cell_handles.size() <
+      d_dagmc_model->getCellHandler().getNumberOfCells() )
+  {
+    moab::Range::const_iterator cell_handle_it =
+      d_dagmc_model->getCellHandler().begin();
 
-    ++cell_handle_it;
+    while( cell_handle_it != d_dagmc_model->getCellHandler().end() )
+    {
+      ++number_of_cells_tested;
+
+      if( this->isRayInCell( position, direction, *cell_handle_it ) )
+      {
+        cell_handle = *cell_handle_it;
+
+        break;
+      }
+
+      ++cell_handle_it;
+    }
   }
 
+  cell_search_grid.recordLookup( candidate_cell_found, number_of_cells_tested );
+
   // Make sure that a cell handle was found
   TEST_FOR_EXCEPTION( cell_handle == 0,
                       DagMCGeometryError,
@@ -742,6 +843,45 @@ DagMCNavigator* DagMCNavigator::clone() const
   return new DagMCNavigator( *this );
 }
 
+// Get the number of boundary crossings resolved by the navigator
+unsigned long long DagMCNavigator::getNumberOfBoundaryCrossings() const
+{
+  return d_number_of_boundary_crossings;
+}
+
+// Get the number of boundary crossings resolved by the crossing cache
+unsigned long long DagMCNavigator::getNumberOfCachedBoundaryCrossings() const
+{
+  return d_number_of_cached_boundary_crossings;
+}
+
+// Get the number of boundary crossings resolved by the adjacency table
+unsigned long long DagMCNavigator::getNumberOfTabulatedBoundaryCrossings() const
+{
+  return d_number_of_tabulated_boundary_crossings;
+}
+
+// Get the fraction of boundary crossings resolved without a DagMC query
+double DagMCNavigator::getBoundaryCrossingResolutionRate() const
+{
+  if( d_number_of_boundary_crossings > 0 )
+  {
+    return ((double)(d_number_of_cached_boundary_crossings +
+                     d_number_of_tabulated_boundary_crossings))/
+      d_number_of_boundary_crossings;
+  }
+  else
+    return 0.0;
+}
+
+// Reset the boundary crossing statistics
+void DagMCNavigator::resetBoundaryCrossingStatistics()
+{
+  d_number_of_boundary_crossings = 0;
+  d_number_of_cached_boundary_crossings = 0;
+  d_number_of_tabulated_boundary_crossings = 0;
+}
+
 // // Save the model to an archive
 // template<typename Archive>
 // void DagMCNavigator::save( Archive& ar, const unsigned version ) const
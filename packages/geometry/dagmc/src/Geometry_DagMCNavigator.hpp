@@ -9,6 +9,9 @@
 #ifndef GEOMETRY_DAGMC_NAVIGATOR_HPP
 #define GEOMETRY_DAGMC_NAVIGATOR_HPP
 
+// Std Lib Includes
+#include <array>
+
 // Boost Includes
 #include <boost/bimap.hpp>
 
@@ -124,6 +127,21 @@ public:
   //! Clone the navigator
   DagMCNavigator* clone() const override;
 
+  //! Get the number of boundary crossings resolved by the navigator
+  unsigned long long getNumberOfBoundaryCrossings() const;
+
+  //! Get the number of boundary crossings resolved by the crossing cache
+  unsigned long long getNumberOfCachedBoundaryCrossings() const;
+
+  //! Get the number of boundary crossings resolved by the adjacency table
+  unsigned long long getNumberOfTabulatedBoundaryCrossings() const;
+
+  //! Get the fraction of boundary crossings resolved without a DagMC query
+  double getBoundaryCrossingResolutionRate() const;
+
+  //! Reset the boundary crossing statistics
+  void resetBoundaryCrossingStatistics();
+
 protected:
 
   //! Copy constructor
@@ -165,6 +183,11 @@ private:
                       const moab::EntityHandle cell_handle,
                       const moab::EntityHandle boundary_surface_handle ) const;
 
+  // Check if the ray is inside of the cell
+  bool isRayInCell( const Length position[3],
+                    const double direction[3],
+                    const moab::EntityHandle cell_handle ) const;
+
   // Find the cell handle that contains the ray
   moab::EntityHandle findCellHandleContainingRay(
                                   const Length position[3],
@@ -203,14 +226,40 @@ private:
                         const double z_direction,
                         const bool reflection );
 
+  // The boundary crossing struct
+  struct BoundaryCrossing
+  {
+    moab::EntityHandle cell_handle;
+    moab::EntityHandle surface_handle;
+    moab::EntityHandle boundary_cell_handle;
+  };
+
   // The boundary tolerance
   static const double s_boundary_tol;
 
+  // The number of boundary crossings that will be cached
+  static const size_t s_crossing_cache_size = 8;
+
   // The DagMC model
   std::shared_ptr<const DagMCModel> d_dagmc_model;
 
   // The internal ray
   DagMCRay d_internal_ray;
+
+  // The most recent boundary crossings
+  mutable std::array<BoundaryCrossing,s_crossing_cache_size> d_crossing_cache;
+
+  // The crossing cache index that will be replaced next
+  mutable size_t d_next_crossing_cache_index;
+
+  // The number of boundary crossings
+  mutable unsigned long long d_number_of_boundary_crossings;
+
+  // The number of boundary crossings resolved by the crossing cache
+  mutable unsigned long long d_number_of_cached_boundary_crossings;
+
+  // The number of boundary crossings resolved by the adjacency table
+  mutable unsigned long long d_number_of_tabulated_boundary_crossings;
 };
 
 /*! The DagMC geometry error
@@ -0,0 +1,186 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDagMCCellSearchGrid.cpp
+//! \author Alex Robinson
+//! \brief  DagMCCellSearchGrid class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+#include <memory>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Geometry_DagMCCellSearchGrid.hpp"
+#include "Geometry_StandardDagMCCellHandler.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+std::shared_ptr<Geometry::DagMCCellHandler> cell_handler;
+std::shared_ptr<Geometry::DagMCCellSearchGrid> cell_search_grid;
+moab::DagMC* dagmc_instance;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Check if a cell handle is a candidate
+bool isCandidate( const Geometry::DagMCCellSearchGrid::CellHandleArray& candidates,
+                  const moab::EntityHandle cell_handle )
+{
+  return std::find( candidates.begin(), candidates.end(), cell_handle ) !=
+    candidates.end();
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the cell search grid can be constructed
+FRENSIE_UNIT_TEST( DagMCCellSearchGrid, constructor )
+{
+  FRENSIE_CHECK_NO_THROW( cell_search_grid.reset( new Geometry::DagMCCellSearchGrid( dagmc_instance, *cell_handler ) ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the number of bins can be returned
+FRENSIE_UNIT_TEST( DagMCCellSearchGrid, getNumberOfBins )
+{
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getNumberOfBins( 0 ), 4 );
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getNumberOfBins( 1 ), 4 );
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getNumberOfBins( 2 ), 4 );
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getNumberOfBins(), 64 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the candidate cells can be returned
+FRENSIE_UNIT_TEST( DagMCCellSearchGrid, getCandidateCellHandles )
+{
+  double position[3] = {-40.0, -40.0, 59.0};
+
+  FRENSIE_CHECK( cell_search_grid->isPointInGrid( position ) );
+  FRENSIE_CHECK( isCandidate( cell_search_grid->getCandidateCellHandles( position ),
+                              cell_handler->getCellHandle( 53 ) ) );
+  FRENSIE_CHECK( cell_search_grid->getCandidateCellHandles( position ).size() <=
+                 cell_handler->getNumberOfCells() );
+
+  position[2] = 61.0;
+
+  FRENSIE_CHECK( cell_search_grid->isPointInGrid( position ) );
+  FRENSIE_CHECK( isCandidate( cell_search_grid->getCandidateCellHandles( position ),
+                              cell_handler->getCellHandle( 54 ) ) );
+
+  position[2] = 64.0;
+
+  FRENSIE_CHECK( cell_search_grid->isPointInGrid( position ) );
+  FRENSIE_CHECK( isCandidate( cell_search_grid->getCandidateCellHandles( position ),
+                              cell_handler->getCellHandle( 55 ) ) );
+
+  // All cells are candidates for points outside of the grid
+  position[2] = 1e6;
+
+  FRENSIE_CHECK( !cell_search_grid->isPointInGrid( position ) );
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getCandidateCellHandles( position ).size(),
+                       cell_handler->getNumberOfCells() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the lookup statistics can be recorded
+FRENSIE_UNIT_TEST( DagMCCellSearchGrid, recordLookup )
+{
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getNumberOfLookups(), 0 );
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getNumberOfHits(), 0 );
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getHitRate(), 0.0 );
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getAverageNumberOfCellsTested(), 0.0 );
+
+  cell_search_grid->recordLookup( true, 2 );
+  cell_search_grid->recordLookup( true, 3 );
+  cell_search_grid->recordLookup( true, 1 );
+  cell_search_grid->recordLookup( false, 10 );
+
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getNumberOfLookups(), 4 );
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getNumberOfHits(), 3 );
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getHitRate(), 0.75 );
+  FRENSIE_CHECK_EQUAL( cell_search_grid->getAverageNumberOfCellsTested(), 4.0 );
+
+  std::ostringstream oss;
+
+  cell_search_grid->printSummary( oss );
+
+  FRENSIE_CHECK( oss.str().find( "Hit rate: 0.75" ) < oss.str().size() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the lookup statistics can be recorded by multiple threads
+FRENSIE_UNIT_TEST( DagMCCellSearchGrid, recordLookup_threads )
+{
+  Geometry::DagMCCellSearchGrid local_cell_search_grid( dagmc_instance,
+                                                        *cell_handler );
+
+  // Note: threads without their own statistics share the overflow statistics
+  #pragma omp parallel for num_threads( 4 )
+  for( int i = 0; i < 1000; ++i )
+    local_cell_search_grid.recordLookup( i%4 != 0, 2 );
+
+  FRENSIE_CHECK_EQUAL( local_cell_search_grid.getNumberOfLookups(), 1000 );
+  FRENSIE_CHECK_EQUAL( local_cell_search_grid.getNumberOfHits(), 750 );
+  FRENSIE_CHECK_EQUAL( local_cell_search_grid.getHitRate(), 0.75 );
+  FRENSIE_CHECK_EQUAL( local_cell_search_grid.getAverageNumberOfCellsTested(), 2.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+std::string test_dagmc_geom_file_name;
+bool suppress_dagmc_output = true;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_cad_file",
+                                        test_dagmc_geom_file_name, "",
+                                        "Test CAD file name" );
+
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "suppress_dagmc_output",
+                                        suppress_dagmc_output, true,
+                                        "Suppress DagMC output" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Initialize dagmc
+  dagmc_instance = new moab::DagMC();
+
+  std::streambuf* cout_streambuf, *cerr_streambuf;
+
+  if( suppress_dagmc_output )
+  {
+    cout_streambuf = std::cout.rdbuf();
+    cerr_streambuf = std::cerr.rdbuf();
+
+    std::cout.rdbuf( NULL );
+    std::cerr.rdbuf( NULL );
+  }
+
+  dagmc_instance->load_file( test_dagmc_geom_file_name.c_str() );
+
+  // The cell bounding boxes require the OBB tree
+  dagmc_instance->init_OBBTree();
+
+  if( suppress_dagmc_output )
+  {
+    std::cout.rdbuf( cout_streambuf );
+    std::cerr.rdbuf( cerr_streambuf );
+  }
+
+  cell_handler.reset( new Geometry::StandardDagMCCellHandler( dagmc_instance ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstDagMCCellSearchGrid.cpp
+//---------------------------------------------------------------------------//
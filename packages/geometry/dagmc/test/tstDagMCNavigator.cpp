@@ -700,6 +700,60 @@ FRENSIE_UNIT_TEST( DagMCNavigator, ray_trace_with_reflection )
   FRENSIE_CHECK_EQUAL( surface_hit, 394 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that repeated boundary crossings can be resolved without DagMC queries
+FRENSIE_UNIT_TEST( DagMCNavigator, boundary_crossing_cache )
+{
+  std::shared_ptr<Geometry::DagMCNavigator>
+    navigator( model->createNavigatorAdvanced() );
+
+  // Initialize the ray
+  navigator->setState( -40.0*cgs::centimeter,
+                       -40.0*cgs::centimeter,
+                       59.0*cgs::centimeter,
+                       0.0, 0.0, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfBoundaryCrossings(), 0 );
+  FRENSIE_CHECK_EQUAL( navigator->getBoundaryCrossingResolutionRate(), 0.0 );
+
+  // Cross back and forth between cells 53, 54 and 55
+  for( size_t i = 0; i < 10; ++i )
+  {
+    navigator->advanceToCellBoundary();
+
+    FRENSIE_REQUIRE_EQUAL( navigator->getCurrentCell(), 54 );
+
+    navigator->advanceToCellBoundary();
+
+    FRENSIE_REQUIRE_EQUAL( navigator->getCurrentCell(), 55 );
+
+    navigator->advanceBySubstep( 0.5*navigator->fireRay() );
+    navigator->changeDirection( 0.0, 0.0, -1.0 );
+    navigator->advanceToCellBoundary();
+
+    FRENSIE_REQUIRE_EQUAL( navigator->getCurrentCell(), 54 );
+
+    navigator->advanceToCellBoundary();
+
+    FRENSIE_REQUIRE_EQUAL( navigator->getCurrentCell(), 53 );
+
+    navigator->advanceBySubstep( 0.5*navigator->fireRay() );
+    navigator->changeDirection( 0.0, 0.0, 1.0 );
+  }
+
+  // Only the first crossing of each surface (in each direction) can miss
+  // the crossing cache
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfBoundaryCrossings(), 40 );
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfCachedBoundaryCrossings(), 36 );
+  FRENSIE_CHECK( navigator->getBoundaryCrossingResolutionRate() >= 0.9 );
+
+  navigator->resetBoundaryCrossingStatistics();
+
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfBoundaryCrossings(), 0 );
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfCachedBoundaryCrossings(), 0 );
+  FRENSIE_CHECK_EQUAL( navigator->getNumberOfTabulatedBoundaryCrossings(), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the ray can be cloned
 FRENSIE_UNIT_TEST( DagMCNavigator, clone )
@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeCell.cpp
+//! \author Alex Robinson
+//! \brief  The native CSG cell class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // Must be included first
+#include "Geometry_NativeCell.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Default constructor
+NativeCell::NativeCell()
+  : d_id( Navigator::invalidCellId() ),
+    d_zones(),
+    d_material_id( Model::invalidMaterialId() ),
+    d_density( Utility::QuantityTraits<Density>::zero() ),
+    d_termination_cell( false ),
+    d_volume( Utility::QuantityTraits<Volume>::zero() )
+{ /* ... */ }
+
+// Void cell constructor
+NativeCell::NativeCell( const EntityId id, const ZoneArray& zones )
+  : d_id( id ),
+    d_zones( zones ),
+    d_material_id( Model::invalidMaterialId() ),
+    d_density( Utility::QuantityTraits<Density>::zero() ),
+    d_termination_cell( false ),
+    d_volume( Utility::QuantityTraits<Volume>::zero() )
+{
+  // Make sure that the zones are valid
+  testPrecondition( zones.size() > 0 );
+}
+
+// Material cell constructor
+/*! \details A negative density is a mass density (g/cm^3) and a positive
+ * density is an atom density (atom/b-cm).
+ */
+NativeCell::NativeCell( const EntityId id,
+                        const ZoneArray& zones,
+                        const MaterialId material_id,
+                        const Density density )
+  : d_id( id ),
+    d_zones( zones ),
+    d_material_id( material_id ),
+    d_density( density ),
+    d_termination_cell( false ),
+    d_volume( Utility::QuantityTraits<Volume>::zero() )
+{
+  // Make sure that the zones are valid
+  testPrecondition( zones.size() > 0 );
+  // Make sure that the material is valid
+  testPrecondition( material_id != Model::invalidMaterialId() );
+  testPrecondition( density != Utility::QuantityTraits<Density>::zero() );
+}
+
+// Return the cell id
+auto NativeCell::getId() const -> EntityId
+{
+  return d_id;
+}
+
+// Return the zones
+auto NativeCell::getZones() const -> const ZoneArray&
+{
+  return d_zones;
+}
+
+// Check if the cell is void
+bool NativeCell::isVoid() const
+{
+  return d_material_id == Model::invalidMaterialId();
+}
+
+// Return the material id
+auto NativeCell::getMaterialId() const -> MaterialId
+{
+  return d_material_id;
+}
+
+// Return the density
+auto NativeCell::getDensity() const -> Density
+{
+  return d_density;
+}
+
+// Set the cell as a termination cell
+void NativeCell::setTerminationCell( const bool termination_cell )
+{
+  d_termination_cell = termination_cell;
+}
+
+// Check if the cell is a termination cell
+bool NativeCell::isTerminationCell() const
+{
+  return d_termination_cell;
+}
+
+// Set the cell volume
+/*! \details The volume of a CSG cell cannot be calculated in general. It
+ * only needs to be set if the cell is used by a cell estimator.
+ */
+void NativeCell::setVolume( const Volume volume )
+{
+  // Make sure that the volume is valid
+  testPrecondition( volume > Utility::QuantityTraits<Volume>::zero() );
+
+  d_volume = volume;
+}
+
+// Get the cell volume (zero if it has not been set)
+auto NativeCell::getVolume() const -> Volume
+{
+  return d_volume;
+}
+
+} // end Geometry namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( Geometry::NativeCell );
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeCell.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,151 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeCell.hpp
+//! \author Alex Robinson
+//! \brief  The native CSG cell class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_CELL_HPP
+#define GEOMETRY_NATIVE_CELL_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <utility>
+
+// FRENSIE Includes
+#include "Geometry_NativeSurface.hpp"
+#include "Geometry_Model.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_Tuple.hpp"
+
+namespace Geometry{
+
+/*! The native CSG cell class
+ *
+ * \details The cell is defined as a union of zones where each zone is an
+ * intersection of surface half-spaces (any boolean combination of
+ * half-spaces can be written in this form). A cell without a material is a
+ * void cell.
+ */
+class NativeCell
+{
+
+public:
+
+  //! The cell id type
+  typedef Navigator::EntityId EntityId;
+
+  //! The material id type
+  typedef Model::MaterialId MaterialId;
+
+  //! The density quantity
+  typedef Model::Density Density;
+
+  //! The volume quantity
+  typedef Model::Volume Volume;
+
+  //! The half-space type (surface id, sense)
+  typedef std::pair<EntityId,NativeSurface::Sense> HalfSpace;
+
+  //! The zone type (intersection of half-spaces)
+  typedef std::vector<HalfSpace> Zone;
+
+  //! The zone array type (union of zones)
+  typedef std::vector<Zone> ZoneArray;
+
+  //! Void cell constructor
+  NativeCell( const EntityId id, const ZoneArray& zones );
+
+  //! Material cell constructor
+  NativeCell( const EntityId id,
+              const ZoneArray& zones,
+              const MaterialId material_id,
+              const Density density );
+
+  //! Destructor
+  ~NativeCell()
+  { /* ... */ }
+
+  //! Return the cell id
+  EntityId getId() const;
+
+  //! Return the zones
+  const ZoneArray& getZones() const;
+
+  //! Check if the cell is void
+  bool isVoid() const;
+
+  //! Return the material id
+  MaterialId getMaterialId() const;
+
+  //! Return the density
+  Density getDensity() const;
+
+  //! Set the cell as a termination cell
+  void setTerminationCell( const bool termination_cell = true );
+
+  //! Check if the cell is a termination cell
+  bool isTerminationCell() const;
+
+  //! Set the cell volume
+  void setVolume( const Volume volume );
+
+  //! Get the cell volume (zero if it has not been set)
+  Volume getVolume() const;
+
+private:
+
+  // Default constructor
+  NativeCell();
+
+  // Serialize the cell
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The cell id
+  EntityId d_id;
+
+  // The zones
+  ZoneArray d_zones;
+
+  // The material id
+  MaterialId d_material_id;
+
+  // The density
+  Density d_density;
+
+  // The termination cell flag
+  bool d_termination_cell;
+
+  // The cell volume
+  Volume d_volume;
+};
+
+// Serialize the cell
+template<typename Archive>
+void NativeCell::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_id );
+  ar & BOOST_SERIALIZATION_NVP( d_zones );
+  ar & BOOST_SERIALIZATION_NVP( d_material_id );
+  ar & BOOST_SERIALIZATION_NVP( d_density );
+  ar & BOOST_SERIALIZATION_NVP( d_termination_cell );
+  ar & BOOST_SERIALIZATION_NVP( d_volume );
+}
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( NativeCell, Geometry, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( Geometry, NativeCell );
+
+#endif // end GEOMETRY_NATIVE_CELL_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeCell.hpp
+//---------------------------------------------------------------------------//
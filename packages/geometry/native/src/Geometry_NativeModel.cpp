@@ -0,0 +1,426 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeModel.cpp
+//! \author Alex Robinson
+//! \brief  The native CSG geometry model class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <limits>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // Must be included first
+#include "Geometry_NativeModel.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const double NativeModel::s_bounding_box_tol = 1e-9;
+
+// Default constructor
+NativeModel::NativeModel()
+{ /* ... */ }
+
+// Constructor
+NativeModel::NativeModel( const std::string& name,
+                          const SurfaceArray& surfaces,
+                          const CellArray& cells )
+  : d_name( name ),
+    d_surfaces( surfaces ),
+    d_cells( cells ),
+    d_surface_id_index_map(),
+    d_cell_id_index_map(),
+    d_cell_data(),
+    d_surface_cell_indices()
+{
+  this->initialize();
+}
+
+// Initialize the model
+/*! \details The surface and cell lookup tables, the cell data and the
+ * surface-cell adjacency lists will be constructed.
+ */
+void NativeModel::initialize()
+{
+  d_surface_id_index_map.clear();
+  d_cell_id_index_map.clear();
+
+  // Construct the surface id index map
+  for( size_t i = 0; i < d_surfaces.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( d_surface_id_index_map.count( d_surfaces[i].getId() ),
+                        InvalidNativeGeometry,
+                        "Surface " << d_surfaces[i].getId() << " has been "
+                        "defined more than once!" );
+
+    d_surface_id_index_map[d_surfaces[i].getId()] = i;
+  }
+
+  // Construct the cell id index map
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( d_cell_id_index_map.count( d_cells[i].getId() ),
+                        InvalidNativeGeometry,
+                        "Cell " << d_cells[i].getId() << " has been "
+                        "defined more than once!" );
+
+    d_cell_id_index_map[d_cells[i].getId()] = i;
+  }
+
+  this->constructCellData();
+}
+
+// Construct the cell data
+void NativeModel::constructCellData()
+{
+  const double inf = std::numeric_limits<double>::infinity();
+
+  d_cell_data.clear();
+  d_cell_data.resize( d_cells.size() );
+
+  d_surface_cell_indices.clear();
+  d_surface_cell_indices.resize( d_surfaces.size() );
+
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    const NativeCell::ZoneArray& zones = d_cells[i].getZones();
+
+    CellData& cell_data = d_cell_data[i];
+
+    cell_data.zones.resize( zones.size() );
+
+    for( size_t d = 0; d < 3; ++d )
+    {
+      cell_data.lower_bounds[d] = inf;
+      cell_data.upper_bounds[d] = -inf;
+    }
+
+    for( size_t j = 0; j < zones.size(); ++j )
+    {
+      double zone_lower_bounds[3] = {-inf, -inf, -inf};
+      double zone_upper_bounds[3] = {inf, inf, inf};
+
+      for( size_t k = 0; k < zones[j].size(); ++k )
+      {
+        const EntityId surface_id = zones[j][k].first;
+
+        TEST_FOR_EXCEPTION( !this->doesSurfaceExist( surface_id ),
+                            InvalidNativeGeometry,
+                            "Cell " << d_cells[i].getId() << " references "
+                            "surface " << surface_id << ", which does not "
+                            "exist!" );
+
+        const size_t surface_index = this->getSurfaceIndex( surface_id );
+
+        cell_data.zones[j].push_back(
+                          std::make_pair( surface_index, zones[j][k].second ) );
+
+        // Add the surface to the cell surface list
+        if( std::find( cell_data.surface_indices.begin(),
+                       cell_data.surface_indices.end(),
+                       surface_index ) == cell_data.surface_indices.end() )
+        {
+          cell_data.surface_indices.push_back( surface_index );
+
+          d_surface_cell_indices[surface_index].push_back( i );
+        }
+
+        // Intersect the zone bounding box with the half-space bounding box
+        double half_space_lower_bounds[3], half_space_upper_bounds[3];
+
+        d_surfaces[surface_index].getBoundingBox( zones[j][k].second,
+                                                  half_space_lower_bounds,
+                                                  half_space_upper_bounds );
+
+        for( size_t d = 0; d < 3; ++d )
+        {
+          zone_lower_bounds[d] =
+            std::max( zone_lower_bounds[d], half_space_lower_bounds[d] );
+
+          zone_upper_bounds[d] =
+            std::min( zone_upper_bounds[d], half_space_upper_bounds[d] );
+        }
+      }
+
+      // The cell bounding box is the union of the zone bounding boxes
+      for( size_t d = 0; d < 3; ++d )
+      {
+        cell_data.lower_bounds[d] =
+          std::min( cell_data.lower_bounds[d], zone_lower_bounds[d] );
+
+        cell_data.upper_bounds[d] =
+          std::max( cell_data.upper_bounds[d], zone_upper_bounds[d] );
+      }
+    }
+  }
+}
+
+// Get the surface index
+size_t NativeModel::getSurfaceIndex( const EntityId surface_id ) const
+{
+  // Make sure that the surface exists
+  testPrecondition( this->doesSurfaceExist( surface_id ) );
+
+  return d_surface_id_index_map.find( surface_id )->second;
+}
+
+// Get the cell index
+size_t NativeModel::getCellIndex( const EntityId cell_id ) const
+{
+  // Make sure that the cell exists
+  testPrecondition( this->doesCellExist( cell_id ) );
+
+  return d_cell_id_index_map.find( cell_id )->second;
+}
+
+// Check if a point is inside of a cell
+/*! \details The direction will be used to determine the sense of any surface
+ * that the point is on.
+ */
+bool NativeModel::isPointInCell( const size_t cell_index,
+                                 const double position[3],
+                                 const double direction[3] ) const
+{
+  // Make sure that the cell index is valid
+  testPrecondition( cell_index < d_cell_data.size() );
+
+  const CellData& cell_data = d_cell_data[cell_index];
+
+  // Check the bounding box first
+  for( size_t d = 0; d < 3; ++d )
+  {
+    if( position[d] < cell_data.lower_bounds[d] - s_bounding_box_tol ||
+        position[d] > cell_data.upper_bounds[d] + s_bounding_box_tol )
+      return false;
+  }
+
+  // Check each zone
+  for( size_t j = 0; j < cell_data.zones.size(); ++j )
+  {
+    bool inside_zone = true;
+
+    for( size_t k = 0; k < cell_data.zones[j].size(); ++k )
+    {
+      const NativeSurface& surface =
+        d_surfaces[cell_data.zones[j][k].first];
+
+      if( surface.getSense( position, direction ) !=
+          cell_data.zones[j][k].second )
+      {
+        inside_zone = false;
+
+        break;
+      }
+    }
+
+    if( inside_zone )
+      return true;
+  }
+
+  return false;
+}
+
+// Get the model name
+std::string NativeModel::getName() const
+{
+  return d_name;
+}
+
+// Check if the model has cell estimator data
+bool NativeModel::hasCellEstimatorData() const
+{
+  return false;
+}
+
+// Get the material ids
+void NativeModel::getMaterialIds( MaterialIdSet& material_ids ) const
+{
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    if( !d_cells[i].isVoid() )
+      material_ids.insert( d_cells[i].getMaterialId() );
+  }
+}
+
+// Get the cells
+void NativeModel::getCells( CellIdSet& cell_set,
+                            const bool include_void_cells,
+                            const bool include_termination_cells ) const
+{
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    // Check if it is a termination cell
+    if( d_cells[i].isTerminationCell() )
+    {
+      if( include_termination_cells )
+        cell_set.insert( d_cells[i].getId() );
+    }
+    // Check if it is a void cell
+    else if( d_cells[i].isVoid() )
+    {
+      if( include_void_cells )
+        cell_set.insert( d_cells[i].getId() );
+    }
+    // Cell with material
+    else
+      cell_set.insert( d_cells[i].getId() );
+  }
+}
+
+// Get the cell material ids
+void NativeModel::getCellMaterialIds(
+                                     CellIdMatIdMap& cell_id_mat_id_map ) const
+{
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    if( !d_cells[i].isVoid() )
+      cell_id_mat_id_map[d_cells[i].getId()] = d_cells[i].getMaterialId();
+  }
+}
+
+// Get the cell densities
+void NativeModel::getCellDensities(
+                                  CellIdDensityMap& cell_id_density_map ) const
+{
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    if( !d_cells[i].isVoid() )
+      cell_id_density_map[d_cells[i].getId()] = d_cells[i].getDensity();
+  }
+}
+
+// Get the cell estimator data
+void NativeModel::getCellEstimatorData( CellEstimatorIdDataMap& ) const
+{ /* ... */ }
+
+// Check if a cell exists
+bool NativeModel::doesCellExist( const EntityId cell_id ) const
+{
+  return d_cell_id_index_map.find( cell_id ) != d_cell_id_index_map.end();
+}
+
+// Check if the cell is a termination cell
+bool NativeModel::isTerminationCell( const EntityId cell_id ) const
+{
+  // Make sure that the cell exists
+  testPrecondition( this->doesCellExist( cell_id ) );
+
+  return d_cells[this->getCellIndex( cell_id )].isTerminationCell();
+}
+
+// Check if a cell is void
+bool NativeModel::isVoidCell( const EntityId cell_id ) const
+{
+  // Make sure that the cell exists
+  testPrecondition( this->doesCellExist( cell_id ) );
+
+  return d_cells[this->getCellIndex( cell_id )].isVoid();
+}
+
+// Get the cell volume
+/*! \details The cell volume must be set explicitly since it cannot be
+ * calculated for an arbitrary CSG cell.
+ */
+auto NativeModel::getCellVolume( const EntityId cell_id ) const -> Volume
+{
+  // Make sure that the cell exists
+  testPrecondition( this->doesCellExist( cell_id ) );
+
+  const Volume volume = d_cells[this->getCellIndex( cell_id )].getVolume();
+
+  TEST_FOR_EXCEPTION( volume <= Utility::QuantityTraits<Volume>::zero(),
+                      InvalidNativeGeometry,
+                      "The volume of cell " << cell_id << " has not been "
+                      "set!" );
+
+  return volume;
+}
+
+// Check if the model has surface estimator data
+bool NativeModel::hasSurfaceEstimatorData() const
+{
+  return false;
+}
+
+// Get the surfaces
+void NativeModel::getSurfaces( SurfaceIdSet& surface_set ) const
+{
+  for( size_t i = 0; i < d_surfaces.size(); ++i )
+    surface_set.insert( d_surfaces[i].getId() );
+}
+
+// Get the surface estimator data
+void NativeModel::getSurfaceEstimatorData( SurfaceEstimatorIdDataMap& ) const
+{ /* ... */ }
+
+// Check if the surface exists
+bool NativeModel::doesSurfaceExist( const EntityId surface_id ) const
+{
+  return d_surface_id_index_map.find( surface_id ) !=
+    d_surface_id_index_map.end();
+}
+
+// Get the surface area
+/*! \details The surface area must be set explicitly since it cannot be
+ * calculated for an arbitrary quadric surface.
+ */
+auto NativeModel::getSurfaceArea( const EntityId surface_id ) const -> Area
+{
+  // Make sure that the surface exists
+  testPrecondition( this->doesSurfaceExist( surface_id ) );
+
+  const Area area = d_surfaces[this->getSurfaceIndex( surface_id )].getArea();
+
+  TEST_FOR_EXCEPTION( area <= Utility::QuantityTraits<Area>::zero(),
+                      InvalidNativeGeometry,
+                      "The area of surface " << surface_id << " has not been "
+                      "set!" );
+
+  return area;
+}
+
+// Check if the surface is a reflecting surface
+bool NativeModel::isReflectingSurface( const EntityId surface_id ) const
+{
+  // Make sure that the surface exists
+  testPrecondition( this->doesSurfaceExist( surface_id ) );
+
+  return d_surfaces[this->getSurfaceIndex( surface_id )].isReflecting();
+}
+
+// Create a raw, heap-allocated navigator
+NativeNavigator* NativeModel::createNavigatorAdvanced(
+    const Navigator::AdvanceCompleteCallback& advance_complete_callback ) const
+{
+  return new NativeNavigator( this->shared_from_this(),
+                              advance_complete_callback );
+}
+
+// Create a raw, heap-allocated navigator (no callback)
+NativeNavigator* NativeModel::createNavigatorAdvanced() const
+{
+  return new NativeNavigator( this->shared_from_this() );
+}
+
+// Check if the model has been initialized
+bool NativeModel::isInitialized() const
+{
+  return true;
+}
+
+// Initialize the model just-in-time
+void NativeModel::initializeJustInTime()
+{ /* ... */ }
+
+} // end Geometry namespace
+
+EXPLICIT_CLASS_SAVE_LOAD_INST( Geometry::NativeModel );
+BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT( NativeModel, Geometry );
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeModel.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,258 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeModel.hpp
+//! \author Alex Robinson
+//! \brief  The native CSG geometry model class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_MODEL_HPP
+#define GEOMETRY_NATIVE_MODEL_HPP
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "Geometry_NativeSurface.hpp"
+#include "Geometry_NativeCell.hpp"
+#include "Geometry_NativeNavigator.hpp"
+#include "Geometry_AdvancedModel.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_Vector.hpp"
+
+namespace Geometry{
+
+/*! The native CSG model
+ *
+ * \details The model is built from quadric surfaces and cells defined by
+ * boolean combinations of the surface half-spaces. Rays are traced
+ * analytically. Only the surfaces that bound the current cell are tested
+ * when a ray is fired and only the cells that share the crossed surface are
+ * tested when a boundary is crossed. Cell bounding boxes are used to cull
+ * point-in-cell tests. The model is not modified after construction and can
+ * be shared by all navigators.
+ */
+class NativeModel : public AdvancedModel,
+                    public std::enable_shared_from_this<NativeModel>
+{
+
+public:
+
+  //! The surface array type
+  typedef std::vector<NativeSurface> SurfaceArray;
+
+  //! The cell array type
+  typedef std::vector<NativeCell> CellArray;
+
+  //! Constructor
+  NativeModel( const std::string& name,
+               const SurfaceArray& surfaces,
+               const CellArray& cells );
+
+  //! Destructor
+  ~NativeModel()
+  { /* ... */ }
+
+  //! Get the model name
+  std::string getName() const override;
+
+  //! Check if the model has cell estimator data
+  bool hasCellEstimatorData() const override;
+
+  //! Get the material ids
+  void getMaterialIds( MaterialIdSet& material_ids ) const override;
+
+  //! Get the cells
+  void getCells( CellIdSet& cell_set,
+                 const bool include_void_cells,
+                 const bool include_termination_cells ) const override;
+
+  //! Get the cell material ids
+  void getCellMaterialIds( CellIdMatIdMap& cell_id_mat_id_map ) const override;
+
+  //! Get the cell densities
+  void getCellDensities( CellIdDensityMap& cell_density_map ) const override;
+
+  //! Get the cell estimator data
+  void getCellEstimatorData(
+           CellEstimatorIdDataMap& cell_estimator_id_data_map ) const override;
+
+  //! Check if a cell exists
+  bool doesCellExist( const EntityId cell_id ) const override;
+
+  //! Check if the cell is a termination cell
+  bool isTerminationCell( const EntityId cell_id ) const override;
+
+  //! Check if a cell is void
+  bool isVoidCell( const EntityId cell_id ) const override;
+
+  //! Get the cell volume
+  Volume getCellVolume( const EntityId cell_id ) const override;
+
+  //! Check if the model has surface estimator data
+  bool hasSurfaceEstimatorData() const override;
+
+  //! Get the surfaces
+  void getSurfaces( SurfaceIdSet& surface_set ) const override;
+
+  //! Get the surface estimator data
+  void getSurfaceEstimatorData( SurfaceEstimatorIdDataMap& surface_estimator_id_data_map ) const override;
+
+  //! Check if the surface exists
+  bool doesSurfaceExist( const EntityId surface_id ) const override;
+
+  //! Get the surface area
+  Area getSurfaceArea( const EntityId surface_id ) const override;
+
+  //! Check if the surface is a reflecting surface
+  bool isReflectingSurface( const EntityId surface_id ) const override;
+
+  //! Create a raw, heap-allocated navigator
+  NativeNavigator* createNavigatorAdvanced(
+                                    const Navigator::AdvanceCompleteCallback&
+                                    advance_complete_callback ) const override;
+
+  //! Create a raw, heap-allocated navigator (no callback)
+  NativeNavigator* createNavigatorAdvanced() const override;
+
+  //! Check if the model has been initialized
+  bool isInitialized() const final override;
+
+protected:
+
+  //! Initialize the model just-in-time
+  void initializeJustInTime() final override;
+
+private:
+
+  // The cell data
+  struct CellData
+  {
+    // The zones (surface index, sense)
+    std::vector<std::vector<std::pair<size_t,NativeSurface::Sense> > > zones;
+
+    // The indices of the surfaces that bound the cell
+    std::vector<size_t> surface_indices;
+
+    // The lower bounds of the cell bounding box
+    double lower_bounds[3];
+
+    // The upper bounds of the cell bounding box
+    double upper_bounds[3];
+  };
+
+  // Default constructor
+  NativeModel();
+
+  // Initialize the model
+  void initialize();
+
+  // Construct the cell data
+  void constructCellData();
+
+  // Get the surface index
+  size_t getSurfaceIndex( const EntityId surface_id ) const;
+
+  // Get the cell index
+  size_t getCellIndex( const EntityId cell_id ) const;
+
+  // Check if a point is inside of a cell
+  bool isPointInCell( const size_t cell_index,
+                      const double position[3],
+                      const double direction[3] ) const;
+
+  // Save the model to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the model from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // Declare the native navigator as a friend
+  friend class NativeNavigator;
+
+  // The bounding box tolerance (cm)
+  static const double s_bounding_box_tol;
+
+  // The model name
+  std::string d_name;
+
+  // The surfaces
+  SurfaceArray d_surfaces;
+
+  // The cells
+  CellArray d_cells;
+
+  // The surface id index map
+  std::unordered_map<EntityId,size_t> d_surface_id_index_map;
+
+  // The cell id index map
+  std::unordered_map<EntityId,size_t> d_cell_id_index_map;
+
+  // The cell data
+  std::vector<CellData> d_cell_data;
+
+  // The cells that are bound by each surface
+  std::vector<std::vector<size_t> > d_surface_cell_indices;
+};
+
+// Save the model to an archive
+template<typename Archive>
+void NativeModel::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class first
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( AdvancedModel );
+
+  // Save the local member data - all other data will be reinitialized
+  ar & BOOST_SERIALIZATION_NVP( d_name );
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_cells );
+}
+
+// Load the model from an archive
+template<typename Archive>
+void NativeModel::load( Archive& ar, const unsigned version )
+{
+  // Load the base class first
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( AdvancedModel );
+
+  // Load the local member data
+  ar & BOOST_SERIALIZATION_NVP( d_name );
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_cells );
+
+  this->initialize();
+}
+
+//! The invalid native geometry error
+class InvalidNativeGeometry : public std::runtime_error
+{
+
+public:
+
+  InvalidNativeGeometry( const std::string& what_arg )
+    : std::runtime_error( what_arg )
+  { /* ... */ }
+};
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( NativeModel, Geometry, 0 );
+BOOST_SERIALIZATION_ENABLE_SHARED_FROM_THIS( Geometry::NativeModel );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( NativeModel, Geometry );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Geometry, NativeModel );
+
+#endif // end GEOMETRY_NATIVE_MODEL_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeModel.hpp
+//---------------------------------------------------------------------------//
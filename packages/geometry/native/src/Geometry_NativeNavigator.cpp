@@ -0,0 +1,479 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeNavigator.cpp
+//! \author Alex Robinson
+//! \brief  The native CSG navigator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_NativeNavigator.hpp"
+#include "Geometry_NativeModel.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const size_t NativeNavigator::s_invalid_index =
+  std::numeric_limits<size_t>::max();
+
+// Constructor
+NativeNavigator::NativeNavigator(
+          const std::shared_ptr<const NativeModel>& native_model,
+          const Navigator::AdvanceCompleteCallback& advance_complete_callback )
+  : Navigator( advance_complete_callback ),
+    d_native_model( native_model ),
+    d_position{ 0.0, 0.0, 0.0 },
+    d_direction{ 0.0, 0.0, 1.0 },
+    d_cell_index( s_invalid_index ),
+    d_intersection_surface_index( s_invalid_index ),
+    d_distance_to_intersection( 0.0 )
+{
+  // Make sure that the model is valid
+  testPrecondition( native_model.get() );
+}
+
+// Copy constructor
+/*! \details This constructor should only be used by the clone method.
+ */
+NativeNavigator::NativeNavigator( const NativeNavigator& other )
+  : Navigator( other ),
+    d_native_model( other.d_native_model ),
+    d_position{ other.d_position[0], other.d_position[1], other.d_position[2] },
+    d_direction{ other.d_direction[0], other.d_direction[1], other.d_direction[2] },
+    d_cell_index( other.d_cell_index ),
+    d_intersection_surface_index( other.d_intersection_surface_index ),
+    d_distance_to_intersection( other.d_distance_to_intersection )
+{ /* ... */ }
+
+// Get the point location w.r.t. a given cell
+/*! \details The direction will be used to determine the location of a point
+ * that is on the cell boundary.
+ */
+PointLocation NativeNavigator::getPointLocation(
+                                       const Length position[3],
+                                       const double direction[3],
+                                       const EntityId cell_id ) const
+{
+  // Make sure that the cell exists
+  testPrecondition( d_native_model->doesCellExist( cell_id ) );
+
+  if( d_native_model->isPointInCell( d_native_model->getCellIndex( cell_id ),
+                                     Utility::reinterpretAsRaw( position ),
+                                     direction ) )
+    return POINT_INSIDE_CELL;
+  else
+    return POINT_OUTSIDE_CELL;
+}
+
+// Get the surface normal at a point on the surface
+/*! \details The dot product of the normal and the direction will be
+ * positive defined.
+ */
+void NativeNavigator::getSurfaceNormal( const EntityId surface_id,
+                                        const Length position[3],
+                                        const double direction[3],
+                                        double normal[3] ) const
+{
+  // Make sure that the surface exists
+  testPrecondition( d_native_model->doesSurfaceExist( surface_id ) );
+
+  const NativeSurface& surface =
+    d_native_model->d_surfaces[d_native_model->getSurfaceIndex( surface_id )];
+
+  surface.getUnitNormal( Utility::reinterpretAsRaw( position ), normal );
+
+  if( normal[0]*direction[0] + normal[1]*direction[1] +
+      normal[2]*direction[2] < 0.0 )
+  {
+    normal[0] = -normal[0];
+    normal[1] = -normal[1];
+    normal[2] = -normal[2];
+  }
+}
+
+// Find the cell that contains a given ray
+auto NativeNavigator::findCellContainingRay( const Length position[3],
+                                             const double direction[3],
+                                             CellIdSet& found_cell_cache ) const
+  -> EntityId
+{
+  // Test the cells in the cache first
+  CellIdSet::const_iterator cell_cache_it, cell_cache_end;
+  cell_cache_it = found_cell_cache.begin();
+  cell_cache_end = found_cell_cache.end();
+
+  while( cell_cache_it != cell_cache_end )
+  {
+    PointLocation test_point_location =
+      this->getPointLocation( position, direction, *cell_cache_it );
+
+    if( test_point_location == POINT_INSIDE_CELL )
+      return *cell_cache_it;
+
+    ++cell_cache_it;
+  }
+
+  // Check all other cells
+  EntityId found_cell =
+    this->findCellContainingRay( position, direction );
+
+  // Add the new cell to the cache
+  found_cell_cache.insert( found_cell );
+
+  return found_cell;
+}
+
+// Find the cell that contains the ray
+auto NativeNavigator::findCellContainingRay( const Length position[3],
+                                             const double direction[3] ) const
+  -> EntityId
+{
+  const size_t cell_index =
+    this->findCellIndexContainingRay( Utility::reinterpretAsRaw( position ),
+                                      direction );
+
+  return d_native_model->d_cells[cell_index].getId();
+}
+
+// Find the index of the cell that contains the ray
+size_t NativeNavigator::findCellIndexContainingRay(
+                                          const double position[3],
+                                          const double direction[3] ) const
+{
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( direction ) );
+
+  for( size_t i = 0; i < d_native_model->d_cells.size(); ++i )
+  {
+    if( d_native_model->isPointInCell( i, position, direction ) )
+      return i;
+  }
+
+  THROW_EXCEPTION( GeometryError,
+                   "Could not find a cell that contains the requested ray! "
+                   "Here are the details...\n"
+                   "  Position: "
+                   << this->arrayToString( position ) << "\n"
+                   "  Direction: "
+                   << this->arrayToString( direction ) );
+}
+
+// Check if the internal ray is set
+bool NativeNavigator::isStateSet() const
+{
+  return d_cell_index != s_invalid_index;
+}
+
+// Set the internal ray with unknown starting cell
+void NativeNavigator::setState( const Length x_position,
+                                const Length y_position,
+                                const Length z_position,
+                                const double x_direction,
+                                const double y_direction,
+                                const double z_direction )
+{
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
+
+  d_position[0] = Utility::getRawQuantity( x_position );
+  d_position[1] = Utility::getRawQuantity( y_position );
+  d_position[2] = Utility::getRawQuantity( z_position );
+
+  d_direction[0] = x_direction;
+  d_direction[1] = y_direction;
+  d_direction[2] = z_direction;
+
+  d_cell_index = this->findCellIndexContainingRay( d_position, d_direction );
+
+  d_intersection_surface_index = s_invalid_index;
+}
+
+// Set the internal ray with known starting cell
+void NativeNavigator::setState( const Length x_position,
+                                const Length y_position,
+                                const Length z_position,
+                                const double x_direction,
+                                const double y_direction,
+                                const double z_direction,
+                                const EntityId current_cell )
+{
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
+  // Make sure that the cell exists
+  testPrecondition( d_native_model->doesCellExist( current_cell ) );
+
+  d_position[0] = Utility::getRawQuantity( x_position );
+  d_position[1] = Utility::getRawQuantity( y_position );
+  d_position[2] = Utility::getRawQuantity( z_position );
+
+  d_direction[0] = x_direction;
+  d_direction[1] = y_direction;
+  d_direction[2] = z_direction;
+
+  d_cell_index = d_native_model->getCellIndex( current_cell );
+
+  d_intersection_surface_index = s_invalid_index;
+}
+
+// Get the internal ray position
+auto NativeNavigator::getPosition() const -> const Length*
+{
+  return Utility::reinterpretAsQuantity<Length>( d_position );
+}
+
+// Get the internal ray direction
+const double* NativeNavigator::getDirection() const
+{
+  return d_direction;
+}
+
+// Get the cell containing the internal ray position
+auto NativeNavigator::getCurrentCell() const -> EntityId
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  return d_native_model->d_cells[d_cell_index].getId();
+}
+
+// Get the distance from the internal ray pos. to the nearest boundary in all directions
+/*! \details The distance to each surface of the current cell is estimated
+ * from the surface function value and gradient (see
+ * Geometry::NativeSurface::getApproximateDistance).
+ */
+auto NativeNavigator::getDistanceToClosestBoundary() -> Length
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  const std::vector<size_t>& surface_indices =
+    d_native_model->d_cell_data[d_cell_index].surface_indices;
+
+  double distance = std::numeric_limits<double>::infinity();
+
+  for( size_t i = 0; i < surface_indices.size(); ++i )
+  {
+    distance = std::min( distance,
+                         d_native_model->d_surfaces[surface_indices[i]].getApproximateDistance( d_position ) );
+  }
+
+  return Length::from_value( distance );
+}
+
+// Get the distance from the internal ray pos. to the nearest boundary
+auto NativeNavigator::fireRay( EntityId* surface_hit ) -> Length
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  if( d_intersection_surface_index == s_invalid_index )
+    this->updateIntersection();
+
+  if( surface_hit != NULL )
+  {
+    *surface_hit =
+      d_native_model->d_surfaces[d_intersection_surface_index].getId();
+  }
+
+  return Length::from_value( d_distance_to_intersection );
+}
+
+// Update the intersection data of the internal ray
+/*! \details Only the surfaces that bound the current cell will be tested.
+ */
+void NativeNavigator::updateIntersection()
+{
+  const std::vector<size_t>& surface_indices =
+    d_native_model->d_cell_data[d_cell_index].surface_indices;
+
+  d_distance_to_intersection = std::numeric_limits<double>::infinity();
+  d_intersection_surface_index = s_invalid_index;
+
+  for( size_t i = 0; i < surface_indices.size(); ++i )
+  {
+    const double distance =
+      d_native_model->d_surfaces[surface_indices[i]].getDistance( d_position,
+                                                                  d_direction );
+
+    if( distance < d_distance_to_intersection )
+    {
+      d_distance_to_intersection = distance;
+      d_intersection_surface_index = surface_indices[i];
+    }
+  }
+
+  TEST_FOR_EXCEPTION( d_intersection_surface_index == s_invalid_index,
+                      GeometryError,
+                      "The ray does not intersect any of the surfaces of "
+                      "cell " << this->getCurrentCell() << "! Here are the "
+                      "details...\n"
+                      "  Position: "
+                      << this->arrayToString( d_position ) << "\n"
+                      "  Direction: "
+                      << this->arrayToString( d_direction ) );
+}
+
+// Change the internal ray direction (without changing its location)
+void NativeNavigator::changeDirection( const double x_direction,
+                                       const double y_direction,
+                                       const double z_direction )
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
+
+  d_direction[0] = x_direction;
+  d_direction[1] = y_direction;
+  d_direction[2] = z_direction;
+
+  d_intersection_surface_index = s_invalid_index;
+}
+
+// Advance the internal ray to the next boundary
+/*! \details Only the cells that are bound by the intersection surface will
+ * be tested when searching for the next cell. All cells will be tested if
+ * none of them contain the ray (e.g. if the cell definitions overlap).
+ */
+bool NativeNavigator::advanceToCellBoundaryImpl( double* surface_normal,
+                                                 Length& distance_traveled )
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  if( d_intersection_surface_index == s_invalid_index )
+    this->updateIntersection();
+
+  const NativeSurface& intersection_surface =
+    d_native_model->d_surfaces[d_intersection_surface_index];
+
+  // Move the ray to the intersection surface
+  d_position[0] += d_distance_to_intersection*d_direction[0];
+  d_position[1] += d_distance_to_intersection*d_direction[1];
+  d_position[2] += d_distance_to_intersection*d_direction[2];
+
+  distance_traveled = Length::from_value( d_distance_to_intersection );
+
+  double local_surface_normal[3];
+
+  this->getSurfaceNormal( intersection_surface.getId(),
+                          this->getPosition(),
+                          d_direction,
+                          local_surface_normal );
+
+  if( surface_normal != NULL )
+  {
+    surface_normal[0] = local_surface_normal[0];
+    surface_normal[1] = local_surface_normal[1];
+    surface_normal[2] = local_surface_normal[2];
+  }
+
+  bool reflecting_boundary = false;
+
+  // Reflect the ray if a reflecting surface is encountered
+  if( intersection_surface.isReflecting() )
+  {
+    double reflected_direction[3];
+
+    Utility::reflectUnitVector( d_direction,
+                                local_surface_normal,
+                                reflected_direction );
+
+    d_direction[0] = reflected_direction[0];
+    d_direction[1] = reflected_direction[1];
+    d_direction[2] = reflected_direction[2];
+
+    reflecting_boundary = true;
+  }
+  // Pass into the next cell if a normal surface is encountered
+  else
+  {
+    const std::vector<size_t>& candidate_cell_indices =
+      d_native_model->d_surface_cell_indices[d_intersection_surface_index];
+
+    size_t next_cell_index = s_invalid_index;
+
+    for( size_t i = 0; i < candidate_cell_indices.size(); ++i )
+    {
+      if( candidate_cell_indices[i] != d_cell_index &&
+          d_native_model->isPointInCell( candidate_cell_indices[i],
+                                         d_position,
+                                         d_direction ) )
+      {
+        next_cell_index = candidate_cell_indices[i];
+
+        break;
+      }
+    }
+
+    if( next_cell_index == s_invalid_index )
+    {
+      next_cell_index =
+        this->findCellIndexContainingRay( d_position, d_direction );
+    }
+
+    d_cell_index = next_cell_index;
+  }
+
+  d_intersection_surface_index = s_invalid_index;
+
+  return reflecting_boundary;
+}
+
+// Advance the internal ray a substep
+/*! \details The substep distance must be less than the distance to the
+ * intersection surface.
+ */
+void NativeNavigator::advanceBySubstepImpl( const Length substep_distance )
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+  // Make sure that the substep distance is valid
+  testPrecondition( substep_distance >= 0.0*boost::units::cgs::centimeter );
+
+  const double raw_substep_distance =
+    Utility::getRawQuantity( substep_distance );
+
+  d_position[0] += raw_substep_distance*d_direction[0];
+  d_position[1] += raw_substep_distance*d_direction[1];
+  d_position[2] += raw_substep_distance*d_direction[2];
+
+  if( d_intersection_surface_index != s_invalid_index )
+    d_distance_to_intersection -= raw_substep_distance;
+}
+
+// Clone the navigator
+NativeNavigator* NativeNavigator::clone( const AdvanceCompleteCallback& advance_complete_callback ) const
+{
+  NativeNavigator* clone = new NativeNavigator( d_native_model,
+                                                advance_complete_callback );
+
+  // Copy the current position, direction and cell
+  if( this->isStateSet() )
+  {
+    clone->setState( this->getPosition(),
+                     this->getDirection(),
+                     this->getCurrentCell() );
+  }
+
+  return clone;
+}
+
+// Clone the navigator
+NativeNavigator* NativeNavigator::clone() const
+{
+  return new NativeNavigator( *this );
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeNavigator.cpp
+//---------------------------------------------------------------------------//
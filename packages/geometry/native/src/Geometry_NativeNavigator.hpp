@@ -0,0 +1,160 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeNavigator.hpp
+//! \author Alex Robinson
+//! \brief  The native CSG navigator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_NAVIGATOR_HPP
+#define GEOMETRY_NATIVE_NAVIGATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "Geometry_Navigator.hpp"
+
+namespace Geometry{
+
+// Forward declare the NativeModel
+class NativeModel;
+
+//! The native CSG navigator
+class NativeNavigator : public Navigator
+{
+
+public:
+
+  //! Constructor
+  NativeNavigator(
+          const std::shared_ptr<const NativeModel>& native_model,
+          const Navigator::AdvanceCompleteCallback& advance_complete_callback =
+          Navigator::AdvanceCompleteCallback() );
+
+  //! Destructor
+  ~NativeNavigator()
+  { /* ... */ }
+
+  //! Get the point location w.r.t. a given cell
+  PointLocation getPointLocation(
+                             const Length position[3],
+                             const double direction[3],
+                             const EntityId cell_id ) const override;
+
+  //! Get the surface normal at a point on the surface
+  void getSurfaceNormal( const EntityId surface_id,
+                         const Length position[3],
+                         const double direction[3],
+                         double normal[3] ) const override;
+
+  //! Find the cell that contains a given ray
+  EntityId findCellContainingRay(
+                                  const Length position[3],
+                                  const double direction[3],
+                                  CellIdSet& found_cell_cache ) const override;
+
+  //! Find the cell that contains the ray
+  EntityId findCellContainingRay(
+                                    const Length position[3],
+                                    const double direction[3] ) const override;
+
+  //! Check if the internal ray is set
+  bool isStateSet() const override;
+
+  //! Set the internal ray with unknown starting cell
+  void setState( const Length x_position,
+                 const Length y_position,
+                 const Length z_position,
+                 const double x_direction,
+                 const double y_direction,
+                 const double z_direction ) override;
+
+  //! Set the internal ray with known starting cell
+  void setState( const Length x_position,
+                 const Length y_position,
+                 const Length z_position,
+                 const double x_direction,
+                 const double y_direction,
+                 const double z_direction,
+                 const EntityId current_cell ) override;
+
+  //! Set the internal ray state (base class overloads)
+  using Navigator::setState;
+
+  //! Get the internal ray position
+  const Length* getPosition() const override;
+
+  //! Get the internal ray direction
+  const double* getDirection() const override;
+
+  //! Get the cell containing the internal ray position
+  EntityId getCurrentCell() const override;
+
+  //! Get the distance from the internal ray pos. to the nearest boundary in all directions
+  Length getDistanceToClosestBoundary() override;
+
+  //! Get the distance from the internal ray pos. to the nearest boundary
+  Length fireRay( EntityId* surface_hit ) override;
+
+  //! Change the internal ray direction (without changing its location)
+  void changeDirection( const double x_direction,
+                        const double y_direction,
+                        const double z_direction ) override;
+
+  //! Clone the navigator
+  NativeNavigator* clone( const AdvanceCompleteCallback& advance_complete_callback ) const override;
+
+  //! Clone the navigator
+  NativeNavigator* clone() const override;
+
+protected:
+
+  //! Copy constructor
+  NativeNavigator( const NativeNavigator& other );
+
+  //! Advance the internal ray to the next boundary
+  bool advanceToCellBoundaryImpl( double* surface_normal,
+                                  Length& distance_traveled ) override;
+
+  //! Advance the internal ray a substep
+  void advanceBySubstepImpl( const Length substep_distance ) override;
+
+private:
+
+  // Find the index of the cell that contains the ray
+  size_t findCellIndexContainingRay( const double position[3],
+                                     const double direction[3] ) const;
+
+  // Update the intersection data of the internal ray
+  void updateIntersection();
+
+  // The invalid index
+  static const size_t s_invalid_index;
+
+  // The native model
+  std::shared_ptr<const NativeModel> d_native_model;
+
+  // The internal ray position (cm)
+  double d_position[3];
+
+  // The internal ray direction
+  double d_direction[3];
+
+  // The index of the cell that contains the internal ray
+  size_t d_cell_index;
+
+  // The index of the surface that the internal ray will intersect
+  size_t d_intersection_surface_index;
+
+  // The distance to the intersection surface (cm)
+  double d_distance_to_intersection;
+};
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_NATIVE_NAVIGATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeNavigator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,398 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeSurface.cpp
+//! \author Alex Robinson
+//! \brief  The native quadric surface class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // Must be included first
+#include "Geometry_NativeSurface.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const double NativeSurface::s_on_surface_tol = 1e-9;
+
+// Default constructor
+NativeSurface::NativeSurface()
+  : d_id( Navigator::invalidSurfaceId() ),
+    d_reflecting( false ),
+    d_area( Utility::QuantityTraits<Area>::zero() )
+{
+  for( size_t i = 0; i < 10; ++i )
+    d_coefficients[i] = 0.0;
+}
+
+// General surface constructor (ax^2+by^2+cz^2+dxy+eyz+fxz+gx+hy+jz+k = 0)
+NativeSurface::NativeSurface( const EntityId id,
+                              const double a,
+                              const double b,
+                              const double c,
+                              const double d,
+                              const double e,
+                              const double f,
+                              const double g,
+                              const double h,
+                              const double j,
+                              const double k )
+  : d_id( id ),
+    d_coefficients{ a, b, c, d, e, f, g, h, j, k },
+    d_reflecting( false ),
+    d_area( Utility::QuantityTraits<Area>::zero() )
+{
+  // Make sure that the surface is valid
+  testPrecondition( a != 0.0 || b != 0.0 || c != 0.0 ||
+                    d != 0.0 || e != 0.0 || f != 0.0 ||
+                    g != 0.0 || h != 0.0 || j != 0.0 );
+}
+
+// Symmetric surface constructor (ax^2+by^2+cz^2+gx+hy+jz+k = 0)
+NativeSurface::NativeSurface( const EntityId id,
+                              const double a,
+                              const double b,
+                              const double c,
+                              const double g,
+                              const double h,
+                              const double j,
+                              const double k )
+  : NativeSurface( id, a, b, c, 0.0, 0.0, 0.0, g, h, j, k )
+{ /* ... */ }
+
+// Planar surface constructor (gx+hy+jz+k = 0)
+NativeSurface::NativeSurface( const EntityId id,
+                              const double g,
+                              const double h,
+                              const double j,
+                              const double k )
+  : NativeSurface( id, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, g, h, j, k )
+{ /* ... */ }
+
+// Return the surface id
+auto NativeSurface::getId() const -> EntityId
+{
+  return d_id;
+}
+
+// Check if the surface is planar
+bool NativeSurface::isPlanar() const
+{
+  return d_coefficients[0] == 0.0 && d_coefficients[1] == 0.0 &&
+    d_coefficients[2] == 0.0 && d_coefficients[3] == 0.0 &&
+    d_coefficients[4] == 0.0 && d_coefficients[5] == 0.0;
+}
+
+// Set the surface as a reflecting surface
+void NativeSurface::setReflecting( const bool reflecting )
+{
+  d_reflecting = reflecting;
+}
+
+// Check if the surface is a reflecting surface
+bool NativeSurface::isReflecting() const
+{
+  return d_reflecting;
+}
+
+// Set the surface area
+/*! \details The area of a quadric surface cannot be calculated in general.
+ * It only needs to be set if the surface is used by a surface estimator.
+ */
+void NativeSurface::setArea( const Area area )
+{
+  // Make sure that the area is valid
+  testPrecondition( area > Utility::QuantityTraits<Area>::zero() );
+
+  d_area = area;
+}
+
+// Get the surface area (zero if it has not been set)
+auto NativeSurface::getArea() const -> Area
+{
+  return d_area;
+}
+
+// Evaluate the surface function at a point
+double NativeSurface::evaluate( const double position[3] ) const
+{
+  const double& x = position[0];
+  const double& y = position[1];
+  const double& z = position[2];
+
+  return (d_coefficients[0]*x + d_coefficients[3]*y + d_coefficients[5]*z +
+          d_coefficients[6])*x +
+    (d_coefficients[1]*y + d_coefficients[4]*z + d_coefficients[7])*y +
+    (d_coefficients[2]*z + d_coefficients[8])*z + d_coefficients[9];
+}
+
+// Evaluate the surface function gradient at a point
+void NativeSurface::evaluateGradient( const double position[3],
+                                      double gradient[3] ) const
+{
+  const double& x = position[0];
+  const double& y = position[1];
+  const double& z = position[2];
+
+  gradient[0] = 2*d_coefficients[0]*x + d_coefficients[3]*y +
+    d_coefficients[5]*z + d_coefficients[6];
+
+  gradient[1] = 2*d_coefficients[1]*y + d_coefficients[3]*x +
+    d_coefficients[4]*z + d_coefficients[7];
+
+  gradient[2] = 2*d_coefficients[2]*z + d_coefficients[4]*y +
+    d_coefficients[5]*x + d_coefficients[8];
+}
+
+// Check if a point is on the surface
+bool NativeSurface::isOn( const double position[3] ) const
+{
+  return this->getApproximateDistance( position ) < s_on_surface_tol;
+}
+
+// Get the sense of a point (the direction is used on the surface)
+/*! \details If the point is on the surface the sense of the region that the
+ * direction points into will be returned.
+ */
+auto NativeSurface::getSense( const double position[3],
+                              const double direction[3] ) const -> Sense
+{
+  if( this->isOn( position ) )
+  {
+    double gradient[3];
+
+    this->evaluateGradient( position, gradient );
+
+    if( gradient[0]*direction[0] + gradient[1]*direction[1] +
+        gradient[2]*direction[2] >= 0.0 )
+      return POSITIVE_SENSE;
+    else
+      return NEGATIVE_SENSE;
+  }
+  else
+  {
+    if( this->evaluate( position ) > 0.0 )
+      return POSITIVE_SENSE;
+    else
+      return NEGATIVE_SENSE;
+  }
+}
+
+// Get the unit normal at a point (pointing toward the positive sense)
+void NativeSurface::getUnitNormal( const double position[3],
+                                   double normal[3] ) const
+{
+  this->evaluateGradient( position, normal );
+
+  Utility::normalizeVector( normal );
+}
+
+// Get the distance along a ray to the surface (inf if not hit)
+/*! \details If the point is on the surface the intersection at the point
+ * will be ignored.
+ */
+double NativeSurface::getDistance( const double position[3],
+                                   const double direction[3] ) const
+{
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( direction ) );
+
+  const double& u = direction[0];
+  const double& v = direction[1];
+  const double& w = direction[2];
+
+  // Calculate the coefficients of the ray-surface quadratic equation
+  const double quad_coeff =
+    (d_coefficients[0]*u + d_coefficients[3]*v + d_coefficients[5]*w)*u +
+    (d_coefficients[1]*v + d_coefficients[4]*w)*v + d_coefficients[2]*w*w;
+
+  double gradient[3];
+
+  this->evaluateGradient( position, gradient );
+
+  const double linear_coeff =
+    gradient[0]*u + gradient[1]*v + gradient[2]*w;
+
+  const double inf = std::numeric_limits<double>::infinity();
+
+  // Ignore the intersection at the current point
+  if( this->isOn( position ) )
+  {
+    if( quad_coeff != 0.0 )
+    {
+      const double distance = -linear_coeff/quad_coeff;
+
+      return distance > 0.0 ? distance : inf;
+    }
+    else
+      return inf;
+  }
+
+  const double const_coeff = this->evaluate( position );
+
+  // Linear equation
+  if( quad_coeff == 0.0 )
+  {
+    if( linear_coeff != 0.0 )
+    {
+      const double distance = -const_coeff/linear_coeff;
+
+      return distance > 0.0 ? distance : inf;
+    }
+    else
+      return inf;
+  }
+
+  // Quadratic equation
+  const double discriminant =
+    linear_coeff*linear_coeff - 4*quad_coeff*const_coeff;
+
+  if( discriminant < 0.0 )
+    return inf;
+
+  const double q = -0.5*(linear_coeff +
+                         std::copysign( std::sqrt( discriminant ), linear_coeff ) );
+
+  double distance_1 = q/quad_coeff;
+  double distance_2 = (q != 0.0 ? const_coeff/q : distance_1);
+
+  if( distance_1 > distance_2 )
+    std::swap( distance_1, distance_2 );
+
+  if( distance_1 > 0.0 )
+    return distance_1;
+  else if( distance_2 > 0.0 )
+    return distance_2;
+  else
+    return inf;
+}
+
+// Get the approximate distance from a point to the surface
+/*! \details The distance is estimated by dividing the surface function value
+ * by the magnitude of the gradient. The estimate is exact for planes and
+ * becomes exact for all other surfaces as the point approaches the surface.
+ */
+double NativeSurface::getApproximateDistance( const double position[3] ) const
+{
+  double gradient[3];
+
+  this->evaluateGradient( position, gradient );
+
+  const double gradient_magnitude = Utility::vectorMagnitude( gradient );
+
+  const double function_value = std::fabs( this->evaluate( position ) );
+
+  if( gradient_magnitude > 0.0 )
+    return function_value/gradient_magnitude;
+  else
+    return function_value;
+}
+
+// Get the bounding box of the region with the requested sense
+/*! \details Bounds can only be calculated for the half-spaces of axis
+ * aligned planes and for the negative sense of quadrics without cross terms
+ * (spheres, ellipsoids and axis aligned cylinders). Infinite bounds will be
+ * returned for all other regions. If no finite bounds could be calculated
+ * false will be returned.
+ */
+bool NativeSurface::getBoundingBox( const Sense sense,
+                                    double lower_bounds[3],
+                                    double upper_bounds[3] ) const
+{
+  const double inf = std::numeric_limits<double>::infinity();
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    lower_bounds[i] = -inf;
+    upper_bounds[i] = inf;
+  }
+
+  if( this->isPlanar() )
+  {
+    size_t number_of_nonzero_linear_coeffs = 0;
+    size_t axis = 0;
+
+    for( size_t i = 0; i < 3; ++i )
+    {
+      if( d_coefficients[6+i] != 0.0 )
+      {
+        ++number_of_nonzero_linear_coeffs;
+        axis = i;
+      }
+    }
+
+    if( number_of_nonzero_linear_coeffs != 1 )
+      return false;
+
+    const double plane_location = -d_coefficients[9]/d_coefficients[6+axis];
+
+    // The negative sense is below the plane if the linear coeff is positive
+    if( (d_coefficients[6+axis] > 0.0) == (sense == NEGATIVE_SENSE) )
+      upper_bounds[axis] = plane_location;
+    else
+      lower_bounds[axis] = plane_location;
+
+    return true;
+  }
+  else
+  {
+    // Only the interior of quadrics without cross terms can be bounded
+    if( sense == POSITIVE_SENSE )
+      return false;
+
+    if( d_coefficients[3] != 0.0 || d_coefficients[4] != 0.0 ||
+        d_coefficients[5] != 0.0 )
+      return false;
+
+    double squared_radius = -d_coefficients[9];
+
+    for( size_t i = 0; i < 3; ++i )
+    {
+      if( d_coefficients[i] < 0.0 )
+        return false;
+      else if( d_coefficients[i] == 0.0 )
+      {
+        // The region is unbounded (e.g. a paraboloid)
+        if( d_coefficients[6+i] != 0.0 )
+          return false;
+      }
+      else
+      {
+        squared_radius +=
+          d_coefficients[6+i]*d_coefficients[6+i]/(4*d_coefficients[i]);
+      }
+    }
+
+    squared_radius = std::max( squared_radius, 0.0 );
+
+    for( size_t i = 0; i < 3; ++i )
+    {
+      if( d_coefficients[i] > 0.0 )
+      {
+        const double center = -d_coefficients[6+i]/(2*d_coefficients[i]);
+        const double half_width =
+          std::sqrt( squared_radius/d_coefficients[i] );
+
+        lower_bounds[i] = center - half_width;
+        upper_bounds[i] = center + half_width;
+      }
+    }
+
+    return true;
+  }
+}
+
+} // end Geometry namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( Geometry::NativeSurface );
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeSurface.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeSurface.hpp
+//! \author Alex Robinson
+//! \brief  The native quadric surface class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_SURFACE_HPP
+#define GEOMETRY_NATIVE_SURFACE_HPP
+
+// Boost Includes
+#include <boost/serialization/array_wrapper.hpp>
+
+// FRENSIE Includes
+#include "Geometry_AdvancedModel.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+
+namespace Geometry{
+
+/*! The native quadric surface class
+ *
+ * \details The surface is defined by the general quadric equation
+ * ax^2+by^2+cz^2+dxy+eyz+fxz+gx+hy+jz+k = 0. The positive sense of the
+ * surface is the region where the left hand side of the equation is
+ * positive. All lengths are in cm.
+ */
+class NativeSurface
+{
+
+public:
+
+  //! The surface id type
+  typedef Navigator::EntityId EntityId;
+
+  //! The area quantity
+  typedef AdvancedModel::Area Area;
+
+  //! The surface sense
+  enum Sense{
+    NEGATIVE_SENSE = -1,
+    POSITIVE_SENSE = 1
+  };
+
+  //! General surface constructor (ax^2+by^2+cz^2+dxy+eyz+fxz+gx+hy+jz+k = 0)
+  NativeSurface( const EntityId id,
+                 const double a,
+                 const double b,
+                 const double c,
+                 const double d,
+                 const double e,
+                 const double f,
+                 const double g,
+                 const double h,
+                 const double j,
+                 const double k );
+
+  //! Symmetric surface constructor (ax^2+by^2+cz^2+gx+hy+jz+k = 0)
+  NativeSurface( const EntityId id,
+                 const double a,
+                 const double b,
+                 const double c,
+                 const double g,
+                 const double h,
+                 const double j,
+                 const double k );
+
+  //! Planar surface constructor (gx+hy+jz+k = 0)
+  NativeSurface( const EntityId id,
+                 const double g,
+                 const double h,
+                 const double j,
+                 const double k );
+
+  //! Destructor
+  ~NativeSurface()
+  { /* ... */ }
+
+  //! Return the surface id
+  EntityId getId() const;
+
+  //! Check if the surface is planar
+  bool isPlanar() const;
+
+  //! Set the surface as a reflecting surface
+  void setReflecting( const bool reflecting = true );
+
+  //! Check if the surface is a reflecting surface
+  bool isReflecting() const;
+
+  //! Set the surface area
+  void setArea( const Area area );
+
+  //! Get the surface area (zero if it has not been set)
+  Area getArea() const;
+
+  //! Evaluate the surface function at a point
+  double evaluate( const double position[3] ) const;
+
+  //! Evaluate the surface function gradient at a point
+  void evaluateGradient( const double position[3], double gradient[3] ) const;
+
+  //! Check if a point is on the surface
+  bool isOn( const double position[3] ) const;
+
+  //! Get the sense of a point (the direction is used on the surface)
+  Sense getSense( const double position[3], const double direction[3] ) const;
+
+  //! Get the unit normal at a point (pointing toward the positive sense)
+  void getUnitNormal( const double position[3], double normal[3] ) const;
+
+  //! Get the distance along a ray to the surface (inf if not hit)
+  double getDistance( const double position[3],
+                      const double direction[3] ) const;
+
+  //! Get the approximate distance from a point to the surface
+  double getApproximateDistance( const double position[3] ) const;
+
+  //! Get the bounding box of the region with the requested sense
+  bool getBoundingBox( const Sense sense,
+                       double lower_bounds[3],
+                       double upper_bounds[3] ) const;
+
+private:
+
+  // Default constructor
+  NativeSurface();
+
+  // Serialize the surface
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The on surface tolerance (cm)
+  static const double s_on_surface_tol;
+
+  // The surface id
+  EntityId d_id;
+
+  // The surface coefficients (a,b,c,d,e,f,g,h,j,k)
+  double d_coefficients[10];
+
+  // The reflecting surface flag
+  bool d_reflecting;
+
+  // The surface area
+  Area d_area;
+};
+
+// Serialize the surface
+template<typename Archive>
+void NativeSurface::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_id );
+  ar & boost::serialization::make_nvp( "d_coefficients", boost::serialization::make_array( d_coefficients, 10 ) );
+  ar & BOOST_SERIALIZATION_NVP( d_reflecting );
+  ar & BOOST_SERIALIZATION_NVP( d_area );
+}
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( NativeSurface, Geometry, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( Geometry, NativeSurface );
+
+#endif // end GEOMETRY_NATIVE_SURFACE_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeSurface.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,292 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeModel.cpp
+//! \author Alex Robinson
+//! \brief  Native CSG model class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "Geometry_NativeModel.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Geometry::NativeModel> model;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the test model
+/*! \details The model consists of a sphere (r=2, cell 1) inside of a sphere
+ * (r=5) that is split in half by the x=0 plane (cells 2 and 3). The region
+ * outside of the outer sphere is the termination cell (cell 4).
+ */
+std::shared_ptr<const Geometry::NativeModel> createModel()
+{
+  Geometry::NativeModel::SurfaceArray surfaces;
+  surfaces.push_back( Geometry::NativeSurface( 1, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, -4.0 ) );
+  surfaces.push_back( Geometry::NativeSurface( 2, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, -25.0 ) );
+  surfaces.push_back( Geometry::NativeSurface( 3, 1.0, 0.0, 0.0, 0.0 ) );
+
+  surfaces[0].setArea( 16*Utility::PhysicalConstants::pi*Geometry::AdvancedModel::Area::unit_type() );
+
+  Geometry::NativeCell::ZoneArray zones( 1 );
+  Geometry::NativeModel::CellArray cells;
+
+  zones[0] = {{1, Geometry::NativeSurface::NEGATIVE_SENSE}};
+
+  cells.push_back( Geometry::NativeCell( 1, zones, 1, -1.0*Geometry::Model::DensityUnit() ) );
+  cells.back().setVolume( 32*Utility::PhysicalConstants::pi/3*Geometry::Model::Volume::unit_type() );
+
+  zones[0] = {{1, Geometry::NativeSurface::POSITIVE_SENSE},
+              {2, Geometry::NativeSurface::NEGATIVE_SENSE},
+              {3, Geometry::NativeSurface::NEGATIVE_SENSE}};
+
+  cells.push_back( Geometry::NativeCell( 2, zones, 2, 0.1*Geometry::Model::DensityUnit() ) );
+
+  zones[0] = {{1, Geometry::NativeSurface::POSITIVE_SENSE},
+              {2, Geometry::NativeSurface::NEGATIVE_SENSE},
+              {3, Geometry::NativeSurface::POSITIVE_SENSE}};
+
+  cells.push_back( Geometry::NativeCell( 3, zones ) );
+
+  zones[0] = {{2, Geometry::NativeSurface::POSITIVE_SENSE}};
+
+  cells.push_back( Geometry::NativeCell( 4, zones ) );
+  cells.back().setTerminationCell();
+
+  return std::make_shared<const Geometry::NativeModel>( "test", surfaces, cells );
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the model name can be returned
+FRENSIE_UNIT_TEST( NativeModel, getName )
+{
+  FRENSIE_CHECK_EQUAL( model->getName(), "test" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the model is initialized after construction
+FRENSIE_UNIT_TEST( NativeModel, isInitialized )
+{
+  FRENSIE_CHECK( model->isInitialized() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a model with duplicate ids cannot be constructed
+FRENSIE_UNIT_TEST( NativeModel, constructor_duplicate_ids )
+{
+  Geometry::NativeModel::SurfaceArray surfaces;
+  surfaces.push_back( Geometry::NativeSurface( 1, 1.0, 0.0, 0.0, 0.0 ) );
+  surfaces.push_back( Geometry::NativeSurface( 1, 0.0, 1.0, 0.0, 0.0 ) );
+
+  Geometry::NativeCell::ZoneArray zones( 1 );
+  zones[0] = {{1, Geometry::NativeSurface::NEGATIVE_SENSE}};
+
+  Geometry::NativeModel::CellArray cells;
+  cells.push_back( Geometry::NativeCell( 1, zones ) );
+
+  FRENSIE_CHECK_THROW( Geometry::NativeModel( "bad", surfaces, cells ),
+                       Geometry::InvalidNativeGeometry );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the model cells can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCells )
+{
+  Geometry::Model::CellIdSet cells;
+
+  model->getCells( cells, true, true );
+
+  FRENSIE_CHECK_EQUAL( cells.size(), 4 );
+
+  cells.clear();
+
+  model->getCells( cells, true, false );
+
+  FRENSIE_CHECK_EQUAL( cells.size(), 3 );
+  FRENSIE_CHECK( !cells.count( 4 ) );
+
+  cells.clear();
+
+  model->getCells( cells, false, false );
+
+  FRENSIE_CHECK_EQUAL( cells.size(), 2 );
+  FRENSIE_CHECK( cells.count( 1 ) );
+  FRENSIE_CHECK( cells.count( 2 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the material ids can be returned
+FRENSIE_UNIT_TEST( NativeModel, getMaterialIds )
+{
+  Geometry::Model::MaterialIdSet material_ids;
+
+  model->getMaterialIds( material_ids );
+
+  FRENSIE_CHECK_EQUAL( material_ids.size(), 2 );
+  FRENSIE_CHECK( material_ids.count( 1 ) );
+  FRENSIE_CHECK( material_ids.count( 2 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell material ids and densities can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCellMaterialIds_getCellDensities )
+{
+  Geometry::Model::CellIdMatIdMap cell_id_mat_id_map;
+
+  model->getCellMaterialIds( cell_id_mat_id_map );
+
+  FRENSIE_CHECK_EQUAL( cell_id_mat_id_map.size(), 2 );
+  FRENSIE_CHECK_EQUAL( cell_id_mat_id_map[1], 1 );
+  FRENSIE_CHECK_EQUAL( cell_id_mat_id_map[2], 2 );
+
+  Geometry::Model::CellIdDensityMap cell_density_map;
+
+  model->getCellDensities( cell_density_map );
+
+  FRENSIE_CHECK_EQUAL( cell_density_map.size(), 2 );
+  FRENSIE_CHECK_EQUAL( cell_density_map[1],
+                       -1.0*Geometry::Model::DensityUnit() );
+  FRENSIE_CHECK_EQUAL( cell_density_map[2],
+                       0.1*Geometry::Model::DensityUnit() );
+}
+
+//---------------------------------------------------------------------------//
+// Check the cell properties
+FRENSIE_UNIT_TEST( NativeModel, cell_properties )
+{
+  FRENSIE_CHECK( model->doesCellExist( 1 ) );
+  FRENSIE_CHECK( model->doesCellExist( 4 ) );
+  FRENSIE_CHECK( !model->doesCellExist( 5 ) );
+
+  FRENSIE_CHECK( !model->isTerminationCell( 1 ) );
+  FRENSIE_CHECK( model->isTerminationCell( 4 ) );
+
+  FRENSIE_CHECK( !model->isVoidCell( 1 ) );
+  FRENSIE_CHECK( model->isVoidCell( 3 ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getCellVolume( 1 ),
+                                   32*Utility::PhysicalConstants::pi/3*Geometry::Model::Volume::unit_type(),
+                                   1e-15 );
+  FRENSIE_CHECK_THROW( model->getCellVolume( 2 ),
+                       Geometry::InvalidNativeGeometry );
+}
+
+//---------------------------------------------------------------------------//
+// Check the surface properties
+FRENSIE_UNIT_TEST( NativeModel, surface_properties )
+{
+  Geometry::AdvancedModel::SurfaceIdSet surfaces;
+
+  model->getSurfaces( surfaces );
+
+  FRENSIE_CHECK_EQUAL( surfaces.size(), 3 );
+
+  FRENSIE_CHECK( model->doesSurfaceExist( 1 ) );
+  FRENSIE_CHECK( !model->doesSurfaceExist( 4 ) );
+
+  FRENSIE_CHECK( !model->isReflectingSurface( 2 ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getSurfaceArea( 1 ),
+                                   16*Utility::PhysicalConstants::pi*Geometry::AdvancedModel::Area::unit_type(),
+                                   1e-15 );
+  FRENSIE_CHECK_THROW( model->getSurfaceArea( 2 ),
+                       Geometry::InvalidNativeGeometry );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a navigator can be created
+FRENSIE_UNIT_TEST( NativeModel, createNavigator )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  FRENSIE_CHECK( navigator.get() != NULL );
+
+  navigator = model->createNavigator( [](const Geometry::Navigator::Length distance){ std::cout << "advanced " << distance << std::endl; } );
+
+  FRENSIE_CHECK( navigator.get() != NULL );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the model can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( NativeModel, archive, TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_native_model" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<const Geometry::Model> shared_model = model;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( shared_model ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived model
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<const Geometry::Model> shared_model;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( shared_model ) );
+  FRENSIE_CHECK_EQUAL( shared_model->getName(), "test" );
+  FRENSIE_CHECK( shared_model->isInitialized() );
+  FRENSIE_CHECK( shared_model->doesCellExist( 3 ) );
+  FRENSIE_CHECK( shared_model->isTerminationCell( 4 ) );
+
+  std::shared_ptr<Geometry::Navigator> navigator =
+    shared_model->createNavigator();
+
+  navigator->setState( 3.0*Geometry::Navigator::Length::unit_type(),
+                       0.0*Geometry::Navigator::Length::unit_type(),
+                       0.0*Geometry::Navigator::Length::unit_type(),
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  model = createModel();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstNativeModel.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,330 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeNavigator.cpp
+//! \author Alex Robinson
+//! \brief  Native CSG navigator class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "Geometry_NativeNavigator.hpp"
+#include "Geometry_NativeModel.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+namespace cgs = boost::units::cgs;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Geometry::NativeModel> model;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the test model
+/*! \details The model consists of a sphere (r=2, cell 1) inside of a sphere
+ * (r=5) that is split in half by the x=0 plane (cells 2 and 3). The region
+ * outside of the outer sphere is the termination cell (cell 4). The outer
+ * sphere can be made reflecting.
+ */
+std::shared_ptr<const Geometry::NativeModel>
+createModel( const bool reflecting_outer_sphere = false )
+{
+  Geometry::NativeModel::SurfaceArray surfaces;
+  surfaces.push_back( Geometry::NativeSurface( 1, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, -4.0 ) );
+  surfaces.push_back( Geometry::NativeSurface( 2, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, -25.0 ) );
+  surfaces.push_back( Geometry::NativeSurface( 3, 1.0, 0.0, 0.0, 0.0 ) );
+
+  surfaces[1].setReflecting( reflecting_outer_sphere );
+
+  Geometry::NativeCell::ZoneArray zones( 1 );
+  Geometry::NativeModel::CellArray cells;
+
+  zones[0] = {{1, Geometry::NativeSurface::NEGATIVE_SENSE}};
+
+  cells.push_back( Geometry::NativeCell( 1, zones, 1, -1.0*Geometry::Model::DensityUnit() ) );
+
+  zones[0] = {{1, Geometry::NativeSurface::POSITIVE_SENSE},
+              {2, Geometry::NativeSurface::NEGATIVE_SENSE},
+              {3, Geometry::NativeSurface::NEGATIVE_SENSE}};
+
+  cells.push_back( Geometry::NativeCell( 2, zones, 2, 0.1*Geometry::Model::DensityUnit() ) );
+
+  zones[0] = {{1, Geometry::NativeSurface::POSITIVE_SENSE},
+              {2, Geometry::NativeSurface::NEGATIVE_SENSE},
+              {3, Geometry::NativeSurface::POSITIVE_SENSE}};
+
+  cells.push_back( Geometry::NativeCell( 3, zones ) );
+
+  zones[0] = {{2, Geometry::NativeSurface::POSITIVE_SENSE}};
+
+  cells.push_back( Geometry::NativeCell( 4, zones ) );
+  cells.back().setTerminationCell();
+
+  return std::make_shared<const Geometry::NativeModel>( "test", surfaces, cells );
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the location of a point w.r.t. a cell can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getPointLocation )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  Geometry::Navigator::Ray ray( 0.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( ray, 1 ),
+                       Geometry::POINT_INSIDE_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( ray, 2 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+
+  // On the boundary the direction determines the location
+  Geometry::Navigator::Ray boundary_ray( 2.0*cgs::centimeter,
+                                         0.0*cgs::centimeter,
+                                         0.0*cgs::centimeter,
+                                         1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( boundary_ray, 1 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( boundary_ray, 3 ),
+                       Geometry::POINT_INSIDE_CELL );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface normal can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getSurfaceNormal )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  Geometry::Navigator::Ray ray( 0.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                -5.0*cgs::centimeter,
+                                0.0, 0.0, -1.0 );
+
+  double normal[3];
+
+  navigator->getSurfaceNormal( 2, ray, normal );
+
+  FRENSIE_CHECK_EQUAL( normal[0], 0.0 );
+  FRENSIE_CHECK_EQUAL( normal[1], 0.0 );
+  FRENSIE_CHECK_EQUAL( normal[2], -1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell containing a ray can be found
+FRENSIE_UNIT_TEST( NativeNavigator, findCellContainingRay )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  Geometry::Navigator::CellIdSet found_cell_cache;
+
+  Geometry::Navigator::Ray ray( -3.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( ray, found_cell_cache ), 2 );
+  FRENSIE_CHECK_EQUAL( found_cell_cache.size(), 1 );
+
+  ray = Geometry::Navigator::Ray( 3.0*cgs::centimeter,
+                                 0.0*cgs::centimeter,
+                                 0.0*cgs::centimeter,
+                                 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( ray, found_cell_cache ), 3 );
+  FRENSIE_CHECK_EQUAL( found_cell_cache.size(), 2 );
+
+  ray = Geometry::Navigator::Ray( 0.0*cgs::centimeter,
+                                 10.0*cgs::centimeter,
+                                 0.0*cgs::centimeter,
+                                 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( ray ), 4 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the closest boundary can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getDistanceToClosestBoundary )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       1.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getDistanceToClosestBoundary(),
+                                   1.5*cgs::centimeter,
+                                   1e-12 );
+
+  navigator->setState( -0.5*cgs::centimeter,
+                       3.5*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getDistanceToClosestBoundary(),
+                                   0.5*cgs::centimeter,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray can be traced through the model
+FRENSIE_UNIT_TEST( NativeNavigator, ray_trace )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( -4.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+
+  Geometry::Navigator::EntityId surface_hit;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   2.0*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 1 );
+
+  double surface_normal[3];
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary( surface_normal ) );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+  FRENSIE_CHECK_EQUAL( surface_normal[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( surface_normal[1], 0.0 );
+  FRENSIE_CHECK_EQUAL( surface_normal[2], 0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   4.0*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 1 );
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary() );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+
+  // Substep before crossing into the termination cell
+  navigator->advanceBySubstep( 1.0*cgs::centimeter );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   2.0*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 2 );
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary() );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 4 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getPosition()[0],
+                                   5.0*cgs::centimeter,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray can cross the plane between the half shells
+FRENSIE_UNIT_TEST( NativeNavigator, ray_trace_plane )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( -3.0*cgs::centimeter,
+                       3.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  Geometry::Navigator::EntityId surface_hit;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   3.0*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 3 );
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary() );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   4.0*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray is reflected by a reflecting surface
+FRENSIE_UNIT_TEST( NativeNavigator, ray_trace_reflecting )
+{
+  std::shared_ptr<const Geometry::NativeModel>
+    reflecting_model = createModel( true );
+
+  std::shared_ptr<Geometry::Navigator> navigator =
+    reflecting_model->createNavigator();
+
+  navigator->setState( 3.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK( navigator->advanceToCellBoundary() );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+  FRENSIE_CHECK_EQUAL( navigator->getDirection()[0], -1.0 );
+
+  Geometry::Navigator::EntityId surface_hit;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   3.0*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the navigator can be cloned
+FRENSIE_UNIT_TEST( NativeNavigator, clone )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 3.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 1.0, 0.0 );
+
+  std::unique_ptr<Geometry::Navigator> navigator_clone( navigator->clone() );
+
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 3 );
+  FRENSIE_CHECK_EQUAL( navigator_clone->getPosition()[0],
+                       3.0*cgs::centimeter );
+  FRENSIE_CHECK_EQUAL( navigator_clone->getDirection()[1], 1.0 );
+
+  navigator_clone->changeDirection( -1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator_clone->fireRay(),
+                                   1.0*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( navigator->getDirection()[1], 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  model = createModel();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstNativeNavigator.cpp
+//---------------------------------------------------------------------------//
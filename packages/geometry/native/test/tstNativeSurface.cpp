@@ -0,0 +1,258 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeSurface.cpp
+//! \author Alex Robinson
+//! \brief  Native CSG surface class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <limits>
+
+// FRENSIE Includes
+#include "Geometry_NativeSurface.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the surface id can be returned
+FRENSIE_UNIT_TEST( NativeSurface, getId )
+{
+  Geometry::NativeSurface surface( 1, 1.0, 0.0, 0.0, -1.0 );
+
+  FRENSIE_CHECK_EQUAL( surface.getId(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a surface is planar
+FRENSIE_UNIT_TEST( NativeSurface, isPlanar )
+{
+  Geometry::NativeSurface plane( 1, 1.0, 0.0, 0.0, -1.0 );
+
+  FRENSIE_CHECK( plane.isPlanar() );
+
+  Geometry::NativeSurface sphere( 2, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, -4.0 );
+
+  FRENSIE_CHECK( !sphere.isPlanar() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a surface can be set as a reflecting surface
+FRENSIE_UNIT_TEST( NativeSurface, setReflecting )
+{
+  Geometry::NativeSurface surface( 1, 1.0, 0.0, 0.0, -1.0 );
+
+  FRENSIE_CHECK( !surface.isReflecting() );
+
+  surface.setReflecting();
+
+  FRENSIE_CHECK( surface.isReflecting() );
+
+  surface.setReflecting( false );
+
+  FRENSIE_CHECK( !surface.isReflecting() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface can be evaluated
+FRENSIE_UNIT_TEST( NativeSurface, evaluate )
+{
+  Geometry::NativeSurface sphere( 1, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, -4.0 );
+
+  double position[3] = {0.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_EQUAL( sphere.evaluate( position ), -4.0 );
+
+  position[0] = 2.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.evaluate( position ), 0.0 );
+  FRENSIE_CHECK( sphere.isOn( position ) );
+
+  position[0] = 3.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.evaluate( position ), 5.0 );
+  FRENSIE_CHECK( !sphere.isOn( position ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sense of a point can be returned
+FRENSIE_UNIT_TEST( NativeSurface, getSense )
+{
+  Geometry::NativeSurface sphere( 1, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, -4.0 );
+
+  double position[3] = {0.0, 0.0, 0.0};
+  double direction[3] = {1.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_EQUAL( sphere.getSense( position, direction ),
+                       Geometry::NativeSurface::NEGATIVE_SENSE );
+
+  position[0] = 2.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getSense( position, direction ),
+                       Geometry::NativeSurface::POSITIVE_SENSE );
+
+  direction[0] = -1.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getSense( position, direction ),
+                       Geometry::NativeSurface::NEGATIVE_SENSE );
+
+  position[0] = 3.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getSense( position, direction ),
+                       Geometry::NativeSurface::POSITIVE_SENSE );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the unit normal can be returned
+FRENSIE_UNIT_TEST( NativeSurface, getUnitNormal )
+{
+  Geometry::NativeSurface sphere( 1, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, -4.0 );
+
+  double position[3] = {0.0, 0.0, 2.0};
+  double normal[3];
+
+  sphere.getUnitNormal( position, normal );
+
+  FRENSIE_CHECK_EQUAL( normal[0], 0.0 );
+  FRENSIE_CHECK_EQUAL( normal[1], 0.0 );
+  FRENSIE_CHECK_EQUAL( normal[2], 1.0 );
+
+  Geometry::NativeSurface plane( 2, 0.0, -2.0, 0.0, 1.0 );
+
+  plane.getUnitNormal( position, normal );
+
+  FRENSIE_CHECK_EQUAL( normal[0], 0.0 );
+  FRENSIE_CHECK_EQUAL( normal[1], -1.0 );
+  FRENSIE_CHECK_EQUAL( normal[2], 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the surface along a ray can be returned
+FRENSIE_UNIT_TEST( NativeSurface, getDistance )
+{
+  Geometry::NativeSurface sphere( 1, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, -4.0 );
+
+  double position[3] = {-5.0, 0.0, 0.0};
+  double direction[3] = {1.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistance( position, direction ),
+                                   3.0,
+                                   1e-12 );
+
+  // The intersection at the current point should be ignored
+  position[0] = -2.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistance( position, direction ),
+                                   4.0,
+                                   1e-12 );
+
+  position[0] = 2.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getDistance( position, direction ),
+                       std::numeric_limits<double>::infinity() );
+
+  // Miss
+  position[0] = -5.0;
+  position[1] = 3.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getDistance( position, direction ),
+                       std::numeric_limits<double>::infinity() );
+
+  Geometry::NativeSurface plane( 2, 1.0, 0.0, 0.0, -1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( plane.getDistance( position, direction ),
+                                   6.0,
+                                   1e-12 );
+
+  direction[0] = -1.0;
+
+  FRENSIE_CHECK_EQUAL( plane.getDistance( position, direction ),
+                       std::numeric_limits<double>::infinity() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface bounding box can be returned
+FRENSIE_UNIT_TEST( NativeSurface, getBoundingBox )
+{
+  Geometry::NativeSurface sphere( 1, 1.0, 1.0, 1.0, -2.0, 0.0, 0.0, -3.0 );
+
+  double lower_bounds[3], upper_bounds[3];
+
+  FRENSIE_REQUIRE( sphere.getBoundingBox( Geometry::NativeSurface::NEGATIVE_SENSE,
+                                          lower_bounds,
+                                          upper_bounds ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_bounds[0], -1.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( upper_bounds[0], 3.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_bounds[1], -2.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( upper_bounds[1], 2.0, 1e-12 );
+
+  FRENSIE_CHECK( !sphere.getBoundingBox( Geometry::NativeSurface::POSITIVE_SENSE,
+                                         lower_bounds,
+                                         upper_bounds ) );
+
+  Geometry::NativeSurface plane( 2, 1.0, 0.0, 0.0, -1.0 );
+
+  FRENSIE_REQUIRE( plane.getBoundingBox( Geometry::NativeSurface::NEGATIVE_SENSE,
+                                         lower_bounds,
+                                         upper_bounds ) );
+  FRENSIE_CHECK_EQUAL( upper_bounds[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( lower_bounds[0],
+                       -std::numeric_limits<double>::infinity() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a surface can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( NativeSurface, archive, TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_native_surface" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    Geometry::NativeSurface surface( 1, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, -4.0 );
+    surface.setReflecting();
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( surface ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived surface
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  Geometry::NativeSurface surface( 2, 1.0, 0.0, 0.0, 0.0 );
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( surface ) );
+  FRENSIE_CHECK_EQUAL( surface.getId(), 1 );
+  FRENSIE_CHECK( surface.isReflecting() );
+  FRENSIE_CHECK( !surface.isPlanar() );
+
+  double position[3] = {0.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_EQUAL( surface.evaluate( position ), -4.0 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstNativeSurface.cpp
+//---------------------------------------------------------------------------//
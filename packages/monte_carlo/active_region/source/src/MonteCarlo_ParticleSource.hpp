@@ -21,6 +21,7 @@
 
 // MonteCarlo Includes
 #include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_ParticleSourceComponent.hpp"
 #include "MonteCarlo_PhaseSpaceDimension.hpp"
 #include "Utility_Communicator.hpp"
 #include "Utility_DistributionTraits.hpp"
@@ -39,6 +40,10 @@ public:
   //! The trial counter type
   typedef Utility::DistributionTraits::Counter Counter;
 
+  //! The sampling statistics array (one entry per component)
+  typedef std::vector<ParticleSourceComponent::SamplingStatistics>
+  SamplingStatisticsArray;
+
   //! Constructor
   ParticleSource()
   { /* ... */ }
@@ -122,6 +127,14 @@ public:
   virtual void getStartingCells( const size_t component,
                                  CellIdSet& starting_cells ) const = 0;
 
+  //! Get the sampling statistics
+  virtual void getSamplingStatistics(
+                           SamplingStatisticsArray& statistics ) const = 0;
+
+  //! Set the sampling statistics
+  virtual void setSamplingStatistics(
+                           const SamplingStatisticsArray& statistics ) = 0;
+
 private:
 
   // Serialize the data
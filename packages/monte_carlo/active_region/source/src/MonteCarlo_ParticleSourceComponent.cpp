@@ -355,6 +355,57 @@ void ParticleSourceComponent::logSummary() const
   FRENSIE_LOG_NOTIFICATION( oss.str() );
 }
 
+// Get the sampling statistics
+/*! \details Only the master thread should call this method. The statistics
+ * from all threads will be merged.
+ */
+void ParticleSourceComponent::getSamplingStatistics(
+                                       SamplingStatistics& statistics ) const
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  statistics.start_cell_cache.clear();
+  
+  this->mergeLocalStartCellCaches( statistics.start_cell_cache );
+
+  statistics.number_of_trials = this->reduceLocalTrialCounters();
+  statistics.number_of_samples = this->reduceLocalSampleCounters();
+
+  statistics.dimension_trial_counters.clear();
+  statistics.dimension_sample_counters.clear();
+
+  this->getDimensionSamplingStatistics( statistics.dimension_trial_counters,
+                                        statistics.dimension_sample_counters );
+}
+
+// Set the sampling statistics
+/*! \details Only the master thread should call this method. The counters
+ * will be assigned to the master thread and the counters of all other
+ * threads will be reset. The start cells will be added to the master thread
+ * start cell cache.
+ */
+void ParticleSourceComponent::setSamplingStatistics(
+                                      const SamplingStatistics& statistics )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( size_t i = 0; i < d_number_of_trials.size(); ++i )
+  {
+    d_number_of_trials[i] = 0;
+    d_number_of_samples[i] = 0;
+  }
+
+  d_start_cell_cache.front().insert( statistics.start_cell_cache.begin(),
+                                     statistics.start_cell_cache.end() );
+  d_number_of_trials.front() = statistics.number_of_trials;
+  d_number_of_samples.front() = statistics.number_of_samples;
+
+  this->setDimensionSamplingStatistics( statistics.dimension_trial_counters,
+                                        statistics.dimension_sample_counters );
+}
+
 // Print a standard summary of the source data
 void ParticleSourceComponent::printStandardSummary(
                                     const std::string& source_component_type,
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <map>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -48,6 +49,39 @@ public:
   //! The cell id set
   typedef Geometry::Model::CellIdSet CellIdSet;
 
+  //! The dimension counter map
+  typedef std::map<PhaseSpaceDimension,Counter> DimensionCounterMap;
+
+  //! The sampling statistics (reduced over all threads)
+  struct SamplingStatistics
+  {
+    //! The start cell cache
+    CellIdSet start_cell_cache;
+
+    //! The number of trials
+    Counter number_of_trials;
+
+    //! The number of samples
+    Counter number_of_samples;
+
+    //! The dimension trial counters
+    DimensionCounterMap dimension_trial_counters;
+
+    //! The dimension sample counters
+    DimensionCounterMap dimension_sample_counters;
+
+    //! Serialize the statistics
+    template<typename Archive>
+    void serialize( Archive& ar, const unsigned version )
+    {
+      ar & BOOST_SERIALIZATION_NVP( start_cell_cache );
+      ar & BOOST_SERIALIZATION_NVP( number_of_trials );
+      ar & BOOST_SERIALIZATION_NVP( number_of_samples );
+      ar & BOOST_SERIALIZATION_NVP( dimension_trial_counters );
+      ar & BOOST_SERIALIZATION_NVP( dimension_sample_counters );
+    }
+  };
+
   //! Constructor
   ParticleSourceComponent( const Id id,
                            const double selection_weight,
@@ -113,6 +147,12 @@ public:
   //! Log a summary of the sampling statistics
   void logSummary() const;
 
+  //! Get the sampling statistics
+  void getSamplingStatistics( SamplingStatistics& statistics ) const;
+
+  //! Set the sampling statistics
+  void setSamplingStatistics( const SamplingStatistics& statistics );
+
 protected:
 
   //! Default constructor
@@ -128,6 +168,16 @@ protected:
   virtual void reduceDataImpl( const Utility::Communicator& comm,
                                const int root_process ) = 0;
 
+  //! Get the dimension sampling statistics
+  virtual void getDimensionSamplingStatistics(
+                   DimensionCounterMap& dimension_trial_counters,
+                   DimensionCounterMap& dimension_sample_counters ) const = 0;
+
+  //! Set the dimension sampling statistics
+  virtual void setDimensionSamplingStatistics(
+                   const DimensionCounterMap& dimension_trial_counters,
+                   const DimensionCounterMap& dimension_sample_counters ) = 0;
+
   /*! \brief Return the number of particle states that will be sampled for the
    * given history number
    */
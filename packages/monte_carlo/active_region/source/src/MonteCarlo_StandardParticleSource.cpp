@@ -13,6 +13,7 @@
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_StandardParticleSource.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -295,6 +296,35 @@ void StandardParticleSource::getStartingCells( const size_t component,
   d_components[component]->getStartingCells( starting_cells );
 }
 
+// Get the sampling statistics
+/*! \details Only the master thread should call this method.
+ */
+void StandardParticleSource::getSamplingStatistics(
+                                   SamplingStatisticsArray& statistics ) const
+{
+  statistics.resize( d_components.size() );
+
+  for( size_t i = 0; i < d_components.size(); ++i )
+    d_components[i]->getSamplingStatistics( statistics[i] );
+}
+
+// Set the sampling statistics
+/*! \details Only the master thread should call this method.
+ */
+void StandardParticleSource::setSamplingStatistics(
+                                  const SamplingStatisticsArray& statistics )
+{
+  TEST_FOR_EXCEPTION( statistics.size() != d_components.size(),
+                      std::runtime_error,
+                      "The number of sampling statistics ("
+                      << statistics.size() << ") does not match the number "
+                      "of source components (" << d_components.size() <<
+                      ")!" );
+
+  for( size_t i = 0; i < d_components.size(); ++i )
+    d_components[i]->setSamplingStatistics( statistics[i] );
+}
+
 } // end MonteCarlo namespace
 
 BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::StandardParticleSource );
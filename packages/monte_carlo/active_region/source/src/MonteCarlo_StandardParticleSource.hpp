@@ -111,6 +111,14 @@ public:
   void getStartingCells( const size_t component,
                          CellIdSet& starting_cells ) const final override;
 
+  //! Get the sampling statistics
+  void getSamplingStatistics(
+                   SamplingStatisticsArray& statistics ) const final override;
+
+  //! Set the sampling statistics
+  void setSamplingStatistics(
+                   const SamplingStatisticsArray& statistics ) final override;
+
 private:
 
   // Default Constructor
@@ -103,6 +103,16 @@ protected:
   void reduceDataImpl( const Utility::Communicator& comm,
                        const int root_process ) final override;
 
+  //! Get the dimension sampling statistics
+  void getDimensionSamplingStatistics(
+           DimensionCounterMap& dimension_trial_counters,
+           DimensionCounterMap& dimension_sample_counters ) const final override;
+
+  //! Set the dimension sampling statistics
+  void setDimensionSamplingStatistics(
+           const DimensionCounterMap& dimension_trial_counters,
+           const DimensionCounterMap& dimension_sample_counters ) final override;
+
   /*! \brief Return the number of particle states that will be sampled for the 
    * given history number
    */
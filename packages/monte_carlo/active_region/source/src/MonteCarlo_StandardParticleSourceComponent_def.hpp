@@ -222,6 +222,39 @@ void StandardParticleSourceComponent<ParticleStateType>::resetDataImpl()
   this->initializeDimensionTrialCounters();
 }
 
+// Get the dimension sampling statistics
+/*! \details Only the master thread should call this method.
+ */
+template<typename ParticleStateType>
+void StandardParticleSourceComponent<ParticleStateType>::getDimensionSamplingStatistics(
+                         DimensionCounterMap& dimension_trial_counters,
+                         DimensionCounterMap& dimension_sample_counters ) const
+{
+  // Make sure only the root process calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  this->reduceAllLocalDimensionTrialCounters( dimension_trial_counters );
+  this->reduceAllLocalDimensionSampleCounters( dimension_sample_counters );
+}
+
+// Set the dimension sampling statistics
+/*! \details Only the master thread should call this method.
+ */
+template<typename ParticleStateType>
+void StandardParticleSourceComponent<ParticleStateType>::setDimensionSamplingStatistics(
+                   const DimensionCounterMap& dimension_trial_counters,
+                   const DimensionCounterMap& dimension_sample_counters )
+{
+  // Make sure only the root process calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  this->initializeDimensionSampleCounters();
+  this->initializeDimensionTrialCounters();
+
+  d_dimension_trial_counters.front() = dimension_trial_counters;
+  d_dimension_sample_counters.front() = dimension_sample_counters;
+}
+
 // Reduce the sampling statistics on the root process
 /*! \details Only the master thread should call this method.
  */
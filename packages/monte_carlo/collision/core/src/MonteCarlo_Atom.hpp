@@ -74,9 +74,16 @@ public:
   //! Return the temperature of the atom
   virtual double getTemperature() const;
 
+  //! Return the energy grid bin index of the energy
+  size_t getEnergyGridBinIndex( const double energy ) const;
+
   //! Return the total cross section at the desired energy
   double getTotalCrossSection( const double energy ) const;
 
+  //! Return the total cross section at the desired energy (efficient)
+  double getTotalCrossSection( const double energy,
+                               const unsigned energy_grid_bin ) const;
+
   //! Return the total cross section from atomic interactions
   double getAtomicTotalCrossSection( const double energy ) const;
 
@@ -86,6 +93,10 @@ public:
   //! Return the total absorption cross section at the desired energy
   double getAbsorptionCrossSection( const double energy ) const;
 
+  //! Return the total absorption cross section at the desired energy (efficient)
+  double getAbsorptionCrossSection( const double energy,
+                                    const unsigned energy_grid_bin ) const;
+
   //! Return the total absorption cross section from atomic interactions
   double getAtomicAbsorptionCrossSection( const double energy ) const;
 
@@ -153,10 +164,6 @@ protected:
 
 private:
 
-  //! Return the total cross section at the desired energy
-  double getTotalCrossSection( const double energy,
-                               const unsigned energy_grid_bin ) const;
-
   //! Return the total cross section from atomic interactions
   double getAtomicTotalCrossSection( const double energy,
                                      const unsigned energy_grid_bin ) const;
@@ -165,10 +172,6 @@ private:
   virtual double getNuclearTotalCrossSection( const double energy,
                                               const unsigned energy_grid_bin ) const;
 
-  //! Return the total absorption cross section at the desired energy
-  double getAbsorptionCrossSection( const double energy,
-                                    const unsigned energy_grid_bin ) const;
-
   //! Return the total absorption cross section from nuclear interactions
   virtual double getNuclearAbsorptionCrossSection( const double energy,
                                                    const unsigned energy_grid_bin ) const;
@@ -182,17 +185,29 @@ private:
                                           const unsigned energy_grid_bin ) const;
 
   // Sample an absorption reaction
-  void sampleAbsorptionReaction( const double scaled_random_number,
+  void sampleAbsorptionReaction( const double random_number,
                                  const unsigned energy_grid_bin,
                                  ParticleStateType& particle,
                                  ParticleBank& bank ) const;
 
   // Sample a scattering reaction
-  void sampleScatteringReaction( const double scaled_random_number,
+  void sampleScatteringReaction( const double random_number,
                                  const unsigned energy_grid_bin,
                                  ParticleStateType& particle,
                                  ParticleBank& bank ) const;
 
+  // Sample a reaction from the reaction map
+  void sampleReaction( const double scaled_random_number,
+                       const unsigned energy_grid_bin,
+                       const ConstReactionMap& reactions,
+                       ParticleStateType& particle,
+                       ParticleBank& bank ) const;
+
+  // Undergo a reaction and relax the atom
+  void react( const typename AtomCore::ReactionType& reaction,
+              ParticleStateType& particle,
+              ParticleBank& bank ) const;
+
   // The atom name
   std::string d_name;
 
@@ -18,6 +18,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_AtomicRelaxationModel.hpp"
+#include "MonteCarlo_ReactionCrossSectionTable.hpp"
 #include "Utility_HashBasedGridSearcher.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Map.hpp"
@@ -66,6 +67,9 @@ public:
   //! Typedef for the const reaction map
   typedef MapType<ReactionEnumType,std::shared_ptr<const ReactionType> > ConstReactionMap;
 
+  //! Typedef for the reaction cross section table
+  typedef ReactionCrossSectionTable<ReactionType> ReactionTable;
+
   //! Destructor
   virtual ~AtomCore()
   { /* ... */ }
@@ -109,6 +113,15 @@ public:
   //! Test if all of the reactions share a common energy grid
   bool hasSharedEnergyGrid() const;
 
+  //! Check if the reaction cross section tables have been created
+  bool hasReactionCrossSectionTables() const;
+
+  //! Return the scattering reaction cross section table
+  const ReactionTable& getScatteringReactionTable() const;
+
+  //! Return the absorption reaction cross section table
+  const ReactionTable& getAbsorptionReactionTable() const;
+
 protected:
 
   //! Default constructor
@@ -176,9 +189,22 @@ protected:
   void createProcessedTotalReaction(
                 const std::shared_ptr<const std::vector<double> >& energy_grid,
                 const ReactionEnumType total_reaction_type );
-  
+
+  //! Create the reaction cross section tables
+  template<typename InterpPolicy>
+  void createReactionCrossSectionTables(
+                const std::shared_ptr<const std::vector<double> >& energy_grid,
+                const bool processed_energy_grid );
+
 private:
 
+  // Create a reaction cross section table
+  template<typename InterpPolicy>
+  static std::shared_ptr<const ReactionTable> createReactionCrossSectionTable(
+                const std::vector<double>& energy_grid,
+                const bool processed_energy_grid,
+                const ConstReactionMap& reactions );
+
   // The reaction types that will be treated as absorption
   static ReactionEnumTypeSet s_absorption_reaction_types;
 
@@ -202,6 +228,12 @@ private:
 
   // The hash-based grid searcher
   std::shared_ptr<const Utility::HashBasedGridSearcher<double> > d_grid_searcher;
+
+  // The scattering reaction cross section table
+  std::shared_ptr<const ReactionTable> d_scattering_reaction_table;
+
+  // The absorption reaction cross section table
+  std::shared_ptr<const ReactionTable> d_absorption_reaction_table;
 };
   
 } // end MonteCarlo namespace
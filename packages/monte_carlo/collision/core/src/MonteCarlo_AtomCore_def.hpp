@@ -9,7 +9,12 @@
 #ifndef MONTE_CARLO_ATOM_CORE_DEF_HPP
 #define MONTE_CARLO_ATOM_CORE_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+#include <type_traits>
+
 // FRENSIE Includes
+#include "Utility_InterpolationPolicy.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -54,7 +59,9 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
     d_absorption_reactions(),
     d_miscellaneous_reactions(),
     d_relaxation_model( relaxation_model ),
-    d_grid_searcher( grid_searcher )
+    d_grid_searcher( grid_searcher ),
+    d_scattering_reaction_table(),
+    d_absorption_reaction_table()
 {
   // There must be at least one reaction specified
   testPrecondition( standard_scattering_reactions.size() +
@@ -103,7 +110,9 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
 /*! \details It is assumed that the scattering, absorption and miscellaneous
  * reactions have already been organized appropriately. The total and total
  * absorption cross sections should have been created from the scattering
- * and absorption reactions.
+ * and absorption reactions. The reaction cross section tables will not be
+ * created (reactions will be selected by evaluating each reaction cross
+ * section).
  */
 template<typename _ReactionEnumType,
          typename _ReactionType,
@@ -121,11 +130,13 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
           grid_searcher )
   : d_total_reaction( total_reaction ),
     d_total_absorption_reaction( total_absorption_reaction ),
-    d_scattering_reactions( d_scattering_reactions ),
+    d_scattering_reactions( scattering_reactions ),
     d_absorption_reactions( absorption_reactions ),
     d_miscellaneous_reactions( miscellaneous_reactions ),
     d_relaxation_model( relaxation_model ),
-    d_grid_searcher( grid_searcher )
+    d_grid_searcher( grid_searcher ),
+    d_scattering_reaction_table(),
+    d_absorption_reaction_table()
 {
   // Make sure the total reaction is valid
   testPrecondition( total_reaction.get() );
@@ -154,7 +165,9 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
     d_absorption_reactions( instance.d_absorption_reactions ),
     d_miscellaneous_reactions( instance.d_miscellaneous_reactions ),
     d_relaxation_model( instance.d_relaxation_model ),
-    d_grid_searcher( instance.d_grid_searcher )
+    d_grid_searcher( instance.d_grid_searcher ),
+    d_scattering_reaction_table( instance.d_scattering_reaction_table ),
+    d_absorption_reaction_table( instance.d_absorption_reaction_table )
 {
   // Make sure the total reaction is valid
   testPrecondition( instance.d_total_reaction.get() );
@@ -200,6 +213,8 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::op
     d_miscellaneous_reactions = instance.d_miscellaneous_reactions;
     d_relaxation_model = instance.d_relaxation_model;
     d_grid_searcher = instance.d_grid_searcher;
+    d_scattering_reaction_table = instance.d_scattering_reaction_table;
+    d_absorption_reaction_table = instance.d_absorption_reaction_table;
   }
 
   return *this;
@@ -371,6 +386,9 @@ void AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType
 }
 
 // Create the total reaction
+/*! \details The scattering and absorption reaction cross section tables
+ * will also be created on the energy grid.
+ */
 template<typename _ReactionEnumType,
          typename _ReactionType,
          typename _ParticleStateType,
@@ -451,6 +469,8 @@ void AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType
                               std::numeric_limits<double>::infinity() ) );
   testPostcondition( inf_element == total_cross_section->end() );
 
+  this->createReactionCrossSectionTables<InterpPolicy>( energy_grid, false );
+
   d_total_reaction.reset( new TotalReactionType<InterpPolicy,false>(
 						  energy_grid,
                                                   total_cross_section,
@@ -460,6 +480,9 @@ void AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType
 }
 
 // Calculate the processed total absorption cross section
+/*! \details The scattering and absorption reaction cross section tables
+ * will also be created on the (unprocessed) energy grid.
+ */
 template<typename _ReactionEnumType,
          typename _ReactionType,
          typename _ParticleStateType,
@@ -526,6 +549,8 @@ void AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType
 		       std::numeric_limits<double>::infinity() ) );
   testPostcondition( inf_element == total_cross_section->end() );
 
+  this->createReactionCrossSectionTables<InterpPolicy>( energy_grid, true );
+
   d_total_reaction.reset( new TotalReactionType<InterpPolicy,true>(
                                                   energy_grid,
                                                   total_cross_section,
@@ -534,6 +559,126 @@ void AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType
                                                   total_reaction_type ) );
 }
 
+// Create the reaction cross section tables
+/*! \details The reactions in each table are ordered by reaction type so
+ * that reaction selection does not depend on the iteration order of the
+ * reaction maps. The tables interpolate the cross sections with the same
+ * policy as the reactions. When the cross sections are interpolated
+ * linearly the tables are cumulative, which allows a binary search to be
+ * used when selecting one of many (e.g. subshell) reactions.
+ */
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+template<typename InterpPolicy>
+void AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::createReactionCrossSectionTables(
+                const std::shared_ptr<const std::vector<double> >& energy_grid,
+                const bool processed_energy_grid )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid->size() > 1 );
+
+  if( d_scattering_reactions.size() > 0 )
+  {
+    d_scattering_reaction_table =
+      ThisType::createReactionCrossSectionTable<InterpPolicy>(
+                                                    *energy_grid,
+                                                    processed_energy_grid,
+                                                    d_scattering_reactions );
+  }
+
+  if( d_absorption_reactions.size() > 0 )
+  {
+    d_absorption_reaction_table =
+      ThisType::createReactionCrossSectionTable<InterpPolicy>(
+                                                    *energy_grid,
+                                                    processed_energy_grid,
+                                                    d_absorption_reactions );
+  }
+}
+
+// Create a reaction cross section table
+/*! \details The table is always created on the unprocessed energy grid. The
+ * interpolation policy of the reactions is used by the table (the
+ * processed log grids of the reactions are equivalent to log interpolation
+ * on the unprocessed grid).
+ */
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+template<typename InterpPolicy>
+auto AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::createReactionCrossSectionTable(
+                                     const std::vector<double>& energy_grid,
+                                     const bool processed_energy_grid,
+                                     const ConstReactionMap& reactions )
+  -> std::shared_ptr<const ReactionTable>
+{
+  // Order the reactions by type
+  std::vector<std::pair<ReactionEnumType,std::shared_ptr<const ReactionType> > >
+    ordered_reactions( reactions.begin(), reactions.end() );
+
+  std::sort( ordered_reactions.begin(),
+             ordered_reactions.end(),
+             []( const std::pair<ReactionEnumType,std::shared_ptr<const ReactionType> >& a,
+                 const std::pair<ReactionEnumType,std::shared_ptr<const ReactionType> >& b )
+             { return a.first < b.first; } );
+
+  typename ReactionTable::ReactionArray table_reactions;
+  table_reactions.reserve( ordered_reactions.size() );
+
+  for( size_t r = 0; r < ordered_reactions.size(); ++r )
+    table_reactions.push_back( ordered_reactions[r].second );
+
+  // Evaluate the reaction cross sections on the energy grid
+  std::vector<double> raw_energy_grid( energy_grid.size() );
+  std::vector<double> cross_sections( energy_grid.size()*
+                                      table_reactions.size() );
+
+  for( size_t i = 0; i < energy_grid.size(); ++i )
+  {
+    const size_t energy_grid_bin = (i < energy_grid.size() - 1 ? i : i-1);
+
+    if( processed_energy_grid )
+    {
+      raw_energy_grid[i] =
+        InterpPolicy::recoverProcessedIndepVar( energy_grid[i] );
+    }
+    else
+      raw_energy_grid[i] = energy_grid[i];
+
+    for( size_t r = 0; r < table_reactions.size(); ++r )
+    {
+      if( processed_energy_grid )
+      {
+        cross_sections[i*table_reactions.size()+r] =
+          table_reactions[r]->getCrossSection( raw_energy_grid[i] );
+      }
+      else
+      {
+        cross_sections[i*table_reactions.size()+r] =
+          table_reactions[r]->getCrossSection( raw_energy_grid[i],
+                                               energy_grid_bin );
+      }
+    }
+  }
+
+  // A sum of log interpolated cross sections is not log interpolated
+  const bool cumulative =
+    std::is_same<typename InterpPolicy::DepVarProcessingTag,
+                 Utility::LinDepVarProcessingTag>::value;
+
+  return std::make_shared<const ReactionTable>(
+                                        raw_energy_grid,
+                                        table_reactions,
+                                        cross_sections,
+                                        cumulative,
+                                        InterpPolicy::getInterpolationType() );
+}
+
 // Set the absorption reaction types
 template<typename _ReactionEnumType,
          typename _ReactionType,
@@ -757,7 +902,56 @@ bool AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType
 
   return true;
 }
-  
+
+// Check if the reaction cross section tables have been created
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+inline bool AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::hasReactionCrossSectionTables() const
+{
+  if( !d_scattering_reaction_table && !d_absorption_reaction_table )
+    return false;
+
+  // Every reaction group must have a table
+  if( d_scattering_reactions.size() > 0 && !d_scattering_reaction_table )
+    return false;
+
+  if( d_absorption_reactions.size() > 0 && !d_absorption_reaction_table )
+    return false;
+
+  return true;
+}
+
+// Return the scattering reaction cross section table
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+inline auto AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::getScatteringReactionTable() const -> const ReactionTable&
+{
+  // Make sure the scattering reaction table has been created
+  testPrecondition( d_scattering_reaction_table.get() );
+
+  return *d_scattering_reaction_table;
+}
+
+// Return the absorption reaction cross section table
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+inline auto AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::getAbsorptionReactionTable() const -> const ReactionTable&
+{
+  // Make sure the absorption reaction table has been created
+  testPrecondition( d_absorption_reaction_table.get() );
+
+  return *d_absorption_reaction_table;
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_ATOM_CORE_DEF_HPP
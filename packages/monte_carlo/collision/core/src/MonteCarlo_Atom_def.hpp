@@ -126,6 +126,16 @@ double Atom<AtomCore>::getAtomicWeight() const
   return d_atomic_weight;
 }
 
+// Return the energy grid bin index of the energy
+template<typename AtomCore>
+inline size_t Atom<AtomCore>::getEnergyGridBinIndex( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( d_core.getGridSearcher().isValueWithinGridBounds( energy ) );
+
+  return d_core.getGridSearcher().findLowerBinIndex( energy );
+}
+
 // Return the total cross section at the desired energy
 template<typename AtomCore>
 inline double Atom<AtomCore>::getTotalCrossSection( const double energy ) const
@@ -139,7 +149,10 @@ inline double Atom<AtomCore>::getTotalCrossSection( const double energy ) const
   return this->getTotalCrossSection( energy, energy_grid_bin );
 }
 
-// Return the total cross section at the desired energy
+// Return the total cross section at the desired energy (efficient)
+/*! \details The energy grid bin must be the bin index returned by
+ * getEnergyGridBinIndex for the energy.
+ */
 template<typename AtomCore>
 inline double Atom<AtomCore>::getTotalCrossSection(
                                         const double energy,
@@ -215,7 +228,10 @@ Atom<AtomCore>::getAbsorptionCrossSection( const double energy ) const
          this->getNuclearAbsorptionCrossSection( energy );
 }
 
-// Return the total absorption cross section at the desired energy
+// Return the total absorption cross section at the desired energy (efficient)
+/*! \details The energy grid bin must be the bin index returned by
+ * getEnergyGridBinIndex for the energy.
+ */
 template<typename AtomCore>
 inline double
 Atom<AtomCore>::getAbsorptionCrossSection( const double energy,
@@ -466,10 +482,11 @@ void Atom<AtomCore>::collideAnalogue( ParticleStateType& particle,
   // Check if absorption occurs
   if( scaled_random_number < absorption_cross_section )
   {
-    this->sampleAbsorptionReaction( scaled_random_number,
-                                    energy_grid_bin,
-                                    particle,
-                                    bank );
+    this->sampleAbsorptionReaction(
+                               scaled_random_number/absorption_cross_section,
+                               energy_grid_bin,
+                               particle,
+                               bank );
 
     // Set the particle as gone regardless of the reaction that occurred
     particle.setAsGone();
@@ -477,7 +494,8 @@ void Atom<AtomCore>::collideAnalogue( ParticleStateType& particle,
   else
   {
     this->sampleScatteringReaction(
-                              scaled_random_number - absorption_cross_section,
+                              (scaled_random_number - absorption_cross_section)/
+                              scattering_cross_section,
                               energy_grid_bin,
                               particle,
                               bank );
@@ -517,8 +535,7 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
       particle.multiplyWeight( survival_prob );
 
       this->sampleScatteringReaction(
-            Utility::RandomNumberGenerator::getRandomNumber<double>()*
-            scattering_cross_section,
+            Utility::RandomNumberGenerator::getRandomNumber<double>(),
             energy_grid_bin,
             particle,
             bank );
@@ -526,8 +543,7 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
       particle_copy.multiplyWeight( 1.0 - survival_prob );
 
       this->sampleAbsorptionReaction(
-            Utility::RandomNumberGenerator::getRandomNumber<double>()*
-            absorption_cross_section,
+            Utility::RandomNumberGenerator::getRandomNumber<double>(),
             energy_grid_bin,
             particle_copy,
             bank );
@@ -535,8 +551,7 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
     else
     {
       this->sampleAbsorptionReaction(
-            Utility::RandomNumberGenerator::getRandomNumber<double>()*
-            absorption_cross_section,
+            Utility::RandomNumberGenerator::getRandomNumber<double>(),
             energy_grid_bin,
             particle,
             bank );
@@ -547,8 +562,7 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
   else
   {
     this->sampleScatteringReaction(
-          Utility::RandomNumberGenerator::getRandomNumber<double>()*
-          scattering_cross_section,
+          Utility::RandomNumberGenerator::getRandomNumber<double>(),
           energy_grid_bin,
           particle,
           bank );
@@ -556,55 +570,85 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
 }
 
 // Sample an absorption reaction
+/*! \details The random number must be in [0,1). If the reaction cross
+ * section tables have been created by the core, the reaction will be
+ * selected using the absorption reaction table.
+ */
 template<typename AtomCore>
-void Atom<AtomCore>::sampleAbsorptionReaction( const double scaled_random_number,
-                                     unsigned energy_grid_bin,
-                                     ParticleStateType& particle,
-                                     ParticleBank& bank ) const
+void Atom<AtomCore>::sampleAbsorptionReaction( const double random_number,
+                                               unsigned energy_grid_bin,
+                                               ParticleStateType& particle,
+                                               ParticleBank& bank ) const
 {
-  double partial_cross_section = 0.0;
-
-  typename ConstReactionMap::const_iterator atomic_reaction =
-    d_core.getAbsorptionReactions().begin();
-
-  while( atomic_reaction != d_core.getAbsorptionReactions().end() )
+  if( d_core.hasReactionCrossSectionTables() )
   {
-    partial_cross_section +=
-      atomic_reaction->second->getCrossSection( particle.getEnergy(),
-                                                energy_grid_bin );
-
-    if( scaled_random_number < partial_cross_section )
-      break;
-
-    ++atomic_reaction;
+    this->react( d_core.getAbsorptionReactionTable().sampleReaction(
+                                                         random_number,
+                                                         particle.getEnergy(),
+                                                         energy_grid_bin ),
+                 particle,
+                 bank );
+  }
+  else
+  {
+    this->sampleReaction( random_number*
+                          this->getAtomicAbsorptionCrossSection(
+                                                        particle.getEnergy(),
+                                                        energy_grid_bin ),
+                          energy_grid_bin,
+                          d_core.getAbsorptionReactions(),
+                          particle,
+                          bank );
   }
-
-  // Make sure a reaction was selected
-  testPostcondition( atomic_reaction != d_core.getAbsorptionReactions().end() );
-
-  // Undergo reaction selected
-  Data::SubshellType subshell_vacancy;
-
-  atomic_reaction->second->react( particle, bank, subshell_vacancy );
-
-  // Relax the atom
-  this->relaxAtom( subshell_vacancy, particle, bank );
 }
 
 // Sample a scattering reaction
+/*! \details The random number must be in [0,1). If the reaction cross
+ * section tables have been created by the core, the reaction will be
+ * selected using the scattering reaction table.
+ */
+template<typename AtomCore>
+void Atom<AtomCore>::sampleScatteringReaction( const double random_number,
+                                               unsigned energy_grid_bin,
+                                               ParticleStateType& particle,
+                                               ParticleBank& bank ) const
+{
+  if( d_core.hasReactionCrossSectionTables() )
+  {
+    this->react( d_core.getScatteringReactionTable().sampleReaction(
+                                                         random_number,
+                                                         particle.getEnergy(),
+                                                         energy_grid_bin ),
+                 particle,
+                 bank );
+  }
+  else
+  {
+    this->sampleReaction( random_number*
+                          this->getAtomicScatteringCrossSection(
+                                                        particle.getEnergy(),
+                                                        energy_grid_bin ),
+                          energy_grid_bin,
+                          d_core.getScatteringReactions(),
+                          particle,
+                          bank );
+  }
+}
+
+// Sample a reaction from the reaction map
 template<typename AtomCore>
-void Atom<AtomCore>::sampleScatteringReaction(
-                                             const double scaled_random_number,
-                                             unsigned energy_grid_bin,
-                                             ParticleStateType& particle,
-                                             ParticleBank& bank ) const
+void Atom<AtomCore>::sampleReaction( const double scaled_random_number,
+                                     const unsigned energy_grid_bin,
+                                     const ConstReactionMap& reactions,
+                                     ParticleStateType& particle,
+                                     ParticleBank& bank ) const
 {
   double partial_cross_section = 0.0;
 
   typename ConstReactionMap::const_iterator atomic_reaction =
-    d_core.getScatteringReactions().begin();
+    reactions.begin();
 
-  while( atomic_reaction != d_core.getScatteringReactions().end() )
+  while( atomic_reaction != reactions.end() )
   {
     partial_cross_section +=
       atomic_reaction->second->getCrossSection( particle.getEnergy(),
@@ -617,12 +661,21 @@ void Atom<AtomCore>::sampleScatteringReaction(
   }
 
   // Make sure the reaction was found
-  testPostcondition( atomic_reaction != d_core.getScatteringReactions().end() );
+  testPostcondition( atomic_reaction != reactions.end() );
 
-  // Undergo reaction selected
+  this->react( *atomic_reaction->second, particle, bank );
+}
+
+// Undergo a reaction and relax the atom
+template<typename AtomCore>
+inline void Atom<AtomCore>::react(
+                            const typename AtomCore::ReactionType& reaction,
+                            ParticleStateType& particle,
+                            ParticleBank& bank ) const
+{
   Data::SubshellType subshell_vacancy;
 
-  atomic_reaction->second->react( particle, bank, subshell_vacancy );
+  reaction.react( particle, bank, subshell_vacancy );
 
   // Relax the atom
   this->relaxAtom( subshell_vacancy, particle, bank );
@@ -285,14 +285,12 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
 		  const bool use_atomic_relaxation_data )
 {
   // Check if the model for this atom has already been created
-  if( d_relaxation_models.find( raw_photoatom_data.extractAtomicNumber() ) !=
-      d_relaxation_models.end() )
-  {
-    atomic_relaxation_model =
-      d_relaxation_models[raw_photoatom_data.extractAtomicNumber()];
-  }
-  else
+  if( !this->getCachedAtomicRelaxationModel(
+                                         raw_photoatom_data.extractAtomicNumber(),
+                                         atomic_relaxation_model ) )
   {
+    // The model is created without holding the cache lock so that models
+    // for different atoms can be created concurrently
     AtomicRelaxationModelFactory::createAtomicRelaxationModel(
 						  raw_photoatom_data,
 						  atomic_relaxation_model,
@@ -303,8 +301,8 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
     // Cache the relaxation model
     if( use_atomic_relaxation_data )
     {
-      d_relaxation_models[raw_photoatom_data.extractAtomicNumber()] =
-	atomic_relaxation_model;
+      this->cacheAtomicRelaxationModel( raw_photoatom_data.extractAtomicNumber(),
+                                        atomic_relaxation_model );
     }
   }
 }
@@ -326,14 +324,12 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
 	 const bool use_atomic_relaxation_data )
 {
   // Check if the model for this atom has already been created
-  if( d_relaxation_models.find( raw_photoatom_data.getAtomicNumber() ) !=
-      d_relaxation_models.end() )
-  {
-    atomic_relaxation_model =
-      d_relaxation_models[raw_photoatom_data.getAtomicNumber()];
-  }
-  else
+  if( !this->getCachedAtomicRelaxationModel(
+                                         raw_photoatom_data.getAtomicNumber(),
+                                         atomic_relaxation_model ) )
   {
+    // The model is created without holding the cache lock so that models
+    // for different atoms can be created concurrently
     AtomicRelaxationModelFactory::createAtomicRelaxationModel(
 						  raw_photoatom_data,
 						  atomic_relaxation_model,
@@ -344,8 +340,8 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
     // Cache the relaxation model
     if( use_atomic_relaxation_data )
     {
-      d_relaxation_models[raw_photoatom_data.getAtomicNumber()] =
-	atomic_relaxation_model;
+      this->cacheAtomicRelaxationModel( raw_photoatom_data.getAtomicNumber(),
+                                        atomic_relaxation_model );
     }
   }
 }
@@ -392,6 +388,41 @@ void AtomicRelaxationModelFactory::createAndCacheAtomicRelaxationModel(
   }*/
 }
 
+// Cache a relaxation model
+/*! \details If another thread has already cached a model for the atom,
+ * the relaxation model will be replaced with the cached model.
+ */
+void AtomicRelaxationModelFactory::cacheAtomicRelaxationModel(
+                 const unsigned atomic_number,
+                 std::shared_ptr<const AtomicRelaxationModel>& atomic_relaxation_model )
+{
+  std::lock_guard<std::mutex> lock( d_relaxation_models_mutex );
+
+  atomic_relaxation_model =
+    d_relaxation_models.emplace( atomic_number,
+                                 atomic_relaxation_model ).first->second;
+}
+
+// Check if a relaxation model has been cached (and retrieve it)
+bool AtomicRelaxationModelFactory::getCachedAtomicRelaxationModel(
+                 const unsigned atomic_number,
+                 std::shared_ptr<const AtomicRelaxationModel>& atomic_relaxation_model )
+{
+  std::lock_guard<std::mutex> lock( d_relaxation_models_mutex );
+
+  std::unordered_map<unsigned,std::shared_ptr<const AtomicRelaxationModel> >::const_iterator
+    model_it = d_relaxation_models.find( atomic_number );
+
+  if( model_it != d_relaxation_models.end() )
+  {
+    atomic_relaxation_model = model_it->second;
+
+    return true;
+  }
+  else
+    return false;
+}
+
 // Create the subshell relaxation models
 void AtomicRelaxationModelFactory::createSubshellRelaxationModels(
 		  const std::vector<Data::SubshellType>& subshell_designators,
@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <memory>
 #include <unordered_map>
+#include <mutex>
 
 // FRENSIE Includes
 #include "MonteCarlo_AtomicRelaxationModel.hpp"
@@ -31,7 +32,9 @@ namespace MonteCarlo{
  * constructing a photoatom and an electroatom). To create an atomic relaxation
  * model using different data, create an overload of the
  * createAtomicRelaxationModel static member function and
- * createAndCacheAtomicRelaxationModel member function.
+ * createAndCacheAtomicRelaxationModel member function. The
+ * createAndCacheAtomicRelaxationModel member functions can be called
+ * concurrently (e.g. when scattering centers are loaded in parallel).
  */
 class AtomicRelaxationModelFactory
 {
@@ -108,9 +111,23 @@ private:
   // The default void atomic relaxation model
   static const std::shared_ptr<const AtomicRelaxationModel> default_void_model;
 
+  // Cache a relaxation model (the previously cached model will be returned
+  // if another thread cached a model for the atom first)
+  void cacheAtomicRelaxationModel(
+                 const unsigned atomic_number,
+                 std::shared_ptr<const AtomicRelaxationModel>& atomic_relaxation_model );
+
+  // Check if a relaxation model has been cached (and retrieve it)
+  bool getCachedAtomicRelaxationModel(
+                 const unsigned atomic_number,
+                 std::shared_ptr<const AtomicRelaxationModel>& atomic_relaxation_model );
+
   // The map of atomic numbers and atomic relaxation models
   std::unordered_map<unsigned,std::shared_ptr<const AtomicRelaxationModel> >
   d_relaxation_models;
+
+  // The relaxation model cache mutex
+  std::mutex d_relaxation_models_mutex;
 };
 
 } // end MonteCarlo namespace
@@ -13,9 +13,12 @@
 #include <unordered_map>
 #include <memory>
 #include <functional>
+#include <atomic>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleBank.hpp"
+#include "Utility_NodeSharedArray.hpp"
+#include "Utility_ArrayView.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Tuple.hpp"
 #include "Utility_QuantityTraits.hpp"
@@ -72,6 +75,30 @@ public:
   //! Return the scattering center number density
   double getScatteringCenterNumberDensity( const std::string& name ) const;
 
+  //! Unionize the energy grid and precompute the macroscopic cross sections
+  void unionizeEnergyGrid( const double min_energy,
+                           const double max_energy,
+                           const double convergence_tolerance = 1e-3 );
+
+  //! Unionize the energy grid and share it with the processes on the node
+  void unionizeEnergyGrid(
+                   const std::shared_ptr<const Utility::Communicator>& node_comm,
+                   const double min_energy,
+                   const double max_energy,
+                   const double convergence_tolerance = 1e-3 );
+
+  //! Check if the unionized energy grid is shared by multiple processes
+  bool isUnionizedEnergyGridShared() const;
+
+  //! Check if the material has a unionized energy grid
+  bool hasUnionizedEnergyGrid() const;
+
+  //! Return the number of points in the unionized energy grid
+  size_t getUnionizedEnergyGridSize() const;
+
+  //! Return the memory used by the unionized energy grid data (bytes)
+  size_t getUnionizedEnergyGridMemoryUsage() const;
+
   //! Return the macroscopic total cross section (1/cm)
   double getMacroscopicTotalCrossSection( const double energy ) const;
 
@@ -143,6 +170,31 @@ protected:
 
 private:
 
+  // The energy grid lookup cache
+  struct EnergyGridLookupCache
+  {
+    // The key of the material that the cached data belongs to
+    uint64_t material_key;
+
+    // The energy that the cached data belongs to
+    double energy;
+
+    // The unionized energy grid bin index
+    size_t unionized_energy_grid_index;
+
+    // The unionized energy grid interpolation fraction
+    double unionized_interpolation_fraction;
+
+    // The scattering center macroscopic total cross section
+    double macroscopic_total_cross_section;
+
+    // The energy grid bin of each scattering center
+    std::vector<size_t> scattering_center_energy_grid_bins;
+  };
+
+  // Return the energy grid lookup cache for the energy (calling thread)
+  EnergyGridLookupCache& getEnergyGridLookupCache( const double energy ) const;
+
   // Get the atomic weight from an atom pointer
   static double getAtomicWeightFromPair(
       const std::pair<double,std::shared_ptr<const ScatteringCenter> >& pair );
@@ -150,11 +202,60 @@ private:
   // Sample the atom that is collided with
   size_t sampleCollisionScatteringCenter( const double energy ) const;
 
+  // Sample the atom that is collided with from the unionized energy grid
+  size_t sampleUnionizedCollisionScatteringCenter( const double energy ) const;
+
+  // Return the energy grid bin of a scattering center
+  size_t getScatteringCenterEnergyGridBinIndex( const size_t index,
+                                                const double energy ) const;
+
+  // Return the weighted total cross section of a scattering center
+  double getScatteringCenterTotalCrossSection( const size_t index,
+                                               const double energy ) const;
+
+  // Return the weighted absorption cross section of a scattering center
+  double getScatteringCenterAbsorptionCrossSection(
+                                                const size_t index,
+                                                const double energy ) const;
+
+  // Return the macroscopic total cross section from the scattering centers
+  double getScatteringCenterMacroscopicTotalCrossSection(
+                                                  const double energy ) const;
+
+  // Calculate the unionized energy grid data (packed)
+  void calculateUnionizedEnergyGridData(
+                                const double min_energy,
+                                const double max_energy,
+                                const double convergence_tolerance,
+                                std::vector<double>& unionized_data ) const;
+
+  // Set the unionized energy grid views of the packed data
+  void setUnionizedEnergyGridViews( const double* unionized_data,
+                                    const size_t unionized_data_size );
+
+  // Check if an energy falls within the unionized energy grid
+  bool isEnergyWithinUnionizedEnergyGrid( const double energy ) const;
+
+  // Return a macroscopic cross section from the unionized energy grid
+  double getUnionizedMacroscopicCrossSection(
+               const double energy,
+               const Utility::ArrayView<const double>& cross_section ) const;
+
+  // Return the energy grid lookup cache with the unionized grid bin resolved
+  const EnergyGridLookupCache& getUnionizedEnergyGridLookupCache(
+                                                   const double energy ) const;
+
   // The ScatteringCenter::getTotalCrossSection function wrapper
   static MicroscopicCrossSectionEvaluationFunctor s_total_cs_evaluation_functor;
   // The ScatteringCenter::getAbsorptionCrossSection function wrapper
   static MicroscopicCrossSectionEvaluationFunctor s_absorption_cs_evaluation_functor;
 
+  // The next material key
+  static std::atomic<uint64_t> s_next_material_key;
+
+  // The unique key used to identify the material in the lookup cache
+  uint64_t d_material_key;
+
   // The material id
   MaterialId d_id;
 
@@ -167,9 +268,27 @@ private:
   // The scattering center names that make up the material
   std::map<std::string,size_t> d_scattering_center_names;
 
-  // The getMacroscopicTotalCrossSection function wrapper
-  MacroscopicCrossSectionEvaluationFunctor
-  d_macroscopic_total_cs_evaluation_functor;
+  // The unionized energy grid data stored by this process (packed)
+  std::vector<double> d_local_unionized_data;
+
+  // The unionized energy grid data shared by the processes on the node
+  // (packed)
+  std::unique_ptr<const Utility::NodeSharedArray<double> >
+  d_node_shared_unionized_data;
+
+  // The unionized energy grid (empty if the grid has not been unionized)
+  Utility::ArrayView<const double> d_unionized_energy_grid;
+
+  // The macroscopic total cross section on the unionized energy grid
+  Utility::ArrayView<const double> d_unionized_total_cross_section;
+
+  // The macroscopic absorption cross section on the unionized energy grid
+  Utility::ArrayView<const double> d_unionized_absorption_cross_section;
+
+  // The weighted scattering center total cross sections on the unionized
+  // energy grid (grouped by grid point)
+  Utility::ArrayView<const double>
+  d_unionized_scattering_center_total_cross_sections;
 };
 
 } // end MonteCarlo namespace
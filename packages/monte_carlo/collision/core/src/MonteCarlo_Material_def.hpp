@@ -9,9 +9,16 @@
 #ifndef MONTE_CARLO_MATERIAL_DEF_HPP
 #define MONTE_CARLO_MATERIAL_DEF_HPP
 
+// Std Lib Includes
+#include <cmath>
+#include <algorithm>
+
 // FRENSIE Includes
 #include "MonteCarlo_MaterialHelpers.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_GridGenerator.hpp"
+#include "Utility_InterpolationPolicy.hpp"
+#include "Utility_SearchAlgorithms.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -33,6 +40,9 @@ Material<ScatteringCenter>::s_absorption_cs_evaluation_functor(
                                                    std::placeholders::_1,
                                                    std::placeholders::_2 ) );
 
+template<typename ScatteringCenter>
+std::atomic<uint64_t> Material<ScatteringCenter>::s_next_material_key( 1 );
+
 // Constructor (without photonuclear data)
 template<typename ScatteringCenter>
 Material<ScatteringCenter>::Material(
@@ -41,14 +51,17 @@ Material<ScatteringCenter>::Material(
                      const ScatteringCenterNameMap& scattering_center_name_map,
                      const std::vector<double>& scattering_center_fractions,
                      const std::vector<std::string>& scattering_center_names )
-  : d_id( id ),
+  : d_material_key( s_next_material_key++ ),
+    d_id( id ),
     d_number_density( density ),
     d_scattering_centers( scattering_center_fractions.size() ),
     d_scattering_center_names(),
-    d_macroscopic_total_cs_evaluation_functor(
-                 std::bind<double>( &ThisType::getMacroscopicTotalCrossSection,
-                                    std::cref(*this),
-                                    std::placeholders::_1 ) )
+    d_local_unionized_data(),
+    d_node_shared_unionized_data(),
+    d_unionized_energy_grid(),
+    d_unionized_total_cross_section(),
+    d_unionized_absorption_cross_section(),
+    d_unionized_scattering_center_total_cross_sections()
 {
   // Make sure the id is valid
   testPrecondition( ThisType::isIdValid( id ) );
@@ -176,13 +189,280 @@ double Material<ScatteringCenter>::getScatteringCenterNumberDensity( const std::
   return Utility::get<0>( d_scattering_centers[index] );
 }
 
+// Unionize the energy grid and precompute the macroscopic cross sections
+/*! \details A single energy grid will be constructed between the min and
+ * max energy on which the total cross section of every scattering center
+ * and the macroscopic absorption cross section will be precomputed. The grid
+ * is refined until lin-lin interpolation of each of these cross sections
+ * agrees with the scattering center data to within the convergence
+ * tolerance. The macroscopic total cross section on the grid is the sum of
+ * the tabulated scattering center total cross sections. Because lin-lin
+ * interpolation is linear in the tabulated values, the interpolated
+ * macroscopic total cross section (used to sample the distance to collision)
+ * will always equal the sum of the interpolated scattering center total cross
+ * sections (used to sample the collision scattering center). Once the grid
+ * has been unionized, both steps will use the same tabulated cross sections
+ * at energies within the grid.
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::unionizeEnergyGrid(
+                                           const double min_energy,
+                                           const double max_energy,
+                                           const double convergence_tolerance )
+{
+  // Make sure the energies are valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( min_energy < max_energy );
+  // Make sure the convergence tolerance is valid
+  testPrecondition( convergence_tolerance > 0.0 );
+  testPrecondition( convergence_tolerance < 1.0 );
+
+  std::vector<double> unionized_data;
+
+  this->calculateUnionizedEnergyGridData( min_energy,
+                                          max_energy,
+                                          convergence_tolerance,
+                                          unionized_data );
+
+  d_node_shared_unionized_data.reset();
+  d_local_unionized_data.swap( unionized_data );
+
+  this->setUnionizedEnergyGridViews( d_local_unionized_data.data(),
+                                     d_local_unionized_data.size() );
+}
+
+// Unionize the energy grid and share it with the processes on the node
+/*! \details Only the node root process will construct the unionized energy
+ * grid (see the other unionizeEnergyGrid overload). Every other process in
+ * the node communicator will read the node root's grid and cross sections
+ * directly so only one copy of the data is stored on each node. This is a
+ * collective operation over the node communicator (every process on the
+ * node must unionize its materials in the same order).
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::unionizeEnergyGrid(
+                   const std::shared_ptr<const Utility::Communicator>& node_comm,
+                   const double min_energy,
+                   const double max_energy,
+                   const double convergence_tolerance )
+{
+  // Make sure the node communicator is valid
+  testPrecondition( node_comm.get() );
+  testPrecondition( node_comm->isValid() );
+  // Make sure the energies are valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( min_energy < max_energy );
+  // Make sure the convergence tolerance is valid
+  testPrecondition( convergence_tolerance > 0.0 );
+  testPrecondition( convergence_tolerance < 1.0 );
+
+  std::vector<double> unionized_data;
+
+  if( node_comm->rank() == 0 )
+  {
+    this->calculateUnionizedEnergyGridData( min_energy,
+                                            max_energy,
+                                            convergence_tolerance,
+                                            unionized_data );
+  }
+
+  d_local_unionized_data.clear();
+  d_local_unionized_data.shrink_to_fit();
+
+  d_node_shared_unionized_data.reset(
+          new Utility::NodeSharedArray<double>( node_comm, unionized_data ) );
+
+  this->setUnionizedEnergyGridViews( d_node_shared_unionized_data->data(),
+                                     d_node_shared_unionized_data->size() );
+}
+
+// Calculate the unionized energy grid data (packed)
+/*! \details The energy grid, the macroscopic total cross section, the
+ * macroscopic absorption cross section and the scattering center total
+ * cross sections (grouped by grid point) will be packed into a single
+ * array (in that order).
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::calculateUnionizedEnergyGridData(
+                                  const double min_energy,
+                                  const double max_energy,
+                                  const double convergence_tolerance,
+                                  std::vector<double>& unionized_data ) const
+{
+  // Create the initial grid (log spacing with 100 points per decade)
+  const size_t initial_grid_bins =
+    std::max( (size_t)std::ceil( 100*std::log10( max_energy/min_energy ) ),
+              (size_t)1 );
+
+  std::vector<double> energy_grid( initial_grid_bins+1 );
+
+  const double log_grid_spacing =
+    std::log( max_energy/min_energy )/initial_grid_bins;
+
+  energy_grid.front() = min_energy;
+
+  for( size_t i = 1; i < initial_grid_bins; ++i )
+    energy_grid[i] = min_energy*std::exp( i*log_grid_spacing );
+
+  energy_grid.back() = max_energy;
+
+  // Refine the grid until the total and absorption cross sections converge
+  std::function<double(double)> total_cs_evaluator =
+    std::bind<double>( &ThisType::getMacroscopicCrossSection,
+                       std::cref( *this ),
+                       std::placeholders::_1,
+                       std::cref( s_total_cs_evaluation_functor ) );
+
+  std::function<double(double)> absorption_cs_evaluator =
+    std::bind<double>( &ThisType::getMacroscopicCrossSection,
+                       std::cref( *this ),
+                       std::placeholders::_1,
+                       std::cref( s_absorption_cs_evaluation_functor ) );
+
+  Utility::GridGenerator<Utility::LinLin>
+    grid_generator( convergence_tolerance, 1e-12, 1e-14 );
+
+  grid_generator.generateInPlace( energy_grid, total_cs_evaluator );
+
+  // Refine the grid until each scattering center total cross section
+  // converges
+  for( size_t j = 0u; j < d_scattering_centers.size(); ++j )
+  {
+    std::function<double(double)> scattering_center_total_cs_evaluator =
+      std::bind<double>( &ThisType::getScatteringCenterTotalCrossSection,
+                         std::cref( *this ),
+                         j,
+                         std::placeholders::_1 );
+
+    grid_generator.refineInPlace( energy_grid,
+                                  scattering_center_total_cs_evaluator,
+                                  min_energy,
+                                  max_energy );
+  }
+
+  std::vector<double> absorption_cross_section;
+
+  grid_generator.refineAndEvaluateInPlace( energy_grid,
+                                           absorption_cross_section,
+                                           absorption_cs_evaluator,
+                                           min_energy,
+                                           max_energy );
+
+  // Tabulate the scattering center total cross sections (grouped by grid
+  // point) and the macroscopic total cross section on the final grid
+  const size_t number_of_scattering_centers = d_scattering_centers.size();
+
+  const size_t grid_size = energy_grid.size();
+
+  unionized_data.assign( grid_size*(3 + number_of_scattering_centers), 0.0 );
+
+  std::copy( energy_grid.begin(),
+             energy_grid.end(),
+             unionized_data.begin() );
+
+  std::copy( absorption_cross_section.begin(),
+             absorption_cross_section.end(),
+             unionized_data.begin() + 2*grid_size );
+
+  double* total_cross_section = unionized_data.data() + grid_size;
+
+  double* scattering_center_total_cross_sections =
+    unionized_data.data() + 3*grid_size;
+
+  for( size_t i = 0; i < energy_grid.size(); ++i )
+  {
+    for( size_t j = 0; j < number_of_scattering_centers; ++j )
+    {
+      const double cross_section =
+        this->getScatteringCenterTotalCrossSection( j, energy_grid[i] );
+
+      scattering_center_total_cross_sections[i*number_of_scattering_centers+j] =
+        cross_section;
+
+      total_cross_section[i] += cross_section;
+    }
+  }
+}
+
+// Set the unionized energy grid views of the packed data
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::setUnionizedEnergyGridViews(
+                                           const double* unionized_data,
+                                           const size_t unionized_data_size )
+{
+  const size_t grid_size =
+    unionized_data_size/(3 + d_scattering_centers.size());
+
+  // Make sure the unionized data is valid
+  testPrecondition( grid_size*(3 + d_scattering_centers.size()) ==
+                    unionized_data_size );
+
+  d_unionized_energy_grid =
+    Utility::ArrayView<const double>( unionized_data, grid_size );
+
+  d_unionized_total_cross_section =
+    Utility::ArrayView<const double>( unionized_data + grid_size, grid_size );
+
+  d_unionized_absorption_cross_section =
+    Utility::ArrayView<const double>( unionized_data + 2*grid_size,
+                                      grid_size );
+
+  d_unionized_scattering_center_total_cross_sections =
+    Utility::ArrayView<const double>(
+                              unionized_data + 3*grid_size,
+                              grid_size*d_scattering_centers.size() );
+}
+
+// Check if the material has a unionized energy grid
+template<typename ScatteringCenter>
+bool Material<ScatteringCenter>::hasUnionizedEnergyGrid() const
+{
+  return !d_unionized_energy_grid.empty();
+}
+
+// Check if the unionized energy grid is shared by multiple processes
+template<typename ScatteringCenter>
+bool Material<ScatteringCenter>::isUnionizedEnergyGridShared() const
+{
+  if( d_node_shared_unionized_data )
+    return d_node_shared_unionized_data->isShared();
+  else
+    return false;
+}
+
+// Return the number of points in the unionized energy grid
+template<typename ScatteringCenter>
+size_t Material<ScatteringCenter>::getUnionizedEnergyGridSize() const
+{
+  return d_unionized_energy_grid.size();
+}
+
+// Return the memory used by the unionized energy grid data (bytes)
+/*! \details If the data is shared by the processes on the node the memory
+ * used by the single node copy will be returned.
+ */
+template<typename ScatteringCenter>
+size_t Material<ScatteringCenter>::getUnionizedEnergyGridMemoryUsage() const
+{
+  if( d_node_shared_unionized_data )
+    return d_node_shared_unionized_data->size()*sizeof(double);
+  else
+    return d_local_unionized_data.capacity()*sizeof(double);
+}
+
 // Return the macroscopic total cross section (1/cm)
 template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getMacroscopicTotalCrossSection(
 						    const double energy ) const
 {
-  return this->getMacroscopicCrossSection( energy,
-                                           s_total_cs_evaluation_functor );
+  if( this->isEnergyWithinUnionizedEnergyGrid( energy ) )
+  {
+    return this->getUnionizedMacroscopicCrossSection(
+                                             energy,
+                                             d_unionized_total_cross_section );
+  }
+  else
+    return this->getScatteringCenterMacroscopicTotalCrossSection( energy );
 }
 
 // Return the macroscopic absorption cross section (1/cm)
@@ -190,9 +470,24 @@ template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getMacroscopicAbsorptionCrossSection(
 						    const double energy ) const
 {
-  return this->getMacroscopicCrossSection(
-                                          energy,
-                                          s_absorption_cs_evaluation_functor );
+  if( this->isEnergyWithinUnionizedEnergyGrid( energy ) )
+  {
+    return this->getUnionizedMacroscopicCrossSection(
+                                        energy,
+                                        d_unionized_absorption_cross_section );
+  }
+  else
+  {
+    double cross_section = 0.0;
+
+    for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+    {
+      cross_section +=
+        this->getScatteringCenterAbsorptionCrossSection( i, energy );
+    }
+
+    return cross_section;
+  }
 }
 
 // Return the macroscopic cross section (1/cm) for a specific reaction
@@ -408,10 +703,274 @@ size_t Material<ScatteringCenter>::sampleCollisionScatteringCenterImpl(
 template<typename ScatteringCenter>
 size_t Material<ScatteringCenter>::sampleCollisionScatteringCenter( const double energy ) const
 {
-  return this->sampleCollisionScatteringCenterImpl(
-                                     energy,
-                                     d_macroscopic_total_cs_evaluation_functor,
-                                     s_total_cs_evaluation_functor );
+  if( this->isEnergyWithinUnionizedEnergyGrid( energy ) )
+    return this->sampleUnionizedCollisionScatteringCenter( energy );
+
+  // The scattering center total cross sections will be evaluated with the
+  // energy grid bins that were cached when the macroscopic total cross
+  // section was evaluated
+  const double scaled_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    this->getScatteringCenterMacroscopicTotalCrossSection( energy );
+
+  double partial_total_cs = 0.0;
+
+  size_t collision_scattering_center_index =
+    std::numeric_limits<size_t>::max();
+
+  for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+  {
+    partial_total_cs += this->getScatteringCenterTotalCrossSection( i, energy );
+
+    if( scaled_random_number < partial_total_cs )
+    {
+      collision_scattering_center_index = i;
+
+      break;
+    }
+  }
+
+  // Make sure a collision index was found
+  testPostcondition( collision_scattering_center_index !=
+		     std::numeric_limits<size_t>::max() );
+
+  return collision_scattering_center_index;
+}
+
+// Sample the atom that is collided with from the unionized energy grid
+/*! \details The tabulated scattering center total cross sections are
+ * interpolated with the same grid bin and interpolation fraction that were
+ * used to evaluate the macroscopic total cross section so that the partial
+ * sums are consistent with the total.
+ */
+template<typename ScatteringCenter>
+size_t Material<ScatteringCenter>::sampleUnionizedCollisionScatteringCenter(
+                                                   const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( this->isEnergyWithinUnionizedEnergyGrid( energy ) );
+
+  const double scaled_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    this->getUnionizedMacroscopicCrossSection(
+                                             energy,
+                                             d_unionized_total_cross_section );
+
+  const EnergyGridLookupCache& cache =
+    this->getUnionizedEnergyGridLookupCache( energy );
+
+  const size_t number_of_scattering_centers = d_scattering_centers.size();
+
+  const double* lower_cross_sections =
+    d_unionized_scattering_center_total_cross_sections.data() +
+    cache.unionized_energy_grid_index*number_of_scattering_centers;
+
+  const double* upper_cross_sections =
+    lower_cross_sections + number_of_scattering_centers;
+
+  double partial_total_cs = 0.0;
+
+  size_t collision_scattering_center_index =
+    std::numeric_limits<size_t>::max();
+
+  for( size_t i = 0u; i < number_of_scattering_centers; ++i )
+  {
+    const double cross_section = lower_cross_sections[i] +
+      cache.unionized_interpolation_fraction*
+      (upper_cross_sections[i] - lower_cross_sections[i]);
+
+    // Roundoff in the partial sums can leave the scaled random number
+    // above the last partial sum - use the last possible center
+    if( cross_section > 0.0 )
+      collision_scattering_center_index = i;
+
+    partial_total_cs += cross_section;
+
+    if( scaled_random_number < partial_total_cs )
+      break;
+  }
+
+  // Make sure a collision index was found
+  testPostcondition( collision_scattering_center_index !=
+		     std::numeric_limits<size_t>::max() );
+
+  return collision_scattering_center_index;
+}
+
+// Return the energy grid bin of a scattering center
+/*! \details The bin will only be searched for once while the energy of the
+ * particle is unchanged. It is then passed into every total and absorption
+ * cross section evaluation of the scattering center (e.g. once for the
+ * distance to collision and once for sampling the collision scattering
+ * center).
+ */
+template<typename ScatteringCenter>
+inline size_t Material<ScatteringCenter>::getScatteringCenterEnergyGridBinIndex(
+                                                   const size_t index,
+                                                   const double energy ) const
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_scattering_centers.size() );
+
+  EnergyGridLookupCache& cache = this->getEnergyGridLookupCache( energy );
+
+  size_t& energy_grid_bin = cache.scattering_center_energy_grid_bins[index];
+
+  if( energy_grid_bin == std::numeric_limits<size_t>::max() )
+  {
+    energy_grid_bin = Utility::get<1>( d_scattering_centers[index] )->
+      getEnergyGridBinIndex( energy );
+  }
+
+  return energy_grid_bin;
+}
+
+// Return the weighted total cross section of a scattering center
+template<typename ScatteringCenter>
+inline double Material<ScatteringCenter>::getScatteringCenterTotalCrossSection(
+                                                   const size_t index,
+                                                   const double energy ) const
+{
+  return Utility::get<0>( d_scattering_centers[index] )*
+    Utility::get<1>( d_scattering_centers[index] )->getTotalCrossSection(
+              energy, this->getScatteringCenterEnergyGridBinIndex( index, energy ) );
+}
+
+// Return the weighted absorption cross section of a scattering center
+template<typename ScatteringCenter>
+inline double Material<ScatteringCenter>::getScatteringCenterAbsorptionCrossSection(
+                                                   const size_t index,
+                                                   const double energy ) const
+{
+  return Utility::get<0>( d_scattering_centers[index] )*
+    Utility::get<1>( d_scattering_centers[index] )->getAbsorptionCrossSection(
+              energy, this->getScatteringCenterEnergyGridBinIndex( index, energy ) );
+}
+
+// Return the macroscopic total cross section from the scattering centers
+/*! \details The unionized energy grid is never used by this method. The
+ * sum is cached so that it will only be calculated once while the energy of
+ * the particle is unchanged (e.g. once for the distance to collision and
+ * once for sampling the collision scattering center).
+ */
+template<typename ScatteringCenter>
+double Material<ScatteringCenter>::getScatteringCenterMacroscopicTotalCrossSection(
+                                                   const double energy ) const
+{
+  EnergyGridLookupCache& cache = this->getEnergyGridLookupCache( energy );
+
+  if( cache.macroscopic_total_cross_section < 0.0 )
+  {
+    double cross_section = 0.0;
+
+    for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+      cross_section += this->getScatteringCenterTotalCrossSection( i, energy );
+
+    cache.macroscopic_total_cross_section = cross_section;
+  }
+
+  return cache.macroscopic_total_cross_section;
+}
+
+// Return the energy grid lookup cache for the energy (calling thread)
+/*! \details Each thread stores the energy grid data that was resolved for
+ * the last material and energy that it looked up. The cache will be reset
+ * if either the material or the energy differs from the cached values. The
+ * cache is a function-local thread_local variable since gcc emits a
+ * duplicate TLS guard for thread_local static data members of class
+ * templates that are instantiated more than once in a translation unit.
+ */
+template<typename ScatteringCenter>
+inline auto Material<ScatteringCenter>::getEnergyGridLookupCache(
+                                                    const double energy ) const
+  -> EnergyGridLookupCache&
+{
+  // The energy grid lookup cache of each thread
+  static thread_local EnergyGridLookupCache cache;
+
+  if( cache.material_key != d_material_key || cache.energy != energy )
+  {
+    cache.material_key = d_material_key;
+    cache.energy = energy;
+    cache.unionized_energy_grid_index = std::numeric_limits<size_t>::max();
+    cache.unionized_interpolation_fraction = 0.0;
+    cache.macroscopic_total_cross_section = -1.0;
+    cache.scattering_center_energy_grid_bins.assign(
+                                        d_scattering_centers.size(),
+                                        std::numeric_limits<size_t>::max() );
+  }
+
+  return cache;
+}
+
+// Check if an energy falls within the unionized energy grid
+template<typename ScatteringCenter>
+inline bool Material<ScatteringCenter>::isEnergyWithinUnionizedEnergyGrid(
+                                                   const double energy ) const
+{
+  if( d_unionized_energy_grid.empty() )
+    return false;
+  else
+  {
+    return energy >= d_unionized_energy_grid.front() &&
+      energy <= d_unionized_energy_grid.back();
+  }
+}
+
+// Return a macroscopic cross section from the unionized energy grid
+template<typename ScatteringCenter>
+inline double Material<ScatteringCenter>::getUnionizedMacroscopicCrossSection(
+                const double energy,
+                const Utility::ArrayView<const double>& cross_section ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( this->isEnergyWithinUnionizedEnergyGrid( energy ) );
+
+  const EnergyGridLookupCache& cache =
+    this->getUnionizedEnergyGridLookupCache( energy );
+
+  const size_t energy_index = cache.unionized_energy_grid_index;
+
+  return cross_section[energy_index] +
+    cache.unionized_interpolation_fraction*
+    (cross_section[energy_index+1] - cross_section[energy_index]);
+}
+
+// Return the energy grid lookup cache with the unionized grid bin resolved
+template<typename ScatteringCenter>
+inline auto Material<ScatteringCenter>::getUnionizedEnergyGridLookupCache(
+                                                    const double energy ) const
+  -> const EnergyGridLookupCache&
+{
+  // Make sure the energy is valid
+  testPrecondition( this->isEnergyWithinUnionizedEnergyGrid( energy ) );
+
+  EnergyGridLookupCache& cache = this->getEnergyGridLookupCache( energy );
+
+  // Resolve the grid bin and interpolation fraction once per energy
+  if( cache.unionized_energy_grid_index == std::numeric_limits<size_t>::max() )
+  {
+    size_t energy_index =
+      Utility::Search::binaryLowerBoundIndex( d_unionized_energy_grid.begin(),
+                                              d_unionized_energy_grid.end(),
+                                              energy );
+
+    if( energy_index + 1 == d_unionized_energy_grid.size() )
+    {
+      cache.unionized_energy_grid_index = energy_index - 1;
+      cache.unionized_interpolation_fraction = 1.0;
+    }
+    else
+    {
+      cache.unionized_energy_grid_index = energy_index;
+      cache.unionized_interpolation_fraction =
+        (energy - d_unionized_energy_grid[energy_index])/
+        (d_unionized_energy_grid[energy_index+1] -
+         d_unionized_energy_grid[energy_index]);
+    }
+  }
+
+  return cache;
 }
 
 } // end MonteCarlo namespace
@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ReactionCrossSectionTable.hpp
+//! \author Alex Robinson
+//! \brief  The reaction cross section table class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_HPP
+#define MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+
+// FRENSIE Includes
+#include "Utility_ArrayView.hpp"
+#include "Utility_InterpolationType.hpp"
+
+namespace MonteCarlo{
+
+/*! The reaction cross section table class
+ * \details The cross sections of a group of reactions that share an energy
+ * grid are stored in a contiguous (energy grid point major) matrix so that a
+ * reaction can be selected with a single table row read followed by a short
+ * scan (or a binary search when the table is cumulative) instead of a virtual
+ * cross section evaluation for every reaction. The cross sections are
+ * interpolated between the bounding grid points of the energy grid bin
+ * using the interpolation type of the reactions (lin-lin, lin-log, log-lin
+ * or log-log). Only tables with a linear cross section interpolation can be
+ * cumulative. The reactions are stored in the order that they are given,
+ * which makes the selection deterministic.
+ */
+template<typename _ReactionType>
+class ReactionCrossSectionTable
+{
+
+public:
+
+  //! Typedef for the reaction type
+  typedef _ReactionType ReactionType;
+
+  //! Typedef for the reaction array
+  typedef std::vector<std::shared_ptr<const ReactionType> > ReactionArray;
+
+  //! Constructor
+  ReactionCrossSectionTable( const std::vector<double>& energy_grid,
+                             const ReactionArray& reactions,
+                             const std::vector<double>& cross_sections,
+                             const bool cumulative,
+                             const Utility::InterpolationType interp_type =
+                             Utility::LINLIN_INTERPOLATION );
+
+  //! Destructor
+  ~ReactionCrossSectionTable()
+  { /* ... */ }
+
+  //! Return the number of reactions
+  size_t getNumberOfReactions() const;
+
+  //! Return a reaction
+  const ReactionType& getReaction( const size_t reaction_index ) const;
+
+  //! Return the reactions
+  const ReactionArray& getReactions() const;
+
+  //! Return the energy grid
+  Utility::ArrayView<const double> getEnergyGrid() const;
+
+  //! Check if the table is cumulative
+  bool isCumulative() const;
+
+  //! Return the interpolation type
+  Utility::InterpolationType getInterpolationType() const;
+
+  //! Return the cross section of a reaction at an energy grid point
+  double getCrossSection( const size_t energy_grid_index,
+                          const size_t reaction_index ) const;
+
+  //! Return the cross section of a reaction
+  double getCrossSection( const double energy,
+                          const size_t energy_grid_bin,
+                          const size_t reaction_index ) const;
+
+  //! Return the summed cross section of the reactions
+  double getTotalCrossSection( const double energy,
+                               const size_t energy_grid_bin ) const;
+
+  //! Sample the index of a reaction
+  size_t sampleReactionIndex( const double random_number,
+                              const double energy,
+                              const size_t energy_grid_bin ) const;
+
+  //! Sample a reaction
+  const ReactionType& sampleReaction( const double random_number,
+                                      const double energy,
+                                      const size_t energy_grid_bin ) const;
+
+private:
+
+  // Calculate the interpolation fraction of an energy in an energy grid bin
+  double calculateInterpolationFraction( const double energy,
+                                         size_t& energy_grid_bin ) const;
+
+  // Return the (interpolated) table value of a reaction
+  double getTableValue( const size_t energy_grid_bin,
+                        const double interpolation_fraction,
+                        const size_t reaction_index ) const;
+
+  // The energy grid
+  std::vector<double> d_energy_grid;
+
+  // The reactions
+  ReactionArray d_reactions;
+
+  // The cross section table (cumulative if requested)
+  std::vector<double> d_table;
+
+  // Records if the table is cumulative
+  bool d_cumulative;
+
+  // The interpolation type
+  Utility::InterpolationType d_interp_type;
+
+  // Records if the energy is interpolated logarithmically
+  bool d_log_energy;
+
+  // Records if the cross section is interpolated logarithmically
+  bool d_log_cross_section;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_ReactionCrossSectionTable_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ReactionCrossSectionTable.hpp
+//---------------------------------------------------------------------------//
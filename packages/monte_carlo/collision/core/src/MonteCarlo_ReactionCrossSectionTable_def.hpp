@@ -0,0 +1,365 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ReactionCrossSectionTable_def.hpp
+//! \author Alex Robinson
+//! \brief  The reaction cross section table class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_DEF_HPP
+#define MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_DEF_HPP
+
+// Std Lib Includes
+#include <cmath>
+
+// FRENSIE Includes
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The cross sections must be ordered by energy grid point first
+ * (i.e. cross_sections[i*number_of_reactions + r] is the cross section of
+ * reaction r at energy grid point i). The energy grid and the cross sections
+ * must not be processed. If a cumulative table is requested the running sum
+ * of each row will be stored, which allows a binary search to be used when
+ * selecting a reaction. The sum of log interpolated cross sections is not
+ * log interpolated, which is why a cumulative table requires a linear cross
+ * section interpolation.
+ */
+template<typename _ReactionType>
+ReactionCrossSectionTable<_ReactionType>::ReactionCrossSectionTable(
+                                 const std::vector<double>& energy_grid,
+                                 const ReactionArray& reactions,
+                                 const std::vector<double>& cross_sections,
+                                 const bool cumulative,
+                                 const Utility::InterpolationType interp_type )
+  : d_energy_grid( energy_grid ),
+    d_reactions( reactions ),
+    d_table( cross_sections ),
+    d_cumulative( cumulative ),
+    d_interp_type( interp_type ),
+    d_log_energy( false ),
+    d_log_cross_section( false )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 1 );
+  // Make sure the reactions are valid
+  testPrecondition( reactions.size() > 0 );
+  // Make sure the cross sections are valid
+  testPrecondition( cross_sections.size() ==
+                    energy_grid.size()*reactions.size() );
+
+  switch( interp_type )
+  {
+  case Utility::LINLIN_INTERPOLATION:
+    break;
+  case Utility::LINLOG_INTERPOLATION:
+    d_log_energy = true;
+    break;
+  case Utility::LOGLIN_INTERPOLATION:
+    d_log_cross_section = true;
+    break;
+  case Utility::LOGLOG_INTERPOLATION:
+    d_log_energy = true;
+    d_log_cross_section = true;
+    break;
+  default:
+    THROW_EXCEPTION( std::runtime_error,
+                     "Interpolation type " << interp_type << " is not "
+                     "supported by the reaction cross section table!" );
+  }
+
+  TEST_FOR_EXCEPTION( d_cumulative && d_log_cross_section,
+                      std::runtime_error,
+                      "A cumulative reaction cross section table requires a "
+                      "linear cross section interpolation!" );
+
+  if( d_cumulative )
+  {
+    for( size_t i = 0; i < d_energy_grid.size(); ++i )
+    {
+      double* row = d_table.data() + i*d_reactions.size();
+
+      for( size_t r = 1; r < d_reactions.size(); ++r )
+        row[r] += row[r-1];
+    }
+  }
+}
+
+// Return the number of reactions
+template<typename _ReactionType>
+inline size_t ReactionCrossSectionTable<_ReactionType>::getNumberOfReactions() const
+{
+  return d_reactions.size();
+}
+
+// Return a reaction
+template<typename _ReactionType>
+inline auto ReactionCrossSectionTable<_ReactionType>::getReaction(
+                   const size_t reaction_index ) const -> const ReactionType&
+{
+  // Make sure the reaction index is valid
+  testPrecondition( reaction_index < d_reactions.size() );
+
+  return *d_reactions[reaction_index];
+}
+
+// Return the reactions
+template<typename _ReactionType>
+inline auto ReactionCrossSectionTable<_ReactionType>::getReactions() const -> const ReactionArray&
+{
+  return d_reactions;
+}
+
+// Return the energy grid
+template<typename _ReactionType>
+inline Utility::ArrayView<const double>
+ReactionCrossSectionTable<_ReactionType>::getEnergyGrid() const
+{
+  return Utility::arrayViewOfConst( d_energy_grid );
+}
+
+// Check if the table is cumulative
+template<typename _ReactionType>
+inline bool ReactionCrossSectionTable<_ReactionType>::isCumulative() const
+{
+  return d_cumulative;
+}
+
+// Return the interpolation type
+template<typename _ReactionType>
+inline Utility::InterpolationType
+ReactionCrossSectionTable<_ReactionType>::getInterpolationType() const
+{
+  return d_interp_type;
+}
+
+// Return the cross section of a reaction at an energy grid point
+template<typename _ReactionType>
+double ReactionCrossSectionTable<_ReactionType>::getCrossSection(
+                                           const size_t energy_grid_index,
+                                           const size_t reaction_index ) const
+{
+  // Make sure the indices are valid
+  testPrecondition( energy_grid_index < d_energy_grid.size() );
+  testPrecondition( reaction_index < d_reactions.size() );
+
+  const double* row = d_table.data() + energy_grid_index*d_reactions.size();
+
+  if( d_cumulative && reaction_index > 0 )
+    return row[reaction_index] - row[reaction_index-1];
+  else
+    return row[reaction_index];
+}
+
+// Return the cross section of a reaction
+template<typename _ReactionType>
+double ReactionCrossSectionTable<_ReactionType>::getCrossSection(
+                                           const double energy,
+                                           const size_t energy_grid_bin,
+                                           const size_t reaction_index ) const
+{
+  // Make sure the reaction index is valid
+  testPrecondition( reaction_index < d_reactions.size() );
+
+  size_t bin = energy_grid_bin;
+
+  const double interpolation_fraction =
+    this->calculateInterpolationFraction( energy, bin );
+
+  double cross_section =
+    this->getTableValue( bin, interpolation_fraction, reaction_index );
+
+  if( d_cumulative && reaction_index > 0 )
+  {
+    cross_section -=
+      this->getTableValue( bin, interpolation_fraction, reaction_index-1 );
+  }
+
+  return cross_section;
+}
+
+// Return the summed cross section of the reactions
+template<typename _ReactionType>
+double ReactionCrossSectionTable<_ReactionType>::getTotalCrossSection(
+                                          const double energy,
+                                          const size_t energy_grid_bin ) const
+{
+  size_t bin = energy_grid_bin;
+
+  const double interpolation_fraction =
+    this->calculateInterpolationFraction( energy, bin );
+
+  if( d_cumulative )
+  {
+    return this->getTableValue( bin,
+                                interpolation_fraction,
+                                d_reactions.size()-1 );
+  }
+  else
+  {
+    double total_cross_section = 0.0;
+
+    for( size_t r = 0; r < d_reactions.size(); ++r )
+    {
+      total_cross_section +=
+        this->getTableValue( bin, interpolation_fraction, r );
+    }
+
+    return total_cross_section;
+  }
+}
+
+// Sample the index of a reaction
+/*! \details The random number must be in [0,1). The first reaction with a
+ * (cumulative) cross section that exceeds the random number times the summed
+ * cross section will be selected.
+ */
+template<typename _ReactionType>
+size_t ReactionCrossSectionTable<_ReactionType>::sampleReactionIndex(
+                                          const double random_number,
+                                          const double energy,
+                                          const size_t energy_grid_bin ) const
+{
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number < 1.0 );
+
+  size_t bin = energy_grid_bin;
+
+  const double interpolation_fraction =
+    this->calculateInterpolationFraction( energy, bin );
+
+  size_t reaction_index;
+
+  if( d_cumulative )
+  {
+    const double scaled_random_number = random_number*
+      this->getTableValue( bin, interpolation_fraction, d_reactions.size()-1 );
+
+    size_t lower_index = 0;
+    size_t upper_index = d_reactions.size()-1;
+
+    while( lower_index < upper_index )
+    {
+      const size_t mid_index = (lower_index + upper_index)/2;
+
+      if( scaled_random_number <
+          this->getTableValue( bin, interpolation_fraction, mid_index ) )
+        upper_index = mid_index;
+      else
+        lower_index = mid_index + 1;
+    }
+
+    reaction_index = lower_index;
+  }
+  else
+  {
+    double total_cross_section = 0.0;
+
+    for( size_t r = 0; r < d_reactions.size(); ++r )
+    {
+      total_cross_section +=
+        this->getTableValue( bin, interpolation_fraction, r );
+    }
+
+    const double scaled_random_number = random_number*total_cross_section;
+
+    double partial_cross_section = 0.0;
+
+    for( reaction_index = 0; reaction_index < d_reactions.size()-1; ++reaction_index )
+    {
+      partial_cross_section +=
+        this->getTableValue( bin, interpolation_fraction, reaction_index );
+
+      if( scaled_random_number < partial_cross_section )
+        break;
+    }
+  }
+
+  // Make sure the reaction index is valid
+  testPostcondition( reaction_index < d_reactions.size() );
+
+  return reaction_index;
+}
+
+// Sample a reaction
+template<typename _ReactionType>
+inline auto ReactionCrossSectionTable<_ReactionType>::sampleReaction(
+                                          const double random_number,
+                                          const double energy,
+                                          const size_t energy_grid_bin ) const
+  -> const ReactionType&
+{
+  return *d_reactions[this->sampleReactionIndex( random_number,
+                                                 energy,
+                                                 energy_grid_bin )];
+}
+
+// Calculate the interpolation fraction of an energy in an energy grid bin
+/*! \details The upper bound of the energy grid is associated with the last
+ * energy grid bin. Energies outside of the bin will be clamped to the bin.
+ * When the energy is interpolated logarithmically the fraction is calculated
+ * from the log of the energies (a lower bin energy of zero falls back to a
+ * linear fraction, as is done by the reactions).
+ */
+template<typename _ReactionType>
+inline double
+ReactionCrossSectionTable<_ReactionType>::calculateInterpolationFraction(
+                                               const double energy,
+                                               size_t& energy_grid_bin ) const
+{
+  // Make sure the energy grid bin is valid
+  testPrecondition( energy_grid_bin < d_energy_grid.size() );
+
+  if( energy_grid_bin == d_energy_grid.size() - 1 )
+    --energy_grid_bin;
+
+  const double lower_energy = d_energy_grid[energy_grid_bin];
+  const double upper_energy = d_energy_grid[energy_grid_bin+1];
+
+  if( energy <= lower_energy || upper_energy <= lower_energy )
+    return 0.0;
+  else if( energy >= upper_energy )
+    return 1.0;
+  else if( d_log_energy && lower_energy > 0.0 )
+    return std::log( energy/lower_energy )/std::log( upper_energy/lower_energy );
+  else
+    return (energy - lower_energy)/(upper_energy - lower_energy);
+}
+
+// Return the (interpolated) table value of a reaction
+/*! \details When the cross section is interpolated logarithmically a zero
+ * value at either grid point (e.g. at a reaction threshold) falls back to a
+ * linear interpolation, as is done by the reactions.
+ */
+template<typename _ReactionType>
+inline double ReactionCrossSectionTable<_ReactionType>::getTableValue(
+                                     const size_t energy_grid_bin,
+                                     const double interpolation_fraction,
+                                     const size_t reaction_index ) const
+{
+  const double lower_value =
+    d_table[energy_grid_bin*d_reactions.size() + reaction_index];
+
+  const double upper_value =
+    d_table[(energy_grid_bin+1)*d_reactions.size() + reaction_index];
+
+  if( d_log_cross_section && lower_value > 0.0 && upper_value > 0.0 )
+  {
+    return lower_value*std::pow( upper_value/lower_value,
+                                 interpolation_fraction );
+  }
+  else
+    return lower_value + interpolation_fraction*(upper_value - lower_value);
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ReactionCrossSectionTable_def.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,58 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ScatteringCenterFactoryHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Scattering center factory helper function definitions
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <exception>
+
+// FRENSIE Includes
+#include "MonteCarlo_ScatteringCenterFactoryHelpers.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+namespace MonteCarlo{
+
+// Load scattering center data tables concurrently
+/*! \details Each loader will be called exactly once. The loaders will be
+ * distributed over the number of threads requested through
+ * Utility::OpenMPProperties. Every loader must only write to its own
+ * scattering center. Exceptions cannot escape an OpenMP parallel block so
+ * the first exception that is thrown by a loader will be rethrown after all
+ * of the loaders have finished.
+ */
+void loadScatteringCenterDataTables(
+      const std::vector<ScatteringCenterDataTableLoader>& data_table_loaders )
+{
+  std::exception_ptr loader_exception;
+
+  const long long number_of_loaders = data_table_loaders.size();
+
+  // Tables can differ greatly in size - assign them to threads dynamically
+  #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( long long i = 0; i < number_of_loaders; ++i )
+  {
+    try{
+      data_table_loaders[i]();
+    }
+    catch( ... )
+    {
+      #pragma omp critical( monte_carlo_scattering_center_data_table_loading )
+      {
+        if( !loader_exception )
+          loader_exception = std::current_exception();
+      }
+    }
+  }
+
+  if( loader_exception )
+    std::rethrow_exception( loader_exception );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ScatteringCenterFactoryHelpers.cpp
+//---------------------------------------------------------------------------//
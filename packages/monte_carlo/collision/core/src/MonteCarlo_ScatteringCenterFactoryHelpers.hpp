@@ -0,0 +1,33 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ScatteringCenterFactoryHelpers.hpp
+//! \author Alex Robinson
+//! \brief  Scattering center factory helper function declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SCATTERING_CENTER_FACTORY_HELPERS_HPP
+#define MONTE_CARLO_SCATTERING_CENTER_FACTORY_HELPERS_HPP
+
+// Std Lib Includes
+#include <functional>
+
+// FRENSIE Includes
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+//! The scattering center data table loader type
+typedef std::function<void()> ScatteringCenterDataTableLoader;
+
+//! Load scattering center data tables concurrently
+void loadScatteringCenterDataTables(
+     const std::vector<ScatteringCenterDataTableLoader>& data_table_loaders );
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_SCATTERING_CENTER_FACTORY_HELPERS_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ScatteringCenterFactoryHelpers.hpp
+//---------------------------------------------------------------------------//
@@ -141,6 +141,33 @@ FRENSIE_UNIT_TEST( AtomicRelaxationModelFactory, cache_models )
   FRENSIE_CHECK( relaxation_model == copy_a_relaxation_model );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a relaxation model can be cached by multiple threads
+FRENSIE_UNIT_TEST( AtomicRelaxationModelFactory, cache_models_concurrently )
+{
+  MonteCarlo::AtomicRelaxationModelFactory factory;
+
+  std::vector<std::shared_ptr<const MonteCarlo::AtomicRelaxationModel> >
+    thread_relaxation_models( 16 );
+
+  #pragma omp parallel for num_threads( 4 )
+  for( int i = 0; i < (int)thread_relaxation_models.size(); ++i )
+  {
+    factory.createAndCacheAtomicRelaxationModel( *native_data_container,
+                                                 thread_relaxation_models[i],
+                                                 1e-3,
+                                                 1e-5,
+                                                 true );
+  }
+
+  // Every thread must get the same (cached) model
+  for( size_t i = 1; i < thread_relaxation_models.size(); ++i )
+  {
+    FRENSIE_CHECK( thread_relaxation_models[i] ==
+                   thread_relaxation_models.front() );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
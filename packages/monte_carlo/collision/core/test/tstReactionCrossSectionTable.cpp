@@ -0,0 +1,187 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstReactionCrossSectionTable.cpp
+//! \author Alex Robinson
+//! \brief  Reaction cross section table unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_ReactionCrossSectionTable.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Structs
+//---------------------------------------------------------------------------//
+struct TestReaction
+{
+  TestReaction( const int id )
+    : id( id )
+  { /* ... */ }
+
+  int id;
+};
+
+typedef MonteCarlo::ReactionCrossSectionTable<TestReaction> TestTable;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a test table
+std::shared_ptr<TestTable> createTestTable(
+                                 const bool cumulative,
+                                 const Utility::InterpolationType interp_type =
+                                 Utility::LINLIN_INTERPOLATION )
+{
+  TestTable::ReactionArray reactions( 3 );
+  reactions[0].reset( new TestReaction( 0 ) );
+  reactions[1].reset( new TestReaction( 1 ) );
+  reactions[2].reset( new TestReaction( 2 ) );
+
+  // Reaction 1 has a threshold at the second grid point
+  std::vector<double> cross_sections( {1.0, 0.0, 3.0,
+                                       2.0, 2.0, 4.0,
+                                       1.0, 4.0, 3.0} );
+
+  return std::make_shared<TestTable>( std::vector<double>( {1.0, 2.0, 4.0} ),
+                                      reactions,
+                                      cross_sections,
+                                      cumulative,
+                                      interp_type );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the table data can be returned
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, getCrossSection )
+{
+  for( bool cumulative : {false, true} )
+  {
+    std::shared_ptr<TestTable> table = createTestTable( cumulative );
+
+    FRENSIE_CHECK_EQUAL( table->isCumulative(), cumulative );
+    FRENSIE_CHECK_EQUAL( table->getInterpolationType(),
+                         Utility::LINLIN_INTERPOLATION );
+    FRENSIE_REQUIRE_EQUAL( table->getNumberOfReactions(), 3 );
+    FRENSIE_CHECK_EQUAL( table->getReaction( 2 ).id, 2 );
+    FRENSIE_CHECK_EQUAL( table->getEnergyGrid(),
+                         std::vector<double>( {1.0, 2.0, 4.0} ) );
+
+    // Grid point values
+    FRENSIE_CHECK_EQUAL( table->getCrossSection( 0, 0 ), 1.0 );
+    FRENSIE_CHECK_EQUAL( table->getCrossSection( 0, 1 ), 0.0 );
+    FRENSIE_CHECK_EQUAL( table->getCrossSection( 1, 2 ), 4.0 );
+    FRENSIE_CHECK_EQUAL( table->getCrossSection( 2, 1 ), 4.0 );
+
+    // Interpolated values
+    FRENSIE_CHECK_FLOATING_EQUALITY( table->getCrossSection( 1.5, 0, 0 ),
+                                     1.5, 1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( table->getCrossSection( 1.5, 0, 1 ),
+                                     1.0, 1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( table->getCrossSection( 3.0, 1, 2 ),
+                                     3.5, 1e-15 );
+
+    // The upper bound of the grid can be associated with the last bin
+    FRENSIE_CHECK_FLOATING_EQUALITY( table->getCrossSection( 4.0, 2, 1 ),
+                                     4.0, 1e-15 );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY( table->getTotalCrossSection( 1.0, 0 ),
+                                     4.0, 1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( table->getTotalCrossSection( 1.5, 0 ),
+                                     6.0, 1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( table->getTotalCrossSection( 4.0, 1 ),
+                                     8.0, 1e-15 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the table data can be interpolated with the reaction policy
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, getCrossSection_log )
+{
+  std::shared_ptr<TestTable> table =
+    createTestTable( false, Utility::LOGLOG_INTERPOLATION );
+
+  FRENSIE_CHECK_EQUAL( table->getInterpolationType(),
+                       Utility::LOGLOG_INTERPOLATION );
+
+  // Log-log interpolated values
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getCrossSection( std::sqrt(2.0), 0, 0 ),
+                                   std::sqrt(2.0), 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getCrossSection( std::sqrt(2.0), 0, 2 ),
+                                   std::sqrt(12.0), 1e-15 );
+
+  // A zero cross section is interpolated linearly
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getCrossSection( std::sqrt(2.0), 0, 1 ),
+                                   1.0, 1e-15 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                           table->getTotalCrossSection( std::sqrt(2.0), 0 ),
+                           std::sqrt(2.0) + 1.0 + std::sqrt(12.0), 1e-15 );
+
+  table = createTestTable( true, Utility::LINLOG_INTERPOLATION );
+
+  // Lin-log interpolated values
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getCrossSection( 3.0, 1, 2 ),
+                                   4.0 - std::log(1.5)/std::log(2.0), 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getTotalCrossSection( 3.0, 1 ),
+                                   8.0, 1e-15 );
+
+  // A log cross section interpolation cannot be used with a cumulative table
+  FRENSIE_CHECK_THROW( createTestTable( true, Utility::LOGLOG_INTERPOLATION ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( createTestTable( false,
+                                        Utility::HISTOGRAM_INTERPOLATION ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a reaction can be sampled
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, sampleReaction )
+{
+  for( bool cumulative : {false, true} )
+  {
+    std::shared_ptr<TestTable> table = createTestTable( cumulative );
+
+    // Cross sections at 1.0: 1.0, 0.0, 3.0
+    FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.0, 1.0, 0 ), 0 );
+    FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.24, 1.0, 0 ), 0 );
+    FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.25, 1.0, 0 ), 2 );
+    FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.99, 1.0, 0 ), 2 );
+
+    // Cross sections at 1.5: 1.5, 1.0, 3.5
+    FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.24, 1.5, 0 ), 0 );
+    FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.26, 1.5, 0 ), 1 );
+    FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.41, 1.5, 0 ), 1 );
+    FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.42, 1.5, 0 ), 2 );
+
+    // Cross sections at 4.0: 1.0, 4.0, 3.0
+    FRENSIE_CHECK_EQUAL( table->sampleReaction( 0.1, 4.0, 2 ).id, 0 );
+    FRENSIE_CHECK_EQUAL( table->sampleReaction( 0.5, 4.0, 2 ).id, 1 );
+    FRENSIE_CHECK_EQUAL( table->sampleReaction( 0.7, 4.0, 2 ).id, 2 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a reaction can be sampled with the reaction policy
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, sampleReaction_log )
+{
+  std::shared_ptr<TestTable> table =
+    createTestTable( false, Utility::LOGLOG_INTERPOLATION );
+
+  // Cross sections at sqrt(2): sqrt(2), 1.0, sqrt(12)
+  const double energy = std::sqrt(2.0);
+
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.24, energy, 0 ), 0 );
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.25, energy, 0 ), 1 );
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.41, energy, 0 ), 1 );
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.42, energy, 0 ), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstReactionCrossSectionTable.cpp
+//---------------------------------------------------------------------------//
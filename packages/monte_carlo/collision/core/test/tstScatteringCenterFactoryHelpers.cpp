@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstScatteringCenterFactoryHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Scattering center factory helper function unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "MonteCarlo_ScatteringCenterFactoryHelpers.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that every data table loader is called exactly once
+FRENSIE_UNIT_TEST( ScatteringCenterFactoryHelpers,
+                   loadScatteringCenterDataTables )
+{
+  std::vector<int> loader_calls( 100, 0 );
+
+  std::vector<MonteCarlo::ScatteringCenterDataTableLoader> loaders;
+
+  for( size_t i = 0; i < loader_calls.size(); ++i )
+    loaders.push_back( [&loader_calls,i](){ ++loader_calls[i]; } );
+
+  MonteCarlo::loadScatteringCenterDataTables( loaders );
+
+  FRENSIE_CHECK_EQUAL( loader_calls, std::vector<int>( 100, 1 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an empty set of data table loaders can be handled
+FRENSIE_UNIT_TEST( ScatteringCenterFactoryHelpers,
+                   loadScatteringCenterDataTables_empty )
+{
+  std::vector<MonteCarlo::ScatteringCenterDataTableLoader> loaders;
+
+  FRENSIE_CHECK_NO_THROW( MonteCarlo::loadScatteringCenterDataTables( loaders ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a data table loader exception will be rethrown
+FRENSIE_UNIT_TEST( ScatteringCenterFactoryHelpers,
+                   loadScatteringCenterDataTables_exception )
+{
+  std::vector<int> loader_calls( 10, 0 );
+
+  std::vector<MonteCarlo::ScatteringCenterDataTableLoader> loaders;
+
+  for( size_t i = 0; i < loader_calls.size(); ++i )
+  {
+    if( i == 5 )
+    {
+      loaders.push_back( [&loader_calls,i](){
+          ++loader_calls[i];
+
+          throw std::runtime_error( "bad data table" ); } );
+    }
+    else
+      loaders.push_back( [&loader_calls,i](){ ++loader_calls[i]; } );
+  }
+
+  FRENSIE_CHECK_THROW( MonteCarlo::loadScatteringCenterDataTables( loaders ),
+                       std::runtime_error );
+
+  // The remaining loaders must still be called
+  FRENSIE_CHECK_EQUAL( loader_calls, std::vector<int>( 10, 1 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+unsigned threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set the number of threads to use
+  Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstScatteringCenterFactoryHelpers.cpp
+//---------------------------------------------------------------------------//
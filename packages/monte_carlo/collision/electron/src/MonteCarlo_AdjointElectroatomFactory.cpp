@@ -9,7 +9,9 @@
 // FRENSIE Includes
 #include "MonteCarlo_AdjointElectroatomFactory.hpp"
 #include "MonteCarlo_AdjointElectroatomNativeFactory.hpp"
+#include "MonteCarlo_ScatteringCenterFactoryHelpers.hpp"
 #include "Data_AdjointElectronPhotonRelaxationDataContainer.hpp"
+#include "Data_DataContainerHelpers.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_LoggingMacros.hpp"
@@ -33,7 +35,14 @@ AdjointElectroatomFactory::AdjointElectroatomFactory(
   FRENSIE_LOG_NOTIFICATION( "Starting to load adjoint electroatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
-  // Create each adjoint electroatom in the set
+  // The adjoint electroatoms that use each data table
+  std::vector<std::pair<std::string,AdjointElectroatomNameMap::mapped_type*> >
+    adjoint_electroatom_tables;
+
+  // The loaders for each data table (every table is only loaded once)
+  std::vector<ScatteringCenterDataTableLoader> table_loaders;
+
+  // Find the data table used by each adjoint electroatom in the set
   ScatteringCenterNameSet::const_iterator adjoint_electroatom_name =
     adjoint_electroatom_names.begin();
 
@@ -59,40 +68,62 @@ AdjointElectroatomFactory::AdjointElectroatomFactory(
     const Data::AdjointElectroatomicDataProperties& adjoint_electroatomic_data_properties =
       adjoint_electroatom_definition.getAdjointElectroatomicDataProperties( &atomic_weight );
 
-    if( adjoint_electroatomic_data_properties.fileType() ==
-        Data::AdjointElectroatomicDataProperties::Native_EPR_FILE )
-    {
-      if( d_adjoint_electroatomic_table_name_map.find( Data::AdjointElectroatomicDataProperties::Native_EPR_FILE ) ==
-          d_adjoint_electroatomic_table_name_map.end() )
-      {
-        d_adjoint_electroatomic_table_name_map[Data::AdjointElectroatomicDataProperties::Native_EPR_FILE];
-      }
-
-      this->createAdjointElectroatomFromNativeTable(
-                                         data_directory,
-                                         *adjoint_electroatom_name,
-                                         atomic_weight,
-                                         adjoint_electroatomic_data_properties,
-                                         properties );
-    }
-    else
+    TEST_FOR_EXCEPTION( adjoint_electroatomic_data_properties.fileType() !=
+                        Data::AdjointElectroatomicDataProperties::Native_EPR_FILE,
+                        std::runtime_error,
+                        "Adjoint electroatom " << *adjoint_electroatom_name <<
+                        " cannot be created because its definition specifies "
+                        "the use of an adjoint electroatomic data file of type "
+                        << adjoint_electroatomic_data_properties.fileType() <<
+                        ", which is currently unsupported!" );
+
+    const std::string table_key =
+      adjoint_electroatomic_data_properties.filePath().string();
+
+    AdjointElectroatomNameMap& table_name_map =
+      d_adjoint_electroatomic_table_name_map[adjoint_electroatomic_data_properties.fileType()];
+
+    // Check if the table has already been scheduled for loading
+    if( table_name_map.find( table_key ) == table_name_map.end() )
     {
-      THROW_EXCEPTION( std::runtime_error,
-                       "Adjoint electroatom " << *adjoint_electroatom_name <<
-                       " cannot be created because its definition specifies "
-                       "the use of an adjoint electroatomic data file of type "
-                       << adjoint_electroatomic_data_properties.fileType() <<
-                       ", which is currently unsupported!" );
+      const Data::AdjointElectroatomicDataProperties* data_properties =
+        &adjoint_electroatomic_data_properties;
+
+      AdjointElectroatomNameMap::mapped_type* adjoint_electroatom =
+        &table_name_map[table_key];
+
+      table_loaders.push_back(
+        [this,&data_directory,&properties,atomic_weight,data_properties,adjoint_electroatom](){
+          this->createAdjointElectroatomFromNativeTable( data_directory,
+                                                         atomic_weight,
+                                                         *data_properties,
+                                                         properties,
+                                                         *adjoint_electroatom ); } );
     }
 
+    adjoint_electroatom_tables.push_back(
+                          std::make_pair( *adjoint_electroatom_name,
+                                          &table_name_map[table_key] ) );
+
     ++adjoint_electroatom_name;
   }
 
+  // Load the data tables
+  loadScatteringCenterDataTables( table_loaders );
+
+  // Assign the loaded data tables to the adjoint electroatoms
+  for( size_t i = 0; i < adjoint_electroatom_tables.size(); ++i )
+  {
+    d_adjoint_electroatom_name_map[adjoint_electroatom_tables[i].first] =
+      *adjoint_electroatom_tables[i].second;
+  }
+
   // Make sure that every adjoint electroatom has been created
   testPostcondition( d_adjoint_electroatom_name_map.size() ==
                      adjoint_electroatom_names.size() );
 
-  FRENSIE_LOG_NOTIFICATION( "Finished loading adjoint electroatom data tables." );
+  FRENSIE_LOG_NOTIFICATION( "Finished loading adjoint electroatom data tables ("
+                            << table_loaders.size() << " tables)." );
   FRENSIE_FLUSH_ALL_LOGS();
 }
 
@@ -104,86 +135,63 @@ void AdjointElectroatomFactory::createAdjointElectroatomMap(
 }
 
 // Create a adjoint electroatom from a Native table
+/*! \details This method can be called concurrently for different tables.
+ */
 void AdjointElectroatomFactory::createAdjointElectroatomFromNativeTable(
                const boost::filesystem::path& data_directory,
-               const std::string& adjoint_electroatom_name,
                const double atomic_weight,
                const Data::AdjointElectroatomicDataProperties& data_properties,
-               const SimulationProperties& properties )
+               const SimulationProperties& properties,
+               AdjointElectroatomNameMap::mapped_type& adjoint_electroatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_adjoint_electroatomic_table_name_map[Data::AdjointElectroatomicDataProperties::Native_EPR_FILE].find( data_properties.filePath().string() ) ==
-      d_adjoint_electroatomic_table_name_map[Data::AdjointElectroatomicDataProperties::Native_EPR_FILE].end() )
-  {
-    // Construct the path to the native file
-    boost::filesystem::path native_file_path = data_directory;
-    native_file_path /= data_properties.filePath();
-    native_file_path.make_preferred();
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                "Loading native adjoint EPR cross section "
-                                "table (v " << data_properties.fileVersion() <<
-                                ") for " << data_properties.atom() <<
-                                " from " << native_file_path.string() <<
-                                " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-
-    // Create the native data container
-    Data::AdjointElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
-
-    // Make sure the min adjoint electron energy are within the energy grid limits
-    TEST_FOR_EXCEPTION( properties.getMinAdjointElectronEnergy() < data_container.getAdjointElectronEnergyGrid().front(),
-                        std::runtime_error,
-                        "The minimum adjoint electron energy "
-                        << properties.getMinAdjointElectronEnergy() <<
-                        " was set below the minimum energy in the adjoint "
-                        "electron energy grid "
-                        << data_container.getAdjointElectronEnergyGrid().front() <<
-                        ". Please rerun the simulation with a valid minimum "
-                        "adjoint electron energy!" );
-
-    // Make sure the max adjoint electron energy are within the energy grid limits
-    TEST_FOR_EXCEPTION( properties.getMaxAdjointElectronEnergy() > data_container.getAdjointElectronEnergyGrid().back(),
-                        std::runtime_error,
-                        "The maximum adjoint electron energy "
-                        << properties.getMaxAdjointElectronEnergy() <<
-                        " was set above the maximum energy in the adjoint "
-                        "electron energy grid "
-                        << data_container.getAdjointElectronEnergyGrid().back() <<
-                        ". Please rerun the simulation with a valid maximum "
-                        "adjoint electron energy!" );
-
-    // Initialize the new adjoint electroatom
-    AdjointElectroatomNameMap::mapped_type& adjoint_electroatom =
-      d_adjoint_electroatom_name_map[adjoint_electroatom_name];
-
-    // Create the new adjoint electroatom
-    AdjointElectroatomNativeFactory::createAdjointElectroatom(
+  // Construct the path to the native file
+  boost::filesystem::path native_file_path = data_directory;
+  native_file_path /= data_properties.filePath();
+  native_file_path.make_preferred();
+
+  // Use the flat array archive export of the table if there is one
+  native_file_path = Data::resolveFlatArrayArchivePath( native_file_path );
+
+  // Create the native data container
+  Data::AdjointElectronPhotonRelaxationDataContainer
+    data_container( native_file_path );
+
+  // Make sure the min adjoint electron energy are within the energy grid limits
+  TEST_FOR_EXCEPTION( properties.getMinAdjointElectronEnergy() < data_container.getAdjointElectronEnergyGrid().front(),
+                      std::runtime_error,
+                      "The minimum adjoint electron energy "
+                      << properties.getMinAdjointElectronEnergy() <<
+                      " was set below the minimum energy in the adjoint "
+                      "electron energy grid "
+                      << data_container.getAdjointElectronEnergyGrid().front() <<
+                      ". Please rerun the simulation with a valid minimum "
+                      "adjoint electron energy!" );
+
+  // Make sure the max adjoint electron energy are within the energy grid limits
+  TEST_FOR_EXCEPTION( properties.getMaxAdjointElectronEnergy() > data_container.getAdjointElectronEnergyGrid().back(),
+                      std::runtime_error,
+                      "The maximum adjoint electron energy "
+                      << properties.getMaxAdjointElectronEnergy() <<
+                      " was set above the maximum energy in the adjoint "
+                      "electron energy grid "
+                      << data_container.getAdjointElectronEnergyGrid().back() <<
+                      ". Please rerun the simulation with a valid maximum "
+                      "adjoint electron energy!" );
+
+  // Create the new adjoint electroatom
+  AdjointElectroatomNativeFactory::createAdjointElectroatom(
                                            data_container,
                                            data_properties.filePath().string(),
                                            atomic_weight,
                                            properties,
                                            adjoint_electroatom );
 
-    // Cache the new adjoint electroatom in the table name map
-    d_adjoint_electroatomic_table_name_map[Data::AdjointElectroatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()] =
-      adjoint_electroatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
+  if( d_verbose )
   {
-    d_adjoint_electroatom_name_map[adjoint_electroatom_name] =
-      d_adjoint_electroatomic_table_name_map[Data::AdjointElectroatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()];
+    FRENSIE_LOG_NOTIFICATION( " Loaded native adjoint EPR cross section "
+                              "table (v " << data_properties.fileVersion() <<
+                              ") for " << data_properties.atom() <<
+                              " from " << native_file_path.string() << "." );
   }
 }
 
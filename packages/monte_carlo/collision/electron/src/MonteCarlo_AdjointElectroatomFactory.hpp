@@ -59,10 +59,10 @@ private:
   // Create a adjoint electroatom from a Native table
   void createAdjointElectroatomFromNativeTable(
                const boost::filesystem::path& data_directory,
-               const std::string& adjoint_electroatom_name,
                const double atomic_weight,
                const Data::AdjointElectroatomicDataProperties& data_properties,
-               const SimulationProperties& properties );
+               const SimulationProperties& properties,
+               AdjointElectroatomNameMap::mapped_type& adjoint_electroatom ) const;
   
   // The adjoint electroatom map
   AdjointElectroatomNameMap d_adjoint_electroatom_name_map;
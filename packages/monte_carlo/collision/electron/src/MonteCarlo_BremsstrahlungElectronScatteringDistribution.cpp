@@ -18,12 +18,16 @@ namespace MonteCarlo{
 // Constructor with simple analytical photon angular distribution
 BremsstrahlungElectronScatteringDistribution::BremsstrahlungElectronScatteringDistribution(
     const std::shared_ptr<const BasicBivariateDist>& bremsstrahlung_scattering_distribution,
-    const bool bank_secondary_particles )
+    const bool bank_secondary_particles,
+    const double min_photon_energy )
   : d_bremsstrahlung_scattering_distribution( bremsstrahlung_scattering_distribution ),
-    d_bank_secondary_particles( bank_secondary_particles )
+    d_bank_secondary_particles( bank_secondary_particles ),
+    d_min_photon_energy( min_photon_energy )
 {
   // Make sure the array is valid
   testPrecondition( d_bremsstrahlung_scattering_distribution.use_count() > 0 );
+  // Make sure the min photon energy is valid
+  testPrecondition( min_photon_energy > 0.0 );
 
   // Use simple analytical photon angular distribution
   d_angular_distribution_func = [this]( const double& incoming_energy,
@@ -37,13 +41,17 @@ BremsstrahlungElectronScatteringDistribution::BremsstrahlungElectronScatteringDi
 BremsstrahlungElectronScatteringDistribution::BremsstrahlungElectronScatteringDistribution(
     const int atomic_number,
     const std::shared_ptr<const BasicBivariateDist>& bremsstrahlung_scattering_distribution,
-    const bool bank_secondary_particles )
+    const bool bank_secondary_particles,
+    const double min_photon_energy )
   : d_atomic_number( atomic_number ),
     d_bremsstrahlung_scattering_distribution( bremsstrahlung_scattering_distribution ),
-    d_bank_secondary_particles( bank_secondary_particles )
+    d_bank_secondary_particles( bank_secondary_particles ),
+    d_min_photon_energy( min_photon_energy )
 {
   // Make sure the arrays are valid
   testPrecondition( d_bremsstrahlung_scattering_distribution.use_count() > 0 );
+  // Make sure the min photon energy is valid
+  testPrecondition( min_photon_energy > 0.0 );
 
   // Use detailed photon angular distribution
   d_angular_distribution_func = [this]( const double& incoming_energy,
@@ -53,6 +61,50 @@ BremsstrahlungElectronScatteringDistribution::BremsstrahlungElectronScatteringDi
   };
 }
 
+// Constructor with simple analytical photon angular distribution and packed sampling
+/*! \details The packed distribution must be created from the same data as
+ * the bremsstrahlung scattering distribution. It will be used to sample the
+ * photon energy. The bremsstrahlung scattering distribution will still be
+ * used to evaluate the distribution.
+ */
+BremsstrahlungElectronScatteringDistribution::BremsstrahlungElectronScatteringDistribution(
+    const std::shared_ptr<const BasicBivariateDist>& bremsstrahlung_scattering_distribution,
+    const std::shared_ptr<const PackedBasicBivariateDist>& packed_bremsstrahlung_scattering_distribution,
+    const bool bank_secondary_particles,
+    const double min_photon_energy )
+  : BremsstrahlungElectronScatteringDistribution( bremsstrahlung_scattering_distribution,
+                                                  bank_secondary_particles,
+                                                  min_photon_energy )
+{
+  // Make sure the packed distribution is valid
+  testPrecondition( packed_bremsstrahlung_scattering_distribution.use_count() > 0 );
+
+  d_packed_bremsstrahlung_scattering_distribution =
+    packed_bremsstrahlung_scattering_distribution;
+}
+
+// Constructor with detailed 2BS photon angular distribution and packed sampling
+/*! \details The packed distribution must be created from the same data as
+ * the bremsstrahlung scattering distribution.
+ */
+BremsstrahlungElectronScatteringDistribution::BremsstrahlungElectronScatteringDistribution(
+    const int atomic_number,
+    const std::shared_ptr<const BasicBivariateDist>& bremsstrahlung_scattering_distribution,
+    const std::shared_ptr<const PackedBasicBivariateDist>& packed_bremsstrahlung_scattering_distribution,
+    const bool bank_secondary_particles,
+    const double min_photon_energy )
+  : BremsstrahlungElectronScatteringDistribution( atomic_number,
+                                                  bremsstrahlung_scattering_distribution,
+                                                  bank_secondary_particles,
+                                                  min_photon_energy )
+{
+  // Make sure the packed distribution is valid
+  testPrecondition( packed_bremsstrahlung_scattering_distribution.use_count() > 0 );
+
+  d_packed_bremsstrahlung_scattering_distribution =
+    packed_bremsstrahlung_scattering_distribution;
+}
+
 // Return the min incoming energy
 double BremsstrahlungElectronScatteringDistribution::getMinEnergy() const
 {
@@ -66,10 +118,13 @@ double BremsstrahlungElectronScatteringDistribution::getMaxEnergy() const
 }
 
 // Return the min outgoing photon energy
-//! \details It is assumed that the minimum outgoing photon energy is 1e-7 MeV.
+/*! \details The minimum outgoing photon energy is 1e-7 MeV unless a
+ * different min photon energy was given (e.g. the hard bremsstrahlung cutoff
+ * energy used in condensed history mode).
+ */
 double BremsstrahlungElectronScatteringDistribution::getMinPhotonEnergy( const double incoming_energy ) const
 {
-  return 1e-7;
+  return d_min_photon_energy;
 }
 
 // Return the Max outgoing photon energy
@@ -139,11 +194,22 @@ void BremsstrahlungElectronScatteringDistribution::sample(
              double& photon_angle_cosine ) const
 {
   // Sample the photon energy
-  photon_energy =
-    d_bremsstrahlung_scattering_distribution->sampleSecondaryConditional(
-      incoming_energy,
-      [self = this](const double& energy){return self->getMinPhotonEnergy( energy );},
-      [self = this](const double& energy){return self->getMaxPhotonEnergy( energy );} );
+  if( d_packed_bremsstrahlung_scattering_distribution )
+  {
+    photon_energy =
+      d_packed_bremsstrahlung_scattering_distribution->sampleSecondaryConditional(
+        incoming_energy,
+        this->getMinPhotonEnergy( incoming_energy ),
+        this->getMaxPhotonEnergy( incoming_energy ) );
+  }
+  else
+  {
+    photon_energy =
+      d_bremsstrahlung_scattering_distribution->sampleSecondaryConditional(
+        incoming_energy,
+        [self = this](const double& energy){return self->getMinPhotonEnergy( energy );},
+        [self = this](const double& energy){return self->getMaxPhotonEnergy( energy );} );
+  }
 
   // Sample the photon outgoing angle cosine
   photon_angle_cosine = d_angular_distribution_func( incoming_energy,
@@ -161,11 +227,22 @@ double BremsstrahlungElectronScatteringDistribution::sampleWithRandomNumber(
              const double random_number ) const
 {
   // Sample the photon energy
-  return d_bremsstrahlung_scattering_distribution->sampleSecondaryConditionalWithRandomNumber(
+  if( d_packed_bremsstrahlung_scattering_distribution )
+  {
+    return d_packed_bremsstrahlung_scattering_distribution->sampleSecondaryConditionalWithRandomNumber(
+      incoming_energy,
+      random_number,
+      this->getMinPhotonEnergy( incoming_energy ),
+      this->getMaxPhotonEnergy( incoming_energy ) );
+  }
+  else
+  {
+    return d_bremsstrahlung_scattering_distribution->sampleSecondaryConditionalWithRandomNumber(
       incoming_energy,
       random_number,
       [self = this](const double& energy){return self->getMinPhotonEnergy( energy );},
       [self = this](const double& energy){return self->getMaxPhotonEnergy( energy );} );
+  }
 }
 
 // Sample an outgoing energy and direction and record the number of trials
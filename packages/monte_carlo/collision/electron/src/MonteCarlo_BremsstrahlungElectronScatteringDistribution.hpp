@@ -14,6 +14,7 @@
 #include "MonteCarlo_PositronScatteringDistribution.hpp"
 #include "MonteCarlo_BremsstrahlungAngularDistributionType.hpp"
 #include "Utility_InterpolatedFullyTabularBasicBivariateDistribution.hpp"
+#include "Utility_PackedTabularBasicBivariateDistributionBase.hpp"
 
 namespace MonteCarlo{
 
@@ -33,16 +34,36 @@ public:
   //! Typedef for the two d distributions
   typedef Utility::FullyTabularBasicBivariateDistribution BasicBivariateDist;
 
+  //! Typedef for the packed two d sampling distributions
+  typedef Utility::PackedTabularBasicBivariateDistributionBase PackedBasicBivariateDist;
+
   //! Constructor with simple dipole photon angular distribution
   BremsstrahlungElectronScatteringDistribution(
     const std::shared_ptr<const BasicBivariateDist>& bremsstrahlung_scattering_distribution,
-    const bool bank_secondary_particles = true );
+    const bool bank_secondary_particles = true,
+    const double min_photon_energy = 1e-7 );
 
   //! Constructor with detailed 2BS photon angular distribution
   BremsstrahlungElectronScatteringDistribution(
     const int atomic_number,
     const std::shared_ptr<const BasicBivariateDist>& bremsstrahlung_scattering_distribution,
-    const bool bank_secondary_particles = true );
+    const bool bank_secondary_particles = true,
+    const double min_photon_energy = 1e-7 );
+
+  //! Constructor with simple dipole photon angular distribution and packed sampling
+  BremsstrahlungElectronScatteringDistribution(
+    const std::shared_ptr<const BasicBivariateDist>& bremsstrahlung_scattering_distribution,
+    const std::shared_ptr<const PackedBasicBivariateDist>& packed_bremsstrahlung_scattering_distribution,
+    const bool bank_secondary_particles = true,
+    const double min_photon_energy = 1e-7 );
+
+  //! Constructor with detailed 2BS photon angular distribution and packed sampling
+  BremsstrahlungElectronScatteringDistribution(
+    const int atomic_number,
+    const std::shared_ptr<const BasicBivariateDist>& bremsstrahlung_scattering_distribution,
+    const std::shared_ptr<const PackedBasicBivariateDist>& packed_bremsstrahlung_scattering_distribution,
+    const bool bank_secondary_particles = true,
+    const double min_photon_energy = 1e-7 );
 
   //! Destructor
   virtual ~BremsstrahlungElectronScatteringDistribution()
@@ -119,12 +140,18 @@ private:
   // bremsstrahlung scattering distribution
   std::shared_ptr<const BasicBivariateDist> d_bremsstrahlung_scattering_distribution;
 
+  // packed bremsstrahlung scattering distribution (used for sampling only)
+  std::shared_ptr<const PackedBasicBivariateDist> d_packed_bremsstrahlung_scattering_distribution;
+
   // The outgoing angle function pointer
   std::function<double ( const double, const double )>
                                         d_angular_distribution_func;
 
   // Turn secondary particle on/off
   bool d_bank_secondary_particles;
+
+  // The min outgoing photon energy
+  double d_min_photon_energy;
 };
 
 } // end MonteCarlo namespace
@@ -44,7 +44,8 @@ public:
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol = 1e-7,
-    const unsigned max_number_of_iterations = 500 );
+    const unsigned max_number_of_iterations = 500,
+    const double min_photon_energy = 1e-7 );
 
   //! Create a detailed 2BS bremsstrahlung distribution
   template <typename TwoDInterpPolicy = Utility::LogLogLog,
@@ -68,7 +69,8 @@ public:
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol = 1e-7,
-    const unsigned max_number_of_iterations = 500 );
+    const unsigned max_number_of_iterations = 500,
+    const double min_photon_energy = 1e-7 );
 
   //! Create the energy loss function
   template <typename TwoDInterpPolicy = Utility::LogLogLog,
@@ -80,6 +82,16 @@ public:
     std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>& energy_loss_function,
     const double evaluation_tol,
     const unsigned max_number_of_iterations );
+
+  //! Create the packed energy loss function (used for sampling only)
+  template <typename TwoDInterpPolicy = Utility::LogLogLog,
+            template<typename> class TwoDGridPolicy = Utility::UnitBaseCorrelated>
+  static void createPackedEnergyLossFunction(
+    const std::map<double,std::vector<double> >& photon_energy_data,
+    const std::map<double,std::vector<double> >& photon_pdf_data,
+    const std::vector<double>& energy_grid,
+    std::shared_ptr<const Utility::PackedTabularBasicBivariateDistributionBase>&
+        packed_energy_loss_function );
 };
 
 } // end MonteCarlo namespace
@@ -10,6 +10,7 @@
 #define MONTE_CARLO_BREMSSTRAHLUNG_ELECTRON_SCATTERING_DISTRIBUTION_NATIVE_FACTORY_DEF_HPP
 
 #include "Utility_TabularDistribution.hpp"
+#include "Utility_PackedTabularBasicBivariateDistribution.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -46,12 +47,15 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations )
+    const unsigned max_number_of_iterations,
+    const double min_photon_energy )
 {
   // Make sure the evaluation tol is valid
   testPrecondition( evaluation_tol > 0.0 );
   // Make sure the max number of iterations is valid
   testPrecondition( max_number_of_iterations > 1 );
+  // Make sure the min photon energy is valid
+  testPrecondition( min_photon_energy > 0.0 );
 
   // Create the scattering function
   std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>
@@ -65,8 +69,22 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     evaluation_tol,
     max_number_of_iterations );
 
+  // Create the packed scattering function used for sampling
+  std::shared_ptr<const Utility::PackedTabularBasicBivariateDistributionBase>
+    packed_energy_loss_function;
+
+  ThisType::createPackedEnergyLossFunction<TwoDInterpPolicy,TwoDGridPolicy>(
+    photon_energy_data,
+    photon_pdf_data,
+    energy_grid,
+    packed_energy_loss_function );
+
   scattering_distribution.reset(
-   new BremsstrahlungElectronScatteringDistribution( energy_loss_function ) );
+   new BremsstrahlungElectronScatteringDistribution(
+                                             energy_loss_function,
+                                             packed_energy_loss_function,
+                                             true,
+                                             min_photon_energy ) );
 }
 
 // Create a detailed 2BS bremsstrahlung distribution
@@ -104,12 +122,15 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>&
         scattering_distribution,
     const double evaluation_tol,
-    const unsigned max_number_of_iterations )
+    const unsigned max_number_of_iterations,
+    const double min_photon_energy )
 {
   // Make sure the evaluation tol is valid
   testPrecondition( evaluation_tol > 0.0 );
   // Make sure the max number of iterations is valid
   testPrecondition( max_number_of_iterations > 1 );
+  // Make sure the min photon energy is valid
+  testPrecondition( min_photon_energy > 0.0 );
 
   // Create the scattering function
   std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>
@@ -123,9 +144,23 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createBremsstrah
     evaluation_tol,
     max_number_of_iterations );
 
+  // Create the packed scattering function used for sampling
+  std::shared_ptr<const Utility::PackedTabularBasicBivariateDistributionBase>
+    packed_energy_loss_function;
+
+  ThisType::createPackedEnergyLossFunction<TwoDInterpPolicy,TwoDGridPolicy>(
+    photon_energy_data,
+    photon_pdf_data,
+    energy_grid,
+    packed_energy_loss_function );
+
   scattering_distribution.reset(
-   new BremsstrahlungElectronScatteringDistribution( atomic_number,
-                                                     energy_loss_function ) );
+   new BremsstrahlungElectronScatteringDistribution(
+                                             atomic_number,
+                                             energy_loss_function,
+                                             packed_energy_loss_function,
+                                             true,
+                                             min_photon_energy ) );
 }
 
 // Create the energy loss function
@@ -166,6 +201,37 @@ void BremsstrahlungElectronScatteringDistributionNativeFactory::createEnergyLoss
             max_number_of_iterations ) );
 }
 
+// Create the packed energy loss function (used for sampling only)
+/*! \details The packed energy loss function samples the same lin-lin
+ * tabular secondary distributions as the energy loss function without any
+ * virtual calls or std::function objects on the sampling path.
+ */
+template<typename TwoDInterpPolicy, template<typename> class TwoDGridPolicy>
+void BremsstrahlungElectronScatteringDistributionNativeFactory::createPackedEnergyLossFunction(
+    const std::map<double,std::vector<double> >& photon_energy_data,
+    const std::map<double,std::vector<double> >& photon_pdf_data,
+    const std::vector<double>& energy_grid,
+    std::shared_ptr<const Utility::PackedTabularBasicBivariateDistributionBase>&
+        packed_energy_loss_function )
+{
+  // Get the function data
+  std::vector<std::vector<double> > photon_energies( energy_grid.size() ),
+    photon_pdfs( energy_grid.size() );
+
+  for( size_t n = 0; n < energy_grid.size(); ++n )
+  {
+    photon_energies[n] = photon_energy_data.find( energy_grid[n] )->second;
+    photon_pdfs[n] = photon_pdf_data.find( energy_grid[n] )->second;
+  }
+
+  // Create the packed scattering function
+  packed_energy_loss_function.reset(
+    new Utility::PackedTabularBasicBivariateDistribution<TwoDGridPolicy<TwoDInterpPolicy> >(
+                                                            energy_grid,
+                                                            photon_energies,
+                                                            photon_pdfs ) );
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_BREMSSTRAHLUNG_ELECTRON_SCATTERING_DISTRIBUTION_NATIVE_FACTORY_DEF_HPP
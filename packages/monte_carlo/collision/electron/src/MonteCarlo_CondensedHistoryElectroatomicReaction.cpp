@@ -0,0 +1,30 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectroatomicReaction.cpp
+//! \author Alex Robinson
+//! \brief  The condensed history electroatomic reaction class instantiation
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectroatomicReaction.hpp"
+
+namespace MonteCarlo{
+
+EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LinLin,false> );
+EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LinLin,true> );
+
+EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LinLog,false> );
+EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LinLog,true> );
+
+EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LogLin,false> );
+EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LogLin,true> );
+
+EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LogLog,false> );
+EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LogLog,true> );
+  
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectroatomicReaction.cpp
+//---------------------------------------------------------------------------//
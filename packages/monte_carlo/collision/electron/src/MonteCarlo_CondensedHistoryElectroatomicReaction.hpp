@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectroatomicReaction.hpp
+//! \author Alex Robinson
+//! \brief  The condensed history electroatomic reaction class decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CONDENSED_HISTORY_ELECTROATOMIC_REACTION_HPP
+#define MONTE_CARLO_CONDENSED_HISTORY_ELECTROATOMIC_REACTION_HPP
+
+// FRENSIE Includes
+#include "MonteCarlo_ElectroatomicReaction.hpp"
+#include "MonteCarlo_StandardReactionBaseImpl.hpp"
+#include "MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp"
+
+namespace MonteCarlo{
+
+//! The condensed history (class-II) electroatomic reaction class
+template<typename InterpPolicy, bool processed_cross_section = false>
+class CondensedHistoryElectroatomicReaction : public StandardReactionBaseImpl<ElectroatomicReaction,InterpPolicy,processed_cross_section>
+{
+  // Typedef for the base class type
+  typedef StandardReactionBaseImpl<ElectroatomicReaction,InterpPolicy,processed_cross_section> 
+    BaseType;
+
+public:
+
+  //! Basic Constructor
+  CondensedHistoryElectroatomicReaction(
+    const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+    const std::shared_ptr<const std::vector<double> >& cross_section,
+    const size_t threshold_energy_index,
+    const std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>&
+            soft_scattering_distribution );
+
+  //! Constructor
+  CondensedHistoryElectroatomicReaction(
+    const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+    const std::shared_ptr<const std::vector<double> >& cross_section,
+    const size_t threshold_energy_index,
+    const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
+    const std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>&
+            soft_scattering_distribution );
+
+  //! Destructor
+  ~CondensedHistoryElectroatomicReaction()
+  { /* ... */ }
+
+  //! Return the number of photons emitted from the rxn at the given energy
+  unsigned getNumberOfEmittedPhotons( const double energy ) const override;
+
+  //! Return the number of electrons emitted from the rxn at the given energy
+  unsigned getNumberOfEmittedElectrons( const double energy ) const override;
+
+  //! Return the number of positrons emitted from the rxn at the given energy
+  unsigned getNumberOfEmittedPositrons( const double energy ) const override;
+
+  //! Return the differential cross section
+  double getDifferentialCrossSection( const double incoming_energy,
+                                      const double outgoing_energy ) const override;
+
+  //! Return the reaction type
+  ElectroatomicReactionType getReactionType() const override;
+
+  //! Simulate the reaction
+  void react( ElectronState& electron,
+              ParticleBank& bank,
+              Data::SubshellType& shell_of_interaction ) const override;
+
+private:
+
+  // The condensed history soft scattering distribution
+  std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>
+    d_soft_scattering_distribution;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes.
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_CondensedHistoryElectroatomicReaction_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_CONDENSED_HISTORY_ELECTROATOMIC_REACTION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectroatomicReaction.hpp
+//---------------------------------------------------------------------------//
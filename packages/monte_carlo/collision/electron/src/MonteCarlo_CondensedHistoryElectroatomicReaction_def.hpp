@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectroatomicReaction_def.hpp
+//! \author Alex Robinson
+//! \brief  The condensed history electroatomic reaction class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CONDENSED_HISTORY_ELECTROATOMIC_REACTION_DEF_HPP
+#define MONTE_CARLO_CONDENSED_HISTORY_ELECTROATOMIC_REACTION_DEF_HPP
+
+// FRENSIE Includes
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_ExplicitTemplateInstantiationMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Basic Constructor
+template<typename InterpPolicy, bool processed_cross_section>
+CondensedHistoryElectroatomicReaction<InterpPolicy,processed_cross_section>::CondensedHistoryElectroatomicReaction(
+       const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+       const std::shared_ptr<const std::vector<double> >& cross_section,
+       const size_t threshold_energy_index,
+       const std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>&
+            soft_scattering_distribution )
+  : BaseType( incoming_energy_grid,
+              cross_section,
+              threshold_energy_index ),
+    d_soft_scattering_distribution( soft_scattering_distribution )
+{
+  // Make sure the soft scattering distribution is valid
+  testPrecondition( soft_scattering_distribution.use_count() > 0 );
+}
+
+// Constructor
+template<typename InterpPolicy, bool processed_cross_section>
+CondensedHistoryElectroatomicReaction<InterpPolicy,processed_cross_section>::CondensedHistoryElectroatomicReaction(
+       const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+       const std::shared_ptr<const std::vector<double> >& cross_section,
+       const size_t threshold_energy_index,
+       const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
+       const std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>&
+            soft_scattering_distribution )
+  : BaseType( incoming_energy_grid,
+              cross_section,
+              threshold_energy_index,
+              grid_searcher ),
+    d_soft_scattering_distribution( soft_scattering_distribution )
+{
+  // Make sure the soft scattering distribution is valid
+  testPrecondition( soft_scattering_distribution.use_count() > 0 );
+}
+
+// Return the number of photons emitted from the rxn at the given energy
+template<typename InterpPolicy, bool processed_cross_section>
+unsigned CondensedHistoryElectroatomicReaction<InterpPolicy,processed_cross_section>::getNumberOfEmittedPhotons( const double energy ) const
+{
+  return 0u;
+}
+
+// Return the number of electrons emitted from the rxn at the given energy
+template<typename InterpPolicy, bool processed_cross_section>
+unsigned CondensedHistoryElectroatomicReaction<InterpPolicy,processed_cross_section>::getNumberOfEmittedElectrons( const double energy ) const
+{
+  return 1u;
+}
+
+// Return the number of positrons emitted from the rxn at the given energy
+template<typename InterpPolicy, bool processed_cross_section>
+unsigned CondensedHistoryElectroatomicReaction<InterpPolicy,processed_cross_section>::getNumberOfEmittedPositrons( const double energy ) const
+{
+  return 0u;
+}
+
+// Return the differential cross section
+/*! \details The condensed history step is an artificial event so the
+ * step cross section is returned.
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+double CondensedHistoryElectroatomicReaction<InterpPolicy,processed_cross_section>::getDifferentialCrossSection(
+                                const double incoming_energy,
+                                const double outgoing_energy ) const
+{
+  return this->getCrossSection( incoming_energy );
+}
+
+// Return the reaction type
+template<typename InterpPolicy, bool processed_cross_section>
+ElectroatomicReactionType CondensedHistoryElectroatomicReaction<InterpPolicy,processed_cross_section>::getReactionType() const
+{
+  return CONDENSED_HISTORY_ELECTROATOMIC_REACTION;
+}
+
+// Simulate the reaction
+template<typename InterpPolicy, bool processed_cross_section>
+void CondensedHistoryElectroatomicReaction<InterpPolicy,processed_cross_section>::react(
+                             ElectronState& electron,
+                             ParticleBank& bank,
+                             Data::SubshellType& shell_of_interaction ) const
+{
+  d_soft_scattering_distribution->scatterElectron( electron,
+                                                   bank,
+                                                   shell_of_interaction );
+
+  electron.incrementCollisionNumber();
+
+  // The soft collisions are not tied to a single shell
+  shell_of_interaction = Data::UNKNOWN_SUBSHELL;
+}
+
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LinLin,false> );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LinLin,true> );
+
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LinLog,false> );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LinLog,true> );
+
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LogLin,false> );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LogLin,true> );
+
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LogLog,false> );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( CondensedHistoryElectroatomicReaction<Utility::LogLog,true> );
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_CONDENSED_HISTORY_ELECTROATOMIC_REACTION_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectroatomicReaction_def.hpp
+//---------------------------------------------------------------------------//
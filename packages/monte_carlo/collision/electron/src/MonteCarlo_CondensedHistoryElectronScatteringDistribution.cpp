@@ -0,0 +1,351 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectronScatteringDistribution.cpp
+//! \author Alex Robinson
+//! \brief  The condensed history electron scattering distribution definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp"
+#include "Utility_InterpolationPolicy.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+CondensedHistoryElectronScatteringDistribution::CondensedHistoryElectronScatteringDistribution(
+                   const std::vector<double>& energy_grid,
+                   const std::vector<double>& soft_stopping_cross_section,
+                   const std::vector<double>& first_transport_cross_section,
+                   const std::vector<double>& second_transport_cross_section,
+                   const double max_energy_loss_fraction,
+                   const double max_transport_mfps )
+  : d_energy_grid( energy_grid ),
+    d_soft_stopping_cross_section( soft_stopping_cross_section ),
+    d_first_transport_cross_section( first_transport_cross_section ),
+    d_second_transport_cross_section( second_transport_cross_section ),
+    d_max_energy_loss_fraction( max_energy_loss_fraction ),
+    d_max_transport_mfps( max_transport_mfps )
+{
+  // Make sure the tables are valid
+  testPrecondition( energy_grid.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid.begin(),
+                                                      energy_grid.end() ) );
+  testPrecondition( soft_stopping_cross_section.size() ==
+                    energy_grid.size() );
+  testPrecondition( first_transport_cross_section.size() ==
+                    energy_grid.size() );
+  testPrecondition( second_transport_cross_section.size() ==
+                    energy_grid.size() );
+  // Make sure the step limits are valid
+  testPrecondition( max_energy_loss_fraction > 0.0 );
+  testPrecondition( max_energy_loss_fraction < 1.0 );
+  testPrecondition( max_transport_mfps > 0.0 );
+}
+
+// Return the max fractional energy loss per step
+double CondensedHistoryElectronScatteringDistribution::getMaxEnergyLossFraction() const
+{
+  return d_max_energy_loss_fraction;
+}
+
+// Return the max number of transport mean free paths per step
+double CondensedHistoryElectronScatteringDistribution::getMaxTransportMeanFreePaths() const
+{
+  return d_max_transport_mfps;
+}
+
+// Evaluate a tabulated soft quantity at the incoming energy
+/*! \details The soft tables can be zero below the atomic excitation and
+ * moment preserving thresholds so lin-lin interpolation is used. Energies
+ * below the grid evaluate to zero and energies above the grid evaluate to
+ * the last tabulated value.
+ */
+double CondensedHistoryElectronScatteringDistribution::evaluateTable(
+                                           const std::vector<double>& table,
+                                           const double incoming_energy ) const
+{
+  if( incoming_energy < d_energy_grid.front() )
+    return 0.0;
+  else if( incoming_energy >= d_energy_grid.back() )
+    return table.back();
+  else
+  {
+    size_t lower_bin_index =
+      Utility::Search::binaryLowerBoundIndex( d_energy_grid.begin(),
+                                              d_energy_grid.end(),
+                                              incoming_energy );
+
+    return Utility::LinLin::interpolate( d_energy_grid[lower_bin_index],
+                                         d_energy_grid[lower_bin_index+1],
+                                         incoming_energy,
+                                         table[lower_bin_index],
+                                         table[lower_bin_index+1] );
+  }
+}
+
+// Evaluate the condensed history step cross section (b)
+/*! \details The step cross section is the inverse of the mean step length
+ * (per atom). It is the sum of the energy loss and angular deflection
+ * step constraints: S(E)/(f*E) + sigma_1(E)/xi.
+ */
+double CondensedHistoryElectronScatteringDistribution::evaluateStepCrossSection(
+                                           const double incoming_energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( incoming_energy > 0.0 );
+
+  return this->evaluateTable( d_soft_stopping_cross_section,
+                              incoming_energy )/
+    (d_max_energy_loss_fraction*incoming_energy) +
+    this->evaluateTable( d_first_transport_cross_section, incoming_energy )/
+    d_max_transport_mfps;
+}
+
+// Evaluate the mean soft energy loss per step (MeV)
+double CondensedHistoryElectronScatteringDistribution::evaluateEnergyLoss(
+                                           const double incoming_energy ) const
+{
+  double step_cross_section =
+    this->evaluateStepCrossSection( incoming_energy );
+
+  if( step_cross_section > 0.0 )
+  {
+    return this->evaluateTable( d_soft_stopping_cross_section,
+                                incoming_energy )/step_cross_section;
+  }
+  else
+    return 0.0;
+}
+
+// Evaluate the first two Legendre moments of the deflection per step
+/*! \details The moments of the Goudsmit-Saunderson distribution after a
+ * step of mean length 1/sigma_step are <P_l> = exp(-sigma_l/sigma_step).
+ */
+void CondensedHistoryElectronScatteringDistribution::evaluateLegendreMoments(
+                                                const double incoming_energy,
+                                                double& first_moment,
+                                                double& second_moment ) const
+{
+  double step_cross_section =
+    this->evaluateStepCrossSection( incoming_energy );
+
+  if( step_cross_section > 0.0 )
+  {
+    first_moment =
+      std::exp( -this->evaluateTable( d_first_transport_cross_section,
+                                      incoming_energy )/step_cross_section );
+    second_moment =
+      std::exp( -this->evaluateTable( d_second_transport_cross_section,
+                                      incoming_energy )/step_cross_section );
+  }
+  else
+  {
+    first_moment = 1.0;
+    second_moment = 1.0;
+  }
+}
+
+// Calculate the parameters of the artificial angular distribution
+/*! \details The reduced deflection u = (1-mu)/2 is sampled from
+ * a*U(0,b) + (1-a)*U(b,1), which preserves <mu> and <mu^2> when
+ * b = (<P_1>-<P_2>)/(2<P_1>) and a = <P_1> + b. The parameters are clipped
+ * to [0,1] for the (unphysical) moment pairs that would make the
+ * distribution negative.
+ */
+void CondensedHistoryElectronScatteringDistribution::calculateAngularParameters(
+                                          const double incoming_energy,
+                                          double& reduced_angle_cutoff,
+                                          double& cutoff_probability ) const
+{
+  double first_moment, second_moment;
+
+  this->evaluateLegendreMoments( incoming_energy,
+                                 first_moment,
+                                 second_moment );
+
+  // The step is long enough that the deflection is isotropic
+  if( first_moment <= 0.0 )
+  {
+    reduced_angle_cutoff = 1.0;
+    cutoff_probability = 1.0;
+  }
+  else
+  {
+    reduced_angle_cutoff =
+      (first_moment - second_moment)/(2.0*first_moment);
+
+    if( reduced_angle_cutoff < 0.0 )
+      reduced_angle_cutoff = 0.0;
+    else if( reduced_angle_cutoff > 1.0 )
+      reduced_angle_cutoff = 1.0;
+
+    cutoff_probability = first_moment + reduced_angle_cutoff;
+
+    if( cutoff_probability > 1.0 )
+      cutoff_probability = 1.0;
+  }
+}
+
+// Evaluate the distribution
+double CondensedHistoryElectronScatteringDistribution::evaluate(
+                                   const double incoming_energy,
+                                   const double scattering_angle_cosine ) const
+{
+  return this->evaluatePDF( incoming_energy, scattering_angle_cosine );
+}
+
+// Evaluate the PDF
+double CondensedHistoryElectronScatteringDistribution::evaluatePDF(
+                                   const double incoming_energy,
+                                   const double scattering_angle_cosine ) const
+{
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+
+  double reduced_angle_cutoff, cutoff_probability;
+
+  this->calculateAngularParameters( incoming_energy,
+                                    reduced_angle_cutoff,
+                                    cutoff_probability );
+
+  double reduced_angle = (1.0 - scattering_angle_cosine)/2.0;
+
+  // The Jacobian of the reduced angle transformation is 1/2
+  if( reduced_angle < reduced_angle_cutoff )
+    return cutoff_probability/(2.0*reduced_angle_cutoff);
+  else if( reduced_angle_cutoff < 1.0 )
+    return (1.0 - cutoff_probability)/(2.0*(1.0 - reduced_angle_cutoff));
+  else
+    return 0.0;
+}
+
+// Evaluate the CDF
+double CondensedHistoryElectronScatteringDistribution::evaluateCDF(
+                                   const double incoming_energy,
+                                   const double scattering_angle_cosine ) const
+{
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+
+  double reduced_angle_cutoff, cutoff_probability;
+
+  this->calculateAngularParameters( incoming_energy,
+                                    reduced_angle_cutoff,
+                                    cutoff_probability );
+
+  double reduced_angle = (1.0 - scattering_angle_cosine)/2.0;
+
+  // The CDF of the reduced angle (mu <= mu' is equivalent to u >= u')
+  double reduced_angle_cdf;
+
+  if( reduced_angle >= 1.0 )
+    reduced_angle_cdf = 1.0;
+  else if( reduced_angle < reduced_angle_cutoff )
+  {
+    reduced_angle_cdf =
+      cutoff_probability*reduced_angle/reduced_angle_cutoff;
+  }
+  else
+  {
+    reduced_angle_cdf = cutoff_probability +
+      (1.0 - cutoff_probability)*(reduced_angle - reduced_angle_cutoff)/
+      (1.0 - reduced_angle_cutoff);
+  }
+
+  return 1.0 - reduced_angle_cdf;
+}
+
+// Sample an outgoing energy and direction from the distribution
+void CondensedHistoryElectronScatteringDistribution::sample(
+                                      const double incoming_energy,
+                                      double& outgoing_energy,
+                                      double& scattering_angle_cosine ) const
+{
+  Counter trials = 0;
+
+  this->sampleAndRecordTrials( incoming_energy,
+                               outgoing_energy,
+                               scattering_angle_cosine,
+                               trials );
+}
+
+// Sample an outgoing energy and direction and record the number of trials
+void CondensedHistoryElectronScatteringDistribution::sampleAndRecordTrials(
+                                          const double incoming_energy,
+                                          double& outgoing_energy,
+                                          double& scattering_angle_cosine,
+                                          Counter& trials ) const
+{
+  // Update trial number
+  ++trials;
+
+  // Deposit the mean soft energy loss (never more than f*E)
+  outgoing_energy =
+    incoming_energy - this->evaluateEnergyLoss( incoming_energy );
+
+  // Sample the artificial soft deflection
+  double reduced_angle_cutoff, cutoff_probability;
+
+  this->calculateAngularParameters( incoming_energy,
+                                    reduced_angle_cutoff,
+                                    cutoff_probability );
+
+  double random_number_1 =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  double random_number_2 =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  double reduced_angle;
+
+  if( random_number_1 < cutoff_probability )
+    reduced_angle = reduced_angle_cutoff*random_number_2;
+  else
+  {
+    reduced_angle = reduced_angle_cutoff +
+      (1.0 - reduced_angle_cutoff)*random_number_2;
+  }
+
+  scattering_angle_cosine = 1.0 - 2.0*reduced_angle;
+
+  // Make sure the scattering angle cosine is valid
+  testPostcondition( scattering_angle_cosine >= -1.0 );
+  testPostcondition( scattering_angle_cosine <= 1.0 );
+}
+
+// Randomly scatter the electron
+void CondensedHistoryElectronScatteringDistribution::scatterElectron(
+                                  ElectronState& electron,
+                                  ParticleBank& bank,
+                                  Data::SubshellType& shell_of_interaction ) const
+{
+  double outgoing_energy, scattering_angle_cosine;
+
+  // Sample the energy loss and deflection
+  this->sample( electron.getEnergy(),
+                outgoing_energy,
+                scattering_angle_cosine );
+
+  // Set the new energy
+  electron.setEnergy( outgoing_energy );
+
+  // Set the new direction
+  electron.rotateDirection( scattering_angle_cosine,
+                            this->sampleAzimuthalAngle() );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectronScatteringDistribution.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,135 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp
+//! \author Alex Robinson
+//! \brief  The condensed history electron scattering distribution class
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_SCATTERING_DISTRIBUTION_HPP
+#define MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_SCATTERING_DISTRIBUTION_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_ElectronScatteringDistribution.hpp"
+
+namespace MonteCarlo{
+
+/*! The condensed history (class-II) electron scattering distribution class
+ * \details All soft (sub-cutoff) collisions that occur along a condensed
+ * history step are grouped into a single artificial event. The step
+ * cross section is chosen so that the mean step length s satisfies both
+ * s*S(E) <= f*E and s*sigma_1(E) <= xi, where S is the soft stopping
+ * cross section (MeV-b), sigma_1 is the first soft transport cross section
+ * (b), f is the maximum fractional energy loss and xi is the maximum number
+ * of transport mean free paths per step. The mean soft energy loss is
+ * deposited at each event and the direction is deflected using a
+ * two-step uniform distribution that preserves the first two Legendre
+ * moments of the Goudsmit-Saunderson multiple scattering distribution,
+ * <P_l> = exp(-sigma_l/sigma_step).
+ */
+class CondensedHistoryElectronScatteringDistribution : public ElectronScatteringDistribution
+{
+
+public:
+
+  //! Typedef for the counter type
+  typedef ElectronScatteringDistribution::Counter Counter;
+
+  //! Constructor
+  CondensedHistoryElectronScatteringDistribution(
+                   const std::vector<double>& energy_grid,
+                   const std::vector<double>& soft_stopping_cross_section,
+                   const std::vector<double>& first_transport_cross_section,
+                   const std::vector<double>& second_transport_cross_section,
+                   const double max_energy_loss_fraction,
+                   const double max_transport_mfps );
+
+  //! Destructor
+  ~CondensedHistoryElectronScatteringDistribution()
+  { /* ... */ }
+
+  //! Return the max fractional energy loss per step
+  double getMaxEnergyLossFraction() const;
+
+  //! Return the max number of transport mean free paths per step
+  double getMaxTransportMeanFreePaths() const;
+
+  //! Evaluate the condensed history step cross section (b)
+  double evaluateStepCrossSection( const double incoming_energy ) const;
+
+  //! Evaluate the mean soft energy loss per step (MeV)
+  double evaluateEnergyLoss( const double incoming_energy ) const;
+
+  //! Evaluate the first two Legendre moments of the deflection per step
+  void evaluateLegendreMoments( const double incoming_energy,
+                                double& first_moment,
+                                double& second_moment ) const;
+
+  //! Evaluate the distribution
+  double evaluate( const double incoming_energy,
+                   const double scattering_angle_cosine ) const override;
+
+  //! Evaluate the PDF
+  double evaluatePDF( const double incoming_energy,
+                      const double scattering_angle_cosine ) const override;
+
+  //! Evaluate the CDF
+  double evaluateCDF( const double incoming_energy,
+                      const double scattering_angle_cosine ) const override;
+
+  //! Sample an outgoing energy and direction from the distribution
+  void sample( const double incoming_energy,
+               double& outgoing_energy,
+               double& scattering_angle_cosine ) const override;
+
+  //! Sample an outgoing energy and direction and record the number of trials
+  void sampleAndRecordTrials( const double incoming_energy,
+                              double& outgoing_energy,
+                              double& scattering_angle_cosine,
+                              Counter& trials ) const override;
+
+  //! Randomly scatter the electron
+  void scatterElectron( ElectronState& electron,
+                        ParticleBank& bank,
+                        Data::SubshellType& shell_of_interaction ) const override;
+
+private:
+
+  // Evaluate a tabulated soft quantity at the incoming energy
+  double evaluateTable( const std::vector<double>& table,
+                        const double incoming_energy ) const;
+
+  // Calculate the parameters of the artificial angular distribution
+  void calculateAngularParameters( const double incoming_energy,
+                                   double& reduced_angle_cutoff,
+                                   double& cutoff_probability ) const;
+
+  // The energy grid
+  std::vector<double> d_energy_grid;
+
+  // The soft stopping cross section (MeV-b)
+  std::vector<double> d_soft_stopping_cross_section;
+
+  // The first soft transport cross section (b)
+  std::vector<double> d_first_transport_cross_section;
+
+  // The second soft transport cross section (b)
+  std::vector<double> d_second_transport_cross_section;
+
+  // The max fractional energy loss per step
+  double d_max_energy_loss_fraction;
+
+  // The max number of transport mean free paths per step
+  double d_max_transport_mfps;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_SCATTERING_DISTRIBUTION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp
+//---------------------------------------------------------------------------//
@@ -10,9 +10,11 @@
 #include "MonteCarlo_ElectroatomFactory.hpp"
 #include "MonteCarlo_ElectroatomACEFactory.hpp"
 #include "MonteCarlo_ElectroatomNativeFactory.hpp"
+#include "MonteCarlo_ScatteringCenterFactoryHelpers.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSEPRDataExtractor.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Data_DataContainerHelpers.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
@@ -37,7 +39,14 @@ ElectroatomFactory::ElectroatomFactory(
   FRENSIE_LOG_NOTIFICATION( "Starting to load electroatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
-  // Create each electroatom in the set
+  // The electroatoms that use each data table
+  std::vector<std::pair<std::string,ElectroatomNameMap::mapped_type*> >
+    electroatom_tables;
+
+  // The loaders for each data table (every table is only loaded once)
+  std::vector<ScatteringCenterDataTableLoader> table_loaders;
+
+  // Find the data table used by each electroatom in the set
   ScatteringCenterNameSet::const_iterator electroatom_name =
     electroatom_names.begin();
 
@@ -63,39 +72,17 @@ ElectroatomFactory::ElectroatomFactory(
     const Data::ElectroatomicDataProperties& electroatom_data_properties =
       electroatom_definition.getElectroatomicDataProperties( &atomic_weight );
 
+    std::string table_key;
+
     if( electroatom_data_properties.fileType() ==
         Data::ElectroatomicDataProperties::ACE_EPR_FILE )
     {
-      // Initialize the electroatomic table name map for ACE_EPR files
-      if( d_electroatomic_table_name_map.find( Data::ElectroatomicDataProperties::ACE_EPR_FILE ) ==
-          d_electroatomic_table_name_map.end() )
-      {
-        d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE];
-      }
-
-      this->createElectroatomFromACETable( data_directory,
-                                           *electroatom_name,
-                                           atomic_weight,
-                                           electroatom_data_properties,
-                                           atomic_relaxation_model_factory,
-                                           properties );
+      table_key = electroatom_data_properties.tableName();
     }
     else if( electroatom_data_properties.fileType() ==
              Data::ElectroatomicDataProperties::Native_EPR_FILE )
     {
-      // Initialize the electroatomic table name map for Native_EPR files
-      if( d_electroatomic_table_name_map.find( Data::ElectroatomicDataProperties::Native_EPR_FILE ) ==
-          d_electroatomic_table_name_map.end() )
-      {
-        d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE];
-      }
-
-      this->createElectroatomFromNativeTable( data_directory,
-                                              *electroatom_name,
-                                              atomic_weight,
-                                              electroatom_data_properties,
-                                              atomic_relaxation_model_factory,
-                                              properties );
+      table_key = electroatom_data_properties.filePath().string();
     }
     else
     {
@@ -107,13 +94,64 @@ ElectroatomFactory::ElectroatomFactory(
                        ", which is currently unsupported!" );
     }
 
+    ElectroatomNameMap& table_name_map =
+      d_electroatomic_table_name_map[electroatom_data_properties.fileType()];
+
+    // Check if the table has already been scheduled for loading
+    if( table_name_map.find( table_key ) == table_name_map.end() )
+    {
+      const Data::ElectroatomicDataProperties* data_properties =
+        &electroatom_data_properties;
+
+      ElectroatomNameMap::mapped_type* electroatom = &table_name_map[table_key];
+
+      if( data_properties->fileType() ==
+          Data::ElectroatomicDataProperties::ACE_EPR_FILE )
+      {
+        table_loaders.push_back(
+          [this,&data_directory,&atomic_relaxation_model_factory,&properties,atomic_weight,data_properties,electroatom](){
+            this->createElectroatomFromACETable( data_directory,
+                                                 atomic_weight,
+                                                 *data_properties,
+                                                 atomic_relaxation_model_factory,
+                                                 properties,
+                                                 *electroatom ); } );
+      }
+      else
+      {
+        table_loaders.push_back(
+          [this,&data_directory,&atomic_relaxation_model_factory,&properties,atomic_weight,data_properties,electroatom](){
+            this->createElectroatomFromNativeTable(
+                                               data_directory,
+                                               atomic_weight,
+                                               *data_properties,
+                                               atomic_relaxation_model_factory,
+                                               properties,
+                                               *electroatom ); } );
+      }
+    }
+
+    electroatom_tables.push_back( std::make_pair( *electroatom_name,
+                                                  &table_name_map[table_key] ) );
+
     ++electroatom_name;
   }
 
+  // Load the data tables
+  loadScatteringCenterDataTables( table_loaders );
+
+  // Assign the loaded data tables to the electroatoms
+  for( size_t i = 0; i < electroatom_tables.size(); ++i )
+  {
+    d_electroatom_name_map[electroatom_tables[i].first] =
+      *electroatom_tables[i].second;
+  }
+
   // Make sure that every electroatom has been created
   testPostcondition( d_electroatom_name_map.size() == electroatom_names.size() );
 
-  FRENSIE_LOG_NOTIFICATION( "Finished loading electroatom data tables." );
+  FRENSIE_LOG_NOTIFICATION( "Finished loading electroatom data tables ("
+                            << table_loaders.size() << " tables)." );
   FRENSIE_FLUSH_ALL_LOGS();
 }
 
@@ -125,156 +163,108 @@ void ElectroatomFactory::createElectroatomMap(
 }
 
 // Create a electroatom from an ACE table
+/*! \details This method can be called concurrently for different tables.
+ */
 void ElectroatomFactory::createElectroatomFromACETable(
-                      const boost::filesystem::path& data_directory,
-                      const std::string& electroatom_name,
-                      const double atomic_weight,
-		      const Data::ElectroatomicDataProperties& data_properties,
-                      const std::shared_ptr<AtomicRelaxationModelFactory>&
-                      atomic_relaxation_model_factory,
-                      const SimulationProperties& properties )
+			const boost::filesystem::path& data_directory,
+                        const double atomic_weight,
+			const Data::ElectroatomicDataProperties& data_properties,
+                        const std::shared_ptr<AtomicRelaxationModelFactory>&
+                        atomic_relaxation_model_factory,
+                        const SimulationProperties& properties,
+                        ElectroatomNameMap::mapped_type& electroatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE].find( data_properties.tableName() ) ==
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE].end() )
-  {
-    // Construct the the path to the data file
-    boost::filesystem::path ace_file_path = data_directory;
-    ace_file_path /= data_properties.filePath();
-    ace_file_path.make_preferred();
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                " Loading ACE EPR electroatomic cross section "
-                                "table " << data_properties.tableName() <<
-                                " from " << ace_file_path.string() <<
-                                " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-
-    // Create the ACEFileHandler
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-                                           data_properties.tableName(),
-                                           data_properties.fileStartLine(),
-                                           true );
-
-    // Create the XSS data extractor
-    Data::XSSEPRDataExtractor xss_data_extractor(
+  // Construct the the path to the data file
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  // Create the ACEFileHandler
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         data_properties.tableName(),
+                                         data_properties.fileStartLine(),
+                                         true );
+
+  // Create the XSS data extractor
+  Data::XSSEPRDataExtractor xss_data_extractor(
                                          ace_file_handler.getTableNXSArray(),
                                          ace_file_handler.getTableJXSArray(),
                                          ace_file_handler.getTableXSSArray() );
 
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
-
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
-                             xss_data_extractor,
-                             atomic_relaxation_model,
-                             properties.getMinPhotonEnergy(),
-                             properties.getMinElectronEnergy(),
-                             properties.isAtomicRelaxationModeOn( ELECTRON ) );
-
-    // Initialize the new electroatom
-    ElectroatomNameMap::mapped_type& electroatom =
-      d_electroatom_name_map[electroatom_name];
-
-    // Create the new electroatom
-    ElectroatomACEFactory::createElectroatom( xss_data_extractor,
-                                              data_properties.tableName(),
-                                              atomic_weight,
-                                              atomic_relaxation_model,
-                                              properties,
-                                              electroatom );
-
-    // Cache the new electroatom in the table name map
-    d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()] = electroatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
+  // Create the atomic relaxation model
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+
+  atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+                               xss_data_extractor,
+                               atomic_relaxation_model,
+                               properties.getMinPhotonEnergy(),
+                               properties.getMinElectronEnergy(),
+                               properties.isAtomicRelaxationModeOn( ELECTRON ) );
+
+  // Create the new electroatom
+  ElectroatomACEFactory::createElectroatom( xss_data_extractor,
+                                            data_properties.tableName(),
+                                            atomic_weight,
+                                            atomic_relaxation_model,
+                                            properties,
+                                            electroatom );
+
+  if( d_verbose )
   {
-    d_electroatom_name_map[electroatom_name] =
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()];
+    FRENSIE_LOG_NOTIFICATION( " Loaded ACE EPR electroatomic cross section "
+                              "table " << data_properties.tableName() <<
+                              " from " << ace_file_path.string() << "." );
   }
 }
 
-
-// Create an electroatom from a Native table
+// Create a electroatom from a Native table
+/*! \details This method can be called concurrently for different tables.
+ */
 void ElectroatomFactory::createElectroatomFromNativeTable(
-                      const boost::filesystem::path& data_directory,
-                      const std::string& electroatom_name,
-                      const double atomic_weight,
-                      const Data::ElectroatomicDataProperties& data_properties,
-                      const std::shared_ptr<AtomicRelaxationModelFactory>&
-                      atomic_relaxation_model_factory,
-                      const SimulationProperties& properties )
+			const boost::filesystem::path& data_directory,
+                        const double atomic_weight,
+                        const Data::ElectroatomicDataProperties& data_properties,
+                        const std::shared_ptr<AtomicRelaxationModelFactory>&
+                        atomic_relaxation_model_factory,
+                        const SimulationProperties& properties,
+                        ElectroatomNameMap::mapped_type& electroatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE].find( data_properties.filePath().string() ) ==
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE].end() )
-  {
-    // Construct the path to the native file
-    boost::filesystem::path native_file_path = data_directory;
-    native_file_path /= data_properties.filePath();
-    native_file_path.make_preferred();
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                     " Loading native EPR cross section table "
-                                     "(v " << data_properties.fileVersion() <<
-                                     ") for " << data_properties.atom() <<
-                                     " from " << native_file_path.string() <<
-                                     " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-
-    // Create the epr data container
-    Data::ElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
-
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
-
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
-                             data_container,
-                             atomic_relaxation_model,
-                             properties.getMinPhotonEnergy(),
-                             properties.getMinElectronEnergy(),
-                             properties.isAtomicRelaxationModeOn( ELECTRON ) );
-
-    // Initialize the new electroatom
-    ElectroatomNameMap::mapped_type& electroatom =
-      d_electroatom_name_map[electroatom_name];
-
-    // Create the new electroatom
-    ElectroatomNativeFactory::createElectroatom( data_container,
-                                                 data_properties.filePath().string(),
-                                                 atomic_weight,
-                                                 atomic_relaxation_model,
-                                                 properties,
-                                                 electroatom );
-
-    // Cache the new electroatom in the table name map
-    d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()] = electroatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
+  // Construct the path to the native file
+  boost::filesystem::path native_file_path = data_directory;
+  native_file_path /= data_properties.filePath();
+  native_file_path.make_preferred();
+
+  // Use the flat array archive export of the table if there is one
+  native_file_path = Data::resolveFlatArrayArchivePath( native_file_path );
+
+  // Create the epr data container
+  Data::ElectronPhotonRelaxationDataContainer
+    data_container( native_file_path );
+
+  // Create the atomic relaxation model
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+
+  atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+                               data_container,
+                               atomic_relaxation_model,
+                               properties.getMinPhotonEnergy(),
+                               properties.getMinElectronEnergy(),
+                               properties.isAtomicRelaxationModeOn( ELECTRON ) );
+
+  // Create the new electroatom
+  ElectroatomNativeFactory::createElectroatom( data_container,
+                                               data_properties.filePath().string(),
+                                               atomic_weight,
+                                               atomic_relaxation_model,
+                                               properties,
+                                               electroatom );
+
+  if( d_verbose )
   {
-    d_electroatom_name_map[electroatom_name] =
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()];
+    FRENSIE_LOG_NOTIFICATION( " Loaded native EPR cross section table "
+                              "(v " << data_properties.fileVersion() <<
+                              ") for " << data_properties.atom() <<
+                              " from " << native_file_path.string() << "." );
   }
 }
 
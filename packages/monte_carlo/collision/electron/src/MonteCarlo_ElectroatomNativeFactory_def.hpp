@@ -141,23 +141,41 @@ void ElectroatomNativeFactory::createElectroatomCore(
     }
   }
 
-  // Create the bremsstrahlung scattering reaction
+  // Create the bremsstrahlung scattering reaction (only the photons above
+  // the cutoff energy are emitted individually when the condensed history
+  // mode is on)
   if ( properties.isBremsstrahlungModeOn() )
   {
     Electroatom::ConstReactionMap::mapped_type& reaction_pointer =
       scattering_reactions[BREMSSTRAHLUNG_ELECTROATOMIC_REACTION];
 
-    ElectroatomicReactionNativeFactory::createBremsstrahlungReaction<TwoDInterpPolicy,TwoDGridPolicy>(
+    if( properties.isCondensedHistoryModeOn() )
+    {
+      ElectroatomicReactionNativeFactory::createHardBremsstrahlungReaction<TwoDInterpPolicy,TwoDGridPolicy>(
+                  raw_electroatom_data,
+                  energy_grid,
+                  grid_searcher,
+                  reaction_pointer,
+                  properties.getBremsstrahlungAngularDistributionFunction(),
+                  properties.getCondensedHistoryBremsstrahlungCutoffEnergy(),
+                  properties.getElectronEvaluationTolerance() );
+    }
+    else
+    {
+      ElectroatomicReactionNativeFactory::createBremsstrahlungReaction<TwoDInterpPolicy,TwoDGridPolicy>(
                   raw_electroatom_data,
                   energy_grid,
                   grid_searcher,
                   reaction_pointer,
                   properties.getBremsstrahlungAngularDistributionFunction(),
                   properties.getElectronEvaluationTolerance() );
+    }
   }
 
-  // Create the atomic excitation scattering reaction
-  if ( properties.isAtomicExcitationModeOn() )
+  // Create the atomic excitation scattering reaction (it is part of the
+  // condensed history reaction when the condensed history mode is on)
+  if ( properties.isAtomicExcitationModeOn() &&
+       !properties.isCondensedHistoryModeOn() )
   {
     Electroatom::ConstReactionMap::mapped_type& reaction_pointer =
       scattering_reactions[ATOMIC_EXCITATION_ELECTROATOMIC_REACTION];
@@ -169,18 +187,34 @@ void ElectroatomNativeFactory::createElectroatomCore(
                                reaction_pointer );
   }
 
-  // Create the subshell electroionization reactions
+  // Create the subshell electroionization reactions (only the knock-on
+  // electrons above the cutoff energy are created individually when the
+  // condensed history mode is on)
   if ( properties.isElectroionizationModeOn() )
   {
     std::vector<std::shared_ptr<const ElectroatomicReaction> > reaction_pointers;
 
-    ElectroatomicReactionNativeFactory::createSubshellElectroionizationReactions<TwoDInterpPolicy,TwoDGridPolicy>(
+    if( properties.isCondensedHistoryModeOn() )
+    {
+      ElectroatomicReactionNativeFactory::createHardSubshellElectroionizationReactions<TwoDInterpPolicy,TwoDGridPolicy>(
                       raw_electroatom_data,
                       energy_grid,
                       grid_searcher,
                       reaction_pointers,
                       properties.getElectroionizationSamplingMode(),
+                      properties.getCondensedHistoryElectroionizationCutoffEnergy(),
                       properties.getElectronEvaluationTolerance() );
+    }
+    else
+    {
+      ElectroatomicReactionNativeFactory::createSubshellElectroionizationReactions<TwoDInterpPolicy,TwoDGridPolicy>(
+                      raw_electroatom_data,
+                      energy_grid,
+                      grid_searcher,
+                      reaction_pointers,
+                      properties.getElectroionizationSamplingMode(),
+                      properties.getElectronEvaluationTolerance() );
+    }
 
     for( size_t i = 0; i < reaction_pointers.size(); ++i )
     {
@@ -189,6 +223,46 @@ void ElectroatomNativeFactory::createElectroatomCore(
     }
   }
 
+  // Create the condensed history reaction without soft elastic scattering
+  // (the soft elastic scattering is added with the hard elastic reaction)
+  if( properties.isCondensedHistoryModeOn() &&
+      !properties.isElasticModeOn() &&
+      ( properties.isAtomicExcitationModeOn() ||
+        properties.isBremsstrahlungModeOn() ||
+        properties.isElectroionizationModeOn() ) )
+  {
+    Electroatom::ConstReactionMap::mapped_type& reaction_pointer =
+      scattering_reactions[CONDENSED_HISTORY_ELECTROATOMIC_REACTION];
+
+    ElectroatomicReactionNativeFactory::createCondensedHistoryReaction(
+            raw_electroatom_data,
+            energy_grid,
+            grid_searcher,
+            reaction_pointer,
+            properties.isAtomicExcitationModeOn(),
+            false,
+            properties.getCondensedHistoryMaxEnergyLossFraction(),
+            properties.getCondensedHistoryMaxTransportMeanFreePaths(),
+            properties.getElectronEvaluationTolerance(),
+            properties.isBremsstrahlungModeOn(),
+            properties.getCondensedHistoryBremsstrahlungCutoffEnergy(),
+            properties.isElectroionizationModeOn(),
+            properties.getCondensedHistoryElectroionizationCutoffEnergy() );
+  }
+
+  // Create the stopping power reaction (it will be a miscellaneous reaction
+  // that is only used for electron range calculations)
+  {
+    Electroatom::ConstReactionMap::mapped_type& reaction_pointer =
+      absorption_reactions[STOPPING_POWER_ELECTROATOMIC_REACTION];
+
+    ElectroatomicReactionNativeFactory::createStoppingPowerReaction(
+                               raw_electroatom_data,
+                               energy_grid,
+                               grid_searcher,
+                               reaction_pointer );
+  }
+
   // Create the electroatom core
   electroatom_core.reset( new ElectroatomCore( energy_grid,
                                                grid_searcher,
@@ -212,7 +286,42 @@ void ElectroatomNativeFactory::createElasticElectroatomCore(
   ElasticElectronDistributionType distribution_type =
                             properties.getElasticElectronDistributionMode();
 
-  if( distribution_type == COUPLED_DISTRIBUTION )
+  // Only the large angle (cutoff) elastic collisions are simulated
+  // individually in condensed history mode. The cutoff must match the moment
+  // preserving data cutoff so that the soft and hard elastic cross sections
+  // are complementary.
+  if( properties.isCondensedHistoryModeOn() )
+  {
+    Electroatom::ConstReactionMap::mapped_type& hard_reaction_pointer =
+      scattering_reactions[CUTOFF_ELASTIC_ELECTROATOMIC_REACTION];
+
+    ElectroatomicReactionNativeFactory::createCutoffElasticReaction<TwoDInterpPolicy,TwoDGridPolicy>(
+                        raw_electroatom_data,
+                        energy_grid,
+                        grid_searcher,
+                        hard_reaction_pointer,
+                        raw_electroatom_data.getCutoffAngleCosine(),
+                        properties.getElectronEvaluationTolerance() );
+
+    Electroatom::ConstReactionMap::mapped_type& soft_reaction_pointer =
+      scattering_reactions[CONDENSED_HISTORY_ELECTROATOMIC_REACTION];
+
+    ElectroatomicReactionNativeFactory::createCondensedHistoryReaction<TwoDInterpPolicy,TwoDGridPolicy>(
+            raw_electroatom_data,
+            energy_grid,
+            grid_searcher,
+            soft_reaction_pointer,
+            properties.isAtomicExcitationModeOn(),
+            true,
+            properties.getCondensedHistoryMaxEnergyLossFraction(),
+            properties.getCondensedHistoryMaxTransportMeanFreePaths(),
+            properties.getElectronEvaluationTolerance(),
+            properties.isBremsstrahlungModeOn(),
+            properties.getCondensedHistoryBremsstrahlungCutoffEnergy(),
+            properties.isElectroionizationModeOn(),
+            properties.getCondensedHistoryElectroionizationCutoffEnergy() );
+  }
+  else if( distribution_type == COUPLED_DISTRIBUTION )
   {
     Electroatom::ConstReactionMap::mapped_type& reaction_pointer =
       scattering_reactions[COUPLED_ELASTIC_ELECTROATOMIC_REACTION];
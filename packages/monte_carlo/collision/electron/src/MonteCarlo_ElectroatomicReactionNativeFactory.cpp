@@ -12,6 +12,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_ElectroatomicReactionNativeFactory.hpp"
 #include "MonteCarlo_VoidAbsorptionElectroatomicReaction.hpp"
+#include "MonteCarlo_AbsorptionElectroatomicReaction.hpp"
 
 namespace MonteCarlo{
 
@@ -97,6 +98,407 @@ void ElectroatomicReactionNativeFactory::createAtomicExcitationReaction(
                                                 energy_loss_distribution ) );
 }
 
+// Create a total stopping power electroatomic reaction
+/*! \details The stopping power reaction is a pseudo absorption reaction
+ * whose "cross section" is the total (collisional + radiative) stopping
+ * cross section (MeV-b), i.e. the sum over the inelastic reactions of the
+ * reaction cross section times the mean energy lost in the reaction. It is
+ * built from the same tables that are used for transport (the atomic
+ * excitation energy losses, the mean bremsstrahlung photon energies and the
+ * mean electroionization knock-on energies plus the subshell binding
+ * energies) so that the resulting ranges are consistent with the transport
+ * model. The macroscopic value (MeV/cm) can be retrieved from a material
+ * through the STOPPING_POWER_ELECTROATOMIC_REACTION type. Since the reaction
+ * type is not a standard absorption reaction it will never be sampled.
+ */
+void ElectroatomicReactionNativeFactory::createStoppingPowerReaction(
+            const Data::ElectronPhotonRelaxationDataContainer& raw_electroatom_data,
+            const std::shared_ptr<const std::vector<double> >& energy_grid,
+            const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
+            std::shared_ptr<const ElectroatomicReaction>& stopping_power_reaction )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( raw_electroatom_data.getElectronEnergyGrid().size() ==
+                    energy_grid->size() );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid->begin(),
+                                                      energy_grid->end() ) );
+
+  std::vector<double> full_stopping_cross_section( energy_grid->size(), 0.0 );
+
+  // Atomic excitation contribution
+  ThisType::addStoppingCrossSectionContribution(
+          *energy_grid,
+          raw_electroatom_data.getAtomicExcitationCrossSection(),
+          raw_electroatom_data.getAtomicExcitationCrossSectionThresholdEnergyIndex(),
+          raw_electroatom_data.getAtomicExcitationEnergyGrid(),
+          raw_electroatom_data.getAtomicExcitationEnergyLoss(),
+          0.0,
+          full_stopping_cross_section );
+
+  // Bremsstrahlung contribution
+  {
+    std::vector<double> mean_photon_energies;
+
+    ThisType::calculateMeanSecondaryEnergies(
+                       raw_electroatom_data.getBremsstrahlungEnergyGrid(),
+                       raw_electroatom_data.getBremsstrahlungPhotonEnergy(),
+                       raw_electroatom_data.getBremsstrahlungPhotonPDF(),
+                       mean_photon_energies );
+
+    ThisType::addStoppingCrossSectionContribution(
+          *energy_grid,
+          raw_electroatom_data.getBremsstrahlungCrossSection(),
+          raw_electroatom_data.getBremsstrahlungCrossSectionThresholdEnergyIndex(),
+          raw_electroatom_data.getBremsstrahlungEnergyGrid(),
+          mean_photon_energies,
+          0.0,
+          full_stopping_cross_section );
+  }
+
+  // Electroionization contributions
+  std::set<unsigned>::const_iterator subshell_it =
+    raw_electroatom_data.getSubshells().begin();
+
+  while( subshell_it != raw_electroatom_data.getSubshells().end() )
+  {
+    std::vector<double> mean_recoil_energies;
+
+    ThisType::calculateMeanSecondaryEnergies(
+        raw_electroatom_data.getElectroionizationEnergyGrid( *subshell_it ),
+        raw_electroatom_data.getElectroionizationRecoilEnergy( *subshell_it ),
+        raw_electroatom_data.getElectroionizationRecoilPDF( *subshell_it ),
+        mean_recoil_energies );
+
+    ThisType::addStoppingCrossSectionContribution(
+        *energy_grid,
+        raw_electroatom_data.getElectroionizationCrossSection( *subshell_it ),
+        raw_electroatom_data.getElectroionizationCrossSectionThresholdEnergyIndex( *subshell_it ),
+        raw_electroatom_data.getElectroionizationEnergyGrid( *subshell_it ),
+        mean_recoil_energies,
+        raw_electroatom_data.getSubshellBindingEnergy( *subshell_it ),
+        full_stopping_cross_section );
+
+    ++subshell_it;
+  }
+
+  // Index of first non zero stopping cross section in the energy grid
+  size_t threshold_energy_index = 0;
+
+  while( threshold_energy_index < full_stopping_cross_section.size()-1 &&
+         full_stopping_cross_section[threshold_energy_index] == 0.0 )
+    ++threshold_energy_index;
+
+  std::shared_ptr<std::vector<double> >
+    stopping_cross_section( new std::vector<double> );
+  stopping_cross_section->assign(
+        full_stopping_cross_section.begin() + threshold_energy_index,
+        full_stopping_cross_section.end() );
+
+  stopping_power_reaction.reset(
+    new AbsorptionElectroatomicReaction<Utility::LinLin,false>(
+                                      energy_grid,
+                                      stopping_cross_section,
+                                      threshold_energy_index,
+                                      grid_searcher,
+                                      STOPPING_POWER_ELECTROATOMIC_REACTION ) );
+}
+
+// Calculate the mean of each tabulated secondary energy distribution
+/*! \details The tabulated pdfs are integrated with the trapezoid rule and
+ * the means are normalized by the integrated pdfs (the tables are not
+ * guaranteed to be normalized).
+ */
+void ElectroatomicReactionNativeFactory::calculateMeanSecondaryEnergies(
+    const std::vector<double>& incoming_energy_grid,
+    const std::map<double,std::vector<double> >& secondary_energies,
+    const std::map<double,std::vector<double> >& secondary_pdfs,
+    std::vector<double>& mean_secondary_energies )
+{
+  mean_secondary_energies.resize( incoming_energy_grid.size() );
+
+  for( size_t i = 0; i < incoming_energy_grid.size(); ++i )
+  {
+    const std::vector<double>& energies =
+      secondary_energies.find( incoming_energy_grid[i] )->second;
+    const std::vector<double>& pdf =
+      secondary_pdfs.find( incoming_energy_grid[i] )->second;
+
+    double norm = 0.0;
+    double first_moment = 0.0;
+
+    for( size_t j = 1; j < energies.size(); ++j )
+    {
+      double bin_width = energies[j] - energies[j-1];
+
+      norm += 0.5*bin_width*(pdf[j] + pdf[j-1]);
+      first_moment +=
+        0.5*bin_width*(energies[j]*pdf[j] + energies[j-1]*pdf[j-1]);
+    }
+
+    if( norm > 0.0 )
+      mean_secondary_energies[i] = first_moment/norm;
+    else
+      mean_secondary_energies[i] = 0.0;
+  }
+}
+
+// Add a cross section weighted mean energy loss to a stopping cross section
+/*! \details The mean energy losses are interpolated (lin-lin) onto the
+ * electron energy grid and are held constant outside of the tabulated range.
+ * The constant energy loss (e.g. a binding energy) is added to every
+ * interpolated mean energy loss.
+ */
+void ElectroatomicReactionNativeFactory::addStoppingCrossSectionContribution(
+                         const std::vector<double>& energy_grid,
+                         const std::vector<double>& cross_section,
+                         const size_t threshold_energy_index,
+                         const std::vector<double>& loss_energy_grid,
+                         const std::vector<double>& mean_energy_losses,
+                         const double constant_energy_loss,
+                         std::vector<double>& stopping_cross_section )
+{
+  // Make sure the cross section is valid
+  testPrecondition( threshold_energy_index + cross_section.size() <=
+                    energy_grid.size() );
+  // Make sure the mean energy losses are valid
+  testPrecondition( loss_energy_grid.size() == mean_energy_losses.size() );
+  testPrecondition( loss_energy_grid.size() > 0 );
+
+  for( size_t i = 0; i < cross_section.size(); ++i )
+  {
+    double energy = energy_grid[threshold_energy_index+i];
+
+    double mean_energy_loss;
+
+    if( energy <= loss_energy_grid.front() )
+      mean_energy_loss = mean_energy_losses.front();
+    else if( energy >= loss_energy_grid.back() )
+      mean_energy_loss = mean_energy_losses.back();
+    else
+    {
+      size_t lower_bin_index =
+        Utility::Search::binaryLowerBoundIndex( loss_energy_grid.begin(),
+                                                loss_energy_grid.end(),
+                                                energy );
+
+      mean_energy_loss = Utility::LinLin::interpolate(
+                                    loss_energy_grid[lower_bin_index],
+                                    loss_energy_grid[lower_bin_index+1],
+                                    energy,
+                                    mean_energy_losses[lower_bin_index],
+                                    mean_energy_losses[lower_bin_index+1] );
+    }
+
+    stopping_cross_section[threshold_energy_index+i] +=
+      cross_section[i]*(mean_energy_loss + constant_energy_loss);
+  }
+}
+
+// Calculate the soft fraction and soft first moment of each distribution
+/*! \details The soft part of a distribution is the part below the cutoff
+ * energy. The tabulated pdfs are integrated with the trapezoid rule (the pdf
+ * at the cutoff energy is found with lin-lin interpolation) and the soft
+ * fractions and soft first moments are normalized by the integrated pdfs.
+ * The soft first moment is therefore the mean soft secondary energy per
+ * collision (hard collisions contribute nothing to it).
+ */
+void ElectroatomicReactionNativeFactory::calculateSoftSecondaryEnergyMoments(
+    const std::vector<double>& incoming_energy_grid,
+    const std::map<double,std::vector<double> >& secondary_energies,
+    const std::map<double,std::vector<double> >& secondary_pdfs,
+    const double cutoff_energy,
+    std::vector<double>& soft_fractions,
+    std::vector<double>& soft_first_moments )
+{
+  // Make sure the cutoff energy is valid
+  testPrecondition( cutoff_energy > 0.0 );
+
+  soft_fractions.resize( incoming_energy_grid.size() );
+  soft_first_moments.resize( incoming_energy_grid.size() );
+
+  for( size_t i = 0; i < incoming_energy_grid.size(); ++i )
+  {
+    const std::vector<double>& energies =
+      secondary_energies.find( incoming_energy_grid[i] )->second;
+    const std::vector<double>& pdf =
+      secondary_pdfs.find( incoming_energy_grid[i] )->second;
+
+    double norm = 0.0;
+    double soft_norm = 0.0;
+    double soft_first_moment = 0.0;
+
+    for( size_t j = 1; j < energies.size(); ++j )
+    {
+      double bin_width = energies[j] - energies[j-1];
+
+      norm += 0.5*bin_width*(pdf[j] + pdf[j-1]);
+
+      if( energies[j-1] < cutoff_energy )
+      {
+        double soft_energy = energies[j];
+        double soft_pdf = pdf[j];
+
+        if( soft_energy > cutoff_energy )
+        {
+          soft_energy = cutoff_energy;
+          soft_pdf = Utility::LinLin::interpolate( energies[j-1],
+                                                   energies[j],
+                                                   cutoff_energy,
+                                                   pdf[j-1],
+                                                   pdf[j] );
+        }
+
+        double soft_bin_width = soft_energy - energies[j-1];
+
+        soft_norm += 0.5*soft_bin_width*(soft_pdf + pdf[j-1]);
+        soft_first_moment += 0.5*soft_bin_width*
+          (soft_energy*soft_pdf + energies[j-1]*pdf[j-1]);
+      }
+    }
+
+    if( norm > 0.0 )
+    {
+      soft_fractions[i] = soft_norm/norm;
+      soft_first_moments[i] = soft_first_moment/norm;
+    }
+    else
+    {
+      soft_fractions[i] = 0.0;
+      soft_first_moments[i] = 0.0;
+    }
+  }
+}
+
+// Remove the soft part of each tabulated secondary energy distribution
+/*! \details Each distribution is truncated at the cutoff energy (the pdf at
+ * the cutoff energy is found with lin-lin interpolation). The distributions
+ * that are entirely below the cutoff energy have no hard part and are
+ * removed along with their incoming energies.
+ */
+void ElectroatomicReactionNativeFactory::truncateSecondaryEnergyDistributions(
+    const std::vector<double>& incoming_energy_grid,
+    const std::map<double,std::vector<double> >& secondary_energies,
+    const std::map<double,std::vector<double> >& secondary_pdfs,
+    const double cutoff_energy,
+    std::vector<double>& hard_incoming_energy_grid,
+    std::map<double,std::vector<double> >& hard_secondary_energies,
+    std::map<double,std::vector<double> >& hard_secondary_pdfs )
+{
+  // Make sure the cutoff energy is valid
+  testPrecondition( cutoff_energy > 0.0 );
+
+  hard_incoming_energy_grid.clear();
+  hard_secondary_energies.clear();
+  hard_secondary_pdfs.clear();
+
+  for( size_t i = 0; i < incoming_energy_grid.size(); ++i )
+  {
+    const std::vector<double>& energies =
+      secondary_energies.find( incoming_energy_grid[i] )->second;
+    const std::vector<double>& pdf =
+      secondary_pdfs.find( incoming_energy_grid[i] )->second;
+
+    if( energies.back() <= cutoff_energy )
+      continue;
+
+    std::vector<double>& hard_energies =
+      hard_secondary_energies[incoming_energy_grid[i]];
+    std::vector<double>& hard_pdf =
+      hard_secondary_pdfs[incoming_energy_grid[i]];
+
+    for( size_t j = 0; j < energies.size(); ++j )
+    {
+      if( energies[j] > cutoff_energy )
+      {
+        // Start the hard part at the cutoff energy
+        if( hard_energies.empty() && j > 0 )
+        {
+          hard_energies.push_back( cutoff_energy );
+          hard_pdf.push_back( Utility::LinLin::interpolate( energies[j-1],
+                                                            energies[j],
+                                                            cutoff_energy,
+                                                            pdf[j-1],
+                                                            pdf[j] ) );
+        }
+
+        hard_energies.push_back( energies[j] );
+        hard_pdf.push_back( pdf[j] );
+      }
+    }
+
+    hard_incoming_energy_grid.push_back( incoming_energy_grid[i] );
+  }
+}
+
+// Calculate the hard cross section above a secondary cutoff energy
+/*! \details The hard cross section is the cross section times the hard
+ * fraction (1 - soft fraction) of the secondary energy distribution. The
+ * soft fractions are interpolated (lin-lin) onto the electron energy grid
+ * and are held constant outside of the tabulated range. The hard cross
+ * section is zero below the min hard energy (the lowest incoming energy of
+ * the hard distribution). The returned threshold energy index is the index
+ * of the first non-zero hard cross section value.
+ */
+void ElectroatomicReactionNativeFactory::calculateHardCrossSection(
+                         const std::vector<double>& energy_grid,
+                         const std::vector<double>& cross_section,
+                         const size_t threshold_energy_index,
+                         const std::vector<double>& incoming_energy_grid,
+                         const std::vector<double>& soft_fractions,
+                         const double min_hard_energy,
+                         std::vector<double>& hard_cross_section,
+                         size_t& hard_threshold_energy_index )
+{
+  // Make sure the cross section is valid
+  testPrecondition( threshold_energy_index + cross_section.size() <=
+                    energy_grid.size() );
+  // Make sure the soft fractions are valid
+  testPrecondition( incoming_energy_grid.size() == soft_fractions.size() );
+  testPrecondition( incoming_energy_grid.size() > 0 );
+
+  hard_cross_section.clear();
+  hard_threshold_energy_index = threshold_energy_index;
+
+  for( size_t i = 0; i < cross_section.size(); ++i )
+  {
+    double energy = energy_grid[threshold_energy_index+i];
+
+    double hard_cross_section_value = 0.0;
+
+    if( energy >= min_hard_energy )
+    {
+      double soft_fraction;
+
+      if( energy <= incoming_energy_grid.front() )
+        soft_fraction = soft_fractions.front();
+      else if( energy >= incoming_energy_grid.back() )
+        soft_fraction = soft_fractions.back();
+      else
+      {
+        size_t lower_bin_index =
+          Utility::Search::binaryLowerBoundIndex( incoming_energy_grid.begin(),
+                                                  incoming_energy_grid.end(),
+                                                  energy );
+
+        soft_fraction = Utility::LinLin::interpolate(
+                                  incoming_energy_grid[lower_bin_index],
+                                  incoming_energy_grid[lower_bin_index+1],
+                                  energy,
+                                  soft_fractions[lower_bin_index],
+                                  soft_fractions[lower_bin_index+1] );
+      }
+
+      hard_cross_section_value = cross_section[i]*(1.0 - soft_fraction);
+    }
+
+    // Skip the zero values below the hard threshold
+    if( hard_cross_section.empty() && hard_cross_section_value <= 0.0 )
+      ++hard_threshold_energy_index;
+    else
+      hard_cross_section.push_back( hard_cross_section_value );
+  }
+}
+
 // Create a void absorption electroatomic reaction
 void ElectroatomicReactionNativeFactory::createVoidAbsorptionReaction(
       std::shared_ptr<const ElectroatomicReaction>& void_absorption_reaction )
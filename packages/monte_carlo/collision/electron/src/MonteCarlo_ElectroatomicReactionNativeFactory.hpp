@@ -124,6 +124,24 @@ public:
     const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
     std::shared_ptr<const ElectroatomicReaction>& atomic_excitation_reaction );
 
+  //! Create a condensed history (class-II) electroatomic reaction
+  template< typename TwoDInterpPolicy = Utility::LogLogCosLog,
+            template<typename> class TwoDGridPolicy = Utility::Correlated>
+  static void createCondensedHistoryReaction(
+    const Data::ElectronPhotonRelaxationDataContainer& raw_electroatom_data,
+    const std::shared_ptr<const std::vector<double> >& energy_grid,
+    const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
+    std::shared_ptr<const ElectroatomicReaction>& condensed_history_reaction,
+    const bool soft_atomic_excitation,
+    const bool soft_elastic,
+    const double max_energy_loss_fraction,
+    const double max_transport_mfps,
+    const double evaluation_tol,
+    const bool soft_bremsstrahlung = false,
+    const double bremsstrahlung_cutoff_energy = 1e-3,
+    const bool soft_electroionization = false,
+    const double electroionization_cutoff_energy = 1e-4 );
+
   //! Create the subshell electroionization electroatomic reaction
   template< typename TwoDInterpPolicy = Utility::LogLogLog,
             template<typename> class TwoDGridPolicy = Utility::UnitBaseCorrelated,
@@ -162,12 +180,91 @@ public:
     BremsstrahlungAngularDistributionType photon_distribution_function,
     const double evaluation_tol );
 
+  //! Create the hard (condensed history) subshell electroionization reactions
+  template< typename TwoDInterpPolicy = Utility::LogLogLog,
+            template<typename> class TwoDGridPolicy = Utility::UnitBaseCorrelated>
+  static void createHardSubshellElectroionizationReactions(
+    const Data::ElectronPhotonRelaxationDataContainer& raw_electroatom_data,
+    const std::shared_ptr<const std::vector<double> >& energy_grid,
+    const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
+    std::vector<std::shared_ptr<const ElectroatomicReaction> >&
+        electroionization_subshell_reactions,
+    const ElectroionizationSamplingType sampling_type,
+    const double cutoff_energy,
+    const double evaluation_tol );
+
+  //! Create the hard (condensed history) bremsstrahlung electroatomic reaction
+  template< typename TwoDInterpPolicy = Utility::LogLogLog,
+            template<typename> class TwoDGridPolicy = Utility::UnitBaseCorrelated>
+  static void createHardBremsstrahlungReaction(
+    const Data::ElectronPhotonRelaxationDataContainer& raw_electroatom_data,
+    const std::shared_ptr<const std::vector<double> >& energy_grid,
+    const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
+    std::shared_ptr<const ElectroatomicReaction>& bremsstrahlung_reaction,
+    BremsstrahlungAngularDistributionType photon_distribution_function,
+    const double cutoff_energy,
+    const double evaluation_tol );
+
+  //! Create a total stopping power electroatomic reaction
+  static void createStoppingPowerReaction(
+    const Data::ElectronPhotonRelaxationDataContainer& raw_electroatom_data,
+    const std::shared_ptr<const std::vector<double> >& energy_grid,
+    const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
+    std::shared_ptr<const ElectroatomicReaction>& stopping_power_reaction );
+
   //! Create a void absorption electroatomic reaction
   static void createVoidAbsorptionReaction(
     std::shared_ptr<const ElectroatomicReaction>& void_absorption_reaction );
 
 private:
 
+  // Calculate the mean of each tabulated secondary energy distribution
+  static void calculateMeanSecondaryEnergies(
+    const std::vector<double>& incoming_energy_grid,
+    const std::map<double,std::vector<double> >& secondary_energies,
+    const std::map<double,std::vector<double> >& secondary_pdfs,
+    std::vector<double>& mean_secondary_energies );
+
+  // Add a cross section weighted mean energy loss to a stopping cross section
+  static void addStoppingCrossSectionContribution(
+    const std::vector<double>& energy_grid,
+    const std::vector<double>& cross_section,
+    const size_t threshold_energy_index,
+    const std::vector<double>& loss_energy_grid,
+    const std::vector<double>& mean_energy_losses,
+    const double constant_energy_loss,
+    std::vector<double>& stopping_cross_section );
+
+  // Calculate the soft fraction and soft first moment of each distribution
+  static void calculateSoftSecondaryEnergyMoments(
+    const std::vector<double>& incoming_energy_grid,
+    const std::map<double,std::vector<double> >& secondary_energies,
+    const std::map<double,std::vector<double> >& secondary_pdfs,
+    const double cutoff_energy,
+    std::vector<double>& soft_fractions,
+    std::vector<double>& soft_first_moments );
+
+  // Remove the soft part of each tabulated secondary energy distribution
+  static void truncateSecondaryEnergyDistributions(
+    const std::vector<double>& incoming_energy_grid,
+    const std::map<double,std::vector<double> >& secondary_energies,
+    const std::map<double,std::vector<double> >& secondary_pdfs,
+    const double cutoff_energy,
+    std::vector<double>& hard_incoming_energy_grid,
+    std::map<double,std::vector<double> >& hard_secondary_energies,
+    std::map<double,std::vector<double> >& hard_secondary_pdfs );
+
+  // Calculate the hard cross section above a secondary cutoff energy
+  static void calculateHardCrossSection(
+    const std::vector<double>& energy_grid,
+    const std::vector<double>& cross_section,
+    const size_t threshold_energy_index,
+    const std::vector<double>& incoming_energy_grid,
+    const std::vector<double>& soft_fractions,
+    const double min_hard_energy,
+    std::vector<double>& hard_cross_section,
+    size_t& hard_threshold_energy_index );
+
   // Constructor
   ElectroatomicReactionNativeFactory();
 };
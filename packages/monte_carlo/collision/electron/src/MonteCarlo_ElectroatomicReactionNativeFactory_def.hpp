@@ -17,11 +17,14 @@
 #include "MonteCarlo_ScreenedRutherfordElasticElectroatomicReaction.hpp"
 #include "MonteCarlo_MomentPreservingElasticElectroatomicReaction.hpp"
 #include "MonteCarlo_AtomicExcitationElectroatomicReaction.hpp"
+#include "MonteCarlo_CondensedHistoryElectroatomicReaction.hpp"
 #include "MonteCarlo_BremsstrahlungElectroatomicReaction.hpp"
 #include "MonteCarlo_ElectroionizationSubshellElectroatomicReaction.hpp"
 #include "Data_SubshellType.hpp"
 #include "Utility_SortAlgorithms.hpp"
+#include "Utility_SearchAlgorithms.hpp"
 #include "Utility_TabularDistribution.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -344,6 +347,293 @@ void ElectroatomicReactionNativeFactory::createMomentPreservingElasticReaction(
                           distribution ) );
 }
 
+// Create a condensed history (class-II) electroatomic reaction
+/*! \details The soft stopping cross section is tabulated from the atomic
+ * excitation cross section and mean energy loss and the soft transport
+ * cross sections are tabulated from the moment preserving elastic cross
+ * section and discrete angles (sigma_l = sigma_mp*sum_k w_k*(1-P_l(mu_k))).
+ * When soft bremsstrahlung is requested the restricted radiative stopping
+ * cross section (sigma_b*int_0^Wc W p(W) dW) of the photons below the
+ * bremsstrahlung cutoff energy is added. When soft electroionization is
+ * requested the restricted collisional stopping cross section
+ * (sigma_i*int_0^Wc (W + B_i) p(W) dW) of the knock-on electrons below the
+ * electroionization cutoff energy is added for every subshell. The hard
+ * (cutoff elastic, bremsstrahlung and electroionization) reactions must be
+ * created separately with the same cutoff energies (see
+ * createHardBremsstrahlungReaction and
+ * createHardSubshellElectroionizationReactions). Moment preserving data is
+ * required when the soft elastic scattering is requested.
+ */
+template< typename TwoDInterpPolicy,
+          template<typename> class TwoDGridPolicy>
+void ElectroatomicReactionNativeFactory::createCondensedHistoryReaction(
+            const Data::ElectronPhotonRelaxationDataContainer& raw_electroatom_data,
+            const std::shared_ptr<const std::vector<double> >& energy_grid,
+            const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
+            std::shared_ptr<const ElectroatomicReaction>& condensed_history_reaction,
+            const bool soft_atomic_excitation,
+            const bool soft_elastic,
+            const double max_energy_loss_fraction,
+            const double max_transport_mfps,
+            const double evaluation_tol,
+            const bool soft_bremsstrahlung,
+            const double bremsstrahlung_cutoff_energy,
+            const bool soft_electroionization,
+            const double electroionization_cutoff_energy )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( raw_electroatom_data.getElectronEnergyGrid().size() ==
+                    energy_grid->size() );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid->begin(),
+                                                      energy_grid->end() ) );
+  // Make sure the step limits are valid
+  testPrecondition( max_energy_loss_fraction > 0.0 );
+  testPrecondition( max_energy_loss_fraction < 1.0 );
+  testPrecondition( max_transport_mfps > 0.0 );
+  // Make sure the cutoff energies are valid
+  testPrecondition( bremsstrahlung_cutoff_energy > 0.0 );
+  testPrecondition( electroionization_cutoff_energy > 0.0 );
+
+  TEST_FOR_EXCEPTION( soft_elastic &&
+                      !raw_electroatom_data.hasMomentPreservingData(),
+                      std::runtime_error,
+                      "condensed history soft elastic scattering requires "
+                      "moment preserving data!" );
+
+  const size_t grid_size = energy_grid->size();
+
+  std::vector<double> soft_stopping_cross_section( grid_size, 0.0 );
+  std::vector<double> first_transport_cross_section( grid_size, 0.0 );
+  std::vector<double> second_transport_cross_section( grid_size, 0.0 );
+
+  // Soft stopping cross section (atomic excitation cross section * mean loss)
+  if( soft_atomic_excitation )
+  {
+    const std::vector<double>& excitation_cross_section =
+      raw_electroatom_data.getAtomicExcitationCrossSection();
+
+    size_t excitation_threshold_index =
+      raw_electroatom_data.getAtomicExcitationCrossSectionThresholdEnergyIndex();
+
+    const std::vector<double>& loss_energy_grid =
+      raw_electroatom_data.getAtomicExcitationEnergyGrid();
+
+    Utility::TabularDistribution<Utility::LinLin> energy_loss(
+                          loss_energy_grid,
+                          raw_electroatom_data.getAtomicExcitationEnergyLoss() );
+
+    for( size_t i = 0; i < excitation_cross_section.size(); ++i )
+    {
+      double energy = (*energy_grid)[excitation_threshold_index+i];
+
+      // Hold the energy loss constant outside of the tabulated range
+      if( energy < loss_energy_grid.front() )
+        energy = loss_energy_grid.front();
+      else if( energy > loss_energy_grid.back() )
+        energy = loss_energy_grid.back();
+
+      soft_stopping_cross_section[excitation_threshold_index+i] =
+        excitation_cross_section[i]*energy_loss.evaluate( energy );
+    }
+  }
+
+  // Soft stopping cross section (bremsstrahlung photons below the cutoff)
+  if( soft_bremsstrahlung )
+  {
+    std::vector<double> soft_fractions, soft_photon_energies;
+
+    ThisType::calculateSoftSecondaryEnergyMoments(
+                       raw_electroatom_data.getBremsstrahlungEnergyGrid(),
+                       raw_electroatom_data.getBremsstrahlungPhotonEnergy(),
+                       raw_electroatom_data.getBremsstrahlungPhotonPDF(),
+                       bremsstrahlung_cutoff_energy,
+                       soft_fractions,
+                       soft_photon_energies );
+
+    ThisType::addStoppingCrossSectionContribution(
+          *energy_grid,
+          raw_electroatom_data.getBremsstrahlungCrossSection(),
+          raw_electroatom_data.getBremsstrahlungCrossSectionThresholdEnergyIndex(),
+          raw_electroatom_data.getBremsstrahlungEnergyGrid(),
+          soft_photon_energies,
+          0.0,
+          soft_stopping_cross_section );
+  }
+
+  // Soft stopping cross section (knock-on electrons below the cutoff)
+  if( soft_electroionization )
+  {
+    std::set<unsigned>::const_iterator subshell_it =
+      raw_electroatom_data.getSubshells().begin();
+
+    while( subshell_it != raw_electroatom_data.getSubshells().end() )
+    {
+      std::vector<double> soft_fractions, soft_energy_losses;
+
+      ThisType::calculateSoftSecondaryEnergyMoments(
+          raw_electroatom_data.getElectroionizationEnergyGrid( *subshell_it ),
+          raw_electroatom_data.getElectroionizationRecoilEnergy( *subshell_it ),
+          raw_electroatom_data.getElectroionizationRecoilPDF( *subshell_it ),
+          electroionization_cutoff_energy,
+          soft_fractions,
+          soft_energy_losses );
+
+      // Every soft collision also loses the subshell binding energy
+      const double binding_energy =
+        raw_electroatom_data.getSubshellBindingEnergy( *subshell_it );
+
+      for( size_t i = 0; i < soft_energy_losses.size(); ++i )
+        soft_energy_losses[i] += binding_energy*soft_fractions[i];
+
+      ThisType::addStoppingCrossSectionContribution(
+          *energy_grid,
+          raw_electroatom_data.getElectroionizationCrossSection( *subshell_it ),
+          raw_electroatom_data.getElectroionizationCrossSectionThresholdEnergyIndex( *subshell_it ),
+          raw_electroatom_data.getElectroionizationEnergyGrid( *subshell_it ),
+          soft_energy_losses,
+          0.0,
+          soft_stopping_cross_section );
+
+      ++subshell_it;
+    }
+  }
+
+  // Soft transport cross sections (moment preserving elastic)
+  if( soft_elastic )
+  {
+    std::vector<double> mp_cross_section;
+    size_t mp_threshold_index;
+
+    ElasticFactory::calculateMomentPreservingCrossSections<TwoDInterpPolicy,TwoDGridPolicy>(
+                                                   mp_cross_section,
+                                                   mp_threshold_index,
+                                                   raw_electroatom_data,
+                                                   energy_grid,
+                                                   evaluation_tol );
+
+    // Tabulate the transport moments of the discrete angles
+    const std::vector<double>& angular_energy_grid =
+      raw_electroatom_data.getElasticAngularEnergyGrid();
+
+    std::vector<double> first_moments( angular_energy_grid.size() );
+    std::vector<double> second_moments( angular_energy_grid.size() );
+
+    for( size_t j = 0; j < angular_energy_grid.size(); ++j )
+    {
+      const std::vector<double>& angles =
+        raw_electroatom_data.getMomentPreservingElasticDiscreteAngles(
+                                                    angular_energy_grid[j] );
+      const std::vector<double>& weights =
+        raw_electroatom_data.getMomentPreservingElasticWeights(
+                                                    angular_energy_grid[j] );
+
+      double norm = 0.0;
+      first_moments[j] = 0.0;
+      second_moments[j] = 0.0;
+
+      for( size_t k = 0; k < angles.size(); ++k )
+      {
+        norm += weights[k];
+        first_moments[j] += weights[k]*(1.0 - angles[k]);
+        second_moments[j] += weights[k]*1.5*(1.0 - angles[k]*angles[k]);
+      }
+
+      if( norm > 0.0 )
+      {
+        first_moments[j] /= norm;
+        second_moments[j] /= norm;
+      }
+    }
+
+    for( size_t i = 0; i < mp_cross_section.size(); ++i )
+    {
+      double energy = (*energy_grid)[mp_threshold_index+i];
+
+      double first_moment, second_moment;
+
+      if( energy <= angular_energy_grid.front() )
+      {
+        first_moment = first_moments.front();
+        second_moment = second_moments.front();
+      }
+      else if( energy >= angular_energy_grid.back() )
+      {
+        first_moment = first_moments.back();
+        second_moment = second_moments.back();
+      }
+      else
+      {
+        size_t lower_bin_index =
+          Utility::Search::binaryLowerBoundIndex( angular_energy_grid.begin(),
+                                                  angular_energy_grid.end(),
+                                                  energy );
+
+        first_moment = Utility::LinLin::interpolate(
+                                      angular_energy_grid[lower_bin_index],
+                                      angular_energy_grid[lower_bin_index+1],
+                                      energy,
+                                      first_moments[lower_bin_index],
+                                      first_moments[lower_bin_index+1] );
+
+        second_moment = Utility::LinLin::interpolate(
+                                      angular_energy_grid[lower_bin_index],
+                                      angular_energy_grid[lower_bin_index+1],
+                                      energy,
+                                      second_moments[lower_bin_index],
+                                      second_moments[lower_bin_index+1] );
+      }
+
+      first_transport_cross_section[mp_threshold_index+i] =
+        mp_cross_section[i]*first_moment;
+      second_transport_cross_section[mp_threshold_index+i] =
+        mp_cross_section[i]*second_moment;
+    }
+  }
+
+  // Create the soft scattering distribution
+  std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>
+    soft_scattering_distribution(
+      new CondensedHistoryElectronScatteringDistribution(
+                                            *energy_grid,
+                                            soft_stopping_cross_section,
+                                            first_transport_cross_section,
+                                            second_transport_cross_section,
+                                            max_energy_loss_fraction,
+                                            max_transport_mfps ) );
+
+  // Tabulate the step cross section above the first soft threshold
+  size_t threshold_energy_index = 0;
+
+  while( threshold_energy_index < grid_size &&
+         soft_scattering_distribution->evaluateStepCrossSection(
+                   (*energy_grid)[threshold_energy_index] ) <= 0.0 )
+    ++threshold_energy_index;
+
+  TEST_FOR_EXCEPTION( threshold_energy_index == grid_size,
+                      std::runtime_error,
+                      "the condensed history step cross section is zero "
+                      "over the entire energy grid!" );
+
+  std::shared_ptr<std::vector<double> >
+    step_cross_section( new std::vector<double> );
+  step_cross_section->reserve( grid_size - threshold_energy_index );
+
+  for( size_t i = threshold_energy_index; i < grid_size; ++i )
+  {
+    step_cross_section->push_back(
+      soft_scattering_distribution->evaluateStepCrossSection(
+                                                     (*energy_grid)[i] ) );
+  }
+
+  condensed_history_reaction.reset(
+    new CondensedHistoryElectroatomicReaction<Utility::LogLog>(
+                                                energy_grid,
+                                                step_cross_section,
+                                                threshold_energy_index,
+                                                grid_searcher,
+                                                soft_scattering_distribution ) );
+}
+
 // Create the subshell electroionization electroatomic reactions
 template< typename TwoDInterpPolicy,
           template<typename> class TwoDGridPolicy,
@@ -504,6 +794,244 @@ void ElectroatomicReactionNativeFactory::createBremsstrahlungReaction(
                         bremsstrahlung_distribution ) );
 }
 
+// Create the hard (condensed history) subshell electroionization reactions
+/*! \details Only the collisions that create a knock-on electron with an
+ * energy above the cutoff energy are simulated individually (the softer
+ * collisions are part of the condensed history reaction). The recoil energy
+ * distributions are truncated at the cutoff energy and the cross sections
+ * are reduced by the soft fractions of the distributions. The subshells
+ * that do not have at least two hard recoil energy distributions are
+ * skipped.
+ */
+template< typename TwoDInterpPolicy,
+          template<typename> class TwoDGridPolicy>
+void ElectroatomicReactionNativeFactory::createHardSubshellElectroionizationReactions(
+    const Data::ElectronPhotonRelaxationDataContainer& raw_electroatom_data,
+    const std::shared_ptr<const std::vector<double> >& energy_grid,
+    const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
+    std::vector<std::shared_ptr<const ElectroatomicReaction> >&
+    electroionization_subshell_reactions,
+    const ElectroionizationSamplingType sampling_type,
+    const double cutoff_energy,
+    const double evaluation_tol )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( raw_electroatom_data.getElectronEnergyGrid().size() ==
+                    energy_grid->size() );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid->begin(),
+                                                      energy_grid->end() ) );
+  // Make sure the cutoff energy is valid
+  testPrecondition( cutoff_energy > 0.0 );
+
+  electroionization_subshell_reactions.clear();
+
+  std::set<unsigned>::const_iterator subshell_it =
+    raw_electroatom_data.getSubshells().begin();
+
+  while( subshell_it != raw_electroatom_data.getSubshells().end() )
+  {
+    const std::vector<double>& subshell_energy_grid =
+      raw_electroatom_data.getElectroionizationEnergyGrid( *subshell_it );
+
+    // Remove the soft knock-on electrons from the recoil distributions
+    std::vector<double> hard_energy_grid;
+    std::map<double,std::vector<double> > hard_recoil_energies, hard_recoil_pdfs;
+
+    ThisType::truncateSecondaryEnergyDistributions(
+        subshell_energy_grid,
+        raw_electroatom_data.getElectroionizationRecoilEnergy( *subshell_it ),
+        raw_electroatom_data.getElectroionizationRecoilPDF( *subshell_it ),
+        cutoff_energy,
+        hard_energy_grid,
+        hard_recoil_energies,
+        hard_recoil_pdfs );
+
+    if( hard_energy_grid.size() < 2 )
+    {
+      ++subshell_it;
+
+      continue;
+    }
+
+    // Hard electroionization cross section
+    std::vector<double> soft_fractions, soft_first_moments;
+
+    ThisType::calculateSoftSecondaryEnergyMoments(
+        subshell_energy_grid,
+        raw_electroatom_data.getElectroionizationRecoilEnergy( *subshell_it ),
+        raw_electroatom_data.getElectroionizationRecoilPDF( *subshell_it ),
+        cutoff_energy,
+        soft_fractions,
+        soft_first_moments );
+
+    std::shared_ptr<std::vector<double> >
+      subshell_cross_section( new std::vector<double> );
+
+    size_t threshold_energy_index;
+
+    ThisType::calculateHardCrossSection(
+        *energy_grid,
+        raw_electroatom_data.getElectroionizationCrossSection( *subshell_it ),
+        raw_electroatom_data.getElectroionizationCrossSectionThresholdEnergyIndex( *subshell_it ),
+        subshell_energy_grid,
+        soft_fractions,
+        hard_energy_grid.front(),
+        *subshell_cross_section,
+        threshold_energy_index );
+
+    if( subshell_cross_section->empty() )
+    {
+      ++subshell_it;
+
+      continue;
+    }
+
+    // Create the hard electroionization subshell distribution
+    const double binding_energy =
+      raw_electroatom_data.getSubshellBindingEnergy( *subshell_it );
+
+    std::shared_ptr<const ElectroionizationSubshellElectronScatteringDistribution>
+      electroionization_subshell_distribution;
+
+    ElectroionizationFactory::createElectroionizationSubshellDistribution<TwoDInterpPolicy,TwoDGridPolicy>(
+        hard_recoil_energies,
+        hard_recoil_pdfs,
+        hard_energy_grid,
+        binding_energy,
+        electroionization_subshell_distribution,
+        sampling_type,
+        evaluation_tol );
+
+    electroionization_subshell_reactions.push_back(
+      std::make_shared<ElectroionizationSubshellElectroatomicReaction<Utility::LogLog> >(
+              energy_grid,
+              subshell_cross_section,
+              threshold_energy_index,
+              grid_searcher,
+              Data::convertENDFDesignatorToSubshellEnum( *subshell_it ),
+              electroionization_subshell_distribution ) );
+
+    ++subshell_it;
+  }
+}
+
+// Create the hard (condensed history) bremsstrahlung electroatomic reaction
+/*! \details Only the collisions that emit a photon with an energy above the
+ * cutoff energy are simulated individually (the softer collisions are part
+ * of the condensed history reaction). The photon energy distributions are
+ * truncated at the cutoff energy and the cross section is reduced by the
+ * soft fractions of the distributions.
+ */
+template< typename TwoDInterpPolicy,
+          template<typename> class TwoDGridPolicy>
+void ElectroatomicReactionNativeFactory::createHardBremsstrahlungReaction(
+    const Data::ElectronPhotonRelaxationDataContainer& raw_electroatom_data,
+    const std::shared_ptr<const std::vector<double> >& energy_grid,
+    const std::shared_ptr<const Utility::HashBasedGridSearcher<double>>& grid_searcher,
+    std::shared_ptr<const ElectroatomicReaction>& bremsstrahlung_reaction,
+    BremsstrahlungAngularDistributionType photon_distribution_function,
+    const double cutoff_energy,
+    const double evaluation_tol )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( raw_electroatom_data.getElectronEnergyGrid().size() ==
+                    energy_grid->size() );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid->begin(),
+                                                      energy_grid->end() ) );
+  // Make sure the cutoff energy is valid
+  testPrecondition( cutoff_energy > 0.0 );
+
+  const std::vector<double>& bremsstrahlung_energy_grid =
+    raw_electroatom_data.getBremsstrahlungEnergyGrid();
+
+  // Remove the soft photons from the photon energy distributions
+  std::vector<double> hard_energy_grid;
+  std::map<double,std::vector<double> > hard_photon_energies, hard_photon_pdfs;
+
+  ThisType::truncateSecondaryEnergyDistributions(
+                       bremsstrahlung_energy_grid,
+                       raw_electroatom_data.getBremsstrahlungPhotonEnergy(),
+                       raw_electroatom_data.getBremsstrahlungPhotonPDF(),
+                       cutoff_energy,
+                       hard_energy_grid,
+                       hard_photon_energies,
+                       hard_photon_pdfs );
+
+  TEST_FOR_EXCEPTION( hard_energy_grid.size() < 2,
+                      std::runtime_error,
+                      "the bremsstrahlung cutoff energy (" << cutoff_energy <<
+                      ") must be below the second highest bremsstrahlung "
+                      "incoming energy!" );
+
+  // Hard bremsstrahlung cross section
+  std::vector<double> soft_fractions, soft_first_moments;
+
+  ThisType::calculateSoftSecondaryEnergyMoments(
+                       bremsstrahlung_energy_grid,
+                       raw_electroatom_data.getBremsstrahlungPhotonEnergy(),
+                       raw_electroatom_data.getBremsstrahlungPhotonPDF(),
+                       cutoff_energy,
+                       soft_fractions,
+                       soft_first_moments );
+
+  std::shared_ptr<std::vector<double> >
+    bremsstrahlung_cross_section( new std::vector<double> );
+
+  size_t threshold_energy_index;
+
+  ThisType::calculateHardCrossSection(
+          *energy_grid,
+          raw_electroatom_data.getBremsstrahlungCrossSection(),
+          raw_electroatom_data.getBremsstrahlungCrossSectionThresholdEnergyIndex(),
+          bremsstrahlung_energy_grid,
+          soft_fractions,
+          hard_energy_grid.front(),
+          *bremsstrahlung_cross_section,
+          threshold_energy_index );
+
+  // Create the hard bremsstrahlung scattering distribution
+  std::shared_ptr<const BremsstrahlungElectronScatteringDistribution>
+    bremsstrahlung_distribution;
+
+  if( photon_distribution_function == TWOBS_DISTRIBUTION )
+  {
+    BremsstrahlungFactory::createBremsstrahlungDistribution<TwoDInterpPolicy,TwoDGridPolicy>(
+      hard_photon_energies,
+      hard_photon_pdfs,
+      hard_energy_grid,
+      raw_electroatom_data.getAtomicNumber(),
+      bremsstrahlung_distribution,
+      evaluation_tol,
+      500,
+      cutoff_energy );
+  }
+  else if( photon_distribution_function == TABULAR_DISTRIBUTION )
+  {
+    THROW_EXCEPTION( std::logic_error,
+          "The detailed bremsstrahlung reaction has not been implemented");
+  }
+  else
+  {
+    BremsstrahlungFactory::createBremsstrahlungDistribution<TwoDInterpPolicy,TwoDGridPolicy>(
+      hard_photon_energies,
+      hard_photon_pdfs,
+      hard_energy_grid,
+      bremsstrahlung_distribution,
+      evaluation_tol,
+      500,
+      cutoff_energy );
+  }
+
+  // Create the hard bremsstrahlung reaction
+  bremsstrahlung_reaction.reset(
+        new BremsstrahlungElectroatomicReaction<Utility::LogLog>(
+                        energy_grid,
+                        bremsstrahlung_cross_section,
+                        threshold_energy_index,
+                        grid_searcher,
+                        bremsstrahlung_distribution ) );
+}
+
 } // end MontCarlo namespace
 
 #endif // end MONTE_CARLO_ELECTROATOMIC_REACTION_NATIVE_FACTORY_DEF_HPP
@@ -179,6 +179,10 @@ std::string ToStringTraits<MonteCarlo::ElectroatomicReactionType>::toString( con
     return "Q2 Subshell Electro-ionization Electro-atomic Reaction";
   case MonteCarlo::Q3_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION:
     return "Q3 Subshell Electro-ionization Electro-atomic Reaction";
+  case MonteCarlo::CONDENSED_HISTORY_ELECTROATOMIC_REACTION:
+    return "Condensed History Electro-atomic Reaction";
+  case MonteCarlo::STOPPING_POWER_ELECTROATOMIC_REACTION:
+    return "Stopping Power Electro-atomic Reaction";
   default:
     THROW_EXCEPTION( std::logic_error,
                      "Cannot convert the Electro-atomic reaction type "
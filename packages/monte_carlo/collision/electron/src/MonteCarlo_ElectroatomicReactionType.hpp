@@ -77,7 +77,9 @@ enum ElectroatomicReactionType{
   P11_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION = 48,
   Q1_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION = 49,
   Q2_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION = 50,
-  Q3_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION = 51
+  Q3_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION = 51,
+  CONDENSED_HISTORY_ELECTROATOMIC_REACTION = 52,
+  STOPPING_POWER_ELECTROATOMIC_REACTION = 53
 };
 
 //! Convert a Data::SubshellType enum to a ElectroatomicReactionType enum
@@ -199,6 +201,8 @@ void serialize( Archive& archive,
       BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::Q1_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION, int, type );
       BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::Q2_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION, int, type );
       BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::Q3_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION, int, type );
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::CONDENSED_HISTORY_ELECTROATOMIC_REACTION, int, type );
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::STOPPING_POWER_ELECTROATOMIC_REACTION, int, type );
       default:
       {
         THROW_EXCEPTION( std::logic_error,
@@ -8,6 +8,8 @@
 
 // Std Lib Includes
 #include <stdexcept>
+#include <cmath>
+#include <limits>
 
 // FRENSIE Includes
 #include "MonteCarlo_ElectronMaterial.hpp"
@@ -19,6 +21,9 @@
 
 namespace MonteCarlo{
 
+// Initialize static member data
+const unsigned ElectronMaterial::s_range_panels_per_decade = 20u;
+
 // Constructor
 ElectronMaterial::ElectronMaterial(
                             const MaterialId id,
@@ -33,6 +38,77 @@ ElectronMaterial::ElectronMaterial(
               electroatom_names )
 { /* ... */ }
 
+// Return the macroscopic total stopping power (MeV/cm)
+/*! \details The stopping power is only available when the electroatoms
+ * were created from native data (the stopping power reaction is a
+ * miscellaneous reaction of the native electroatoms). Zero will be returned
+ * otherwise.
+ */
+double ElectronMaterial::getMacroscopicStoppingPower( const double energy ) const
+{
+  return this->getMacroscopicReactionCrossSection(
+                                       energy,
+                                       STOPPING_POWER_ELECTROATOMIC_REACTION );
+}
+
+// Return the continuous slowing down approximation range (cm)
+/*! \details The range is the path length that is required for an electron
+ * to slow down from the energy to the cutoff energy if it continuously loses
+ * energy at the rate given by the total stopping power: the integral of
+ * 1/S(E') from the cutoff energy to the energy. The integral is evaluated
+ * with the trapezoid rule in ln(E') (the integrand E'/S(E') is smooth in
+ * ln(E')). If the stopping power vanishes anywhere in the integration range
+ * (e.g. the stopping power data is not available) the range is infinite.
+ */
+double ElectronMaterial::getCSDARange( const double energy,
+                                       const double cutoff_energy ) const
+{
+  // Make sure the energies are valid
+  testPrecondition( energy > 0.0 );
+  testPrecondition( cutoff_energy > 0.0 );
+
+  if( energy <= cutoff_energy )
+    return 0.0;
+
+  const double log_energy_ratio = std::log( energy/cutoff_energy );
+
+  unsigned number_of_panels =
+    (unsigned)std::ceil( s_range_panels_per_decade*
+                         log_energy_ratio/std::log( 10.0 ) );
+
+  if( number_of_panels == 0u )
+    number_of_panels = 1u;
+
+  const double log_step = log_energy_ratio/number_of_panels;
+
+  double range = 0.0;
+  double previous_integrand = 0.0;
+
+  for( unsigned i = 0u; i <= number_of_panels; ++i )
+  {
+    double panel_energy;
+
+    if( i == number_of_panels )
+      panel_energy = energy;
+    else
+      panel_energy = cutoff_energy*std::exp( i*log_step );
+
+    double stopping_power = this->getMacroscopicStoppingPower( panel_energy );
+
+    if( stopping_power <= 0.0 )
+      return std::numeric_limits<double>::infinity();
+
+    double integrand = panel_energy/stopping_power;
+
+    if( i > 0u )
+      range += 0.5*log_step*(integrand + previous_integrand);
+
+    previous_integrand = integrand;
+  }
+
+  return range;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
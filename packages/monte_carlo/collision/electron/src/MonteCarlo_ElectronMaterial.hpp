@@ -61,6 +61,18 @@ public:
   //! Destructor
   ~ElectronMaterial()
   { /* ... */ }
+
+  //! Return the macroscopic total stopping power (MeV/cm)
+  double getMacroscopicStoppingPower( const double energy ) const;
+
+  //! Return the continuous slowing down approximation range (cm)
+  double getCSDARange( const double energy,
+                       const double cutoff_energy ) const;
+
+private:
+
+  // The number of range integration panels per energy decade
+  static const unsigned s_range_panels_per_decade;
 };
 
 } // end MonteCarlo namespace
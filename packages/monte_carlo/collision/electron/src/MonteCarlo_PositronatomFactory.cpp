@@ -10,9 +10,11 @@
 #include "MonteCarlo_PositronatomFactory.hpp"
 #include "MonteCarlo_PositronatomACEFactory.hpp"
 #include "MonteCarlo_PositronatomNativeFactory.hpp"
+#include "MonteCarlo_ScatteringCenterFactoryHelpers.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSEPRDataExtractor.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Data_DataContainerHelpers.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
@@ -37,7 +39,14 @@ PositronatomFactory::PositronatomFactory(
   FRENSIE_LOG_NOTIFICATION( "Starting to load positronatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
-  // Create each positron-atom in the set
+  // The positronatoms that use each data table
+  std::vector<std::pair<std::string,PositronatomNameMap::mapped_type*> >
+    positronatom_tables;
+
+  // The loaders for each data table (every table is only loaded once)
+  std::vector<ScatteringCenterDataTableLoader> table_loaders;
+
+  // Find the data table used by each positronatom in the set
   ScatteringCenterNameSet::const_iterator positronatom_name =
     positronatom_names.begin();
 
@@ -60,35 +69,20 @@ PositronatomFactory::PositronatomFactory(
 
     double atomic_weight;
 
-    const Data::ElectroatomicDataProperties& electroatom_data_properties =
+    const Data::ElectroatomicDataProperties& positronatom_data_properties =
       positronatom_definition.getElectroatomicDataProperties( &atomic_weight );
 
-    if( electroatom_data_properties.fileType() ==
+    std::string table_key;
+
+    if( positronatom_data_properties.fileType() ==
         Data::ElectroatomicDataProperties::ACE_EPR_FILE )
     {
-      // Initialize the positronatomic table name map for ACE_EPR files
-      if( d_positronatomic_table_name_map.find( Data::ElectroatomicDataProperties::ACE_EPR_FILE ) ==
-          d_positronatomic_table_name_map.end() )
-      {
-        d_positronatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE];
-      }
-
-      this->createPositronatomFromACETable( data_directory,
-                                            *positronatom_name,
-                                            atomic_weight,
-                                            electroatom_data_properties,
-                                            atomic_relaxation_model_factory,
-                                            properties );
+      table_key = positronatom_data_properties.tableName();
     }
-    else if( electroatom_data_properties.fileType() ==
+    else if( positronatom_data_properties.fileType() ==
              Data::ElectroatomicDataProperties::Native_EPR_FILE )
     {
-      this->createPositronatomFromNativeTable( data_directory,
-                                               *positronatom_name,
-                                               atomic_weight,
-                                               electroatom_data_properties,
-                                               atomic_relaxation_model_factory,
-                                               properties );
+      table_key = positronatom_data_properties.filePath().string();
     }
     else
     {
@@ -96,17 +90,68 @@ PositronatomFactory::PositronatomFactory(
                        "Positronatom " << *positronatom_name << " cannot be "
                        "created because its definition specifies the use of "
                        "a positronatomic data file of type "
-                       << electroatom_data_properties.fileType() <<
+                       << positronatom_data_properties.fileType() <<
                        ", which is currently unsupported!" );
     }
 
+    PositronatomNameMap& table_name_map =
+      d_positronatomic_table_name_map[positronatom_data_properties.fileType()];
+
+    // Check if the table has already been scheduled for loading
+    if( table_name_map.find( table_key ) == table_name_map.end() )
+    {
+      const Data::ElectroatomicDataProperties* data_properties =
+        &positronatom_data_properties;
+
+      PositronatomNameMap::mapped_type* positronatom = &table_name_map[table_key];
+
+      if( data_properties->fileType() ==
+          Data::ElectroatomicDataProperties::ACE_EPR_FILE )
+      {
+        table_loaders.push_back(
+          [this,&data_directory,&atomic_relaxation_model_factory,&properties,atomic_weight,data_properties,positronatom](){
+            this->createPositronatomFromACETable( data_directory,
+                                                  atomic_weight,
+                                                  *data_properties,
+                                                  atomic_relaxation_model_factory,
+                                                  properties,
+                                                  *positronatom ); } );
+      }
+      else
+      {
+        table_loaders.push_back(
+          [this,&data_directory,&atomic_relaxation_model_factory,&properties,atomic_weight,data_properties,positronatom](){
+            this->createPositronatomFromNativeTable(
+                                               data_directory,
+                                               atomic_weight,
+                                               *data_properties,
+                                               atomic_relaxation_model_factory,
+                                               properties,
+                                               *positronatom ); } );
+      }
+    }
+
+    positronatom_tables.push_back( std::make_pair( *positronatom_name,
+                                                   &table_name_map[table_key] ) );
+
     ++positronatom_name;
   }
 
+  // Load the data tables
+  loadScatteringCenterDataTables( table_loaders );
+
+  // Assign the loaded data tables to the positronatoms
+  for( size_t i = 0; i < positronatom_tables.size(); ++i )
+  {
+    d_positronatom_name_map[positronatom_tables[i].first] =
+      *positronatom_tables[i].second;
+  }
+
   // Make sure that every positron-atom has been created
   testPostcondition( d_positronatom_name_map.size() == positronatom_names.size() );
 
-  FRENSIE_LOG_NOTIFICATION( "Finished loading positronatom data tables." );
+  FRENSIE_LOG_NOTIFICATION( "Finished loading positronatom data tables ("
+                            << table_loaders.size() << " tables)." );
   FRENSIE_FLUSH_ALL_LOGS();
 }
 
@@ -118,156 +163,108 @@ void PositronatomFactory::createPositronatomMap(
 }
 
 // Create a positron-atom from an ACE table
+/*! \details This method can be called concurrently for different tables.
+ */
 void PositronatomFactory::createPositronatomFromACETable(
-                      const boost::filesystem::path& data_directory,
-                      const std::string& positronatom_name,
-                      const double atomic_weight,
-		      const Data::ElectroatomicDataProperties& data_properties,
-                      const std::shared_ptr<AtomicRelaxationModelFactory>&
-                      atomic_relaxation_model_factory,
-                      const SimulationProperties& properties )
+			const boost::filesystem::path& data_directory,
+                        const double atomic_weight,
+			const Data::ElectroatomicDataProperties& data_properties,
+                        const std::shared_ptr<AtomicRelaxationModelFactory>&
+                        atomic_relaxation_model_factory,
+                        const SimulationProperties& properties,
+                        PositronatomNameMap::mapped_type& positronatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_positronatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE].find( data_properties.tableName() ) ==
-      d_positronatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE].end() )
-  {
-    // Construct the the path to the data file
-    boost::filesystem::path ace_file_path = data_directory;
-    ace_file_path /= data_properties.filePath();
-    ace_file_path.make_preferred();
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                 "Loading ACE EPR positronatomic cross section "
-                                 "table " << data_properties.tableName() <<
-                                 " from " << ace_file_path.string() <<
-                                 " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-
-    // Create the ACEFileHandler
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-                                           data_properties.tableName(),
-                                           data_properties.fileStartLine(),
-                                           true );
-
-    // Create the XSS data extractor
-    Data::XSSEPRDataExtractor xss_data_extractor(
+  // Construct the the path to the data file
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  // Create the ACEFileHandler
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         data_properties.tableName(),
+                                         data_properties.fileStartLine(),
+                                         true );
+
+  // Create the XSS data extractor
+  Data::XSSEPRDataExtractor xss_data_extractor(
                                          ace_file_handler.getTableNXSArray(),
                                          ace_file_handler.getTableJXSArray(),
                                          ace_file_handler.getTableXSSArray() );
 
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
-
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
-                             xss_data_extractor,
-                             atomic_relaxation_model,
-                             properties.getMinPhotonEnergy(),
-                             properties.getMinElectronEnergy(),
-                             properties.isAtomicRelaxationModeOn( ELECTRON ) );
-
-    // Initialize the new positron-atom
-    PositronatomNameMap::mapped_type& positronatom =
-      d_positronatom_name_map[positronatom_name];
-
-    // Create the new positron-atom
-    PositronatomACEFactory::createPositronatom( xss_data_extractor,
-                                                data_properties.tableName(),
-                                                atomic_weight,
-                                                atomic_relaxation_model,
-                                                properties,
-                                                positronatom );
-
-    // Cache the new positron-atom in the table name map
-    d_positronatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()] = positronatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
+  // Create the atomic relaxation model
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+
+  atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+                               xss_data_extractor,
+                               atomic_relaxation_model,
+                               properties.getMinPhotonEnergy(),
+                               properties.getMinElectronEnergy(),
+                               properties.isAtomicRelaxationModeOn( ELECTRON ) );
+
+  // Create the new positron-atom
+  PositronatomACEFactory::createPositronatom( xss_data_extractor,
+                                              data_properties.tableName(),
+                                              atomic_weight,
+                                              atomic_relaxation_model,
+                                              properties,
+                                              positronatom );
+
+  if( d_verbose )
   {
-    d_positronatom_name_map[positronatom_name] =
-      d_positronatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()];
+    FRENSIE_LOG_NOTIFICATION( " Loaded ACE EPR positronatomic cross section "
+                              "table " << data_properties.tableName() <<
+                              " from " << ace_file_path.string() << "." );
   }
 }
 
-
 // Create a positron-atom from a Native table
+/*! \details This method can be called concurrently for different tables.
+ */
 void PositronatomFactory::createPositronatomFromNativeTable(
-                      const boost::filesystem::path& data_directory,
-                      const std::string& positronatom_name,
-                      const double atomic_weight,
-                      const Data::ElectroatomicDataProperties& data_properties,
-                      const std::shared_ptr<AtomicRelaxationModelFactory>&
-                      atomic_relaxation_model_factory,
-                      const SimulationProperties& properties  )
+			const boost::filesystem::path& data_directory,
+                        const double atomic_weight,
+                        const Data::ElectroatomicDataProperties& data_properties,
+                        const std::shared_ptr<AtomicRelaxationModelFactory>&
+                        atomic_relaxation_model_factory,
+                        const SimulationProperties& properties,
+                        PositronatomNameMap::mapped_type& positronatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_positronatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE].find( data_properties.filePath().string() ) ==
-      d_positronatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE].end() )
-  {
-    // Construct the path to the native file
-    boost::filesystem::path native_file_path = data_directory;
-    native_file_path /= data_properties.filePath();
-    native_file_path.make_preferred();
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                "Loading native EPR cross section table "
-                                "(v " << data_properties.fileVersion() <<
-                                ") for " << data_properties.atom() <<
-                                " from " << native_file_path.string() <<
-                                " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-
-    // Create the epr data container
-    Data::ElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
-
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
-
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
-                             data_container,
-                             atomic_relaxation_model,
-                             properties.getMinPhotonEnergy(),
-                             properties.getMinElectronEnergy(),
-                             properties.isAtomicRelaxationModeOn( ELECTRON ) );
-
-    // Initialize the new positron-atom
-    PositronatomNameMap::mapped_type& positronatom =
-      d_positronatom_name_map[positronatom_name];
-
-    // Create the new positron-atom
-    PositronatomNativeFactory::createPositronatom( data_container,
-                                                   data_properties.filePath().string(),
-                                                   atomic_weight,
-                                                   atomic_relaxation_model,
-                                                   properties,
-                                                   positronatom );
-
-    // Cache the new positron-atom in the table name map
-    d_positronatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()] = positronatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
+  // Construct the path to the native file
+  boost::filesystem::path native_file_path = data_directory;
+  native_file_path /= data_properties.filePath();
+  native_file_path.make_preferred();
+
+  // Use the flat array archive export of the table if there is one
+  native_file_path = Data::resolveFlatArrayArchivePath( native_file_path );
+
+  // Create the epr data container
+  Data::ElectronPhotonRelaxationDataContainer
+    data_container( native_file_path );
+
+  // Create the atomic relaxation model
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+
+  atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+                               data_container,
+                               atomic_relaxation_model,
+                               properties.getMinPhotonEnergy(),
+                               properties.getMinElectronEnergy(),
+                               properties.isAtomicRelaxationModeOn( ELECTRON ) );
+
+  // Create the new positron-atom
+  PositronatomNativeFactory::createPositronatom( data_container,
+                                                 data_properties.filePath().string(),
+                                                 atomic_weight,
+                                                 atomic_relaxation_model,
+                                                 properties,
+                                                 positronatom );
+
+  if( d_verbose )
   {
-    d_positronatom_name_map[positronatom_name] =
-      d_positronatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()];
+    FRENSIE_LOG_NOTIFICATION( " Loaded native EPR cross section table "
+                              "(v " << data_properties.fileVersion() <<
+                              ") for " << data_properties.atom() <<
+                              " from " << native_file_path.string() << "." );
   }
 }
 
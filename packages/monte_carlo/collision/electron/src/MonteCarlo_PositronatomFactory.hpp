@@ -57,23 +57,23 @@ private:
 
   // Create a positron-atom from an ACE table
   void createPositronatomFromACETable(
-                      const boost::filesystem::path& data_directory,
-                      const std::string& positronatom_name,
-                      const double atomic_weight,
-		      const Data::ElectroatomicDataProperties& data_properties,
-                      const std::shared_ptr<AtomicRelaxationModelFactory>&
-                      atomic_relaxation_model_factory,
-                      const SimulationProperties& properties );
+                        const boost::filesystem::path& data_directory,
+                        const double atomic_weight,
+                        const Data::ElectroatomicDataProperties& data_properties,
+                        const std::shared_ptr<AtomicRelaxationModelFactory>&
+                        atomic_relaxation_model_factory,
+                        const SimulationProperties& properties,
+                        PositronatomNameMap::mapped_type& positronatom ) const;
 
   // Create a positron-atom from a Native table
   void createPositronatomFromNativeTable(
-                      const boost::filesystem::path& data_directory,
-                      const std::string& positronatom_name,
-                      const double atomic_weight,
-                      const Data::ElectroatomicDataProperties& data_properties,
-                      const std::shared_ptr<AtomicRelaxationModelFactory>&
-                      atomic_relaxation_model_factory,
-                      const SimulationProperties& properties );
+                        const boost::filesystem::path& data_directory,
+                        const double atomic_weight,
+                        const Data::ElectroatomicDataProperties& data_properties,
+                        const std::shared_ptr<AtomicRelaxationModelFactory>&
+                        atomic_relaxation_model_factory,
+                        const SimulationProperties& properties,
+                        PositronatomNameMap::mapped_type& positronatom ) const;
 
   // The positron-atom map
   PositronatomNameMap d_positronatom_name_map;
@@ -17,6 +17,7 @@
 #include "Data_XSSEPRDataExtractor.hpp"
 #include "Utility_HistogramDistribution.hpp"
 #include "Utility_TabularDistribution.hpp"
+#include "Utility_PackedTabularBasicBivariateDistribution.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
@@ -25,7 +26,7 @@
 //---------------------------------------------------------------------------//
 
 std::shared_ptr<MonteCarlo::BremsstrahlungElectronScatteringDistribution>
-  native_brem_dist;
+  native_brem_dist, packed_native_brem_dist;
 
 //---------------------------------------------------------------------------//
 // Tests.
@@ -73,6 +74,61 @@ FRENSIE_UNIT_TEST( BremsstrahlungElectronScatteringDistribution,
   FRENSIE_CHECK_FLOATING_EQUALITY( cdf, 9.5771054298946046e-01, 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the packed distribution samples match the distribution samples
+FRENSIE_UNIT_TEST( BremsstrahlungElectronScatteringDistribution,
+                   sampleWithRandomNumber_packed_native )
+{
+  for( double incoming_energy : {9.0e-4, 0.02, 1.0, 1.0e5} )
+  {
+    for( double random_number : {0.0, 0.25, 0.5, 0.75, 1.0-1e-15} )
+    {
+      FRENSIE_CHECK_FLOATING_EQUALITY(
+         packed_native_brem_dist->sampleWithRandomNumber( incoming_energy,
+                                                          random_number ),
+         native_brem_dist->sampleWithRandomNumber( incoming_energy,
+                                                   random_number ),
+         1e-15 );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the packed distribution samples match the distribution samples
+FRENSIE_UNIT_TEST( BremsstrahlungElectronScatteringDistribution,
+                   sample_packed_native )
+{
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.5; // Correlated sample the photon energy
+  fake_stream[1] = 0.5; // Sample the dipole angle
+
+  for( double incoming_energy : {9.0e-4, 0.02, 1.0, 1.0e5} )
+  {
+    double photon_energy, photon_angle_cosine;
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    native_brem_dist->sample( incoming_energy,
+                              photon_energy,
+                              photon_angle_cosine );
+
+    double packed_photon_energy, packed_photon_angle_cosine;
+
+    packed_native_brem_dist->sample( incoming_energy,
+                                     packed_photon_energy,
+                                     packed_photon_angle_cosine );
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+
+    FRENSIE_CHECK_FLOATING_EQUALITY( packed_photon_energy,
+                                     photon_energy,
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( packed_photon_angle_cosine,
+                                     photon_angle_cosine,
+                                     1e-15 );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
@@ -102,6 +158,8 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
   std::vector<double> primary_grid( energy_grid.size() );
   std::vector<std::shared_ptr<const Utility::TabularUnivariateDistribution> >
     secondary_dists( energy_grid.size() );
+  std::vector<std::vector<double> > photon_energies( energy_grid.size() ),
+    photon_pdfs( energy_grid.size() );
 
   for( unsigned n = 0; n < energy_grid.size(); ++n )
   {
@@ -118,6 +176,9 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
     secondary_dists[n].reset(
         new const Utility::TabularDistribution<Utility::LinLin>( photon_energy,
                                                                  pdf ) );
+
+    photon_energies[n] = photon_energy;
+    photon_pdfs[n] = pdf;
   }
 
   double eval_tol = 1e-12;
@@ -134,6 +195,19 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
         new MonteCarlo::BremsstrahlungElectronScatteringDistribution(
               energy_loss_function ) );
 
+  // Create the packed scattering function
+  std::shared_ptr<const Utility::PackedTabularBasicBivariateDistributionBase>
+    packed_energy_loss_function(
+       new Utility::PackedTabularBasicBivariateDistribution<Utility::UnitBaseCorrelated<Utility::LogLogLog> >(
+                                                            primary_grid,
+                                                            photon_energies,
+                                                            photon_pdfs ) );
+
+  packed_native_brem_dist.reset(
+        new MonteCarlo::BremsstrahlungElectronScatteringDistribution(
+              energy_loss_function,
+              packed_energy_loss_function ) );
+
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
 }
@@ -0,0 +1,276 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCondensedHistoryElectronScatteringDistribution.cpp
+//! \author Alex Robinson
+//! \brief  Condensed history electron scattering distribution unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables.
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<MonteCarlo::CondensedHistoryElectronScatteringDistribution>
+  distribution;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the step limits can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   getStepLimits )
+{
+  FRENSIE_CHECK_EQUAL( distribution->getMaxEnergyLossFraction(), 0.05 );
+  FRENSIE_CHECK_EQUAL( distribution->getMaxTransportMeanFreePaths(), 0.2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the step cross section can be evaluated
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   evaluateStepCrossSection )
+{
+  FRENSIE_CHECK_EQUAL( distribution->evaluateStepCrossSection( 1e-4 ), 0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          distribution->evaluateStepCrossSection( 1e-2 ),
+                          4.5e6,
+                          1e-12 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          distribution->evaluateStepCrossSection( 5e-2 ),
+                          9.222222222222222e5,
+                          1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the energy loss per step can be evaluated
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   evaluateEnergyLoss )
+{
+  FRENSIE_CHECK_EQUAL( distribution->evaluateEnergyLoss( 1e-4 ), 0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distribution->evaluateEnergyLoss( 1e-2 ),
+                                   4.4444444444444447e-04,
+                                   1e-12 );
+
+  // The energy loss can never exceed the max fractional energy loss
+  FRENSIE_CHECK( distribution->evaluateEnergyLoss( 5e-2 ) <= 0.05*5e-2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the Legendre moments per step can be evaluated
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   evaluateLegendreMoments )
+{
+  double first_moment, second_moment;
+
+  distribution->evaluateLegendreMoments( 1e-4, first_moment, second_moment );
+
+  FRENSIE_CHECK_EQUAL( first_moment, 1.0 );
+  FRENSIE_CHECK_EQUAL( second_moment, 1.0 );
+
+  distribution->evaluateLegendreMoments( 1e-2, first_moment, second_moment );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( first_moment,
+                                   9.780228724846005e-01,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( second_moment,
+                                   9.375882010485728e-01,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the PDF can be evaluated
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   evaluatePDF )
+{
+  FRENSIE_CHECK_FLOATING_EQUALITY( distribution->evaluatePDF( 1e-2, 0.99 ),
+                                   2.4156152137067973e+01,
+                                   1e-12 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distribution->evaluatePDF( 1e-2, 0.9 ),
+                                   6.665223860930039e-04,
+                                   1e-12 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distribution->evaluate( 1e-2, 0.9 ),
+                                   6.665223860930039e-04,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the CDF can be evaluated
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   evaluateCDF )
+{
+  FRENSIE_CHECK_SMALL( distribution->evaluateCDF( 1e-2, -1.0 ), 1e-15 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distribution->evaluateCDF( 1e-2, 0.9 ),
+                                   1.2663925335767434e-03,
+                                   1e-10 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          distribution->evaluateCDF( 1e-2, 1.0 - 2.067163896346627e-02 ),
+                          5.006527442759666e-01,
+                          1e-10 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distribution->evaluateCDF( 1e-2, 1.0 ),
+                                   1.0,
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distribution can be sampled
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   sample )
+{
+  std::vector<double> fake_stream( 4 );
+  fake_stream[0] = 0.0; // sample below the reduced angle cutoff
+  fake_stream[1] = 0.5;
+  fake_stream[2] = 1.0-1e-15; // sample above the reduced angle cutoff
+  fake_stream[3] = 0.5;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double outgoing_energy, scattering_angle_cosine;
+
+  distribution->sample( 1e-2, outgoing_energy, scattering_angle_cosine );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( outgoing_energy,
+                                   1e-2 - 4.4444444444444447e-04,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine,
+                                   9.793283610365338e-01,
+                                   1e-12 );
+
+  distribution->sample( 1e-2, outgoing_energy, scattering_angle_cosine );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( outgoing_energy,
+                                   1e-2 - 4.4444444444444447e-04,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine,
+                                   -2.0671638963466243e-02,
+                                   1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distribution can be sampled and the trials recorded
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   sampleAndRecordTrials )
+{
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.5;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double outgoing_energy, scattering_angle_cosine;
+  MonteCarlo::CondensedHistoryElectronScatteringDistribution::Counter
+    trials = 10;
+
+  distribution->sampleAndRecordTrials( 1e-2,
+                                       outgoing_energy,
+                                       scattering_angle_cosine,
+                                       trials );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( outgoing_energy,
+                                   1e-2 - 4.4444444444444447e-04,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine,
+                                   9.793283610365338e-01,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( trials, 11 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that an electron can be scattered
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   scatterElectron )
+{
+  MonteCarlo::ParticleBank bank;
+
+  MonteCarlo::ElectronState electron( 0 );
+  electron.setEnergy( 1e-2 );
+  electron.setDirection( 0.0, 0.0, 1.0 );
+
+  Data::SubshellType shell_of_interaction;
+
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.5;
+  fake_stream[2] = 0.0; // azimuthal angle
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  distribution->scatterElectron( electron, bank, shell_of_interaction );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( electron.getEnergy(),
+                                   1e-2 - 4.4444444444444447e-04,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( electron.getZDirection(),
+                                   9.793283610365338e-01,
+                                   1e-12 );
+  FRENSIE_CHECK( bank.isEmpty() );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  std::vector<double> energy_grid( 4 ), soft_stopping_cross_section( 4 ),
+    first_transport_cross_section( 4 ), second_transport_cross_section( 4 );
+
+  energy_grid[0] = 1e-3;
+  energy_grid[1] = 1e-2;
+  energy_grid[2] = 1e-1;
+  energy_grid[3] = 1.0;
+
+  soft_stopping_cross_section[0] = 1e3;
+  soft_stopping_cross_section[1] = 2e3;
+  soft_stopping_cross_section[2] = 1e3;
+  soft_stopping_cross_section[3] = 5e2;
+
+  first_transport_cross_section[0] = 1e6;
+  first_transport_cross_section[1] = 1e5;
+  first_transport_cross_section[2] = 1e4;
+  first_transport_cross_section[3] = 1e3;
+
+  second_transport_cross_section[0] = 2.9e6;
+  second_transport_cross_section[1] = 2.9e5;
+  second_transport_cross_section[2] = 2.9e4;
+  second_transport_cross_section[3] = 2.9e3;
+
+  distribution.reset(
+    new MonteCarlo::CondensedHistoryElectronScatteringDistribution(
+                                            energy_grid,
+                                            soft_stopping_cross_section,
+                                            first_transport_cross_section,
+                                            second_transport_cross_section,
+                                            0.05,
+                                            0.2 ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstCondensedHistoryElectronScatteringDistribution.cpp
+//---------------------------------------------------------------------------//
@@ -197,6 +197,19 @@ MonteCarlo::ElectroatomicReactionType reaction;
 
   cross_section = atom->getReactionCrossSection( 1.0e5, reaction );
   FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 1.82234e5, 1e-12 );
+
+
+  // Test that the stopping power is a miscellaneous reaction
+  MonteCarlo::Electroatom::ReactionEnumTypeSet reaction_types;
+
+  atom->getMiscReactionTypes( reaction_types );
+
+  FRENSIE_CHECK_EQUAL( reaction_types.size(), 1 );
+  FRENSIE_CHECK( reaction_types.count( MonteCarlo::STOPPING_POWER_ELECTROATOMIC_REACTION ) );
+
+  reaction = MonteCarlo::STOPPING_POWER_ELECTROATOMIC_REACTION;
+  cross_section = atom->getReactionCrossSection( 1.0e-3, reaction );
+  FRENSIE_CHECK_GREATER( cross_section, 0.0 );
 }
 
 //---------------------------------------------------------------------------//
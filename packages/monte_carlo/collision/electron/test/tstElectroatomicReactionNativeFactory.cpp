@@ -14,6 +14,7 @@
 #include "MonteCarlo_BremsstrahlungAngularDistributionType.hpp"
 #include "MonteCarlo_ElasticElectronDistributionType.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -434,6 +435,313 @@ FRENSIE_UNIT_TEST( ElectroatomicReactionNativeFactory,
   reaction.reset();
 }
 
+//---------------------------------------------------------------------------//
+// Check that a condensed history reaction can be created
+FRENSIE_UNIT_TEST( ElectroatomicReactionNativeFactory,
+                   createCondensedHistoryReaction )
+{
+  std::shared_ptr<const MonteCarlo::ElectroatomicReaction>
+    excitation_reaction;
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createAtomicExcitationReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               excitation_reaction );
+
+  // Only soft atomic excitation: the step length is set by the energy loss
+  MonteCarlo::ElectroatomicReactionNativeFactory::createCondensedHistoryReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               reaction,
+                               true,
+                               false,
+                               0.05,
+                               0.2,
+                               eval_tol );
+
+  // Test reaction properties
+  FRENSIE_CHECK_EQUAL( reaction->getReactionType(),
+                       MonteCarlo::CONDENSED_HISTORY_ELECTROATOMIC_REACTION );
+  FRENSIE_CHECK_EQUAL( reaction->getThresholdEnergy(),
+                       excitation_reaction->getThresholdEnergy() );
+  FRENSIE_CHECK_EQUAL( reaction->getNumberOfEmittedElectrons( 1e-3 ), 1u );
+
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.5;
+  fake_stream[1] = 0.5;
+  fake_stream[2] = 0.0;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::ParticleBank bank;
+  Data::SubshellType shell_of_interaction;
+
+  MonteCarlo::ElectronState electron( 0 );
+  electron.setEnergy( 1e-3 );
+  electron.setDirection( 0.0, 0.0, 1.0 );
+
+  reaction->react( electron, bank, shell_of_interaction );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // The full fractional energy loss is deposited and there is no deflection
+  FRENSIE_CHECK_FLOATING_EQUALITY( electron.getEnergy(), 0.95e-3, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( electron.getZDirection(), 1.0, 1e-12 );
+  FRENSIE_CHECK_EQUAL( shell_of_interaction, Data::UNKNOWN_SUBSHELL );
+
+  // Soft atomic excitation and soft (moment preserving) elastic scattering
+  std::shared_ptr<const MonteCarlo::ElectroatomicReaction> excitation_only =
+    reaction;
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createCondensedHistoryReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               reaction,
+                               true,
+                               true,
+                               0.05,
+                               0.2,
+                               eval_tol );
+
+  FRENSIE_CHECK_EQUAL( reaction->getReactionType(),
+                       MonteCarlo::CONDENSED_HISTORY_ELECTROATOMIC_REACTION );
+  FRENSIE_CHECK_EQUAL( reaction->getThresholdEnergy(), 1e-5 );
+
+  // The angular step constraint shortens the step
+  FRENSIE_CHECK( reaction->getCrossSection( 1e-3 ) >
+                 excitation_only->getCrossSection( 1e-3 ) );
+  FRENSIE_CHECK( reaction->getCrossSection( 1e5 ) >
+                 excitation_only->getCrossSection( 1e5 ) );
+
+  // Clear the reaction
+  reaction.reset();
+}
+
+//---------------------------------------------------------------------------//
+// Check that a condensed history reaction with soft bremsstrahlung and
+// electroionization can be created
+FRENSIE_UNIT_TEST( ElectroatomicReactionNativeFactory,
+                   createCondensedHistoryReaction_soft_inelastic )
+{
+  std::shared_ptr<const MonteCarlo::ElectroatomicReaction>
+    stopping_power_reaction, excitation_only_reaction;
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createStoppingPowerReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               stopping_power_reaction );
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createCondensedHistoryReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               excitation_only_reaction,
+                               true,
+                               false,
+                               0.05,
+                               0.2,
+                               eval_tol );
+
+  // Cutoffs above every secondary energy: all inelastic collisions are soft
+  MonteCarlo::ElectroatomicReactionNativeFactory::createCondensedHistoryReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               reaction,
+                               true,
+                               false,
+                               0.05,
+                               0.2,
+                               eval_tol,
+                               true,
+                               2e5,
+                               true,
+                               2e5 );
+
+  FRENSIE_CHECK_EQUAL( reaction->getReactionType(),
+                       MonteCarlo::CONDENSED_HISTORY_ELECTROATOMIC_REACTION );
+
+  // The soft stopping cross section is the total stopping cross section
+  for( size_t i = energy_grid->size()/4; i < energy_grid->size(); i += energy_grid->size()/4 )
+  {
+    double energy = (*energy_grid)[i];
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                          reaction->getCrossSection( energy )*0.05*energy,
+                          stopping_power_reaction->getCrossSection( energy ),
+                          1e-12 );
+  }
+
+  // Default cutoffs: only the restricted stopping cross section is soft
+  std::shared_ptr<const MonteCarlo::ElectroatomicReaction> full_soft_reaction =
+    reaction;
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createCondensedHistoryReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               reaction,
+                               true,
+                               false,
+                               0.05,
+                               0.2,
+                               eval_tol,
+                               true,
+                               1e-3,
+                               true,
+                               1e-4 );
+
+  std::vector<double> energies( {1.0, 1e2, 1e5} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    FRENSIE_CHECK_GREATER( reaction->getCrossSection( energies[i] ),
+                           excitation_only_reaction->getCrossSection( energies[i] ) );
+    FRENSIE_CHECK_LESS( reaction->getCrossSection( energies[i] ),
+                        full_soft_reaction->getCrossSection( energies[i] ) );
+  }
+
+  // Clear the reaction
+  reaction.reset();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the hard bremsstrahlung reaction can be created
+FRENSIE_UNIT_TEST( ElectroatomicReactionNativeFactory,
+                   createHardBremsstrahlungReaction )
+{
+  std::shared_ptr<const MonteCarlo::ElectroatomicReaction> full_reaction;
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createBremsstrahlungReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               full_reaction,
+                               MonteCarlo::DIPOLE_DISTRIBUTION,
+                               eval_tol );
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createHardBremsstrahlungReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               reaction,
+                               MonteCarlo::DIPOLE_DISTRIBUTION,
+                               1e-3,
+                               eval_tol );
+
+  // Test reaction properties
+  FRENSIE_CHECK_EQUAL( reaction->getReactionType(),
+                       MonteCarlo::BREMSSTRAHLUNG_ELECTROATOMIC_REACTION );
+  FRENSIE_CHECK_GREATER( reaction->getThresholdEnergy(), 1e-3 );
+
+  // Only the photons above the cutoff energy are emitted
+  std::vector<double> energies( {2e-2, 1.0, 1e2, 1e5} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    FRENSIE_CHECK_GREATER( reaction->getCrossSection( energies[i] ), 0.0 );
+    FRENSIE_CHECK_LESS( reaction->getCrossSection( energies[i] ),
+                        full_reaction->getCrossSection( energies[i] ) );
+  }
+
+  std::vector<double> random_numbers( {0.0, 0.5, 1.0-1e-15} );
+
+  for( size_t i = 0; i < random_numbers.size(); ++i )
+  {
+    std::vector<double> fake_stream( 4, random_numbers[i] );
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    MonteCarlo::ParticleBank bank;
+    Data::SubshellType shell_of_interaction;
+
+    MonteCarlo::ElectronState electron( 0 );
+    electron.setEnergy( 1.0 );
+    electron.setDirection( 0.0, 0.0, 1.0 );
+
+    reaction->react( electron, bank, shell_of_interaction );
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+
+    FRENSIE_CHECK_GREATER_OR_EQUAL( 1.0 - electron.getEnergy(), 1e-3*(1.0-1e-12) );
+  }
+
+  // Clear the reaction
+  reaction.reset();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the hard electroionization subshell reactions can be created
+FRENSIE_UNIT_TEST( ElectroatomicReactionNativeFactory,
+                   createHardSubshellElectroionizationReactions )
+{
+  std::vector<std::shared_ptr<const MonteCarlo::ElectroatomicReaction> >
+    full_reactions, reactions;
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createSubshellElectroionizationReactions(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               full_reactions,
+                               MonteCarlo::KNOCK_ON_SAMPLING,
+                               eval_tol );
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createHardSubshellElectroionizationReactions(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               reactions,
+                               MonteCarlo::KNOCK_ON_SAMPLING,
+                               1e-4,
+                               eval_tol );
+
+  FRENSIE_REQUIRE_GREATER( reactions.size(), 0 );
+  FRENSIE_CHECK_LESS_OR_EQUAL( reactions.size(), full_reactions.size() );
+
+  // Test the first shell's reaction properties
+  FRENSIE_CHECK_EQUAL( reactions.front()->getReactionType(),
+                       full_reactions.front()->getReactionType() );
+  FRENSIE_CHECK_GREATER( reactions.front()->getThresholdEnergy(),
+                         full_reactions.front()->getThresholdEnergy() );
+
+  // Only the knock-on electrons above the cutoff energy are created
+  std::vector<double> energies( {1.0, 1e2, 1e5} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    FRENSIE_CHECK_GREATER( reactions.front()->getCrossSection( energies[i] ),
+                           0.0 );
+    FRENSIE_CHECK_LESS( reactions.front()->getCrossSection( energies[i] ),
+                        full_reactions.front()->getCrossSection( energies[i] ) );
+  }
+
+  std::vector<double> random_numbers( {0.0, 0.5, 1.0-1e-15} );
+
+  for( size_t i = 0; i < random_numbers.size(); ++i )
+  {
+    std::vector<double> fake_stream( 4, random_numbers[i] );
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    MonteCarlo::ParticleBank bank;
+    Data::SubshellType shell_of_interaction;
+
+    MonteCarlo::ElectronState electron( 0 );
+    electron.setEnergy( 1.0 );
+    electron.setDirection( 0.0, 0.0, 1.0 );
+
+    reactions.back()->react( electron, bank, shell_of_interaction );
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+
+    FRENSIE_CHECK_GREATER_OR_EQUAL( 1.0 - electron.getEnergy(), 1e-4*(1.0-1e-12) );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that the electroionization subshell reactions can be created
 FRENSIE_UNIT_TEST( ElectroatomicReactionNativeFactory,
@@ -815,6 +1123,78 @@ FRENSIE_UNIT_TEST( ElectroatomicReactionNativeFactory,
   reaction.reset();
 }
 
+//---------------------------------------------------------------------------//
+// Check that a stopping power reaction can be created
+FRENSIE_UNIT_TEST( ElectroatomicReactionNativeFactory,
+                   createStoppingPowerReaction )
+{
+  MonteCarlo::ElectroatomicReactionNativeFactory::createStoppingPowerReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               reaction );
+
+  // Test reaction properties
+  FRENSIE_CHECK_EQUAL( reaction->getReactionType(),
+                       MonteCarlo::STOPPING_POWER_ELECTROATOMIC_REACTION );
+  FRENSIE_CHECK_EQUAL( reaction->getThresholdEnergy(), 1e-5 );
+
+  // Create the inelastic reactions
+  std::vector<std::shared_ptr<const MonteCarlo::ElectroatomicReaction> >
+    inelastic_reactions;
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createSubshellElectroionizationReactions(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               inelastic_reactions,
+                               MonteCarlo::KNOCK_ON_SAMPLING,
+                               eval_tol );
+
+  inelastic_reactions.resize( inelastic_reactions.size()+2 );
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createAtomicExcitationReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               inelastic_reactions[inelastic_reactions.size()-2] );
+
+  MonteCarlo::ElectroatomicReactionNativeFactory::createBremsstrahlungReaction(
+                               *data_container,
+                               energy_grid,
+                               grid_searcher,
+                               inelastic_reactions.back(),
+                               MonteCarlo::DIPOLE_DISTRIBUTION,
+                               eval_tol );
+
+  // The mean energy loss per inelastic collision must be in (0,E)
+  std::vector<double> energies( {1e-5, 1e-3, 1e-1, 1.0, 1e2, 1e5} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    double inelastic_cross_section = 0.0;
+
+    for( size_t j = 0; j < inelastic_reactions.size(); ++j )
+    {
+      inelastic_cross_section +=
+        inelastic_reactions[j]->getCrossSection( energies[i] );
+    }
+
+    double stopping_cross_section = reaction->getCrossSection( energies[i] );
+
+    FRENSIE_CHECK_GREATER( stopping_cross_section, 0.0 );
+    FRENSIE_CHECK_LESS( stopping_cross_section,
+                        energies[i]*inelastic_cross_section );
+  }
+
+  // The stopping cross section is never sampled
+  FRENSIE_CHECK_EQUAL( reaction->getNumberOfEmittedElectrons( 1.0 ), 0 );
+  FRENSIE_CHECK_EQUAL( reaction->getNumberOfEmittedPhotons( 1.0 ), 0 );
+
+  // Clear the reaction
+  reaction.reset();
+}
+
 //---------------------------------------------------------------------------//
 // Check that a void absorption reaction can be created
 FRENSIE_UNIT_TEST( ElectroatomicReactionNativeFactory,
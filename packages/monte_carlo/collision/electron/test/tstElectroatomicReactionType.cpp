@@ -281,6 +281,16 @@ FRENSIE_UNIT_TEST( ElectroatomicReactionType, toString )
     Utility::toString( MonteCarlo::Q3_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION );
 
   FRENSIE_CHECK_EQUAL( reaction_name, "Q3 Subshell Electro-ionization Electro-atomic Reaction" );
+
+  reaction_name =
+    Utility::toString( MonteCarlo::CONDENSED_HISTORY_ELECTROATOMIC_REACTION );
+
+  FRENSIE_CHECK_EQUAL( reaction_name, "Condensed History Electro-atomic Reaction" );
+
+  reaction_name =
+    Utility::toString( MonteCarlo::STOPPING_POWER_ELECTROATOMIC_REACTION );
+
+  FRENSIE_CHECK_EQUAL( reaction_name, "Stopping Power Electro-atomic Reaction" );
 }
 
 //---------------------------------------------------------------------------//
@@ -848,6 +858,20 @@ FRENSIE_UNIT_TEST( ElectroatomicReactionType, ostream_operator )
 
   oss.str( "" );
   oss.clear();
+
+  oss << MonteCarlo::CONDENSED_HISTORY_ELECTROATOMIC_REACTION;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "Condensed History Electro-atomic Reaction" );
+
+  oss.str( "" );
+  oss.clear();
+
+  oss << MonteCarlo::STOPPING_POWER_ELECTROATOMIC_REACTION;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "Stopping Power Electro-atomic Reaction" );
+
+  oss.str( "" );
+  oss.clear();
 }
 
 //---------------------------------------------------------------------------//
@@ -921,6 +945,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ElectroatomicReactionType,
     MonteCarlo::ElectroatomicReactionType type_49 = MonteCarlo::Q1_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION;
     MonteCarlo::ElectroatomicReactionType type_50 = MonteCarlo::Q2_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION;
     MonteCarlo::ElectroatomicReactionType type_51 = MonteCarlo::Q3_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION;
+    MonteCarlo::ElectroatomicReactionType type_52 = MonteCarlo::CONDENSED_HISTORY_ELECTROATOMIC_REACTION;
+    MonteCarlo::ElectroatomicReactionType type_53 = MonteCarlo::STOPPING_POWER_ELECTROATOMIC_REACTION;
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_1 ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_2 ) );
@@ -973,6 +999,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ElectroatomicReactionType,
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_49 ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_50 ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_51 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_52 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_53 ) );
   }
 
   // Copy the archive ostream to an istream
@@ -989,7 +1017,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ElectroatomicReactionType,
     type_22, type_23, type_24, type_25, type_26, type_27, type_28, type_29,
     type_30, type_31, type_32, type_33, type_34, type_35, type_36, type_37,
     type_38, type_39, type_40, type_41, type_42, type_43, type_44, type_45,
-    type_46, type_47, type_48, type_49, type_50, type_51;
+    type_46, type_47, type_48, type_49, type_50, type_51, type_52, type_53;
 
   FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_1 ) );
   FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_2 ) );
@@ -1042,6 +1070,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ElectroatomicReactionType,
   FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_49 ) );
   FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_50 ) );
   FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_51 ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_52 ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_53 ) );
 
   iarchive.reset();
 
@@ -1096,6 +1126,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ElectroatomicReactionType,
   FRENSIE_CHECK_EQUAL( type_49, MonteCarlo::Q1_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION );
   FRENSIE_CHECK_EQUAL( type_50, MonteCarlo::Q2_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION );
   FRENSIE_CHECK_EQUAL( type_51, MonteCarlo::Q3_SUBSHELL_ELECTROIONIZATION_ELECTROATOMIC_REACTION );
+  FRENSIE_CHECK_EQUAL( type_52, MonteCarlo::CONDENSED_HISTORY_ELECTROATOMIC_REACTION );
+  FRENSIE_CHECK_EQUAL( type_53, MonteCarlo::STOPPING_POWER_ELECTROATOMIC_REACTION );
 }
 
 //---------------------------------------------------------------------------//
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <limits>
 
 // FRENSIE Includes
 #include "MonteCarlo_ElectroatomFactory.hpp"
@@ -218,9 +219,30 @@ FRENSIE_UNIT_TEST( ElectronMaterial, getReactionTypes )
   FRENSIE_CHECK( reaction_types.count( MonteCarlo::ATOMIC_EXCITATION_ELECTROATOMIC_REACTION ) );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the macroscopic stopping power can be returned
+FRENSIE_UNIT_TEST( ElectronMaterial, getMacroscopicStoppingPower )
+{
+  // The stopping power is only available with native data
+  FRENSIE_CHECK_EQUAL( material->getMacroscopicStoppingPower( 1e-3 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( material->getMacroscopicStoppingPower( 1.0 ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the CSDA range can be returned
+FRENSIE_UNIT_TEST( ElectronMaterial, getCSDARange )
+{
+  // No distance is required to reach the cutoff energy
+  FRENSIE_CHECK_EQUAL( material->getCSDARange( 1e-3, 1e-3 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( material->getCSDARange( 1e-3, 1e-2 ), 0.0 );
+
+  // Without stopping power data the range is conservatively infinite
+  FRENSIE_CHECK_EQUAL( material->getCSDARange( 1.0, 1e-3 ),
+                       std::numeric_limits<double>::infinity() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a electron can collide with the material
-//! \details This unit test is dependent on the version of boost being used.
 FRENSIE_UNIT_TEST( ElectronMaterial, collideAnalogue )
 {
   // Test that the Doppler data is present
@@ -233,7 +255,7 @@ FRENSIE_UNIT_TEST( ElectronMaterial, collideAnalogue )
   // Set up the random number stream
   std::vector<double> fake_stream( 3 );
   fake_stream[0] = 0.5; // select the pb atom
-  fake_stream[1] = 1.0-1e-15; // select the elastic reaction
+  fake_stream[1] = 0.01; // select the elastic reaction
   fake_stream[2] = 0.5; // sample mu = 0.9874366113907
 
   Utility::RandomNumberGenerator::setFakeStream( fake_stream );
@@ -248,7 +270,6 @@ FRENSIE_UNIT_TEST( ElectronMaterial, collideAnalogue )
 
 //---------------------------------------------------------------------------//
 // Check that a electron can collide with the material and survival bias
-//! \details This unit test is dependent on the version of boost being used.
 FRENSIE_UNIT_TEST( ElectronMaterial, collideSurvivalBias )
 {
   // Test that the Doppler data is present
@@ -261,7 +282,7 @@ FRENSIE_UNIT_TEST( ElectronMaterial, collideSurvivalBias )
   // Set up the random number stream
   std::vector<double> fake_stream( 3 );
   fake_stream[0] = 0.5; // select the pb atom
-  fake_stream[1] = 1.0-1e-15; // select the elastic reaction
+  fake_stream[1] = 0.01; // select the elastic reaction
   fake_stream[2] = 0.5; // sample mu = 0.9874366113907
 
   Utility::RandomNumberGenerator::setFakeStream( fake_stream );
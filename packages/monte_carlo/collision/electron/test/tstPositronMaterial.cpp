@@ -253,7 +253,6 @@ FRENSIE_UNIT_TEST( PositronMaterial, getReactionTypes )
 
 //---------------------------------------------------------------------------//
 // Check that a positron can collide with the material
-//! \details This unit test is dependent on the version of boost being used.
 FRENSIE_UNIT_TEST( PositronMaterial, collideAnalogue )
 {
   // Test that the Doppler data is present
@@ -266,10 +265,7 @@ FRENSIE_UNIT_TEST( PositronMaterial, collideAnalogue )
   // Set up the random number stream
   std::vector<double> fake_stream( 3 );
   fake_stream[0] = 0.5; // select the pb atom
-  if( BOOST_VERSION < 106000 )
-    fake_stream[1] = 0.36; // select the elastic reaction (for boost below version 1.60)
-  else
-    fake_stream[1] = 0.61; // select the elastic reaction (for boost above version 1.60)
+  fake_stream[1] = 0.01; // select the elastic reaction
   fake_stream[2] = 0.5; // sample mu = 0.9874366113907
 
   Utility::RandomNumberGenerator::setFakeStream( fake_stream );
@@ -284,7 +280,6 @@ FRENSIE_UNIT_TEST( PositronMaterial, collideAnalogue )
 
 //---------------------------------------------------------------------------//
 // Check that a positron can collide with the material and survival bias
-//! \details This unit test is dependent on the version of boost being used.
 FRENSIE_UNIT_TEST( PositronMaterial, collideSurvivalBias )
 {
   // Test that the Doppler data is present
@@ -297,10 +292,7 @@ FRENSIE_UNIT_TEST( PositronMaterial, collideSurvivalBias )
   // Set up the random number stream
   std::vector<double> fake_stream( 3 );
   fake_stream[0] = 0.5; // select the pb atom
-  if( BOOST_VERSION < 106000 )
-    fake_stream[1] = 0.36; // select the elastic reaction (for boost below version 1.60)
-  else
-    fake_stream[1] = 0.61; // select the elastic reaction (for boost above version 1.60)
+  fake_stream[1] = 0.01; // select the elastic reaction
   fake_stream[2] = 0.5; // sample mu = 0.9874366113907
 
   Utility::RandomNumberGenerator::setFakeStream( fake_stream );
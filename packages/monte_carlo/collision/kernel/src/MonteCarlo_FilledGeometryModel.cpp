@@ -14,6 +14,10 @@
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_AtomicRelaxationModelFactory.hpp"
 #include "MonteCarlo_ParticleModeTypeTraits.hpp"
+#include "Data_ACEFileHandler.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_Communicator.hpp"
+#include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -34,6 +38,20 @@ void FilledGeometryModel::setDefaultDatabasePath(
     s_default_database_path = default_database_path;
 }
 
+// Set the directory where parsed data tables will be cached
+/*! \details Parsing the ACE text tables can dominate the time it takes to
+ * fill a model. Once a table has been parsed a binary copy of it will be
+ * stored in the cache directory. Models filled later (in this run or in
+ * later runs) will load the binary copy instead, as long as the ACE file has
+ * not been modified. Native data files are already stored as archives and are
+ * not cached.
+ */
+void FilledGeometryModel::setDataTableCacheDirectory(
+                               const boost::filesystem::path& cache_directory )
+{
+  Data::ACEFileHandler::setTableCacheDirectory( cache_directory );
+}
+
 // Default constructor
 FilledGeometryModel::FilledGeometryModel()
   : d_database_path(),
@@ -138,10 +156,33 @@ void FilledGeometryModel::passUnfilledModelToBases()
   FilledPositronGeometryModel::setUnfilledModel( d_unfilled_model );
 }
 
+// Pass the node communicator to the bases
+void FilledGeometryModel::passNodeCommunicatorToBases(
+                const std::shared_ptr<const Utility::Communicator>& node_comm )
+{
+  FilledNeutronGeometryModel::setNodeCommunicator( node_comm );
+  FilledPhotonGeometryModel::setNodeCommunicator( node_comm );
+  FilledAdjointPhotonGeometryModel::setNodeCommunicator( node_comm );
+  FilledElectronGeometryModel::setNodeCommunicator( node_comm );
+  FilledAdjointElectronGeometryModel::setNodeCommunicator( node_comm );
+  FilledPositronGeometryModel::setNodeCommunicator( node_comm );
+}
+
 // Fill the geometry
+/*! \details When the unionized energy grid mode is on, the unionized energy
+ * grids are shared by the processes on each node (the default communicator
+ * will be split by node). The model must therefore be filled by every
+ * process in the default communicator in that case.
+ */
 void FilledGeometryModel::fillGeometry( const bool verbose )
 {
   this->passUnfilledModelToBases();
+
+  if( d_properties->isUnionizedEnergyGridModeOn() )
+  {
+    this->passNodeCommunicatorToBases(
+                     Utility::Communicator::getDefault()->splitByNode() );
+  }
     
   // Make sure that the database path is valid
   TEST_FOR_EXCEPTION( !boost::filesystem::is_directory( d_database_path ),
@@ -257,9 +298,23 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
   // Only load the particle materials required by the simulation mode
   ParticleModeType mode = d_properties->getParticleMode();
 
+  // The scattering centers of each stage are loaded concurrently - the
+  // wall time of each stage will be reported. Note: reading an ACE table
+  // that is not in the table cache is serialized (see
+  // Data::ACEFileHandler) so only the table processing will overlap.
+  std::shared_ptr<Utility::Timer> stage_timer =
+    Utility::OpenMPProperties::createTimer();
+
+  std::shared_ptr<Utility::Timer> fill_timer =
+    Utility::OpenMPProperties::createTimer();
+
+  fill_timer->start();
+
   // Load the neutron materials
   if( MonteCarlo::isParticleTypeCompatible( mode, NEUTRON ) )
   {
+    stage_timer->start();
+
     try{
       FilledNeutronGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
@@ -275,11 +330,18 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Could not fill the model with neutron "
                              "materials!" );
+
+    stage_timer->stop();
+
+    FRENSIE_LOG_NOTIFICATION( "Filled the model with neutron materials ("
+                              << stage_timer->elapsed().count() << " s)." );
   }
 
   // Load the photon materials
   if( MonteCarlo::isParticleTypeCompatible( mode, PHOTON ) )
   {
+    stage_timer->start();
+
     try{
       FilledPhotonGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
@@ -295,11 +357,18 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Could not fill the model with photon "
                              "materials!" );
+
+    stage_timer->stop();
+
+    FRENSIE_LOG_NOTIFICATION( "Filled the model with photon materials ("
+                              << stage_timer->elapsed().count() << " s)." );
   }
 
   // Load the adjoint photon materials
   if( MonteCarlo::isParticleTypeCompatible( mode, ADJOINT_PHOTON ) )
   {
+    stage_timer->start();
+
     try{
       FilledAdjointPhotonGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
@@ -315,11 +384,18 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Could not fill the model with adjoint photon "
                              "materials!" );
+
+    stage_timer->stop();
+
+    FRENSIE_LOG_NOTIFICATION( "Filled the model with adjoint photon materials ("
+                              << stage_timer->elapsed().count() << " s)." );
   }
 
   // Load the electron materials
   if( MonteCarlo::isParticleTypeCompatible( mode, ELECTRON ) )
   {
+    stage_timer->start();
+
     try{
       FilledElectronGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
@@ -336,6 +412,13 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                              "Could not fill the model with electron "
                              "materials!" );
 
+    stage_timer->stop();
+
+    FRENSIE_LOG_NOTIFICATION( "Filled the model with electron materials ("
+                              << stage_timer->elapsed().count() << " s)." );
+
+    stage_timer->start();
+
     try{
       FilledPositronGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
@@ -351,11 +434,18 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Could not fill the model with positron "
                              "materials!" );
+
+    stage_timer->stop();
+
+    FRENSIE_LOG_NOTIFICATION( "Filled the model with positron materials ("
+                              << stage_timer->elapsed().count() << " s)." );
   }
 
   // Load the adjoint electron materials
   if( MonteCarlo::isParticleTypeCompatible( mode, ADJOINT_ELECTRON ) )
   {
+    stage_timer->start();
+
     try{
       FilledAdjointElectronGeometryModel::loadMaterialsAndFillModel(
                                               d_database_path,
@@ -371,8 +461,18 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Could not fill the model with adjoint electron "
                              "materials!" );
+
+    stage_timer->stop();
+
+    FRENSIE_LOG_NOTIFICATION( "Filled the model with adjoint electron materials ("
+                              << stage_timer->elapsed().count() << " s)." );
   }
 
+  fill_timer->stop();
+
+  FRENSIE_LOG_NOTIFICATION( "Finished filling the model ("
+                            << fill_timer->elapsed().count() << " s)." );
+
   d_filled = true;
 }
 
@@ -65,6 +65,10 @@ public:
   static void setDefaultDatabasePath(
                         const boost::filesystem::path& default_database_path );
 
+  //! Set the directory where parsed data tables will be cached
+  static void setDataTableCacheDirectory(
+                              const boost::filesystem::path& cache_directory );
+
   //! Check if a cell is void (as experienced by the given particle type)
   bool isCellVoid( const Geometry::Model::EntityId cell,
                    const MonteCarlo::ParticleType particle_type ) const;
@@ -220,6 +224,10 @@ private:
   // Pass the unfilled model to the bases
   void passUnfilledModelToBases();
 
+  // Pass the node communicator to the bases
+  void passNodeCommunicatorToBases(
+               const std::shared_ptr<const Utility::Communicator>& node_comm );
+
   // Fill the geometry
   void fillGeometry( const bool verbose );
 
@@ -21,6 +21,7 @@
 #include "MonteCarlo_MaterialDefinitionDatabase.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
 #include "Geometry_Model.hpp"
+#include "Utility_Communicator.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
 #include "Utility_Vector.hpp"
@@ -138,6 +139,10 @@ protected:
   //! Set the unfilled model
   void setUnfilledModel( const std::shared_ptr<const Geometry::Model>& unfilled_model );
 
+  //! Set the node communicator used to share the unionized energy grids
+  void setNodeCommunicator(
+               const std::shared_ptr<const Utility::Communicator>& node_comm );
+
   //! Load the materials and fill the model
   void loadMaterialsAndFillModel(
        const boost::filesystem::path& database_path,
@@ -175,9 +180,15 @@ private:
                     const std::vector<Geometry::Model::EntityId>&
                     cells_containing_material );
 
+  // Report the memory used by the unionized energy grids
+  void reportUnionizedEnergyGridMemoryUsage() const;
+
   // The unfilled model
   std::shared_ptr<const Geometry::Model> d_unfilled_model;
 
+  // The node communicator used to share the unionized energy grids
+  std::shared_ptr<const Utility::Communicator> d_node_comm;
+
   // The scattering center name map
   ScatteringCenterNameMap d_scattering_center_name_map;
 
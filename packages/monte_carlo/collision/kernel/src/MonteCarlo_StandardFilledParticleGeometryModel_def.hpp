@@ -11,6 +11,7 @@
 
 // FRENSIE Includes
 #include "Utility_ToStringTraits.hpp"
+#include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -27,6 +28,7 @@ template<typename Material>
 StandardFilledParticleGeometryModel<Material>::StandardFilledParticleGeometryModel(
                  const std::shared_ptr<const Geometry::Model>& unfilled_model )
   : d_unfilled_model( unfilled_model ),
+    d_node_comm(),
     d_scattering_center_name_map(),
     d_material_name_map(),
     d_cell_id_material_map()
@@ -46,6 +48,19 @@ void StandardFilledParticleGeometryModel<Material>::setUnfilledModel(
   d_unfilled_model = unfilled_model;
 }
 
+// Set the node communicator used to share the unionized energy grids
+/*! \details If a node communicator has been set the unionized energy grids
+ * of the materials will only be constructed by the node root process and
+ * shared with the other processes on the node (see
+ * Material::unionizeEnergyGrid).
+ */
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::setNodeCommunicator(
+                const std::shared_ptr<const Utility::Communicator>& node_comm )
+{
+  d_node_comm = node_comm;
+}
+
 // Load the materials and fill the model
 template<typename Material>
 void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
@@ -125,11 +140,34 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
           Utility::get<1>( material_definition[i] );
       }
 
-      new_material.reset( new MaterialType( material_id,
-                                            density,
-                                            d_scattering_center_name_map,
-                                            scattering_center_fractions,
-                                            scattering_center_names ) );
+      std::shared_ptr<MaterialType> material(
+                             new MaterialType( material_id,
+                                               density,
+                                               d_scattering_center_name_map,
+                                               scattering_center_fractions,
+                                               scattering_center_names ) );
+
+      // Precompute the macroscopic cross sections on a unionized grid
+      if( properties.isUnionizedEnergyGridModeOn() )
+      {
+        if( d_node_comm )
+        {
+          material->unionizeEnergyGrid(
+             d_node_comm,
+             properties.template getMinParticleEnergy<ParticleStateType>(),
+             properties.template getMaxParticleEnergy<ParticleStateType>(),
+             properties.getUnionizedEnergyGridConvergenceTolerance() );
+        }
+        else
+        {
+          material->unionizeEnergyGrid(
+             properties.template getMinParticleEnergy<ParticleStateType>(),
+             properties.template getMaxParticleEnergy<ParticleStateType>(),
+             properties.getUnionizedEnergyGridConvergenceTolerance() );
+        }
+      }
+
+      new_material = material;
     }
 
     material_name_cell_ids_map[material_name].push_back( cell_id );
@@ -148,6 +186,39 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
     
     ++material_name_it;
   }
+
+  // Report the memory used by the unionized energy grids
+  if( properties.isUnionizedEnergyGridModeOn() )
+    this->reportUnionizedEnergyGridMemoryUsage();
+}
+
+// Report the memory used by the unionized energy grids
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::reportUnionizedEnergyGridMemoryUsage() const
+{
+  size_t number_of_grid_points = 0;
+  size_t memory_usage = 0;
+
+  typename MaterialNameMap::const_iterator material_name_it =
+    d_material_name_map.begin();
+
+  while( material_name_it != d_material_name_map.end() )
+  {
+    number_of_grid_points +=
+      material_name_it->second->getUnionizedEnergyGridSize();
+
+    memory_usage +=
+      material_name_it->second->getUnionizedEnergyGridMemoryUsage();
+
+    ++material_name_it;
+  }
+
+  FRENSIE_LOG_NOTIFICATION( "Unionized energy grids ("
+                            << Utility::toString( ParticleStateType::type ) <<
+                            "): " << d_material_name_map.size() <<
+                            " materials, " << number_of_grid_points <<
+                            " grid points, " << memory_usage/1048576.0 <<
+                            " MB" );
 }
 
 // Add a material to the collision kernel
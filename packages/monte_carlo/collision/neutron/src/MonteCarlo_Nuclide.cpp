@@ -118,6 +118,7 @@ Nuclide::Nuclide(
     d_isomer_number( isomer_number ),
     d_atomic_weight_ratio( atomic_weight_ratio ),
     d_temperature( temperature ),
+    d_grid_searcher( grid_searcher ),
     d_total_reaction(),
     d_total_absorption_reaction()
 {
@@ -220,18 +221,48 @@ double Nuclide::getTemperature() const
   return d_temperature;
 }
 
+// Return the energy grid bin index of the energy
+size_t Nuclide::getEnergyGridBinIndex( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( d_grid_searcher->isValueWithinGridBounds( energy ) );
+
+  return d_grid_searcher->findLowerBinIndex( energy );
+}
+
 // Return the total cross section at the desired energy
 double Nuclide::getTotalCrossSection( const double energy ) const
 {
   return d_total_reaction->getCrossSection( energy );
 }
 
+// Return the total cross section at the desired energy (efficient)
+/*! \details The energy grid bin must be the bin index returned by
+ * getEnergyGridBinIndex for the energy.
+ */
+double Nuclide::getTotalCrossSection( const double energy,
+                                      const size_t energy_grid_bin ) const
+{
+  return d_total_reaction->getCrossSection( energy, energy_grid_bin );
+}
+
 // Return the total absorption cross section at the desired energy
 double Nuclide::getAbsorptionCrossSection( const double energy ) const
 {
   return d_total_absorption_reaction->getCrossSection( energy );
 }
 
+// Return the total absorption cross section at the desired energy (efficient)
+/*! \details The energy grid bin must be the bin index returned by
+ * getEnergyGridBinIndex for the energy.
+ */
+double Nuclide::getAbsorptionCrossSection( const double energy,
+                                           const size_t energy_grid_bin ) const
+{
+  return d_total_absorption_reaction->getCrossSection( energy,
+                                                       energy_grid_bin );
+}
+
 // Return the survival probability at the desired energy
 double Nuclide::getSurvivalProbability( const double energy ) const
 {
@@ -103,12 +103,23 @@ public:
   //! Return the temperature of the nuclide (in MeV)
   double getTemperature() const;
 
+  //! Return the energy grid bin index of the energy
+  size_t getEnergyGridBinIndex( const double energy ) const;
+
   //! Return the total cross section at the desired energy
   double getTotalCrossSection( const double energy ) const;
 
+  //! Return the total cross section at the desired energy (efficient)
+  double getTotalCrossSection( const double energy,
+                               const size_t energy_grid_bin ) const;
+
   //! Return the total absorption cross section at the desired energy
   double getAbsorptionCrossSection( const double energy ) const;
 
+  //! Return the total absorption cross section at the desired energy (efficient)
+  double getAbsorptionCrossSection( const double energy,
+                                    const size_t energy_grid_bin ) const;
+
   //! Return the survival probability at the desired energy
   double getSurvivalProbability( const double energy ) const;
 
@@ -186,6 +197,10 @@ private:
   // The temperature of the nuclide (MeV)
   double d_temperature;
 
+  // The energy grid searcher
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> >
+  d_grid_searcher;
+
   // The total reaction
   std::unique_ptr<const NeutronNuclearReaction> d_total_reaction;
 
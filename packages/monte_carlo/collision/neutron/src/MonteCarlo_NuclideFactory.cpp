@@ -9,6 +9,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_NuclideFactory.hpp"
 #include "MonteCarlo_NuclideACEFactory.hpp"
+#include "MonteCarlo_ScatteringCenterFactoryHelpers.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSNeutronDataExtractor.hpp"
 #include "Utility_LoggingMacros.hpp"
@@ -24,11 +25,21 @@ NuclideFactory::NuclideFactory(
                  const ScatteringCenterDefinitionDatabase& nuclide_definitions,
                  const SimulationProperties& properties,
                  const bool verbose )
+  : d_nuclide_name_map(),
+    d_nuclear_table_name_map(),
+    d_verbose( verbose )
 {
   FRENSIE_LOG_NOTIFICATION( "Starting to load nuclide data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
   
-  // Create each nuclide in the set
+  // The nuclides that use each data table
+  std::vector<std::pair<std::string,NuclideNameMap::mapped_type*> >
+    nuclide_tables;
+
+  // The loaders for each data table (every table is only loaded once)
+  std::vector<ScatteringCenterDataTableLoader> table_loaders;
+
+  // Find the data table used by each nuclide in the set
   ScatteringCenterNameSet::const_iterator nuclide_name =
     nuclide_names.begin();
 
@@ -54,39 +65,57 @@ NuclideFactory::NuclideFactory(
     const Data::NuclearDataProperties& nuclear_data_properties =
       nuclide_definition.getNuclearDataProperties( &atomic_weight_ratio );
 
-    if( nuclear_data_properties.fileType() ==
-        Data::NuclearDataProperties::ACE_FILE )
-    {
-      // Initialize the nuclear table name map for ACE files
-      if( d_nuclear_table_name_map.find( Data::NuclearDataProperties::ACE_FILE ) ==
-          d_nuclear_table_name_map.end() )
-      {
-        d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE];
-      }
-      
-      this->createNuclideFromACETable( data_directory,
-                                       *nuclide_name,
-                                       atomic_weight_ratio,
-                                       nuclear_data_properties,
-                                       properties );
-    }
-    else
+    TEST_FOR_EXCEPTION( nuclear_data_properties.fileType() !=
+                        Data::NuclearDataProperties::ACE_FILE,
+                        std::runtime_error,
+                        "Nuclide " << *nuclide_name << " cannot be created "
+                        "because its definition specifies the use of a "
+                        "nuclear data file of type "
+                        << nuclear_data_properties.fileType() <<
+                        ", which is currently unsupported!" );
+
+    const std::string& table_key = nuclear_data_properties.tableName();
+
+    NuclideNameMap& table_name_map =
+      d_nuclear_table_name_map[nuclear_data_properties.fileType()];
+
+    // Check if the table has already been scheduled for loading
+    if( table_name_map.find( table_key ) == table_name_map.end() )
     {
-      THROW_EXCEPTION( std::runtime_error,
-                       "Nuclide " << *nuclide_name << " cannot be created "
-                       "because its definition specifies the use of a "
-                       "nuclear data file of type "
-                       << nuclear_data_properties.fileType() <<
-                       ", which is currently unsupported!" );
+      const Data::NuclearDataProperties* data_properties =
+        &nuclear_data_properties;
+
+      NuclideNameMap::mapped_type* nuclide = &table_name_map[table_key];
+
+      table_loaders.push_back(
+        [this,&data_directory,&properties,atomic_weight_ratio,data_properties,nuclide](){
+          this->createNuclideFromACETable( data_directory,
+                                           atomic_weight_ratio,
+                                           *data_properties,
+                                           properties,
+                                           *nuclide ); } );
     }
 
+    nuclide_tables.push_back( std::make_pair( *nuclide_name,
+                                              &table_name_map[table_key] ) );
+
     ++nuclide_name;
   }
 
+  // Load the data tables
+  loadScatteringCenterDataTables( table_loaders );
+
+  // Assign the loaded data tables to the nuclides
+  for( size_t i = 0; i < nuclide_tables.size(); ++i )
+  {
+    d_nuclide_name_map[nuclide_tables[i].first] = *nuclide_tables[i].second;
+  }
+
   // Make sure that every nuclide has been created
   testPostcondition( d_nuclide_name_map.size() == nuclide_names.size() );
 
-  FRENSIE_LOG_NOTIFICATION( "Finished loading nuclide data tables." );
+  FRENSIE_LOG_NOTIFICATION( "Finished loading nuclide data tables ("
+                            << table_loaders.size() << " tables)." );
   FRENSIE_FLUSH_ALL_LOGS();
 }
 
@@ -97,48 +126,34 @@ void NuclideFactory::createNuclideMap( NuclideNameMap& nuclide_map ) const
 }
 
 // Create a nuclide from an ACE table
+/*! \details This method can be called concurrently for different tables.
+ */
 void NuclideFactory::createNuclideFromACETable(
                             const boost::filesystem::path& data_directory,
-                            const std::string& nuclide_name,
                             const double atomic_weight_ratio,
                             const Data::NuclearDataProperties& data_properties,
-                            const SimulationProperties& properties )
+                            const SimulationProperties& properties,
+                            NuclideNameMap::mapped_type& nuclide ) const
 {
-  // Check if the table has already been loaded
-  if( d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE].find( data_properties.tableName() ) ==
-      d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE].end() )
-  {
-    // Construct the path to the data file
-    boost::filesystem::path ace_file_path = data_directory;
-    ace_file_path /= data_properties.filePath();
-    ace_file_path.make_preferred();
-    
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION( " Loading ACE cross section table "
-                                        << data_properties.tableName() <<
-                                        " from " << ace_file_path.string() <<
-                                        " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-
-    // The ACE table reader
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-                                           data_properties.tableName(),
-                                           data_properties.fileStartLine(),
-                                           true );
-    
-    // The XSS neutron data extractor
-    Data::XSSNeutronDataExtractor xss_data_extractor(
-					 ace_file_handler.getTableNXSArray(),
-					 ace_file_handler.getTableJXSArray(),
-				         ace_file_handler.getTableXSSArray() );
-
-    // Initialize the new nuclide
-    NuclideNameMap::mapped_type& nuclide = d_nuclide_name_map[nuclide_name];
-
-    // Create the new nuclide
-    NuclideACEFactory::createNuclide(
+  // Construct the path to the data file
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  // The ACE table reader
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         data_properties.tableName(),
+                                         data_properties.fileStartLine(),
+                                         true );
+
+  // The XSS neutron data extractor
+  Data::XSSNeutronDataExtractor xss_data_extractor(
+                                         ace_file_handler.getTableNXSArray(),
+                                         ace_file_handler.getTableJXSArray(),
+                                         ace_file_handler.getTableXSSArray() );
+
+  // Create the new nuclide
+  NuclideACEFactory::createNuclide(
                           xss_data_extractor,
                           data_properties.tableName(),
                           data_properties.zaid().atomicNumber(),
@@ -149,20 +164,11 @@ void NuclideFactory::createNuclideFromACETable(
                           properties,
                           nuclide );
 
-    // Cache the new nuclide in the table name map
-    d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][data_properties.tableName()] = nuclide;
-    
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
+  if( d_verbose )
   {
-    d_nuclide_name_map[nuclide_name] =
-      d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][data_properties.tableName()];
+    FRENSIE_LOG_NOTIFICATION( " Loaded ACE cross section table "
+                              << data_properties.tableName() <<
+                              " from " << ace_file_path.string() << "." );
   }
 }
 
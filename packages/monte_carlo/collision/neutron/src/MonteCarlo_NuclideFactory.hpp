@@ -57,10 +57,10 @@ private:
   // Create a nuclide from an ACE table
   void createNuclideFromACETable(
                             const boost::filesystem::path& data_directory,
-                            const std::string& nuclide_name,
                             const double atomic_weight_ratio,
                             const Data::NuclearDataProperties& data_properties,
-                            const SimulationProperties& properties );
+                            const SimulationProperties& properties,
+                            NuclideNameMap::mapped_type& nuclide ) const;
 
   // The nuclide  map
   NuclideNameMap d_nuclide_name_map;
@@ -28,6 +28,10 @@ using boost::units::si::kelvin;
 
 std::shared_ptr<const MonteCarlo::NeutronMaterial> material;
 
+std::shared_ptr<MonteCarlo::NeutronMaterial> unionized_material;
+
+std::shared_ptr<MonteCarlo::NeutronMaterial> node_shared_unionized_material;
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -72,6 +76,120 @@ FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen,
   FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 1.6267115171099e-5, 1e-13 );
 }
 
+//---------------------------------------------------------------------------//
+// Check if the material has a unionized energy grid
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, hasUnionizedEnergyGrid )
+{
+  FRENSIE_CHECK( !material->hasUnionizedEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( material->getUnionizedEnergyGridSize(), 0 );
+  FRENSIE_CHECK_EQUAL( material->getUnionizedEnergyGridMemoryUsage(), 0 );
+
+  FRENSIE_CHECK( unionized_material->hasUnionizedEnergyGrid() );
+  FRENSIE_CHECK( unionized_material->getUnionizedEnergyGridSize() > 2 );
+  FRENSIE_CHECK( unionized_material->getUnionizedEnergyGridMemoryUsage() >=
+                 3*sizeof(double)*unionized_material->getUnionizedEnergyGridSize() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the macroscopic total and absorption cross sections can be
+// returned from the unionized energy grid
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen,
+                   getMacroscopicCrossSection_unionized )
+{
+  // The grid end points are evaluated exactly
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                   unionized_material->getMacroscopicTotalCrossSection( 1.0e-11 ),
+                   703.45055504218,
+                   1e-13 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                   unionized_material->getMacroscopicTotalCrossSection( 2.0e1 ),
+                   0.28847574157342,
+                   1e-9 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+              unionized_material->getMacroscopicAbsorptionCrossSection( 1.0e-11 ),
+              9.9795573924326,
+              1e-13 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+              unionized_material->getMacroscopicAbsorptionCrossSection( 2.0e1 ),
+              1.6267115171099e-5,
+              1e-13 );
+
+  // Intermediate energies are interpolated to within the grid tolerance
+  std::vector<double> energies( {3.3e-10, 2.53e-8, 1.7e-6, 4.2e-3, 0.77, 13.1} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+             unionized_material->getMacroscopicTotalCrossSection( energies[i] ),
+             material->getMacroscopicTotalCrossSection( energies[i] ),
+             2e-3 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+        unionized_material->getMacroscopicAbsorptionCrossSection( energies[i] ),
+        material->getMacroscopicAbsorptionCrossSection( energies[i] ),
+        2e-3 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a unionized energy grid shared by the processes on a node
+// matches a locally constructed grid
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen,
+                   getMacroscopicCrossSection_node_shared_unionized )
+{
+  FRENSIE_CHECK( node_shared_unionized_material->hasUnionizedEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( node_shared_unionized_material->getUnionizedEnergyGridSize(),
+                       unionized_material->getUnionizedEnergyGridSize() );
+
+  if( Utility::Communicator::getDefault()->splitByNode()->size() == 1 )
+  {
+    FRENSIE_CHECK( !node_shared_unionized_material->isUnionizedEnergyGridShared() );
+  }
+
+  std::vector<double> energies( {1.0e-11, 3.3e-10, 2.53e-8, 1.7e-6, 4.2e-3, 0.77, 13.1, 2.0e1} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL(
+      node_shared_unionized_material->getMacroscopicTotalCrossSection( energies[i] ),
+      unionized_material->getMacroscopicTotalCrossSection( energies[i] ) );
+    FRENSIE_CHECK_EQUAL(
+      node_shared_unionized_material->getMacroscopicAbsorptionCrossSection( energies[i] ),
+      unionized_material->getMacroscopicAbsorptionCrossSection( energies[i] ) );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that cached energy grid lookups are only reused for the same
+// material and energy
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen,
+                   getMacroscopicCrossSection_cached_lookup )
+{
+  const double exact_cross_section =
+    material->getMacroscopicTotalCrossSection( 2.53e-8 );
+
+  const double unionized_cross_section =
+    unionized_material->getMacroscopicTotalCrossSection( 2.53e-8 );
+
+  FRENSIE_CHECK_EQUAL( material->getMacroscopicTotalCrossSection( 2.53e-8 ),
+                       exact_cross_section );
+  FRENSIE_CHECK_EQUAL( unionized_material->getMacroscopicTotalCrossSection( 2.53e-8 ),
+                       unionized_cross_section );
+  FRENSIE_CHECK_EQUAL( material->getMacroscopicTotalCrossSection( 2.53e-8 ),
+                       exact_cross_section );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+            unionized_material->getMacroscopicAbsorptionCrossSection( 2.53e-8 ),
+            material->getMacroscopicAbsorptionCrossSection( 2.53e-8 ),
+            2e-3 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                   unionized_material->getMacroscopicTotalCrossSection( 1.0e-11 ),
+                   703.45055504218,
+                   1e-13 );
+  FRENSIE_CHECK_EQUAL( unionized_material->getMacroscopicTotalCrossSection( 2.53e-8 ),
+                       unionized_cross_section );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the survival probability can be returned
 FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, getSurvivalProbability )
@@ -245,6 +363,24 @@ FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, collideSurvivalBias )
   FRENSIE_CHECK_EQUAL( bank.size(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a neutron can collide with a material that has a unionized
+// energy grid
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, collideAnalogue_unionized )
+{
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setEnergy( 1.0 );
+  neutron.setWeight( 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  unionized_material->collideAnalogue( neutron, bank );
+
+  FRENSIE_CHECK_EQUAL( neutron.getWeight(), 1.0 );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -318,6 +454,25 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                                    nuclide_fractions,
                                                    nuclide_names ) );
 
+  unionized_material.reset( new MonteCarlo::NeutronMaterial( 0,
+                                                             -1.0,
+                                                             nuclide_map,
+                                                             nuclide_fractions,
+                                                             nuclide_names ) );
+
+  unionized_material->unionizeEnergyGrid( 1.0e-11, 2.0e1, 1e-3 );
+
+  node_shared_unionized_material.reset(
+                          new MonteCarlo::NeutronMaterial( 0,
+                                                           -1.0,
+                                                           nuclide_map,
+                                                           nuclide_fractions,
+                                                           nuclide_names ) );
+
+  node_shared_unionized_material->unionizeEnergyGrid(
+                           Utility::Communicator::getDefault()->splitByNode(),
+                           1.0e-11, 2.0e1, 1e-3 );
+
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
 }
@@ -164,6 +164,25 @@ FRENSIE_UNIT_TEST( Nuclide_hydrogen, getAbsorptionCrossSection )
   FRENSIE_CHECK_EQUAL( cross_section, 2.722354e-5 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the total and absorption cross sections can be returned with
+// a precomputed energy grid bin
+FRENSIE_UNIT_TEST( Nuclide_hydrogen, getCrossSection_energy_grid_bin )
+{
+  std::vector<double> energies( {1.0e-11, 1.03125e-11, 2.53e-8, 1.0, 1.95e1, 2.0e1} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    const size_t energy_grid_bin =
+      h1_nuclide->getEnergyGridBinIndex( energies[i] );
+
+    FRENSIE_CHECK_EQUAL( h1_nuclide->getTotalCrossSection( energies[i], energy_grid_bin ),
+                         h1_nuclide->getTotalCrossSection( energies[i] ) );
+    FRENSIE_CHECK_EQUAL( h1_nuclide->getAbsorptionCrossSection( energies[i], energy_grid_bin ),
+                         h1_nuclide->getAbsorptionCrossSection( energies[i] ) );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that the survival probability can be returned
 FRENSIE_UNIT_TEST( Nuclide_hydrogen, getSurvivalProbability )
@@ -9,7 +9,9 @@
 // FRENSIE Includes
 #include "MonteCarlo_AdjointPhotoatomFactory.hpp"
 #include "MonteCarlo_AdjointPhotoatomNativeFactory.hpp"
+#include "MonteCarlo_ScatteringCenterFactoryHelpers.hpp"
 #include "Data_AdjointElectronPhotonRelaxationDataContainer.hpp"
+#include "Data_DataContainerHelpers.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -32,7 +34,14 @@ AdjointPhotoatomFactory::AdjointPhotoatomFactory(
   FRENSIE_LOG_NOTIFICATION( "Starting to load adjoint photoatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
-  // Create each adjoint photoatom in the set
+  // The adjoint photoatoms that use each data table
+  std::vector<std::pair<std::string,AdjointPhotoatomNameMap::mapped_type*> >
+    adjoint_photoatom_tables;
+
+  // The loaders for each data table (every table is only loaded once)
+  std::vector<ScatteringCenterDataTableLoader> table_loaders;
+
+  // Find the data table used by each adjoint photoatom in the set
   ScatteringCenterNameSet::const_iterator adjoint_photoatom_name =
     adjoint_photoatom_names.begin();
 
@@ -65,42 +74,62 @@ AdjointPhotoatomFactory::AdjointPhotoatomFactory(
     else
       atomic_weight = adjoint_photoatom_data_properties.atomicWeight().value();
 
-    if( adjoint_photoatom_data_properties.fileType() ==
-        Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE )
-    {
-      // Initialize the adjoint photoatomic table name map for Native EPR
-      // files
-      if( d_adjoint_photoatomic_table_name_map.find( Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE ) ==
-          d_adjoint_photoatomic_table_name_map.end() )
-      {
-        d_adjoint_photoatomic_table_name_map[Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE];
-      }
-
-      this->createAdjointPhotoatomFromNativeTable(
-                                             data_directory,
-                                             *adjoint_photoatom_name,
-                                             atomic_weight,
-                                             adjoint_photoatom_data_properties,
-                                             properties );
-    }
-    else
+    TEST_FOR_EXCEPTION( adjoint_photoatom_data_properties.fileType() !=
+                        Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE,
+                        std::runtime_error,
+                        "Adjoint photoatom " << *adjoint_photoatom_name <<
+                        " cannot be created because its definition specifies "
+                        "the use of an adjoint photoatomic data file of type "
+                        << adjoint_photoatom_data_properties.fileType() <<
+                        ", which is currently unsupported!" );
+
+    const std::string table_key =
+      adjoint_photoatom_data_properties.filePath().string();
+
+    AdjointPhotoatomNameMap& table_name_map =
+      d_adjoint_photoatomic_table_name_map[adjoint_photoatom_data_properties.fileType()];
+
+    // Check if the table has already been scheduled for loading
+    if( table_name_map.find( table_key ) == table_name_map.end() )
     {
-      THROW_EXCEPTION( std::runtime_error,
-                       "Adjoint photoatom " << *adjoint_photoatom_name <<
-                       " cannot be created because its definition specifies "
-                       "the use of an adjoint photoatomic data file of type "
-                       << adjoint_photoatom_data_properties.fileType() <<
-                       ", which is currently unsupported!" );
+      const Data::AdjointPhotoatomicDataProperties* data_properties =
+        &adjoint_photoatom_data_properties;
+
+      AdjointPhotoatomNameMap::mapped_type* adjoint_photoatom =
+        &table_name_map[table_key];
+
+      table_loaders.push_back(
+        [this,&data_directory,&properties,atomic_weight,data_properties,adjoint_photoatom](){
+          this->createAdjointPhotoatomFromNativeTable( data_directory,
+                                                       atomic_weight,
+                                                       *data_properties,
+                                                       properties,
+                                                       *adjoint_photoatom ); } );
     }
 
+    adjoint_photoatom_tables.push_back(
+                            std::make_pair( *adjoint_photoatom_name,
+                                            &table_name_map[table_key] ) );
+
     ++adjoint_photoatom_name;
   }
 
+  // Load the data tables
+  loadScatteringCenterDataTables( table_loaders );
+
+  // Assign the loaded data tables to the adjoint photoatoms
+  for( size_t i = 0; i < adjoint_photoatom_tables.size(); ++i )
+  {
+    d_adjoint_photoatom_name_map[adjoint_photoatom_tables[i].first] =
+      *adjoint_photoatom_tables[i].second;
+  }
+
   // Make sure that every adjoint photoatom has been created
   testPostcondition( d_adjoint_photoatom_name_map.size() ==
                      adjoint_photoatom_names.size() );
 
-  FRENSIE_LOG_NOTIFICATION( "Finished loading adjoint photoatom data tables." );
+  FRENSIE_LOG_NOTIFICATION( "Finished loading adjoint photoatom data tables ("
+                            << table_loaders.size() << " tables)." );
   FRENSIE_FLUSH_ALL_LOGS();
 }
 
@@ -112,63 +141,41 @@ void AdjointPhotoatomFactory::createAdjointPhotoatomMap(
 }
 
 // Create an adjoint photoatom from a Native table
+/*! \details This method can be called concurrently for different tables.
+ */
 void AdjointPhotoatomFactory::createAdjointPhotoatomFromNativeTable(
                  const boost::filesystem::path& data_directory,
-                 const std::string& adjoint_photoatom_name,
                  const double atomic_weight,
                  const Data::AdjointPhotoatomicDataProperties& data_properties,
-                 const SimulationAdjointPhotonProperties& properties )
+                 const SimulationAdjointPhotonProperties& properties,
+                 AdjointPhotoatomNameMap::mapped_type& adjoint_photoatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_adjoint_photoatomic_table_name_map[Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE].find( data_properties.filePath().string() ) ==
-      d_adjoint_photoatomic_table_name_map[Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE].end() )
-  {
-    // Construct the path to the native file
-    boost::filesystem::path native_file_path = data_directory;
-    native_file_path /= data_properties.filePath();
-    native_file_path.make_preferred();
+  // Construct the path to the native file
+  boost::filesystem::path native_file_path = data_directory;
+  native_file_path /= data_properties.filePath();
+  native_file_path.make_preferred();
 
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                           "Loading native adjoint EPR cross section table (v "
-                           << data_properties.fileVersion() <<
-                           ") for " << data_properties.atom() <<
-                           " from " << native_file_path.string() <<
-                           " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
+  // Use the flat array archive export of the table if there is one
+  native_file_path = Data::resolveFlatArrayArchivePath( native_file_path );
 
-    // Create the aepr data container
-    Data::AdjointElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
+  // Create the aepr data container
+  Data::AdjointElectronPhotonRelaxationDataContainer
+    data_container( native_file_path );
 
-    // Initialize the new adjoint photoatom
-    AdjointPhotoatomNameMap::mapped_type& adjoint_photoatom =
-      d_adjoint_photoatom_name_map[adjoint_photoatom_name];
-
-    // Create the new adjoint photoatom
-    AdjointPhotoatomNativeFactory::createAdjointPhotoatom(
+  // Create the new adjoint photoatom
+  AdjointPhotoatomNativeFactory::createAdjointPhotoatom(
                                            data_container,
                                            data_properties.filePath().string(),
                                            atomic_weight,
                                            properties,
                                            adjoint_photoatom );
 
-    // Cache the new adjoint photoatom in the table name map
-    d_adjoint_photoatomic_table_name_map[Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()] = adjoint_photoatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
+  if( d_verbose )
   {
-    d_adjoint_photoatom_name_map[adjoint_photoatom_name] =
-      d_adjoint_photoatomic_table_name_map[Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()];
+    FRENSIE_LOG_NOTIFICATION( " Loaded native adjoint EPR cross section table "
+                              "(v " << data_properties.fileVersion() <<
+                              ") for " << data_properties.atom() <<
+                              " from " << native_file_path.string() << "." );
   }
 }
 
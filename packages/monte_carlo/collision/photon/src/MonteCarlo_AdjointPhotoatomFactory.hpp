@@ -59,10 +59,10 @@ private:
   // Create an adjoint photoatom from a Native table
   void createAdjointPhotoatomFromNativeTable(
                  const boost::filesystem::path& data_directory,
-                 const std::string& adjoint_photoatom_name,
                  const double atomic_weight,
                  const Data::AdjointPhotoatomicDataProperties& data_properties,
-                 const SimulationAdjointPhotonProperties& properties );
+                 const SimulationAdjointPhotonProperties& properties,
+                 AdjointPhotoatomNameMap::mapped_type& adjoint_photoatom ) const;
 
   // The adjoint photoatom map
   AdjointPhotoatomNameMap d_adjoint_photoatom_name_map;
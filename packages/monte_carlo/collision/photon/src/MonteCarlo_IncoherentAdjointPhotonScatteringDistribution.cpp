@@ -9,6 +9,7 @@
 // Std Lib Includes
 #include <limits>
 #include <functional>
+#include <array>
 
 // FRENSIE Includes
 #include "MonteCarlo_IncoherentAdjointPhotonScatteringDistribution.hpp"
@@ -362,16 +363,19 @@ void IncoherentAdjointPhotonScatteringDistribution::sampleAndRecordTrialsAdjoint
 
   double inverse_energy_gain_ratio;
 
+  // Three random numbers are required by the rejection scheme
+  std::array<double,3> random_numbers;
+
   while( true )
   {
     ++trials;
-    
-    const double random_number_1 =
-      Utility::RandomNumberGenerator::getRandomNumber<double>();
-    const double random_number_2 =
-      Utility::RandomNumberGenerator::getRandomNumber<double>();
-    const double random_number_3 =
-      Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+    Utility::RandomNumberGenerator::fillRandomNumbers(
+                             Utility::ArrayView<double>( random_numbers ) );
+
+    const double& random_number_1 = random_numbers[0];
+    const double& random_number_2 = random_numbers[1];
+    const double& random_number_3 = random_numbers[2];
 
     inverse_energy_gain_ratio = min_inverse_energy_gain_ratio +
       random_number_2*(1.0 - min_inverse_energy_gain_ratio);
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <limits>
+#include <array>
 
 // FRENSIE Includes
 #include "MonteCarlo_IncoherentPhotonScatteringDistribution.hpp"
@@ -103,37 +104,33 @@ void IncoherentPhotonScatteringDistribution::sampleAndRecordTrialsKleinNishina(
     const double branching_ratio = arg/(8.0 + arg);
 
     // Three random numbers are required by the rejection scheme
-    double random_number_1, random_number_2, random_number_3;
+    std::array<double,3> random_numbers;
 
     while( true )
     {
       // Generate new random numbers
-      random_number_1 =
-	Utility::RandomNumberGenerator::getRandomNumber<double>();
-      random_number_2 =
-	Utility::RandomNumberGenerator::getRandomNumber<double>();
-      random_number_3 =
-	Utility::RandomNumberGenerator::getRandomNumber<double>();
+      Utility::RandomNumberGenerator::fillRandomNumbers(
+                             Utility::ArrayView<double>( random_numbers ) );
 
       // Increment the number of trials
       ++trials;
 
       // Take the first branch
-      if( random_number_1 <= branching_ratio )
+      if( random_numbers[0] <= branching_ratio )
       {
-	x = 1.0 + 2.0*random_number_2*alpha;
+	x = 1.0 + 2.0*random_numbers[1]*alpha;
 
-	if( random_number_3 <= 4.0*(1.0/x - 1.0/(x*x)) )
+	if( random_numbers[2] <= 4.0*(1.0/x - 1.0/(x*x)) )
 	  break;
       }
       // Take the second branch
       else
       {
-	x = (arg)/(1.0 + 2.0*random_number_2*alpha);
+	x = (arg)/(1.0 + 2.0*random_numbers[1]*alpha);
 
 	double branch_arg = (1.0 - x)/alpha + 1.0;
 
-	if( 2*random_number_3 <= branch_arg*branch_arg + 1.0/x )
+	if( 2*random_numbers[2] <= branch_arg*branch_arg + 1.0/x )
 	  break;
       }
     }
@@ -158,19 +155,19 @@ void IncoherentPhotonScatteringDistribution::sampleAndRecordTrialsKleinNishina(
     p4 /= norm;
 
     // Sample from the individual pdfs
-    double random_number_1 =
-      Utility::RandomNumberGenerator::getRandomNumber<double>();
-    double random_number_2 =
-      Utility::RandomNumberGenerator::getRandomNumber<double>();
-
-    if( random_number_1 <= p1 )
-      x = 1.0 + 2.0*alpha*random_number_2;
-    else if( random_number_1 <= p1+p2 )
-      x = pow( arg, random_number_2 );
-    else if( random_number_1 <= p1+p2+p3 )
-      x = arg/(1.0 + 2.0*alpha*random_number_2 );
+    std::array<double,2> random_numbers;
+
+    Utility::RandomNumberGenerator::fillRandomNumbers(
+                             Utility::ArrayView<double>( random_numbers ) );
+
+    if( random_numbers[0] <= p1 )
+      x = 1.0 + 2.0*alpha*random_numbers[1];
+    else if( random_numbers[0] <= p1+p2 )
+      x = pow( arg, random_numbers[1] );
+    else if( random_numbers[0] <= p1+p2+p3 )
+      x = arg/(1.0 + 2.0*alpha*random_numbers[1] );
     else
-      x = 1.0/sqrt(1.0 - random_number_2*(1.0 - 1.0/(arg*arg)));
+      x = 1.0/sqrt(1.0 - random_numbers[1]*(1.0 - 1.0/(arg*arg)));
   }
 
   // Calculate the outgoing energy
@@ -10,9 +10,11 @@
 #include "MonteCarlo_PhotoatomFactory.hpp"
 #include "MonteCarlo_PhotoatomACEFactory.hpp"
 #include "MonteCarlo_PhotoatomNativeFactory.hpp"
+#include "MonteCarlo_ScatteringCenterFactoryHelpers.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSEPRDataExtractor.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Data_DataContainerHelpers.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
@@ -37,7 +39,14 @@ PhotoatomFactory::PhotoatomFactory(
   FRENSIE_LOG_NOTIFICATION( "Starting to load photoatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
   
-  // Create each photoatom in the set
+  // The photoatoms that use each data table
+  std::vector<std::pair<std::string,PhotoatomNameMap::mapped_type*> >
+    photoatom_tables;
+
+  // The loaders for each data table (every table is only loaded once)
+  std::vector<ScatteringCenterDataTableLoader> table_loaders;
+
+  // Find the data table used by each photoatom in the set
   ScatteringCenterNameSet::const_iterator photoatom_name =
     photoatom_names.begin();
 
@@ -63,39 +72,17 @@ PhotoatomFactory::PhotoatomFactory(
     const Data::PhotoatomicDataProperties& photoatom_data_properties =
       photoatom_definition.getPhotoatomicDataProperties( &atomic_weight );
 
+    std::string table_key;
+
     if( photoatom_data_properties.fileType() ==
         Data::PhotoatomicDataProperties::ACE_EPR_FILE )
     {
-      // Initialize the photoatomic table name map for ACE_EPR files
-      if( d_photoatomic_table_name_map.find( Data::PhotoatomicDataProperties::ACE_EPR_FILE ) ==
-          d_photoatomic_table_name_map.end() )
-      {
-        d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE];
-      }
-        
-      this->createPhotoatomFromACETable( data_directory,
-                                         *photoatom_name,
-                                         atomic_weight,
-                                         photoatom_data_properties,
-                                         atomic_relaxation_model_factory,
-                                         properties );
+      table_key = photoatom_data_properties.tableName();
     }
     else if( photoatom_data_properties.fileType() ==
              Data::PhotoatomicDataProperties::Native_EPR_FILE )
     {
-      // Initialize the photoatomic table name map for Native EPR files
-      if( d_photoatomic_table_name_map.find( Data::PhotoatomicDataProperties::Native_EPR_FILE ) ==
-          d_photoatomic_table_name_map.end() )
-      {
-        d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE];
-      }
-      
-      this->createPhotoatomFromNativeTable( data_directory,
-                                            *photoatom_name,
-                                            atomic_weight,
-                                            photoatom_data_properties,
-                                            atomic_relaxation_model_factory,
-                                            properties );
+      table_key = photoatom_data_properties.filePath().string();
     }
     else
     {
@@ -107,13 +94,64 @@ PhotoatomFactory::PhotoatomFactory(
                        ", which is currently unsupported!" );
     }
 
+    PhotoatomNameMap& table_name_map =
+      d_photoatomic_table_name_map[photoatom_data_properties.fileType()];
+
+    // Check if the table has already been scheduled for loading
+    if( table_name_map.find( table_key ) == table_name_map.end() )
+    {
+      const Data::PhotoatomicDataProperties* data_properties =
+        &photoatom_data_properties;
+
+      PhotoatomNameMap::mapped_type* photoatom = &table_name_map[table_key];
+
+      if( data_properties->fileType() ==
+          Data::PhotoatomicDataProperties::ACE_EPR_FILE )
+      {
+        table_loaders.push_back(
+          [this,&data_directory,&atomic_relaxation_model_factory,&properties,atomic_weight,data_properties,photoatom](){
+            this->createPhotoatomFromACETable( data_directory,
+                                               atomic_weight,
+                                               *data_properties,
+                                               atomic_relaxation_model_factory,
+                                               properties,
+                                               *photoatom ); } );
+      }
+      else
+      {
+        table_loaders.push_back(
+          [this,&data_directory,&atomic_relaxation_model_factory,&properties,atomic_weight,data_properties,photoatom](){
+            this->createPhotoatomFromNativeTable(
+                                               data_directory,
+                                               atomic_weight,
+                                               *data_properties,
+                                               atomic_relaxation_model_factory,
+                                               properties,
+                                               *photoatom ); } );
+      }
+    }
+
+    photoatom_tables.push_back( std::make_pair( *photoatom_name,
+                                                &table_name_map[table_key] ) );
+
     ++photoatom_name;
   }
 
+  // Load the data tables
+  loadScatteringCenterDataTables( table_loaders );
+
+  // Assign the loaded data tables to the photoatoms
+  for( size_t i = 0; i < photoatom_tables.size(); ++i )
+  {
+    d_photoatom_name_map[photoatom_tables[i].first] =
+      *photoatom_tables[i].second;
+  }
+
   // Make sure that every photoatom has been created
   testPostcondition( d_photoatom_name_map.size() == photoatom_names.size() );
 
-  FRENSIE_LOG_NOTIFICATION( "Finished loading photoatom data tables." );
+  FRENSIE_LOG_NOTIFICATION( "Finished loading photoatom data tables ("
+                            << table_loaders.size() << " tables)." );
   FRENSIE_FLUSH_ALL_LOGS();
 }
 
@@ -125,157 +163,108 @@ void PhotoatomFactory::createPhotoatomMap(
 }
 
 // Create a photoatom from an ACE table
+/*! \details This method can be called concurrently for different tables.
+ */
 void PhotoatomFactory::createPhotoatomFromACETable(
 			const boost::filesystem::path& data_directory,
-                        const std::string& photoatom_name,
                         const double atomic_weight,
 			const Data::PhotoatomicDataProperties& data_properties,
                         const std::shared_ptr<AtomicRelaxationModelFactory>&
                         atomic_relaxation_model_factory,
-                        const SimulationProperties& properties )
+                        const SimulationProperties& properties,
+                        PhotoatomNameMap::mapped_type& photoatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE].find( data_properties.tableName() ) ==
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE].end() )
-  {
-    // Construct the the path to the data file
-    boost::filesystem::path ace_file_path = data_directory;
-    ace_file_path /= data_properties.filePath();
-    ace_file_path.make_preferred();
-    
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                   " Loading ACE EPR photoatomic cross section "
-                                   "table " << data_properties.tableName() <<
-                                   " from " << ace_file_path.string() <<
-                                   " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-    
-    // Create the ACEFileHandler
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-					   data_properties.tableName(),
-					   data_properties.fileStartLine(),
-					   true );
-
-    // Create the XSS data extractor
-    Data::XSSEPRDataExtractor xss_data_extractor(
-					 ace_file_handler.getTableNXSArray(),
-					 ace_file_handler.getTableJXSArray(),
-					 ace_file_handler.getTableXSSArray() );
-
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
-
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+  // Construct the the path to the data file
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  // Create the ACEFileHandler
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         data_properties.tableName(),
+                                         data_properties.fileStartLine(),
+                                         true );
+
+  // Create the XSS data extractor
+  Data::XSSEPRDataExtractor xss_data_extractor(
+                                         ace_file_handler.getTableNXSArray(),
+                                         ace_file_handler.getTableJXSArray(),
+                                         ace_file_handler.getTableXSSArray() );
+
+  // Create the atomic relaxation model
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+
+  atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
                                xss_data_extractor,
                                atomic_relaxation_model,
                                properties.getMinPhotonEnergy(),
                                properties.getMinElectronEnergy(),
-			       properties.isAtomicRelaxationModeOn( PHOTON ) );
-
-    // Initialize the new photoatom
-    PhotoatomNameMap::mapped_type& photoatom =
-      d_photoatom_name_map[photoatom_name];
+                               properties.isAtomicRelaxationModeOn( PHOTON ) );
 
-    // Create the new photoatom
-    PhotoatomACEFactory::createPhotoatom(
-                                        xss_data_extractor,
+  // Create the new photoatom
+  PhotoatomACEFactory::createPhotoatom( xss_data_extractor,
                                         data_properties.tableName(),
                                         atomic_weight,
                                         atomic_relaxation_model,
                                         properties,
                                         photoatom );
-    
-    // Cache the new photoatom in the table name map
-    d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()] = photoatom;
 
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
+  if( d_verbose )
   {
-    d_photoatom_name_map[photoatom_name] =
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()];
+    FRENSIE_LOG_NOTIFICATION( " Loaded ACE EPR photoatomic cross section "
+                              "table " << data_properties.tableName() <<
+                              " from " << ace_file_path.string() << "." );
   }
 }
 
 // Create a photoatom from a Native table
+/*! \details This method can be called concurrently for different tables.
+ */
 void PhotoatomFactory::createPhotoatomFromNativeTable(
 			const boost::filesystem::path& data_directory,
-                        const std::string& photoatom_name,
                         const double atomic_weight,
                         const Data::PhotoatomicDataProperties& data_properties,
                         const std::shared_ptr<AtomicRelaxationModelFactory>&
                         atomic_relaxation_model_factory,
-                        const SimulationProperties& properties )
+                        const SimulationProperties& properties,
+                        PhotoatomNameMap::mapped_type& photoatom ) const
 {
-  // Check if the table has already been loaded
-  if( d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE].find( data_properties.filePath().string() ) ==
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE].end() )
-  {
-    // Construct the path to the native file
-    boost::filesystem::path native_file_path = data_directory;
-    native_file_path /= data_properties.filePath();
-    native_file_path.make_preferred();
+  // Construct the path to the native file
+  boost::filesystem::path native_file_path = data_directory;
+  native_file_path /= data_properties.filePath();
+  native_file_path.make_preferred();
 
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                " Loading native EPR cross section table "
-                                "(v " << data_properties.fileVersion() <<
-                                ") for " << data_properties.atom() <<
-                                " from " << native_file_path.string() <<
-                                " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-    
-    // Create the epr data container
-    Data::ElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
+  // Use the flat array archive export of the table if there is one
+  native_file_path = Data::resolveFlatArrayArchivePath( native_file_path );
+
+  // Create the epr data container
+  Data::ElectronPhotonRelaxationDataContainer
+    data_container( native_file_path );
 
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+  // Create the atomic relaxation model
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
 
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+  atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
                                data_container,
                                atomic_relaxation_model,
                                properties.getMinPhotonEnergy(),
                                properties.getMinElectronEnergy(),
                                properties.isAtomicRelaxationModeOn( PHOTON ) );
 
-    // Initialize the new photoatom
-    PhotoatomNameMap::mapped_type& photoatom =
-      d_photoatom_name_map[photoatom_name];
-
-    // Create the new photoatom
-    PhotoatomNativeFactory::createPhotoatom(
-                                           data_container,
+  // Create the new photoatom
+  PhotoatomNativeFactory::createPhotoatom( data_container,
                                            data_properties.filePath().string(),
                                            atomic_weight,
                                            atomic_relaxation_model,
                                            properties,
                                            photoatom );
 
-    // Cache the new photoatom in the table name map
-    d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()] = photoatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
+  if( d_verbose )
   {
-    d_photoatom_name_map[photoatom_name] =
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()];
+    FRENSIE_LOG_NOTIFICATION( " Loaded native EPR cross section table "
+                              "(v " << data_properties.fileVersion() <<
+                              ") for " << data_properties.atom() <<
+                              " from " << native_file_path.string() << "." );
   }
 }
 
@@ -62,22 +62,22 @@ private:
   // Create a photoatom from an ACE table
   void createPhotoatomFromACETable(
                         const boost::filesystem::path& data_directory,
-                        const std::string& photoatom_name,
                         const double atomic_weight,
-			const Data::PhotoatomicDataProperties& data_properties,
+                        const Data::PhotoatomicDataProperties& data_properties,
                         const std::shared_ptr<AtomicRelaxationModelFactory>&
                         atomic_relaxation_model_factory,
-                        const SimulationProperties& properties );
+                        const SimulationProperties& properties,
+                        PhotoatomNameMap::mapped_type& photoatom ) const;
 
   // Create a photoatom from a Native table
   void createPhotoatomFromNativeTable(
-			const boost::filesystem::path& data_directory,
-                        const std::string& photoatom_name,
+                        const boost::filesystem::path& data_directory,
                         const double atomic_weight,
                         const Data::PhotoatomicDataProperties& data_properties,
                         const std::shared_ptr<AtomicRelaxationModelFactory>&
                         atomic_relaxation_model_factory,
-                        const SimulationProperties& properties );
+                        const SimulationProperties& properties,
+                        PhotoatomNameMap::mapped_type& photoatom ) const;
 
   // The photoatom map
   PhotoatomNameMap d_photoatom_name_map;
@@ -197,6 +197,49 @@ FRENSIE_UNIT_TEST( PhotoatomCore, getReactionTypes )
   FRENSIE_CHECK( reaction_types.count( MonteCarlo::TOTAL_ABSORPTION_PHOTOATOMIC_REACTION ) );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the reaction cross section tables can be returned
+FRENSIE_UNIT_TEST( PhotoatomCore, getReactionTables )
+{
+  FRENSIE_REQUIRE( ace_photoatom_core->hasReactionCrossSectionTables() );
+
+  const MonteCarlo::PhotoatomCore::ReactionTable& scattering_table =
+    ace_photoatom_core->getScatteringReactionTable();
+
+  FRENSIE_REQUIRE_EQUAL( scattering_table.getNumberOfReactions(), 1 );
+  FRENSIE_CHECK_EQUAL( scattering_table.getReaction( 0 ).getReactionType(),
+                       MonteCarlo::PAIR_PRODUCTION_PHOTOATOMIC_REACTION );
+
+  const MonteCarlo::PhotoatomCore::ReactionTable& absorption_table =
+    ace_photoatom_core->getAbsorptionReactionTable();
+
+  FRENSIE_REQUIRE_EQUAL( absorption_table.getNumberOfReactions(), 1 );
+  FRENSIE_CHECK_EQUAL( absorption_table.getReaction( 0 ).getReactionType(),
+                       MonteCarlo::TOTAL_PHOTOELECTRIC_PHOTOATOMIC_REACTION );
+
+  // The table energy grid is not processed
+  double energy = exp( 1.151292546497E+01 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_table.getEnergyGrid().back(),
+                                   energy,
+                                   1e-12 );
+
+  size_t energy_grid_bin =
+    ace_photoatom_core->getGridSearcher().findLowerBinIndex( energy );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                  scattering_table.getCrossSection( energy, energy_grid_bin, 0 ),
+                  exp( 3.718032834377E+00 ),
+                  1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                  absorption_table.getCrossSection( energy, energy_grid_bin, 0 ),
+                  exp( -1.115947249407E+01 ),
+                  1e-12 );
+  FRENSIE_CHECK_EQUAL(
+            scattering_table.sampleReactionIndex( 0.5, energy, energy_grid_bin ),
+            0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the atomic relaxation model can be returned
 FRENSIE_UNIT_TEST( PhotoatomCore, getAtomicRelaxationModel )
@@ -93,6 +93,14 @@ AdjointElectronProbeState* AdjointElectronProbeState::clone() const
   return new AdjointElectronProbeState( *this, false, false );
 }
 
+// Copy the state of another probe into this probe (the probe will be inactive)
+void AdjointElectronProbeState::copyState( const ParticleState& existing_state )
+{
+  AdjointElectronState::copyState( existing_state );
+
+  d_active = false;
+}
+
 
 // Print the adjoint electron state
 void AdjointElectronProbeState::toStream( std::ostream& os ) const
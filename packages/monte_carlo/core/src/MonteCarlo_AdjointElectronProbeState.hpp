@@ -70,6 +70,9 @@ public:
   //! Clone the particle state (do not use to generate new particles!)
   AdjointElectronProbeState* clone() const;
 
+  //! Copy the state of another probe into this probe (the probe will be inactive)
+  void copyState( const ParticleState& existing_state ) override;
+
   //! Print the adjoint electron state
   void toStream( std::ostream& os ) const;
 
@@ -92,6 +92,14 @@ AdjointPhotonProbeState* AdjointPhotonProbeState::clone() const
   return new AdjointPhotonProbeState( *this, false, false );
 }
 
+// Copy the state of another probe into this probe (the probe will be inactive)
+void AdjointPhotonProbeState::copyState( const ParticleState& existing_state )
+{
+  AdjointPhotonState::copyState( existing_state );
+
+  d_active = false;
+}
+
 // Print the adjoint photon state
 void AdjointPhotonProbeState::toStream( std::ostream& os ) const
 {
@@ -69,6 +69,9 @@ public:
   //! Clone the particle state (do not use to generate new particles!)
   AdjointPhotonProbeState* clone() const;
 
+  //! Copy the state of another probe into this probe (the probe will be inactive)
+  void copyState( const ParticleState& existing_state ) override;
+
   //! Print the adjoint photon state
   void toStream( std::ostream& os ) const;
 
@@ -0,0 +1,111 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_HistoryScheduleType.hpp
+//! \author Alex Robinson
+//! \brief  History schedule type enumeration and helper function decls.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_HISTORY_SCHEDULE_TYPE_HPP
+#define MONTE_CARLO_HISTORY_SCHEDULE_TYPE_HPP
+
+// Std Lib Includes
+#include <string>
+#include <iostream>
+
+// FRENSIE Includes
+#include "Utility_ToStringTraits.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace MonteCarlo{
+
+/*! The history schedule type enum
+ *
+ * The schedule determines how the histories in a batch are distributed over
+ * the threads. When adding a new type the ToStringTraits methods and the
+ * serialization method must be updated.
+ */
+enum HistoryScheduleType{
+  STATIC_HISTORY_SCHEDULE = 0,
+  DYNAMIC_HISTORY_SCHEDULE,
+  GUIDED_HISTORY_SCHEDULE,
+  WORK_STEALING_HISTORY_SCHEDULE
+};
+
+} // end MonteCarlo namespace
+
+namespace Utility{
+
+/*! \brief Specialization of Utility::ToStringTraits for
+ * MonteCarlo::HistoryScheduleType
+ * \ingroup to_string_traits
+ */
+template<>
+struct ToStringTraits<MonteCarlo::HistoryScheduleType>
+{
+  //! Convert a MonteCarlo::HistoryScheduleType to a string
+  static std::string toString( const MonteCarlo::HistoryScheduleType type );
+
+  //! Place the MonteCarlo::HistoryScheduleType in a stream
+  static void toStream( std::ostream& os,
+                        const MonteCarlo::HistoryScheduleType type );
+};
+
+} // end Utility namespace
+
+namespace std{
+
+//! Stream operator for printing HistoryScheduleType enums
+inline std::ostream& operator<<( std::ostream& os,
+                                 const MonteCarlo::HistoryScheduleType type )
+{
+  os << Utility::toString( type );
+  return os;
+}
+
+} // end std namespace
+
+namespace boost{
+
+namespace serialization{
+
+//! Serialize the MonteCarlo::HistoryScheduleType enum
+template<typename Archive>
+void serialize( Archive& archive,
+                MonteCarlo::HistoryScheduleType& type,
+                const unsigned version )
+{
+  if( Archive::is_saving::value )
+    archive & (int)type;
+  else
+  {
+    int raw_type;
+
+    archive & raw_type;
+
+    switch( raw_type )
+    {
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::STATIC_HISTORY_SCHEDULE, int, type );
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::DYNAMIC_HISTORY_SCHEDULE, int, type );
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::GUIDED_HISTORY_SCHEDULE, int, type );
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE, int, type );
+      default:
+      {
+        THROW_EXCEPTION( std::logic_error,
+                         "Cannot convert the deserialized raw history "
+                         "schedule type to its corresponding enum value!" );
+      }
+    }
+  }
+}
+
+} // end serialization namespace
+
+} // end boost namespace
+
+#endif // end MONTE_CARLO_HISTORY_SCHEDULE_TYPE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_HistoryScheduleType.hpp
+//---------------------------------------------------------------------------//
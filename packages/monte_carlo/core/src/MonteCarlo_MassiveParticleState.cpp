@@ -114,6 +114,14 @@ void MassiveParticleState::setSpeed( const double speed )
                                                      d_speed ) );
 }
 
+// Copy the state of another particle of the same type into this particle
+void MassiveParticleState::copyState( const ParticleState& existing_state )
+{
+  ParticleState::copyState( existing_state );
+
+  d_speed = static_cast<const MassiveParticleState&>( existing_state ).d_speed;
+}
+
 // Calculate the time to traverse a distance
 ParticleState::timeType
 MassiveParticleState::calculateTraversalTime( const double distance ) const
@@ -69,6 +69,9 @@ public:
   //! Return the rest mass energy of the particle (MeV)
   virtual double getRestMassEnergy() const = 0;
 
+  //! Copy the state of another particle of the same type into this particle
+  void copyState( const ParticleState& existing_state ) override;
+
 private:
 
   // Calculate the time to traverse a distance
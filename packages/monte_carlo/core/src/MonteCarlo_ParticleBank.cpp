@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <algorithm>
+#include <typeinfo>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
@@ -16,21 +17,55 @@
 
 namespace MonteCarlo{
 
+// Initialize static member data
+const size_t ParticleBank::s_max_recycled_states_per_type = 256;
+
 // Default Constructor
 ParticleBank::ParticleBank()
-  : d_particle_states()
+  : d_pooled_mode( false ),
+    d_particle_states(),
+    d_pooled_particle_states(),
+    d_recycled_particle_states()
+{ /* ... */ }
+
+// Constructor
+ParticleBank::ParticleBank( const bool pooled_mode )
+  : d_pooled_mode( pooled_mode ),
+    d_particle_states(),
+    d_pooled_particle_states(),
+    d_recycled_particle_states( pooled_mode ? ParticleType_END : 0 )
 { /* ... */ }
 
 // Check if the bank is empty
 bool ParticleBank::isEmpty() const
 {
-  return d_particle_states.size() == 0;
+  return this->size() == 0;
 }
 
 // The size of the bank
 unsigned long long ParticleBank::size() const
 {
-  return d_particle_states.size();
+  if( d_pooled_mode )
+    return d_pooled_particle_states.size();
+  else
+    return d_particle_states.size();
+}
+
+// Check if pooled (LIFO) mode is on
+bool ParticleBank::isPooledModeOn() const
+{
+  return d_pooled_mode;
+}
+
+// Return the number of recycled particle states
+size_t ParticleBank::getNumberOfRecycledStates() const
+{
+  size_t number_of_recycled_states = 0;
+
+  for( size_t i = 0; i < d_recycled_particle_states.size(); ++i )
+    number_of_recycled_states += d_recycled_particle_states[i].size();
+
+  return number_of_recycled_states;
 }
 
 // Access the top element
@@ -39,7 +74,10 @@ ParticleState& ParticleBank::top()
   // Make sure there is at least one particle in the bank
   testPrecondition( this->size() > 0 );
 
-  return *d_particle_states.front();
+  if( d_pooled_mode )
+    return *d_pooled_particle_states.back();
+  else
+    return *d_particle_states.front();
 }
 
 // Access the top element
@@ -48,7 +86,10 @@ const ParticleState& ParticleBank::top() const
   // Make sure there is at least one particle in the bank
   testPrecondition( this->size() > 0 );
 
-  return *d_particle_states.front();
+  if( d_pooled_mode )
+    return *d_pooled_particle_states.back();
+  else
+    return *d_particle_states.front();
 }
 
 // Push a particle to the bank
@@ -57,7 +98,36 @@ const ParticleState& ParticleBank::top() const
  */
 void ParticleBank::push( const ParticleState& particle )
 {
-  d_particle_states.emplace_back( particle.clone() );
+  if( d_pooled_mode )
+    this->pushPooled( particle );
+  else
+    d_particle_states.emplace_back( particle.clone() );
+}
+
+// Push a particle to the bank (pooled mode)
+/*! \details If a recycled particle state of the same type is available the
+ * particle will be copied into it (the navigator of the recycled state will
+ * also be reused when possible). Otherwise a clone of the particle will be
+ * created.
+ */
+void ParticleBank::pushPooled( const ParticleState& particle )
+{
+  PooledBankContainerType& recycled_particle_states =
+    d_recycled_particle_states[particle.getParticleType()];
+
+  // Probe states share a particle type with the standard states so the
+  // dynamic type must also be checked
+  if( !recycled_particle_states.empty() &&
+      typeid(*recycled_particle_states.back()) == typeid(particle) )
+  {
+    d_pooled_particle_states.push_back( recycled_particle_states.back() );
+
+    recycled_particle_states.pop_back();
+
+    d_pooled_particle_states.back()->copyState( particle );
+  }
+  else
+    d_pooled_particle_states.emplace_back( particle.clone() );
 }
 
 // Insert a neutron into the bank after an interaction (Most Efficient/Recommended)
@@ -90,12 +160,77 @@ void ParticleBank::pop()
   // Make sure the bank is not empty
   testPrecondition( !this->isEmpty() );
 
-  d_particle_states.pop_front();
+  if( d_pooled_mode )
+  {
+    std::shared_ptr<ParticleState> particle;
+
+    particle.swap( d_pooled_particle_states.back() );
+
+    d_pooled_particle_states.pop_back();
+
+    this->recycle( particle );
+  }
+  else
+    d_particle_states.pop_front();
+}
+
+// Release the top particle from the bank (without cloning it)
+/*! \details Unlike the pop member function that takes a smart pointer, the
+ * top particle will not be cloned - ownership of the particle will simply
+ * be transferred to the input pointer. Once the particle is no longer needed
+ * it can be returned to the bank using the recycle member function.
+ */
+void ParticleBank::releaseTop( std::shared_ptr<ParticleState>& particle )
+{
+  // Make sure the bank is not empty
+  testPrecondition( !this->isEmpty() );
+
+  if( d_pooled_mode )
+  {
+    particle.swap( d_pooled_particle_states.back() );
+
+    d_pooled_particle_states.pop_back();
+  }
+  else
+  {
+    particle.swap( d_particle_states.front() );
+
+    d_particle_states.pop_front();
+  }
+}
+
+// Return a particle that is no longer needed to the bank
+/*! \details In pooled mode the particle state will be stored so that it can
+ * be reused by a later push (as long as the bank has sole ownership of it).
+ * Otherwise the particle state will simply be released. The input pointer
+ * will be reset.
+ */
+void ParticleBank::recycle( std::shared_ptr<ParticleState>& particle )
+{
+  if( d_pooled_mode && particle.use_count() == 1 )
+  {
+    PooledBankContainerType& recycled_particle_states =
+      d_recycled_particle_states[particle->getParticleType()];
+
+    if( recycled_particle_states.size() < s_max_recycled_states_per_type )
+      recycled_particle_states.push_back( particle );
+  }
+
+  particle.reset();
 }
 
 // Check if the bank is sorted
 bool ParticleBank::isSorted( const CompareFunctionType& compare_function )
 {
+  if( d_pooled_mode )
+  {
+    return std::is_sorted( d_pooled_particle_states.rbegin(),
+                           d_pooled_particle_states.rend(),
+                           std::bind<bool>(compare_function,
+                                           std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
+                                           std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_2) ) );
+  }
+
   return std::is_sorted( d_particle_states.begin(),
 			 d_particle_states.end(),
 			 std::bind<bool>(compare_function,
@@ -106,9 +241,20 @@ bool ParticleBank::isSorted( const CompareFunctionType& compare_function )
 // Sort the particle states
 bool ParticleBank::sort( const CompareFunctionType& compare_function )
 {
-  d_particle_states.sort( std::bind<bool>(compare_function,
+  if( d_pooled_mode )
+  {
+    std::stable_sort( d_pooled_particle_states.rbegin(),
+                      d_pooled_particle_states.rend(),
+                      std::bind<bool>(compare_function,
+                                      std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
+                                      std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_2) ) );
+  }
+  else
+  {
+    d_particle_states.sort( std::bind<bool>(compare_function,
 					    std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
 					    std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_2) ) );
+  }
 }
 
 // Merge the bank with another bank
@@ -122,23 +268,66 @@ void ParticleBank::merge( ParticleBank& other_bank,
   testPrecondition( this->isSorted( compare_function ) );
   testPrecondition( other_bank.isSorted( compare_function ) );
 
+  // The merge is done on the lists (in pop order)
+  if( d_pooled_mode )
+    this->moveStackToList( d_particle_states );
+
+  if( other_bank.d_pooled_mode )
+    other_bank.moveStackToList( other_bank.d_particle_states );
+
   d_particle_states.merge( other_bank.d_particle_states,
 			   std::bind<bool>(compare_function,
 					     std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
 					     std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_2) ) );
+
+  if( d_pooled_mode )
+    this->moveListToStack( d_particle_states );
 }
 
 // Splice the bank with another bank
 /*! The contents of the input bank are added to the end of this bank. The
- * input bank will be emptied by this operation.
+ * input bank will be emptied by this operation. In pooled mode the contents
+ * of the input bank are added to the top of this bank (the order of the
+ * input bank particles will be preserved).
  */
 void ParticleBank::splice( ParticleBank& other_bank )
 {
-  d_particle_states.splice( d_particle_states.end(),
-			    other_bank.d_particle_states );
+  if( other_bank.d_pooled_mode )
+    other_bank.moveStackToList( other_bank.d_particle_states );
+
+  if( d_pooled_mode )
+    this->moveListToStack( other_bank.d_particle_states );
+  else
+  {
+    d_particle_states.splice( d_particle_states.end(),
+                              other_bank.d_particle_states );
+  }
+}
+
+// Move the particles in the pooled stack to a list (in pop order)
+void ParticleBank::moveStackToList( BankContainerType& particle_states )
+{
+  particle_states.insert( particle_states.end(),
+                          d_pooled_particle_states.rbegin(),
+                          d_pooled_particle_states.rend() );
+
+  d_pooled_particle_states.clear();
+}
+
+// Move the particles in a list to the top of the pooled stack
+/*! \details The first particle in the list will be the new top particle.
+ * The list will be emptied by this operation.
+ */
+void ParticleBank::moveListToStack( BankContainerType& particle_states )
+{
+  d_pooled_particle_states.insert( d_pooled_particle_states.end(),
+                                   particle_states.rbegin(),
+                                   particle_states.rend() );
+
+  particle_states.clear();
 }
 
-EXPLICIT_CLASS_SERIALIZE_INST( ParticleBank );
+EXPLICIT_CLASS_SAVE_LOAD_INST( ParticleBank );
 
 } // end MonteCarlo namespace
 
@@ -24,10 +24,20 @@
 #include "MonteCarlo_NeutronState.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_List.hpp"
+#include "Utility_Vector.hpp"
 
 namespace MonteCarlo{
 
-//! The particle bank base class (FIFO)
+/*! The particle bank base class (FIFO)
+ * \details The bank can also be constructed in pooled mode. In pooled mode
+ * the particles will be stored in a stack (LIFO) and the particle states
+ * that are popped from the bank will be recycled (for each particle type)
+ * instead of being deallocated. Particle states that are pushed to the bank
+ * by reference will be copied into a recycled particle state (and its
+ * navigator) when one is available. This avoids most of the allocations that
+ * are required when a large number of secondary particles are created in a
+ * history. Pooled banks should not be shared between threads.
+ */
 class ParticleBank
 {
 
@@ -39,6 +49,9 @@ public:
   //! Default Constructor
   ParticleBank();
 
+  //! Constructor
+  explicit ParticleBank( const bool pooled_mode );
+
   //! Destructor
   virtual ~ParticleBank()
   { /* ... */ }
@@ -49,6 +62,12 @@ public:
   //! The size of the bank
   unsigned long long size() const;
 
+  //! Check if pooled (LIFO) mode is on
+  bool isPooledModeOn() const;
+
+  //! Return the number of recycled particle states
+  size_t getNumberOfRecycledStates() const;
+
   //! Access the top element
   ParticleState& top();
 
@@ -86,6 +105,12 @@ public:
   template<template<typename> class SmartPointer>
   void pop( SmartPointer<ParticleState>& particle );
 
+  //! Release the top particle from the bank (without cloning it)
+  void releaseTop( std::shared_ptr<ParticleState>& particle );
+
+  //! Return a particle that is no longer needed to the bank
+  void recycle( std::shared_ptr<ParticleState>& particle );
+
   //! Check if the bank is sorted
   virtual bool isSorted( const CompareFunctionType& compare_function );
 
@@ -104,22 +129,51 @@ protected:
   //! The bank container type
   typedef std::list<std::shared_ptr<ParticleState> > BankContainerType;
 
+  //! The pooled bank container type
+  typedef std::vector<std::shared_ptr<ParticleState> > PooledBankContainerType;
+
 private:
 
   // Dereference a smart ptr
   static const ParticleState& dereference(
                                const std::shared_ptr<ParticleState>& pointer );
 
+  // Push a particle to the bank (pooled mode)
+  void pushPooled( const ParticleState& particle );
+
+  // Move the particles in the pooled stack to a list (in pop order)
+  void moveStackToList( BankContainerType& particle_states );
+
+  // Move the particles in a list to the top of the pooled stack
+  void moveListToStack( BankContainerType& particle_states );
+
   // Save the bank to an archive
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version )
-  { ar & BOOST_SERIALIZATION_NVP(d_particle_states); }
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the bank from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
 
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
+  // The max number of recycled particle states of each particle type
+  static const size_t s_max_recycled_states_per_type;
+
+  // Records if pooled (LIFO) mode is on
+  bool d_pooled_mode;
+
   // A list of particle states
   BankContainerType d_particle_states;
+
+  // A stack of particle states (pooled mode)
+  PooledBankContainerType d_pooled_particle_states;
+
+  // The recycled particle states of each particle type (pooled mode)
+  std::vector<PooledBankContainerType> d_recycled_particle_states;
 };
 
 // Dereference a smart pointer
@@ -132,7 +186,7 @@ inline const ParticleState& ParticleBank::dereference(
 } // end MonteCarlo namespace
 
 BOOST_SERIALIZATION_CLASS_VERSION( ParticleBank, MonteCarlo, 0 );
-EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleBank );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, ParticleBank );
 
 //---------------------------------------------------------------------------//
 // Template Includes
@@ -46,7 +46,10 @@ void ParticleBank::push( std::shared_ptr<State>& particle )
   // If this pointer is unique we can simply take it
   if( particle.use_count() == 1 )
   {
-    d_particle_states.push_back( particle );
+    if( d_pooled_mode )
+      d_pooled_particle_states.push_back( particle );
+    else
+      d_particle_states.push_back( particle );
   }
   // The pointer is not unique - make a clone
   else
@@ -83,6 +86,41 @@ void ParticleBank::pop( SmartPointer<ParticleState>& particle )
   this->pop();
 }
 
+// Save the bank to an archive
+/*! \details The particle states will always be saved in the order that they
+ * would be popped from the bank so that an archived bank can be loaded by
+ * a bank in either mode.
+ */
+template<typename Archive>
+void ParticleBank::save( Archive& ar, const unsigned version ) const
+{
+  if( d_pooled_mode )
+  {
+    BankContainerType particle_states( d_pooled_particle_states.rbegin(),
+                                       d_pooled_particle_states.rend() );
+
+    ar & boost::serialization::make_nvp( "d_particle_states", particle_states );
+  }
+  else
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_particle_states );
+  }
+}
+
+// Load the bank from an archive
+template<typename Archive>
+void ParticleBank::load( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_particle_states );
+
+  if( d_pooled_mode )
+  {
+    d_pooled_particle_states.clear();
+
+    this->moveListToStack( d_particle_states );
+  }
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_PARTICLE_BANK_DEF_HPP
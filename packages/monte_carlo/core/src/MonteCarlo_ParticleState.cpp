@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <typeinfo>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleState.hpp"
@@ -126,6 +129,55 @@ ParticleState* ParticleState::clone(
   return clone_state;
 }
 
+// Copy the state of another particle of the same type into this particle
+/*! \details The state will be copied in the same way that it is copied by
+ * the clone method (i.e. the lost and gone states will not be copied). If
+ * both particles are embedded in the same model the navigator of this
+ * particle will be reused instead of creating a new navigator. This method
+ * allows particle state objects to be recycled (see
+ * MonteCarlo::ParticleBank).
+ */
+void ParticleState::copyState( const ParticleState& existing_state )
+{
+  // Make sure that the particle states have the same type
+  testPrecondition( typeid(*this) == typeid(existing_state) );
+
+  if( this == &existing_state )
+    return;
+
+  d_history_number = existing_state.d_history_number;
+  d_particle_type = existing_state.d_particle_type;
+  d_source_id = existing_state.d_source_id;
+  d_source_energy = existing_state.d_source_energy;
+  d_energy = existing_state.d_energy;
+  d_charge = existing_state.d_charge;
+  d_source_time = existing_state.d_source_time;
+  d_time = existing_state.d_time;
+  d_collision_number = existing_state.d_collision_number;
+  d_generation_number = existing_state.d_generation_number;
+  d_source_weight = existing_state.d_source_weight;
+  d_weight = existing_state.d_weight;
+  d_importance_pair = existing_state.d_importance_pair;
+  d_ray_safety_distance = existing_state.d_ray_safety_distance;
+  d_source_cell = existing_state.d_source_cell;
+  d_lost = false;
+  d_gone = false;
+
+  // Reuse the navigator if possible
+  if( d_model == existing_state.d_model )
+  {
+    d_navigator->setState( existing_state.d_navigator->getPosition(),
+                           existing_state.d_navigator->getDirection(),
+                           existing_state.d_navigator->getCurrentCell() );
+  }
+  else
+  {
+    d_model = existing_state.d_model;
+
+    d_navigator.reset( existing_state.d_navigator->clone( this->createAdvanceCompleteCallback() ) );
+  }
+}
+
 // Return the history number
 ParticleState::historyNumberType ParticleState::getHistoryNumber() const
 {
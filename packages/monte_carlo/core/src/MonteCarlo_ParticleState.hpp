@@ -100,6 +100,9 @@ public:
   //! Clone the particle state but change the history number
   ParticleState* clone( const historyNumberType new_history_number ) const;
 
+  //! Copy the state of another particle of the same type into this particle
+  virtual void copyState( const ParticleState& existing_state );
+
   //! Return the history number
   historyNumberType getHistoryNumber() const;
 
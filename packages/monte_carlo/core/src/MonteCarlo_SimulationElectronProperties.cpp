@@ -40,6 +40,13 @@ SimulationElectronProperties::SimulationElectronProperties()
     d_electroionization_interpolation_type( LOGLOGLOG_INTERPOLATION ),
     d_electroionization_sampling_mode( KNOCK_ON_SAMPLING ),
     d_atomic_excitation_mode_on( true ),
+    d_condensed_history_mode_on( false ),
+    d_condensed_history_max_energy_loss_fraction( 0.05 ),
+    d_condensed_history_max_transport_mfps( 0.2 ),
+    d_condensed_history_bremsstrahlung_cutoff_energy( 1e-3 ),
+    d_condensed_history_electroionization_cutoff_energy( 1e-4 ),
+    d_cell_min_electron_energies(),
+    d_electron_range_rejection_mode_on( false ),
     d_threshold_weight( 0.0 ),
     d_survival_weight()
 { /* ... */ }
@@ -312,6 +319,177 @@ bool SimulationElectronProperties::isAtomicExcitationModeOn() const
   return d_atomic_excitation_mode_on;
 }
 
+// Set condensed history mode to on (off by default)
+/*! \details In condensed history mode the small angle elastic scatters and
+ * the atomic excitation energy losses are not simulated individually.
+ * Instead, their combined effect is applied in condensed history steps (a
+ * multiple scattering deflection and a continuous energy loss). Only the
+ * hard collisions (large angle elastic, electroionization and
+ * bremsstrahlung) are simulated in an analog fashion. The bremsstrahlung and
+ * electroionization collisions that transfer less energy than the
+ * condensed history cutoff energies are also soft collisions: their
+ * energy losses are part of the continuous energy loss.
+ */
+void SimulationElectronProperties::setCondensedHistoryModeOn()
+{
+  d_condensed_history_mode_on = true;
+}
+
+// Set condensed history mode to off (off by default)
+void SimulationElectronProperties::setCondensedHistoryModeOff()
+{
+  d_condensed_history_mode_on = false;
+}
+
+// Return if condensed history mode is on
+bool SimulationElectronProperties::isCondensedHistoryModeOn() const
+{
+  return d_condensed_history_mode_on;
+}
+
+// Set the max fractional energy loss per condensed history step (0.05 by default)
+void SimulationElectronProperties::setCondensedHistoryMaxEnergyLossFraction(
+                                                       const double fraction )
+{
+  // Make sure the fraction is valid
+  testPrecondition( fraction > 0.0 );
+  testPrecondition( fraction < 1.0 );
+
+  d_condensed_history_max_energy_loss_fraction = fraction;
+}
+
+// Return the max fractional energy loss per condensed history step
+double SimulationElectronProperties::getCondensedHistoryMaxEnergyLossFraction() const
+{
+  return d_condensed_history_max_energy_loss_fraction;
+}
+
+// Set the max transport mean free paths per condensed history step (0.2 by default)
+/*! \details The transport mean free path refers to the first transport
+ * mean free path of the small angle elastic scattering.
+ */
+void SimulationElectronProperties::setCondensedHistoryMaxTransportMeanFreePaths(
+                                                           const double mfps )
+{
+  // Make sure the number of mean free paths is valid
+  testPrecondition( mfps > 0.0 );
+
+  d_condensed_history_max_transport_mfps = mfps;
+}
+
+// Return the max transport mean free paths per condensed history step
+double SimulationElectronProperties::getCondensedHistoryMaxTransportMeanFreePaths() const
+{
+  return d_condensed_history_max_transport_mfps;
+}
+
+// Set the condensed history bremsstrahlung photon cutoff energy (1e-3 MeV by default)
+/*! \details Only the bremsstrahlung collisions that emit a photon with an
+ * energy above the cutoff will be simulated individually. The default
+ * cutoff is the default minimum photon energy.
+ */
+void SimulationElectronProperties::setCondensedHistoryBremsstrahlungCutoffEnergy(
+                                                         const double energy )
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+
+  d_condensed_history_bremsstrahlung_cutoff_energy = energy;
+}
+
+// Return the condensed history bremsstrahlung photon cutoff energy (MeV)
+double SimulationElectronProperties::getCondensedHistoryBremsstrahlungCutoffEnergy() const
+{
+  return d_condensed_history_bremsstrahlung_cutoff_energy;
+}
+
+// Set the condensed history knock-on electron cutoff energy (1e-4 MeV by default)
+/*! \details Only the electroionization collisions that emit a knock-on
+ * electron with an energy above the cutoff will be simulated individually.
+ * The default cutoff is the default minimum electron energy.
+ */
+void SimulationElectronProperties::setCondensedHistoryElectroionizationCutoffEnergy(
+                                                         const double energy )
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+
+  d_condensed_history_electroionization_cutoff_energy = energy;
+}
+
+// Return the condensed history knock-on electron cutoff energy (MeV)
+double SimulationElectronProperties::getCondensedHistoryElectroionizationCutoffEnergy() const
+{
+  return d_condensed_history_electroionization_cutoff_energy;
+}
+
+// Set the minimum electron energy (MeV) in a cell
+/*! \details The cell minimum electron energy overrides the global minimum
+ * electron energy in the cell. It can be used to terminate electrons early in
+ * regions of the geometry that are far from any tally region (e.g. thick
+ * shields).
+ */
+void SimulationElectronProperties::setMinElectronEnergyInCell(
+                                         const Geometry::Model::EntityId cell,
+                                         const double energy )
+{
+  // Make sure the energy is valid
+  testPrecondition( energy >= s_absolute_min_electron_energy );
+  testPrecondition( energy < d_max_electron_energy );
+
+  d_cell_min_electron_energies[cell] = energy;
+}
+
+// Return the minimum electron energy (MeV) in a cell
+/*! \details If a minimum electron energy has not been set for the cell the
+ * global minimum electron energy will be returned.
+ */
+double SimulationElectronProperties::getMinElectronEnergyInCell(
+                                  const Geometry::Model::EntityId cell ) const
+{
+  std::map<Geometry::Model::EntityId,double>::const_iterator energy_it =
+    d_cell_min_electron_energies.find( cell );
+
+  if( energy_it != d_cell_min_electron_energies.end() )
+    return energy_it->second;
+  else
+    return d_min_electron_energy;
+}
+
+// Check if any cell minimum electron energies have been set
+bool SimulationElectronProperties::hasMinElectronEnergyInCells() const
+{
+  return !d_cell_min_electron_energies.empty();
+}
+
+// Set electron range rejection mode to on (off by default)
+/*! \details When electron range rejection mode is on, an electron will be
+ * terminated as soon as its continuous slowing down approximation range (to
+ * the minimum electron energy in its current cell) is less than the distance
+ * to the closest boundary of the cell. Since the electron can never leave
+ * the cell it cannot contribute to tallies outside of the cell directly.
+ * When photons are transported, an electron will only be range rejected
+ * once its energy is below the minimum photon energy so that none of the
+ * photons that it could have created are lost. The secondary electrons that
+ * it could have created cannot leave the cell either.
+ */
+void SimulationElectronProperties::setElectronRangeRejectionModeOn()
+{
+  d_electron_range_rejection_mode_on = true;
+}
+
+// Set electron range rejection mode to off (off by default)
+void SimulationElectronProperties::setElectronRangeRejectionModeOff()
+{
+  d_electron_range_rejection_mode_on = false;
+}
+
+// Return if electron range rejection mode is on
+bool SimulationElectronProperties::isElectronRangeRejectionModeOn() const
+{
+  return d_electron_range_rejection_mode_on;
+}
+
 // Set the cutoff roulette threshold weight
 void SimulationElectronProperties::setElectronRouletteThresholdWeight(
       const double threshold_weight )
@@ -22,6 +22,8 @@
 #include "MonteCarlo_ElasticElectronDistributionType.hpp"
 #include "MonteCarlo_TwoDInterpolationType.hpp"
 #include "MonteCarlo_TwoDGridType.hpp"
+#include "Geometry_Model.hpp"
+#include "Utility_Map.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 
 namespace MonteCarlo{
@@ -170,6 +172,62 @@ public:
   //! Return if atomic excitation mode is on
   bool isAtomicExcitationModeOn() const;
 
+  /* ------ Condensed History Properties ------ */
+
+  //! Set condensed history mode to on (off by default)
+  void setCondensedHistoryModeOn();
+
+  //! Set condensed history mode to off (off by default)
+  void setCondensedHistoryModeOff();
+
+  //! Return if condensed history mode is on
+  bool isCondensedHistoryModeOn() const;
+
+  //! Set the max fractional energy loss per condensed history step (0.05 by default)
+  void setCondensedHistoryMaxEnergyLossFraction( const double fraction );
+
+  //! Return the max fractional energy loss per condensed history step
+  double getCondensedHistoryMaxEnergyLossFraction() const;
+
+  //! Set the max transport mean free paths per condensed history step (0.2 by default)
+  void setCondensedHistoryMaxTransportMeanFreePaths( const double mfps );
+
+  //! Return the max transport mean free paths per condensed history step
+  double getCondensedHistoryMaxTransportMeanFreePaths() const;
+
+  //! Set the condensed history bremsstrahlung photon cutoff energy (1e-3 MeV by default)
+  void setCondensedHistoryBremsstrahlungCutoffEnergy( const double energy );
+
+  //! Return the condensed history bremsstrahlung photon cutoff energy (MeV)
+  double getCondensedHistoryBremsstrahlungCutoffEnergy() const;
+
+  //! Set the condensed history knock-on electron cutoff energy (1e-4 MeV by default)
+  void setCondensedHistoryElectroionizationCutoffEnergy( const double energy );
+
+  //! Return the condensed history knock-on electron cutoff energy (MeV)
+  double getCondensedHistoryElectroionizationCutoffEnergy() const;
+
+  /* ------ Electron Cutoff Properties ------ */
+
+  //! Set the minimum electron energy (MeV) in a cell
+  void setMinElectronEnergyInCell( const Geometry::Model::EntityId cell,
+                                   const double energy );
+
+  //! Return the minimum electron energy (MeV) in a cell
+  double getMinElectronEnergyInCell( const Geometry::Model::EntityId cell ) const;
+
+  //! Check if any cell minimum electron energies have been set
+  bool hasMinElectronEnergyInCells() const;
+
+  //! Set electron range rejection mode to on (off by default)
+  void setElectronRangeRejectionModeOn();
+
+  //! Set electron range rejection mode to off (off by default)
+  void setElectronRangeRejectionModeOff();
+
+  //! Return if electron range rejection mode is on
+  bool isElectronRangeRejectionModeOn() const;
+
   //! Set the cutoff roulette threshold weight
   void setElectronRouletteThresholdWeight( const double threshold_weight );
 
@@ -186,7 +244,13 @@ private:
 
   // Save the state to an archive
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version );
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the state from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
 
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
@@ -255,6 +319,27 @@ private:
   // The atomic excitation electron scattering mode (true = on - default, false = off)
   bool d_atomic_excitation_mode_on;
 
+  // The condensed history mode (true = on, false = off - default)
+  bool d_condensed_history_mode_on;
+
+  // The max fractional energy loss per condensed history step
+  double d_condensed_history_max_energy_loss_fraction;
+
+  // The max first transport mean free paths per condensed history step
+  double d_condensed_history_max_transport_mfps;
+
+  // The condensed history bremsstrahlung photon cutoff energy (MeV)
+  double d_condensed_history_bremsstrahlung_cutoff_energy;
+
+  // The condensed history knock-on electron cutoff energy (MeV)
+  double d_condensed_history_electroionization_cutoff_energy;
+
+  // The cell minimum electron energies (MeV)
+  std::map<Geometry::Model::EntityId,double> d_cell_min_electron_energies;
+
+  // The electron range rejection mode (true = on, false = off - default)
+  bool d_electron_range_rejection_mode_on;
+
   // The roulette threshold weight
   double d_threshold_weight;
 
@@ -262,10 +347,10 @@ private:
   double d_survival_weight;
 };
 
-// Save/load the state to an archive
+// Save the state to an archive
 template<typename Archive>
-void SimulationElectronProperties::serialize( Archive& ar,
-                                              const unsigned version )
+void SimulationElectronProperties::save( Archive& ar,
+                                         const unsigned version ) const
 {
   ar & BOOST_SERIALIZATION_NVP( d_min_electron_energy );
   ar & BOOST_SERIALIZATION_NVP( d_max_electron_energy );
@@ -288,13 +373,83 @@ void SimulationElectronProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_atomic_excitation_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+  ar & BOOST_SERIALIZATION_NVP( d_condensed_history_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_condensed_history_max_energy_loss_fraction );
+  ar & BOOST_SERIALIZATION_NVP( d_condensed_history_max_transport_mfps );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_min_electron_energies );
+  ar & BOOST_SERIALIZATION_NVP( d_electron_range_rejection_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_condensed_history_bremsstrahlung_cutoff_energy );
+  ar & BOOST_SERIALIZATION_NVP( d_condensed_history_electroionization_cutoff_energy );
+}
+
+// Load the state from an archive
+template<typename Archive>
+void SimulationElectronProperties::load( Archive& ar,
+                                         const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_min_electron_energy );
+  ar & BOOST_SERIALIZATION_NVP( d_max_electron_energy );
+  ar & BOOST_SERIALIZATION_NVP( d_evaluation_tol );
+  ar & BOOST_SERIALIZATION_NVP( d_electron_interpolation_type );
+  ar & BOOST_SERIALIZATION_NVP( d_electron_grid_type );
+  ar & BOOST_SERIALIZATION_NVP( d_num_electron_hash_grid_bins );
+  ar & BOOST_SERIALIZATION_NVP( d_atomic_relaxation_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_elastic_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_elastic_interpolation_type );
+  ar & BOOST_SERIALIZATION_NVP( d_elastic_distribution_mode );
+  ar & BOOST_SERIALIZATION_NVP( d_coupled_elastic_sampling_method );
+  ar & BOOST_SERIALIZATION_NVP( d_elastic_cutoff_angle_cosine );
+  ar & BOOST_SERIALIZATION_NVP( d_electroionization_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_electroionization_interpolation_type );
+  ar & BOOST_SERIALIZATION_NVP( d_electroionization_sampling_mode );
+  ar & BOOST_SERIALIZATION_NVP( d_bremsstrahlung_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_bremsstrahlung_interpolation_type );
+  ar & BOOST_SERIALIZATION_NVP( d_bremsstrahlung_angular_distribution_function );
+  ar & BOOST_SERIALIZATION_NVP( d_atomic_excitation_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
+  ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_mode_on );
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_max_energy_loss_fraction );
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_max_transport_mfps );
+  }
+  else
+  {
+    d_condensed_history_mode_on = false;
+    d_condensed_history_max_energy_loss_fraction = 0.05;
+    d_condensed_history_max_transport_mfps = 0.2;
+  }
+
+  if( version > 1 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_cell_min_electron_energies );
+    ar & BOOST_SERIALIZATION_NVP( d_electron_range_rejection_mode_on );
+  }
+  else
+  {
+    d_cell_min_electron_energies.clear();
+    d_electron_range_rejection_mode_on = false;
+  }
+
+  if( version > 2 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_bremsstrahlung_cutoff_energy );
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_electroionization_cutoff_energy );
+  }
+  else
+  {
+    d_condensed_history_bremsstrahlung_cutoff_energy = 1e-3;
+    d_condensed_history_electroionization_cutoff_energy = 1e-4;
+  }
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationElectronProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationElectronProperties, 3 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationElectronProperties, "SimulationElectronProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationElectronProperties );
 
@@ -26,7 +26,17 @@ SimulationGeneralProperties::SimulationGeneralProperties()
     d_number_of_batches_per_processor( 1 ),
     d_number_of_snapshots_per_batch( 1 ),
     d_wall_time( Utility::QuantityTraits<double>::inf() ),
-    d_implicit_capture_mode_on( false )
+    d_implicit_capture_mode_on( false ),
+    d_pooled_particle_bank_mode_on( false ),
+    d_random_number_generator_type( Utility::LINEAR_CONGRUENTIAL_GENERATOR ),
+    d_unionized_energy_grid_mode_on( false ),
+    d_unionized_energy_grid_convergence_tolerance( 1e-3 ),
+    d_event_based_transport_mode_on( false ),
+    d_event_based_history_batch_size( 64 ),
+    d_history_schedule_type( STATIC_HISTORY_SCHEDULE ),
+    d_history_schedule_chunk_size( 1 ),
+    d_incremental_rendezvous_mode_on( false ),
+    d_overlapped_rendezvous_mode_on( false )
 { /* ... */ }
 
 // Set the particle mode
@@ -201,6 +211,239 @@ bool SimulationGeneralProperties::isImplicitCaptureModeOn() const
   return d_implicit_capture_mode_on;
 }
 
+// Set pooled particle bank mode to on (off by default)
+/*! \details In pooled mode the particle bank used by each thread will be a
+ * stack (LIFO) that recycles the particle states that have been simulated.
+ */
+void SimulationGeneralProperties::setPooledParticleBankModeOn()
+{
+  d_pooled_particle_bank_mode_on = true;
+}
+
+// Set standard particle bank mode to on (on by default)
+void SimulationGeneralProperties::setStandardParticleBankModeOn()
+{
+  d_pooled_particle_bank_mode_on = false;
+}
+
+// Return if pooled particle bank mode has been set
+bool SimulationGeneralProperties::isPooledParticleBankModeOn() const
+{
+  return d_pooled_particle_bank_mode_on;
+}
+
+// Set the random number generator type
+/*! \details The counter-based generator can skip to any history in O(1)
+ * time. Both generators produce reproducible streams for each history but
+ * the streams produced by each generator are different.
+ */
+void SimulationGeneralProperties::setRandomNumberGeneratorType(
+                                 const Utility::RandomNumberGeneratorType type )
+{
+  d_random_number_generator_type = type;
+}
+
+// Return the random number generator type
+Utility::RandomNumberGeneratorType
+SimulationGeneralProperties::getRandomNumberGeneratorType() const
+{
+  return d_random_number_generator_type;
+}
+
+// Set unionized energy grid mode to on (off by default)
+/*! \details In unionized energy grid mode each material will construct a
+ * single energy grid on which the scattering center total cross sections
+ * and the macroscopic absorption cross section are precomputed. A single
+ * grid search is then required to evaluate these cross sections instead of
+ * a search and evaluation for every scattering center in the material. The
+ * same tabulated cross sections are used to sample the distance to
+ * collision and the collision scattering center. This trades memory for
+ * speed.
+ */
+void SimulationGeneralProperties::setUnionizedEnergyGridModeOn()
+{
+  d_unionized_energy_grid_mode_on = true;
+}
+
+// Set unionized energy grid mode to off (off by default)
+void SimulationGeneralProperties::setUnionizedEnergyGridModeOff()
+{
+  d_unionized_energy_grid_mode_on = false;
+}
+
+// Return if unionized energy grid mode has been set
+bool SimulationGeneralProperties::isUnionizedEnergyGridModeOn() const
+{
+  return d_unionized_energy_grid_mode_on;
+}
+
+// Set the unionized energy grid convergence tolerance
+/*! \details The unionized energy grid will be refined until the relative
+ * error of the interpolated macroscopic cross sections is below this
+ * tolerance.
+ */
+void SimulationGeneralProperties::setUnionizedEnergyGridConvergenceTolerance(
+                                                      const double tolerance )
+{
+  TEST_FOR_EXCEPTION( tolerance <= 0.0 || tolerance >= 1.0,
+                      std::runtime_error,
+                      "The unionized energy grid convergence tolerance must "
+                      "be in the range (0.0,1.0)!" );
+
+  d_unionized_energy_grid_convergence_tolerance = tolerance;
+}
+
+// Return the unionized energy grid convergence tolerance
+double SimulationGeneralProperties::getUnionizedEnergyGridConvergenceTolerance() const
+{
+  return d_unionized_energy_grid_convergence_tolerance;
+}
+
+// Set event-based transport mode to on (off by default)
+/*! \details In event-based transport mode each thread simulates a batch of
+ * histories together (see
+ * MonteCarlo::SimulationGeneralProperties::setEventBasedHistoryBatchSize).
+ * The current particle of every history in the batch is advanced one event
+ * (cross section lookup, surface crossing, collision) at a time, with the
+ * particles sorted by cell so that the same material data is reused by
+ * consecutive particles. Each history keeps its own random number stream
+ * and its own observer contributions, and the particles of a history are
+ * simulated in the same order as in history-based mode, so the tallies are
+ * the same as the ones obtained in history-based mode (up to round-off).
+ */
+void SimulationGeneralProperties::setEventBasedTransportModeOn()
+{
+  d_event_based_transport_mode_on = true;
+}
+
+// Set history-based transport mode to on (on by default)
+void SimulationGeneralProperties::setHistoryBasedTransportModeOn()
+{
+  d_event_based_transport_mode_on = false;
+}
+
+// Return if event-based transport mode has been set
+bool SimulationGeneralProperties::isEventBasedTransportModeOn() const
+{
+  return d_event_based_transport_mode_on;
+}
+
+// Set the number of histories that a thread simulates together
+/*! \details This is only used in event-based transport mode. Larger batches
+ * increase the number of particles that are advanced together but each
+ * history in a batch needs its own particle banks and observer contribution
+ * storage.
+ */
+void SimulationGeneralProperties::setEventBasedHistoryBatchSize(
+                                                   const unsigned batch_size )
+{
+  TEST_FOR_EXCEPTION( batch_size == 0,
+                      std::runtime_error,
+                      "The event-based history batch size must be greater "
+                      "than zero!" );
+
+  d_event_based_history_batch_size = batch_size;
+}
+
+// Return the number of histories that a thread simulates together
+unsigned SimulationGeneralProperties::getEventBasedHistoryBatchSize() const
+{
+  return d_event_based_history_batch_size;
+}
+
+// Set the history schedule type
+/*! \details The static schedule assigns an equal block of histories to each
+ * thread. The dynamic and guided schedules hand out chunks of histories to
+ * the threads as they become idle. The work stealing schedule assigns an
+ * equal block of histories to each thread but an idle thread will steal
+ * half of the remaining histories from another thread. Each history is
+ * always simulated with its own random number stream so the schedule does
+ * not affect the histories that are simulated.
+ */
+void SimulationGeneralProperties::setHistoryScheduleType(
+                                             const HistoryScheduleType type )
+{
+  d_history_schedule_type = type;
+}
+
+// Return the history schedule type
+HistoryScheduleType SimulationGeneralProperties::getHistoryScheduleType() const
+{
+  return d_history_schedule_type;
+}
+
+// Set the history schedule chunk size
+/*! \details The chunk size is the number of histories that are handed to
+ * a thread at once (or the minimum number with the guided schedule). It is
+ * ignored by the static schedule.
+ */
+void SimulationGeneralProperties::setHistoryScheduleChunkSize(
+                                                   const uint64_t chunk_size )
+{
+  TEST_FOR_EXCEPTION( chunk_size == 0,
+                      std::runtime_error,
+                      "The history schedule chunk size must be greater than "
+                      "zero!" );
+
+  d_history_schedule_chunk_size = chunk_size;
+}
+
+// Return the history schedule chunk size
+uint64_t SimulationGeneralProperties::getHistoryScheduleChunkSize() const
+{
+  return d_history_schedule_chunk_size;
+}
+
+// Set incremental rendezvous mode to on (off by default)
+/*! \details When incremental rendezvous mode is on the complete simulation
+ * state (including the filled model) will only be archived once. All
+ * subsequent rendezvous will only archive the state that changes during the
+ * simulation (e.g. the estimators, the source sampling statistics and the
+ * next history). These rendezvous archives are written asynchronously.
+ */
+void SimulationGeneralProperties::setIncrementalRendezvousModeOn()
+{
+  d_incremental_rendezvous_mode_on = true;
+}
+
+// Set incremental rendezvous mode to off (off by default)
+void SimulationGeneralProperties::setIncrementalRendezvousModeOff()
+{
+  d_incremental_rendezvous_mode_on = false;
+}
+
+// Return if incremental rendezvous mode has been set
+bool SimulationGeneralProperties::isIncrementalRendezvousModeOn() const
+{
+  return d_incremental_rendezvous_mode_on;
+}
+
+// Set overlapped rendezvous mode to on (off by default)
+/*! \details When overlapped rendezvous mode is on the workers in a
+ * distributed simulation will send their summable estimator data to the
+ * root process without blocking and then continue simulating histories
+ * while the root process writes the rendezvous archive. All data is still
+ * fully reduced at the end of the simulation. The rendezvous archives
+ * written before the end of the simulation are intermediate archives that
+ * cannot be used to restart the simulation.
+ */
+void SimulationGeneralProperties::setOverlappedRendezvousModeOn()
+{
+  d_overlapped_rendezvous_mode_on = true;
+}
+
+// Set overlapped rendezvous mode to off (off by default)
+void SimulationGeneralProperties::setOverlappedRendezvousModeOff()
+{
+  d_overlapped_rendezvous_mode_on = false;
+}
+
+// Return if overlapped rendezvous mode has been set
+bool SimulationGeneralProperties::isOverlappedRendezvousModeOn() const
+{
+  return d_overlapped_rendezvous_mode_on;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationGeneralProperties );
 
 } // end MonteCarlo namespace
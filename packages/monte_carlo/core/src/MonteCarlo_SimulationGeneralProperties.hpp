@@ -17,6 +17,8 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleModeType.hpp"
+#include "MonteCarlo_HistoryScheduleType.hpp"
+#include "Utility_RandomNumberGeneratorType.hpp"
 #include "Utility_QuantityTraits.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 
@@ -101,6 +103,82 @@ public:
   //! Return if implicit capture mode has been set
   bool isImplicitCaptureModeOn() const;
 
+  //! Set pooled particle bank mode to on (off by default)
+  void setPooledParticleBankModeOn();
+
+  //! Set standard particle bank mode to on (on by default)
+  void setStandardParticleBankModeOn();
+
+  //! Return if pooled particle bank mode has been set
+  bool isPooledParticleBankModeOn() const;
+
+  //! Set the random number generator type
+  void setRandomNumberGeneratorType(
+                            const Utility::RandomNumberGeneratorType type );
+
+  //! Return the random number generator type
+  Utility::RandomNumberGeneratorType getRandomNumberGeneratorType() const;
+
+  //! Set unionized energy grid mode to on (off by default)
+  void setUnionizedEnergyGridModeOn();
+
+  //! Set unionized energy grid mode to off (off by default)
+  void setUnionizedEnergyGridModeOff();
+
+  //! Return if unionized energy grid mode has been set
+  bool isUnionizedEnergyGridModeOn() const;
+
+  //! Set the unionized energy grid convergence tolerance
+  void setUnionizedEnergyGridConvergenceTolerance( const double tolerance );
+
+  //! Return the unionized energy grid convergence tolerance
+  double getUnionizedEnergyGridConvergenceTolerance() const;
+
+  //! Set event-based transport mode to on (off by default)
+  void setEventBasedTransportModeOn();
+
+  //! Set history-based transport mode to on (on by default)
+  void setHistoryBasedTransportModeOn();
+
+  //! Return if event-based transport mode has been set
+  bool isEventBasedTransportModeOn() const;
+
+  //! Set the number of histories that a thread simulates together
+  void setEventBasedHistoryBatchSize( const unsigned batch_size );
+
+  //! Return the number of histories that a thread simulates together
+  unsigned getEventBasedHistoryBatchSize() const;
+
+  //! Set the history schedule type
+  void setHistoryScheduleType( const HistoryScheduleType type );
+
+  //! Return the history schedule type
+  HistoryScheduleType getHistoryScheduleType() const;
+
+  //! Set the history schedule chunk size
+  void setHistoryScheduleChunkSize( const uint64_t chunk_size );
+
+  //! Return the history schedule chunk size
+  uint64_t getHistoryScheduleChunkSize() const;
+
+  //! Set incremental rendezvous mode to on (off by default)
+  void setIncrementalRendezvousModeOn();
+
+  //! Set incremental rendezvous mode to off (off by default)
+  void setIncrementalRendezvousModeOff();
+
+  //! Return if incremental rendezvous mode has been set
+  bool isIncrementalRendezvousModeOn() const;
+
+  //! Set overlapped rendezvous mode to on (off by default)
+  void setOverlappedRendezvousModeOn();
+
+  //! Set overlapped rendezvous mode to off (off by default)
+  void setOverlappedRendezvousModeOff();
+
+  //! Return if overlapped rendezvous mode has been set
+  bool isOverlappedRendezvousModeOn() const;
+
 private:
 
   // Save the state to an archive
@@ -145,6 +223,36 @@ private:
 
   // The capture mode (true = implicit, false = analogue - default)
   bool d_implicit_capture_mode_on;
+
+  // The particle bank mode (true = pooled, false = standard - default)
+  bool d_pooled_particle_bank_mode_on;
+
+  // The random number generator type
+  Utility::RandomNumberGeneratorType d_random_number_generator_type;
+
+  // The unionized energy grid mode (true = on, false = off - default)
+  bool d_unionized_energy_grid_mode_on;
+
+  // The unionized energy grid convergence tolerance
+  double d_unionized_energy_grid_convergence_tolerance;
+
+  // The transport mode (true = event-based, false = history-based - default)
+  bool d_event_based_transport_mode_on;
+
+  // The number of histories that a thread simulates together (event-based)
+  unsigned d_event_based_history_batch_size;
+
+  // The history schedule type
+  HistoryScheduleType d_history_schedule_type;
+
+  // The history schedule chunk size
+  uint64_t d_history_schedule_chunk_size;
+
+  // The incremental rendezvous mode (true = on, false = off - default)
+  bool d_incremental_rendezvous_mode_on;
+
+  // The overlapped rendezvous mode (true = on, false = off - default)
+  bool d_overlapped_rendezvous_mode_on;
 };
 
 // Save the state to an archive
@@ -179,6 +287,16 @@ void SimulationGeneralProperties::save( Archive& ar, const unsigned version ) co
   }
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_pooled_particle_bank_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_random_number_generator_type );
+  ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_convergence_tolerance );
+  ar & BOOST_SERIALIZATION_NVP( d_event_based_transport_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_history_schedule_type );
+  ar & BOOST_SERIALIZATION_NVP( d_history_schedule_chunk_size );
+  ar & BOOST_SERIALIZATION_NVP( d_incremental_rendezvous_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_overlapped_rendezvous_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_event_based_history_batch_size );
 }
 
 // Load the state to an archive
@@ -203,13 +321,65 @@ void SimulationGeneralProperties::load( Archive& ar, const unsigned version )
     d_wall_time = Utility::QuantityTraits<double>::inf();
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_pooled_particle_bank_mode_on );
+  else
+    d_pooled_particle_bank_mode_on = false;
+
+  if( version > 1 )
+    ar & BOOST_SERIALIZATION_NVP( d_random_number_generator_type );
+  else
+    d_random_number_generator_type = Utility::LINEAR_CONGRUENTIAL_GENERATOR;
+
+  if( version > 2 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_mode_on );
+    ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_convergence_tolerance );
+  }
+  else
+  {
+    d_unionized_energy_grid_mode_on = false;
+    d_unionized_energy_grid_convergence_tolerance = 1e-3;
+  }
+
+  if( version > 3 )
+    ar & BOOST_SERIALIZATION_NVP( d_event_based_transport_mode_on );
+  else
+    d_event_based_transport_mode_on = false;
+
+  if( version > 4 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_history_schedule_type );
+    ar & BOOST_SERIALIZATION_NVP( d_history_schedule_chunk_size );
+  }
+  else
+  {
+    d_history_schedule_type = STATIC_HISTORY_SCHEDULE;
+    d_history_schedule_chunk_size = 1;
+  }
+
+  if( version > 5 )
+    ar & BOOST_SERIALIZATION_NVP( d_incremental_rendezvous_mode_on );
+  else
+    d_incremental_rendezvous_mode_on = false;
+
+  if( version > 6 )
+    ar & BOOST_SERIALIZATION_NVP( d_overlapped_rendezvous_mode_on );
+  else
+    d_overlapped_rendezvous_mode_on = false;
+
+  if( version > 7 )
+    ar & BOOST_SERIALIZATION_NVP( d_event_based_history_batch_size );
+  else
+    d_event_based_history_batch_size = 64;
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 8 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationGeneralProperties, "SimulationGeneralProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationGeneralProperties );
 
@@ -54,6 +54,10 @@ public:
   template<typename ParticleType>
   double getMinParticleEnergy() const;
 
+  //! Return the min particle energy in a cell
+  template<typename ParticleType>
+  double getMinParticleEnergyInCell( const Geometry::Model::EntityId cell ) const;
+
   //! Return the max particle energy
   template<typename ParticleType>
   double getMaxParticleEnergy() const;
@@ -14,6 +14,7 @@
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_AdjointPhotonState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
+#include "MonteCarlo_PositronState.hpp"
 #include "MonteCarlo_AdjointElectronState.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 
@@ -55,6 +56,13 @@ inline double SimulationProperties::getMinParticleEnergy<ElectronState>() const
   return this->getMinElectronEnergy();
 }
 
+//! Return the min positron energy (same as the min electron energy)
+template<>
+inline double SimulationProperties::getMinParticleEnergy<PositronState>() const
+{
+  return this->getMinElectronEnergy();
+}
+
 //! Return the min adjoint electron energy
 template<>
 inline double SimulationProperties::getMinParticleEnergy<AdjointElectronState>() const
@@ -62,6 +70,34 @@ inline double SimulationProperties::getMinParticleEnergy<AdjointElectronState>()
   return this->getMinAdjointElectronEnergy();
 }
 
+// Return the min particle energy in a cell
+/*! \details Only the electron (and positron) min energies can currently be
+ * overridden in individual cells. The global min particle energy will be
+ * returned for all other particle types.
+ */
+template<typename ParticleType>
+double SimulationProperties::getMinParticleEnergyInCell(
+                                  const Geometry::Model::EntityId cell ) const
+{
+  return this->getMinParticleEnergy<ParticleType>();
+}
+
+//! Return the min electron energy in a cell
+template<>
+inline double SimulationProperties::getMinParticleEnergyInCell<ElectronState>(
+                                  const Geometry::Model::EntityId cell ) const
+{
+  return this->getMinElectronEnergyInCell( cell );
+}
+
+//! Return the min positron energy in a cell (same as the electron energy)
+template<>
+inline double SimulationProperties::getMinParticleEnergyInCell<PositronState>(
+                                  const Geometry::Model::EntityId cell ) const
+{
+  return this->getMinElectronEnergyInCell( cell );
+}
+
 // Return the max particle energy
 template<typename ParticleType>
 double SimulationProperties::getMaxParticleEnergy() const
@@ -98,6 +134,13 @@ inline double SimulationProperties::getMaxParticleEnergy<ElectronState>() const
   return this->getMaxElectronEnergy();
 }
 
+//! Return the max positron energy (same as the max electron energy)
+template<>
+inline double SimulationProperties::getMaxParticleEnergy<PositronState>() const
+{
+  return this->getMaxElectronEnergy();
+}
+
 //! Return the max adjoint electron energy
 template<>
 inline double SimulationProperties::getMaxParticleEnergy<AdjointElectronState>() const
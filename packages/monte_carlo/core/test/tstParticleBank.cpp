@@ -509,6 +509,195 @@ FRENSIE_UNIT_TEST( ParticleBank, splice )
 		       MonteCarlo::POSITRON );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a pooled bank is a stack
+FRENSIE_UNIT_TEST( ParticleBank, pooled_push_pop )
+{
+  MonteCarlo::ParticleBank bank( true );
+
+  FRENSIE_CHECK( bank.isPooledModeOn() );
+  FRENSIE_CHECK( bank.isEmpty() );
+
+  {
+    MonteCarlo::PhotonState photon( 0ull );
+    bank.push( photon );
+  }
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleState>
+      neutron( new MonteCarlo::NeutronState( 1ull ) );
+
+    bank.push( neutron );
+
+    FRENSIE_CHECK( !neutron );
+  }
+
+  {
+    MonteCarlo::ElectronState electron( 2ull );
+    bank.push( electron );
+  }
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 3 );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 2ull );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::ELECTRON );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 1ull );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::NEUTRON );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 0ull );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+
+  bank.pop();
+
+  FRENSIE_CHECK( bank.isEmpty() );
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfRecycledStates(), 3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a pooled bank recycles the particle states that are popped
+FRENSIE_UNIT_TEST( ParticleBank, pooled_recycle )
+{
+  MonteCarlo::ParticleBank bank( true );
+
+  {
+    MonteCarlo::PhotonState photon( 0ull );
+    photon.setEnergy( 1.0 );
+
+    bank.push( photon );
+  }
+
+  const MonteCarlo::ParticleState* recycled_state = &bank.top();
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfRecycledStates(), 1 );
+
+  // A state of a different type cannot reuse the recycled state
+  {
+    MonteCarlo::ElectronState electron( 1ull );
+
+    bank.push( electron );
+  }
+
+  FRENSIE_CHECK( &bank.top() != recycled_state );
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfRecycledStates(), 1 );
+
+  {
+    MonteCarlo::PhotonState photon( 2ull );
+    photon.setEnergy( 2.0 );
+    photon.setWeight( 0.5 );
+    photon.setAsGone();
+
+    bank.push( photon );
+  }
+
+  FRENSIE_CHECK( &bank.top() == recycled_state );
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfRecycledStates(), 0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 2ull );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 2.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getWeight(), 0.5 );
+  FRENSIE_CHECK( !bank.top().isGone() );
+
+  // Particles that are released from the bank can also be recycled
+  std::shared_ptr<MonteCarlo::ParticleState> particle;
+
+  bank.releaseTop( particle );
+
+  FRENSIE_CHECK( particle.get() == recycled_state );
+  FRENSIE_CHECK_EQUAL( bank.size(), 1 );
+
+  bank.recycle( particle );
+
+  FRENSIE_CHECK( !particle );
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfRecycledStates(), 1 );
+
+  bank.releaseTop( particle );
+
+  FRENSIE_CHECK_EQUAL( particle->getParticleType(), MonteCarlo::ELECTRON );
+  FRENSIE_CHECK( bank.isEmpty() );
+
+  // Shared particles will not be recycled
+  std::shared_ptr<MonteCarlo::ParticleState> particle_copy = particle;
+
+  bank.recycle( particle );
+
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfRecycledStates(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a pooled bank can be sorted, merged and spliced
+FRENSIE_UNIT_TEST( ParticleBank, pooled_sort_merge_splice )
+{
+  MonteCarlo::ParticleBank bank_a( true ), bank_b;
+
+  {
+    MonteCarlo::PhotonState photon( 2ull );
+    bank_a.push( photon );
+  }
+
+  {
+    MonteCarlo::NeutronState neutron( 0ull );
+    bank_a.push( neutron );
+  }
+
+  {
+    MonteCarlo::ElectronState electron( 3ull );
+    bank_b.push( electron );
+  }
+
+  {
+    MonteCarlo::PositronState positron( 1ull );
+    bank_b.push( positron );
+  }
+
+  FRENSIE_CHECK( bank_a.isSorted( compareHistoryNumbers ) );
+  FRENSIE_CHECK( !bank_b.isSorted( compareHistoryNumbers ) );
+
+  bank_b.sort( compareHistoryNumbers );
+
+  bank_a.merge( bank_b, compareHistoryNumbers );
+
+  FRENSIE_CHECK_EQUAL( bank_a.size(), 4 );
+  FRENSIE_CHECK( bank_b.isEmpty() );
+  FRENSIE_CHECK( bank_a.isSorted( compareHistoryNumbers ) );
+
+  {
+    MonteCarlo::PhotonState photon( 5ull );
+    bank_b.push( photon );
+  }
+
+  {
+    MonteCarlo::PhotonState photon( 4ull );
+    bank_b.push( photon );
+  }
+
+  bank_a.splice( bank_b );
+
+  FRENSIE_CHECK_EQUAL( bank_a.size(), 6 );
+  FRENSIE_CHECK( bank_b.isEmpty() );
+
+  // The spliced particles are on top of the stack
+  FRENSIE_CHECK_EQUAL( bank_a.top().getHistoryNumber(), 5ull );
+
+  bank_a.pop();
+
+  FRENSIE_CHECK_EQUAL( bank_a.top().getHistoryNumber(), 4ull );
+
+  bank_a.pop();
+
+  for( unsigned long long i = 0; i < 4; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( bank_a.top().getHistoryNumber(), i );
+
+    bank_a.pop();
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that a particle bank can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleBank, archive, TestArchives )
@@ -576,6 +765,88 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleBank, archive, TestArchives )
                        MonteCarlo::POSITRON );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a pooled particle bank can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleBank, archive_pooled, TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_pooled_particle_bank" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    MonteCarlo::ParticleBank bank( true ), pooled_bank( true );
+
+    MonteCarlo::PhotonState photon( 0ull );
+    bank.push( photon );
+    pooled_bank.push( photon );
+
+    MonteCarlo::NeutronState neutron( 1ull );
+    bank.push( neutron );
+    pooled_bank.push( neutron );
+
+    MonteCarlo::ElectronState electron( 2ull );
+    bank.push( electron );
+    pooled_bank.push( electron );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( bank ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( pooled_bank ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived distributions
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  // The particles are archived in pop order
+  MonteCarlo::ParticleBank bank;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( bank ) );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 3 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(),
+                       MonteCarlo::ELECTRON );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(),
+                       MonteCarlo::NEUTRON );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(),
+                       MonteCarlo::PHOTON );
+
+  MonteCarlo::ParticleBank pooled_bank( true );
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( pooled_bank ) );
+
+  FRENSIE_CHECK_EQUAL( pooled_bank.size(), 3 );
+  FRENSIE_CHECK_EQUAL( pooled_bank.top().getParticleType(),
+                       MonteCarlo::ELECTRON );
+
+  pooled_bank.pop();
+
+  FRENSIE_CHECK_EQUAL( pooled_bank.top().getParticleType(),
+                       MonteCarlo::NEUTRON );
+
+  pooled_bank.pop();
+
+  FRENSIE_CHECK_EQUAL( pooled_bank.top().getParticleType(),
+                       MonteCarlo::PHOTON );
+}
+
 //---------------------------------------------------------------------------//
 // end tstParticleBank.cpp
 //---------------------------------------------------------------------------//
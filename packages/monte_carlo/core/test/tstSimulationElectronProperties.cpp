@@ -53,6 +53,14 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::TWOBS_DISTRIBUTION );
   FRENSIE_CHECK( properties.isAtomicExcitationModeOn() );
+  FRENSIE_CHECK( !properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryMaxEnergyLossFraction(), 0.05 );
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryMaxTransportMeanFreePaths(), 0.2 );
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryBremsstrahlungCutoffEnergy(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryElectroionizationCutoffEnergy(), 1e-4 );
+  FRENSIE_CHECK( !properties.hasMinElectronEnergyInCells() );
+  FRENSIE_CHECK_EQUAL( properties.getMinElectronEnergyInCell( 1 ), 1e-4 );
+  FRENSIE_CHECK( !properties.isElectronRangeRejectionModeOn() );
   FRENSIE_CHECK_SMALL( properties.getElectronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getElectronRouletteSurvivalWeight(), 1e-30 );
 }
@@ -352,6 +360,87 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties, setAtomicExcitationModeOffOn )
   FRENSIE_CHECK( properties.isAtomicExcitationModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that condensed history mode can be turned on
+FRENSIE_UNIT_TEST( SimulationElectronProperties, setCondensedHistoryModeOnOff )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setCondensedHistoryModeOn();
+
+  FRENSIE_CHECK( properties.isCondensedHistoryModeOn() );
+
+  properties.setCondensedHistoryModeOff();
+
+  FRENSIE_CHECK( !properties.isCondensedHistoryModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the condensed history step limits can be set
+FRENSIE_UNIT_TEST( SimulationElectronProperties, setCondensedHistoryStepLimits )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setCondensedHistoryMaxEnergyLossFraction( 0.1 );
+
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryMaxEnergyLossFraction(), 0.1 );
+
+  properties.setCondensedHistoryMaxTransportMeanFreePaths( 0.5 );
+
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryMaxTransportMeanFreePaths(), 0.5 );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the condensed history cutoff energies can be set
+FRENSIE_UNIT_TEST( SimulationElectronProperties, setCondensedHistoryCutoffEnergies )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setCondensedHistoryBremsstrahlungCutoffEnergy( 1e-2 );
+
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryBremsstrahlungCutoffEnergy(), 1e-2 );
+
+  properties.setCondensedHistoryElectroionizationCutoffEnergy( 1e-3 );
+
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryElectroionizationCutoffEnergy(), 1e-3 );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the min electron energy in a cell can be set
+FRENSIE_UNIT_TEST( SimulationElectronProperties, setMinElectronEnergyInCell )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setMinElectronEnergyInCell( 2, 1e-2 );
+
+  FRENSIE_CHECK( properties.hasMinElectronEnergyInCells() );
+  FRENSIE_CHECK_EQUAL( properties.getMinElectronEnergyInCell( 2 ), 1e-2 );
+
+  // The global min electron energy is used in all other cells
+  FRENSIE_CHECK_EQUAL( properties.getMinElectronEnergyInCell( 1 ), 1e-4 );
+
+  properties.setMinElectronEnergy( 1e-3 );
+
+  FRENSIE_CHECK_EQUAL( properties.getMinElectronEnergyInCell( 1 ), 1e-3 );
+  FRENSIE_CHECK_EQUAL( properties.getMinElectronEnergyInCell( 2 ), 1e-2 );
+}
+
+//---------------------------------------------------------------------------//
+// Test that electron range rejection mode can be turned on
+FRENSIE_UNIT_TEST( SimulationElectronProperties,
+                   setElectronRangeRejectionModeOnOff )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setElectronRangeRejectionModeOn();
+
+  FRENSIE_CHECK( properties.isElectronRangeRejectionModeOn() );
+
+  properties.setElectronRangeRejectionModeOff();
+
+  FRENSIE_CHECK( !properties.isElectronRangeRejectionModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the critical line energies can be set
 FRENSIE_UNIT_TEST( SimulationElectronProperties,
@@ -420,6 +509,13 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
     custom_properties.setBremsstrahlungModeOff();
     custom_properties.setBremsstrahlungAngularDistributionFunction( MonteCarlo::DIPOLE_DISTRIBUTION );
     custom_properties.setAtomicExcitationModeOff();
+    custom_properties.setCondensedHistoryModeOn();
+    custom_properties.setCondensedHistoryMaxEnergyLossFraction( 0.1 );
+    custom_properties.setCondensedHistoryMaxTransportMeanFreePaths( 0.5 );
+    custom_properties.setCondensedHistoryBremsstrahlungCutoffEnergy( 1e-2 );
+    custom_properties.setCondensedHistoryElectroionizationCutoffEnergy( 1e-3 );
+    custom_properties.setMinElectronEnergyInCell( 2, 5e-2 );
+    custom_properties.setElectronRangeRejectionModeOn();
     custom_properties.setElectronRouletteThresholdWeight( 1e-15 );
     custom_properties.setElectronRouletteSurvivalWeight( 1e-13 );
 
@@ -460,6 +556,13 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::TWOBS_DISTRIBUTION );
   FRENSIE_CHECK( default_properties.isAtomicExcitationModeOn() );
+  FRENSIE_CHECK( !default_properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getCondensedHistoryMaxEnergyLossFraction(), 0.05 );
+  FRENSIE_CHECK_EQUAL( default_properties.getCondensedHistoryMaxTransportMeanFreePaths(), 0.2 );
+  FRENSIE_CHECK_EQUAL( default_properties.getCondensedHistoryBremsstrahlungCutoffEnergy(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( default_properties.getCondensedHistoryElectroionizationCutoffEnergy(), 1e-4 );
+  FRENSIE_CHECK( !default_properties.hasMinElectronEnergyInCells() );
+  FRENSIE_CHECK( !default_properties.isElectronRangeRejectionModeOn() );
   FRENSIE_CHECK_SMALL( default_properties.getElectronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getElectronRouletteSurvivalWeight(), 1e-30  );
 
@@ -488,6 +591,13 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::DIPOLE_DISTRIBUTION );
   FRENSIE_CHECK( !custom_properties.isAtomicExcitationModeOn() );
+  FRENSIE_CHECK( custom_properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getCondensedHistoryMaxEnergyLossFraction(), 0.1 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getCondensedHistoryMaxTransportMeanFreePaths(), 0.5 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getCondensedHistoryBremsstrahlungCutoffEnergy(), 1e-2 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getCondensedHistoryElectroionizationCutoffEnergy(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getMinElectronEnergyInCell( 2 ), 5e-2 );
+  FRENSIE_CHECK( custom_properties.isElectronRangeRejectionModeOn() );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronRouletteSurvivalWeight(), 1e-13 );
 }
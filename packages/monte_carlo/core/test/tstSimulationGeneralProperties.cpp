@@ -41,6 +41,19 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( properties.getNumberOfSnapshotsPerBatch(), 1 );
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !properties.isPooledParticleBankModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getRandomNumberGeneratorType(),
+                       Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+  FRENSIE_CHECK( !properties.isUnionizedEnergyGridModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getUnionizedEnergyGridConvergenceTolerance(),
+                       1e-3 );
+  FRENSIE_CHECK( !properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getEventBasedHistoryBatchSize(), 64 );
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleType(),
+                       MonteCarlo::STATIC_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleChunkSize(), 1 );
+  FRENSIE_CHECK( !properties.isIncrementalRendezvousModeOn() );
+  FRENSIE_CHECK( !properties.isOverlappedRendezvousModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -193,6 +206,170 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, setImplicitCaptureModeOnOff )
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that pooled particle bank mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setPooledParticleBankModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setPooledParticleBankModeOn();
+
+  FRENSIE_CHECK( properties.isPooledParticleBankModeOn() );
+
+  properties.setStandardParticleBankModeOn();
+
+  FRENSIE_CHECK( !properties.isPooledParticleBankModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the random number generator type can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setRandomNumberGeneratorType )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setRandomNumberGeneratorType( Utility::COUNTER_BASED_GENERATOR );
+
+  FRENSIE_CHECK_EQUAL( properties.getRandomNumberGeneratorType(),
+                       Utility::COUNTER_BASED_GENERATOR );
+
+  properties.setRandomNumberGeneratorType( Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+
+  FRENSIE_CHECK_EQUAL( properties.getRandomNumberGeneratorType(),
+                       Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+}
+
+//---------------------------------------------------------------------------//
+// Test that unionized energy grid mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setUnionizedEnergyGridModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setUnionizedEnergyGridModeOn();
+
+  FRENSIE_CHECK( properties.isUnionizedEnergyGridModeOn() );
+
+  properties.setUnionizedEnergyGridModeOff();
+
+  FRENSIE_CHECK( !properties.isUnionizedEnergyGridModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the unionized energy grid convergence tolerance can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setUnionizedEnergyGridConvergenceTolerance )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setUnionizedEnergyGridConvergenceTolerance( 1e-4 );
+
+  FRENSIE_CHECK_EQUAL( properties.getUnionizedEnergyGridConvergenceTolerance(),
+                       1e-4 );
+
+  FRENSIE_CHECK_THROW( properties.setUnionizedEnergyGridConvergenceTolerance( 0.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( properties.setUnionizedEnergyGridConvergenceTolerance( 1.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Test that event-based transport mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setEventBasedTransportModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setEventBasedTransportModeOn();
+
+  FRENSIE_CHECK( properties.isEventBasedTransportModeOn() );
+
+  properties.setHistoryBasedTransportModeOn();
+
+  FRENSIE_CHECK( !properties.isEventBasedTransportModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the event-based history batch size can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setEventBasedHistoryBatchSize )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setEventBasedHistoryBatchSize( 128 );
+
+  FRENSIE_CHECK_EQUAL( properties.getEventBasedHistoryBatchSize(), 128 );
+
+  FRENSIE_CHECK_THROW( properties.setEventBasedHistoryBatchSize( 0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the history schedule type can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setHistoryScheduleType )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setHistoryScheduleType( MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleType(),
+                       MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+
+  properties.setHistoryScheduleType( MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleType(),
+                       MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+
+  properties.setHistoryScheduleType( MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleType(),
+                       MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the history schedule chunk size can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setHistoryScheduleChunkSize )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setHistoryScheduleChunkSize( 100 );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleChunkSize(), 100 );
+
+  FRENSIE_CHECK_THROW( properties.setHistoryScheduleChunkSize( 0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Test that incremental rendezvous mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setIncrementalRendezvousModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setIncrementalRendezvousModeOn();
+
+  FRENSIE_CHECK( properties.isIncrementalRendezvousModeOn() );
+
+  properties.setIncrementalRendezvousModeOff();
+
+  FRENSIE_CHECK( !properties.isIncrementalRendezvousModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that overlapped rendezvous mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setOverlappedRendezvousModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setOverlappedRendezvousModeOn();
+
+  FRENSIE_CHECK( properties.isOverlappedRendezvousModeOn() );
+
+  properties.setOverlappedRendezvousModeOff();
+
+  FRENSIE_CHECK( !properties.isOverlappedRendezvousModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
@@ -226,6 +403,16 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
     custom_properties.setNumberOfBatchesPerProcessor( 25 );
     custom_properties.setNumberOfSnapshotsPerBatch( 3 );
     custom_properties.setImplicitCaptureModeOn();
+    custom_properties.setPooledParticleBankModeOn();
+    custom_properties.setRandomNumberGeneratorType( Utility::COUNTER_BASED_GENERATOR );
+    custom_properties.setUnionizedEnergyGridModeOn();
+    custom_properties.setUnionizedEnergyGridConvergenceTolerance( 1e-4 );
+    custom_properties.setEventBasedTransportModeOn();
+    custom_properties.setEventBasedHistoryBatchSize( 16 );
+    custom_properties.setHistoryScheduleType( MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE );
+    custom_properties.setHistoryScheduleChunkSize( 10 );
+    custom_properties.setIncrementalRendezvousModeOn();
+    custom_properties.setOverlappedRendezvousModeOn();
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -257,6 +444,19 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfSnapshotsPerBatch(), 1 );
   FRENSIE_CHECK( !default_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !default_properties.isPooledParticleBankModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getRandomNumberGeneratorType(),
+                       Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+  FRENSIE_CHECK( !default_properties.isUnionizedEnergyGridModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getUnionizedEnergyGridConvergenceTolerance(),
+                       1e-3 );
+  FRENSIE_CHECK( !default_properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getEventBasedHistoryBatchSize(), 64 );
+  FRENSIE_CHECK_EQUAL( default_properties.getHistoryScheduleType(),
+                       MonteCarlo::STATIC_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( default_properties.getHistoryScheduleChunkSize(), 1 );
+  FRENSIE_CHECK( !default_properties.isIncrementalRendezvousModeOn() );
+  FRENSIE_CHECK( !default_properties.isOverlappedRendezvousModeOn() );
 
   MonteCarlo::SimulationGeneralProperties custom_properties;
 
@@ -275,6 +475,19 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfBatchesPerProcessor(), 25 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfSnapshotsPerBatch(), 3 );
   FRENSIE_CHECK( custom_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( custom_properties.isPooledParticleBankModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getRandomNumberGeneratorType(),
+                       Utility::COUNTER_BASED_GENERATOR );
+  FRENSIE_CHECK( custom_properties.isUnionizedEnergyGridModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getUnionizedEnergyGridConvergenceTolerance(),
+                       1e-4 );
+  FRENSIE_CHECK( custom_properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getEventBasedHistoryBatchSize(), 16 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getHistoryScheduleType(),
+                       MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( custom_properties.getHistoryScheduleChunkSize(), 10 );
+  FRENSIE_CHECK( custom_properties.isIncrementalRendezvousModeOn() );
+  FRENSIE_CHECK( custom_properties.isOverlappedRendezvousModeOn() );
 }
 
 //---------------------------------------------------------------------------//
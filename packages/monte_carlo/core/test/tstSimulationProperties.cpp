@@ -138,6 +138,26 @@ FRENSIE_UNIT_TEST( SimulationProperties, getMinParticleEnergy )
                        1e-4 );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the min particle energy in a cell can be returned
+FRENSIE_UNIT_TEST( SimulationProperties, getMinParticleEnergyInCell )
+{
+  MonteCarlo::SimulationProperties properties;
+
+  properties.setMinElectronEnergyInCell( 2, 1e-2 );
+
+  FRENSIE_CHECK_EQUAL( properties.getMinParticleEnergyInCell<MonteCarlo::PhotonState>( 2 ),
+                       1e-3 );
+  FRENSIE_CHECK_EQUAL( properties.getMinParticleEnergyInCell<MonteCarlo::ElectronState>( 1 ),
+                       1e-4 );
+  FRENSIE_CHECK_EQUAL( properties.getMinParticleEnergyInCell<MonteCarlo::ElectronState>( 2 ),
+                       1e-2 );
+  FRENSIE_CHECK_EQUAL( properties.getMinParticleEnergyInCell<MonteCarlo::PositronState>( 2 ),
+                       1e-2 );
+  FRENSIE_CHECK_EQUAL( properties.getMinParticleEnergyInCell<MonteCarlo::AdjointElectronState>( 2 ),
+                       1e-4 );
+}
+
 //---------------------------------------------------------------------------//
 // Test that the max particle energy can be returned
 FRENSIE_UNIT_TEST( SimulationProperties, getMaxParticleEnergy )
@@ -72,7 +72,7 @@ public:
 
   //! Return the discretization for a dimension of the phase space
   template<ObserverPhaseSpaceDimension dimension, typename InputDataType>
-  void getDiscretization( InputDataType& bin_data );
+  void getDiscretization( InputDataType& bin_data ) const;
 
   //! Return the dimensions that have been discretized
   void getDiscretizedDimensions(
@@ -43,7 +43,7 @@ void DiscretizableParticleHistoryObserver::setDiscretization( const InputDataTyp
  * previously set dimension discretization.
  */
 template<ObserverPhaseSpaceDimension dimension, typename InputDataType>
-void DiscretizableParticleHistoryObserver::getDiscretization( InputDataType& bin_data )
+void DiscretizableParticleHistoryObserver::getDiscretization( InputDataType& bin_data ) const
 {
   // Make sure the DimensionType matches the type associated with the dimension
   testStaticPrecondition((boost::is_same<typename DefaultTypedObserverPhaseSpaceDimensionDiscretization<dimension>::InputDataType,InputDataType>::value));
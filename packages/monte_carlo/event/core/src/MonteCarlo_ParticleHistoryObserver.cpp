@@ -12,6 +12,7 @@
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleHistoryObserver.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -23,6 +24,12 @@ uint64_t ParticleHistoryObserver::s_num_histories = 0;
 // Initialize the elapsed time
 double ParticleHistoryObserver::s_elapsed_time = 0.0;
 
+// Initialize the number of history contribution slots per thread
+unsigned ParticleHistoryObserver::s_num_history_contribution_slots_per_thread = 1;
+
+// Initialize the history contribution slot of each thread
+thread_local unsigned ParticleHistoryObserver::s_history_contribution_slot = 0;
+
 // Set the number of particle histories that have been observed
 void ParticleHistoryObserver::setNumberOfHistories(
                                                  const uint64_t num_histories )
@@ -49,6 +56,115 @@ double ParticleHistoryObserver::getElapsedTime()
   return s_elapsed_time;
 }
 
+// Set the number of histories that a thread can have in flight
+/*! \details Observers store the uncommitted contribution of each history
+ * that is in flight separately so that the histories of a thread can be
+ * interleaved (e.g. with event-based transport). This must be set before
+ * thread support is enabled.
+ */
+void ParticleHistoryObserver::setNumberOfHistoryContributionSlotsPerThread(
+                                                    const unsigned num_slots )
+{
+  // Make sure the number of slots is valid
+  testPrecondition( num_slots > 0 );
+
+  s_num_history_contribution_slots_per_thread = num_slots;
+}
+
+// Return the number of histories that a thread can have in flight
+unsigned ParticleHistoryObserver::getNumberOfHistoryContributionSlotsPerThread()
+{
+  return s_num_history_contribution_slots_per_thread;
+}
+
+// Set the history contribution slot of the calling thread
+/*! \details Every contribution that the calling thread makes to an observer
+ * (and every commit) will use this slot until it is changed.
+ */
+void ParticleHistoryObserver::setHistoryContributionSlot( const unsigned slot )
+{
+  // Make sure the slot is valid
+  testPrecondition( slot < s_num_history_contribution_slots_per_thread );
+
+  s_history_contribution_slot = slot;
+}
+
+// Return the history contribution slot of the calling thread
+unsigned ParticleHistoryObserver::getHistoryContributionSlot()
+{
+  return s_history_contribution_slot;
+}
+
+// Return the index of the uncommitted contribution of the calling thread
+/*! \details Observers must use this index (instead of the thread id) to
+ * store the uncommitted contribution of the current history. The thread id
+ * must still be used for committed data.
+ */
+unsigned ParticleHistoryObserver::getHistoryContributionIndex()
+{
+  return Utility::OpenMPProperties::getThreadId()*
+    s_num_history_contribution_slots_per_thread + s_history_contribution_slot;
+}
+
+// Return the number of uncommitted contributions for the threads
+unsigned ParticleHistoryObserver::getNumberOfHistoryContributions(
+                                                   const unsigned num_threads )
+{
+  return num_threads*s_num_history_contribution_slots_per_thread;
+}
+
+// Return the number of summable values that will be packed for a reduction
+/*! \details Observers that do not override this method (and the packing
+ * methods) will be reduced with the reduceData method.
+ */
+size_t ParticleHistoryObserver::getNumberOfPackedReductionValues() const
+{
+  return 0;
+}
+
+// Pack the summable observer data for a reduction
+/*! \details The summable data (e.g. estimator moments) from every process
+ * will be packed into a single buffer so that it can be reduced with a single
+ * reduce operation (see MonteCarlo::EventHandler::reduceObserverData). The
+ * size of the packed data array must be equal to the value returned by
+ * getNumberOfPackedReductionValues.
+ */
+void ParticleHistoryObserver::packReductionData(
+                                 const Utility::ArrayView<double>& packed_data )
+{
+  // Make sure that the packed data array is valid
+  testPrecondition( packed_data.size() ==
+                    this->getNumberOfPackedReductionValues() );
+}
+
+// Unpack the summable observer data (replaces the current data)
+/*! \details This can be used to load packed data that was combined from
+ * several processes without a collective reduction (e.g. an overlapped
+ * rendezvous). The size of the packed data array must be equal to the value
+ * returned by getNumberOfPackedReductionValues.
+ */
+void ParticleHistoryObserver::unpackReductionData(
+                         const Utility::ArrayView<const double>& packed_data )
+{
+  // Make sure that the packed data array is valid
+  testPrecondition( packed_data.size() ==
+                    this->getNumberOfPackedReductionValues() );
+}
+
+// Reduce the object data using the reduced packed data (root only)
+/*! \details The reduced packed data will only be available on the root
+ * process (the array will be empty on all other processes). Any data that
+ * could not be packed must be reduced by this method. The default
+ * implementation simply calls reduceData.
+ */
+void ParticleHistoryObserver::reducePackedData(
+                  const Utility::Communicator& comm,
+                  const int root_process,
+                  const Utility::ArrayView<const double>& reduced_packed_data )
+{
+  this->reduceData( comm, root_process );
+}
+
 // Log a summary of the data
 void ParticleHistoryObserver::logSummary() const
 {
@@ -22,6 +22,7 @@
 
 // FRENSIE Includes
 #include "Utility_Communicator.hpp"
+#include "Utility_ArrayView.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_SerializationHelpers.hpp"
 
@@ -47,6 +48,25 @@ public:
   //! Set the elapsed time (for analysis of observer data)
   static void setElapsedTime( const double elapsed_time );
 
+  //! Set the number of histories that a thread can have in flight
+  static void setNumberOfHistoryContributionSlotsPerThread(
+                                                   const unsigned num_slots );
+
+  //! Return the number of histories that a thread can have in flight
+  static unsigned getNumberOfHistoryContributionSlotsPerThread();
+
+  //! Set the history contribution slot of the calling thread
+  static void setHistoryContributionSlot( const unsigned slot );
+
+  //! Return the history contribution slot of the calling thread
+  static unsigned getHistoryContributionSlot();
+
+  //! Return the index of the uncommitted contribution of the calling thread
+  static unsigned getHistoryContributionIndex();
+
+  //! Return the number of uncommitted contributions for the threads
+  static unsigned getNumberOfHistoryContributions( const unsigned num_threads );
+
   //! Enable support for multiple threads
   virtual void enableThreadSupport( const unsigned num_threads ) = 0;
 
@@ -67,14 +87,28 @@ public:
   virtual void reduceData( const Utility::Communicator& comm,
                            const int root_process ) = 0;
 
+  //! Return the number of summable values that will be packed for a reduction
+  virtual size_t getNumberOfPackedReductionValues() const;
+
+  //! Pack the summable observer data for a reduction
+  virtual void packReductionData( const Utility::ArrayView<double>& packed_data );
+
+  //! Unpack the summable observer data (replaces the current data)
+  virtual void unpackReductionData(
+                     const Utility::ArrayView<const double>& packed_data );
+
+  //! Reduce the object data using the reduced packed data (root only)
+  virtual void reducePackedData(
+                 const Utility::Communicator& comm,
+                 const int root_process,
+                 const Utility::ArrayView<const double>& reduced_packed_data );
+
   //! Print a summary of the data
   virtual void printSummary( std::ostream& os ) const = 0;
 
   //! Log a summary of the data
   virtual void logSummary() const;
 
-protected:
-
   //! Get the number of particle histories observed
   static uint64_t getNumberOfHistories();
 
@@ -96,6 +130,12 @@ private:
 
   // The elapsed time (used for the figure of merit calculation)
   static double s_elapsed_time;
+
+  // The number of histories that a thread can have in flight
+  static unsigned s_num_history_contribution_slots_per_thread;
+
+  // The history contribution slot of the calling thread
+  static thread_local unsigned s_history_contribution_slot;
 };
 
 } // end MonteCarlo namespace
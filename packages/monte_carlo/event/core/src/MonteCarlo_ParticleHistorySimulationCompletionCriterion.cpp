@@ -163,6 +163,45 @@ public:
     }
   }
 
+  //! Return the number of summable values that will be packed for a reduction
+  size_t getNumberOfPackedReductionValues() const final override
+  { return 1; }
+
+  //! Pack the summable criterion data for a reduction
+  void packReductionData( const Utility::ArrayView<double>& packed_data ) final override
+  {
+    // Make sure that the packed data array is valid
+    testPrecondition( packed_data.size() == 1 );
+
+    packed_data[0] = this->getNumberOfCompletedHistories();
+  }
+
+  //! Unpack the summable criterion data (replaces the current data)
+  void unpackReductionData( const Utility::ArrayView<const double>& packed_data ) final override
+  {
+    // Make sure that the packed data array is valid
+    testPrecondition( packed_data.size() == 1 );
+
+    this->resetData();
+
+    d_num_completed_histories.front() = (uint64_t)packed_data[0];
+  }
+
+  //! Reduce the criterion data using the reduced packed data (root only)
+  void reducePackedData(
+   const Utility::Communicator& comm,
+   const int root_process,
+   const Utility::ArrayView<const double>& reduced_packed_data ) final override
+  {
+    if( comm.size() > 1 )
+    {
+      if( comm.rank() == root_process )
+        this->unpackReductionData( reduced_packed_data );
+      else
+        this->resetData();
+    }
+  }
+
   //! Get a description of the criterion
   std::string description() const final override
   {
@@ -429,6 +468,70 @@ public:
     d_rhs->reduceData( comm, root_process );
   }
 
+  //! Return the number of summable values that will be packed for a reduction
+  size_t getNumberOfPackedReductionValues() const final override
+  {
+    return d_lhs->getNumberOfPackedReductionValues() +
+      d_rhs->getNumberOfPackedReductionValues();
+  }
+
+  //! Pack the summable criterion data for a reduction
+  void packReductionData( const Utility::ArrayView<double>& packed_data ) final override
+  {
+    // Make sure that the packed data array is valid
+    testPrecondition( packed_data.size() ==
+                      this->getNumberOfPackedReductionValues() );
+
+    const size_t lhs_size = d_lhs->getNumberOfPackedReductionValues();
+
+    d_lhs->packReductionData(
+                  Utility::ArrayView<double>( packed_data.data(), lhs_size ) );
+    d_rhs->packReductionData(
+                  Utility::ArrayView<double>( packed_data.data() + lhs_size,
+                                              packed_data.size() - lhs_size ) );
+  }
+
+  //! Unpack the summable criterion data (replaces the current data)
+  void unpackReductionData( const Utility::ArrayView<const double>& packed_data ) final override
+  {
+    // Make sure that the packed data array is valid
+    testPrecondition( packed_data.size() ==
+                      this->getNumberOfPackedReductionValues() );
+
+    const size_t lhs_size = d_lhs->getNumberOfPackedReductionValues();
+
+    d_lhs->unpackReductionData(
+            Utility::ArrayView<const double>( packed_data.data(), lhs_size ) );
+    d_rhs->unpackReductionData(
+            Utility::ArrayView<const double>( packed_data.data() + lhs_size,
+                                              packed_data.size() - lhs_size ) );
+  }
+
+  //! Reduce the criterion data using the reduced packed data (root only)
+  void reducePackedData(
+   const Utility::Communicator& comm,
+   const int root_process,
+   const Utility::ArrayView<const double>& reduced_packed_data ) final override
+  {
+    Utility::ArrayView<const double> lhs_reduced_packed_data;
+    Utility::ArrayView<const double> rhs_reduced_packed_data;
+
+    if( comm.rank() == root_process && comm.size() > 1 )
+    {
+      const size_t lhs_size = d_lhs->getNumberOfPackedReductionValues();
+
+      lhs_reduced_packed_data =
+        Utility::ArrayView<const double>( reduced_packed_data.data(),
+                                          lhs_size );
+      rhs_reduced_packed_data =
+        Utility::ArrayView<const double>( reduced_packed_data.data() + lhs_size,
+                                          reduced_packed_data.size() - lhs_size );
+    }
+
+    d_lhs->reducePackedData( comm, root_process, lhs_reduced_packed_data );
+    d_rhs->reducePackedData( comm, root_process, rhs_reduced_packed_data );
+  }
+
   //! Get a description of the criterion
   std::string description() const final override
   {
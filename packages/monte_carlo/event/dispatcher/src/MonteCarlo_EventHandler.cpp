@@ -539,6 +539,10 @@ void EventHandler::updateObserversFromParticleSimulationStoppedEvent()
 }
 
 // Commit the estimator history contributions
+/*! \details Only the contributions stored in the history contribution slot
+ * of the calling thread will be committed (see
+ * MonteCarlo::ParticleHistoryObserver::setHistoryContributionSlot).
+ */
 void EventHandler::commitObserverHistoryContributions()
 {
   ParticleHistoryObservers::iterator it =
@@ -644,7 +648,12 @@ void EventHandler::resetObserverData()
 
 // Reduce the observer data on all processes in comm and collect on the root
 /*! \details A Snapshot must be taken before the reduction to ensure that the
- * snapshot data stays in sync with the current data.
+ * snapshot data stays in sync with the current data. The summable data from
+ * every observer (e.g. estimator moments and histograms) is packed into a
+ * single buffer that is reduced with a single reduce operation. Any observer
+ * data that cannot be packed (e.g. estimator snapshots) is then reduced by
+ * each observer (see
+ * MonteCarlo::ParticleHistoryObserver::reducePackedData).
  */
 void EventHandler::reduceObserverData( const Utility::Communicator& comm,
                                        const int root_process )
@@ -693,19 +702,69 @@ void EventHandler::reduceObserverData( const Utility::Communicator& comm,
                              "event handler for number of committed "
                              "histories!" );
 
-    comm.barrier();
+    // Pack the summable observer data
+    std::vector<size_t> packed_data_offsets;
 
-    // Reduce the observers
-    ParticleHistoryObservers::iterator it =
-      d_particle_history_observers.begin();
+    this->calculatePackedObserverDataOffsets( packed_data_offsets );
+
+    std::vector<double> packed_data( packed_data_offsets.back() );
 
-    while( it != d_particle_history_observers.end() )
+    for( size_t i = 0; i < d_particle_history_observers.size(); ++i )
     {
-      (*it)->reduceData( comm, root_process );
+      d_particle_history_observers[i]->packReductionData(
+                  Utility::ArrayView<double>( packed_data.data() +
+                                              packed_data_offsets[i],
+                                              packed_data_offsets[i+1] -
+                                              packed_data_offsets[i] ) );
+    }
+
+    // Reduce the packed observer data
+    std::vector<double> reduced_packed_data;
 
-      comm.barrier();
+    if( !packed_data.empty() )
+    {
+      try{
+        if( comm.rank() == root_process )
+        {
+          reduced_packed_data.resize( packed_data.size() );
 
-      ++it;
+          Utility::reduce( comm,
+                           Utility::arrayViewOfConst( packed_data ),
+                           Utility::arrayView( reduced_packed_data ),
+                           std::plus<double>(),
+                           root_process );
+        }
+        else
+        {
+          Utility::reduce( comm,
+                           Utility::arrayViewOfConst( packed_data ),
+                           std::plus<double>(),
+                           root_process );
+        }
+      }
+      EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                               "Unable to perform mpi reduction in "
+                               "event handler for packed observer data!" );
+    }
+
+    // Reduce the observers
+    for( size_t i = 0; i < d_particle_history_observers.size(); ++i )
+    {
+      Utility::ArrayView<const double> reduced_observer_packed_data;
+
+      if( comm.rank() == root_process )
+      {
+        reduced_observer_packed_data =
+          Utility::ArrayView<const double>( reduced_packed_data.data() +
+                                            packed_data_offsets[i],
+                                            packed_data_offsets[i+1] -
+                                            packed_data_offsets[i] );
+      }
+
+      d_particle_history_observers[i]->reducePackedData(
+                                               comm,
+                                               root_process,
+                                               reduced_observer_packed_data );
     }
 
     // Reset the snapshot timer (no need to include reduction time)
@@ -715,6 +774,93 @@ void EventHandler::reduceObserverData( const Utility::Communicator& comm,
   }
 }
 
+// Return the number of values in the packed observer data
+/*! \details The number of committed histories is stored in the first
+ * value. The packed data of each observer follows.
+ */
+size_t EventHandler::getNumberOfPackedObserverValues() const
+{
+  std::vector<size_t> packed_data_offsets;
+
+  this->calculatePackedObserverDataOffsets( packed_data_offsets );
+
+  return packed_data_offsets.back() + 1;
+}
+
+// Pack the summable observer data (and the committed history count)
+/*! \details The packed data from several processes can be summed and then
+ * unpacked on a single process without a collective reduction (see
+ * MonteCarlo::ParticleHistoryObserver::packReductionData). Observer data
+ * that cannot be summed (e.g. snapshots) will not be packed.
+ */
+void EventHandler::packObserverData(
+                                 const Utility::ArrayView<double>& packed_data )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure that the packed data array is valid
+  testPrecondition( packed_data.size() ==
+                    this->getNumberOfPackedObserverValues() );
+
+  std::vector<size_t> packed_data_offsets;
+
+  this->calculatePackedObserverDataOffsets( packed_data_offsets );
+
+  packed_data[0] = this->getNumberOfCommittedHistories();
+
+  for( size_t i = 0; i < d_particle_history_observers.size(); ++i )
+  {
+    d_particle_history_observers[i]->packReductionData(
+              Utility::ArrayView<double>( packed_data.data() + 1 +
+                                          packed_data_offsets[i],
+                                          packed_data_offsets[i+1] -
+                                          packed_data_offsets[i] ) );
+  }
+}
+
+// Unpack the summable observer data (replaces the current data)
+void EventHandler::unpackObserverData(
+                         const Utility::ArrayView<const double>& packed_data )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure that the packed data array is valid
+  testPrecondition( packed_data.size() ==
+                    this->getNumberOfPackedObserverValues() );
+
+  std::vector<size_t> packed_data_offsets;
+
+  this->calculatePackedObserverDataOffsets( packed_data_offsets );
+
+  d_number_of_committed_histories.front() = (uint64_t)packed_data[0];
+
+  for( size_t i = 1; i < d_number_of_committed_histories.size(); ++i )
+    d_number_of_committed_histories[i] = 0;
+
+  for( size_t i = 0; i < d_particle_history_observers.size(); ++i )
+  {
+    d_particle_history_observers[i]->unpackReductionData(
+        Utility::ArrayView<const double>( packed_data.data() + 1 +
+                                          packed_data_offsets[i],
+                                          packed_data_offsets[i+1] -
+                                          packed_data_offsets[i] ) );
+  }
+}
+
+// Calculate the offset of each observer in the packed observer data
+void EventHandler::calculatePackedObserverDataOffsets(
+                                          std::vector<size_t>& offsets ) const
+{
+  offsets.clear();
+  offsets.resize( d_particle_history_observers.size() + 1, 0 );
+
+  for( size_t i = 0; i < d_particle_history_observers.size(); ++i )
+  {
+    offsets[i+1] = offsets[i] +
+      d_particle_history_observers[i]->getNumberOfPackedReductionValues();
+  }
+}
+
 // Get the number of particle histories that have been simulated
 uint64_t EventHandler::getNumberOfCommittedHistories() const
 {
@@ -146,6 +146,15 @@ public:
   void reduceObserverData( const Utility::Communicator& comm,
                            const int root_process );
 
+  //! Return the number of values in the packed observer data
+  size_t getNumberOfPackedObserverValues() const;
+
+  //! Pack the summable observer data (and the committed history count)
+  void packObserverData( const Utility::ArrayView<double>& packed_data );
+
+  //! Unpack the summable observer data (replaces the current data)
+  void unpackObserverData( const Utility::ArrayView<const double>& packed_data );
+
   //! Get the number of particle histories that have been committed
   uint64_t getNumberOfCommittedHistories() const;
 
@@ -173,6 +182,9 @@ private:
   // Reset the elapsed time since the last snapshot
   void resetElapsedTimeSinceLastSnapshot();
 
+  // Calculate the offset of each observer in the packed observer data
+  void calculatePackedObserverDataOffsets( std::vector<size_t>& offsets ) const;
+
   // Struct for registering estimator
   template<typename EstimatorType>
   struct EstimatorRegistrationHelper
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <memory>
 #include <cmath>
+#include <numeric>
 
 // FRENSIE Includes
 #include "MonteCarlo_EventHandler.hpp"
@@ -25,6 +26,7 @@
 #include "MonteCarlo_SimulationProperties.hpp"
 #include "Geometry_InfiniteMediumModel.hpp"
 #include "Utility_StructuredHexMesh.hpp"
+#include "Utility_LoggingMacros.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 #include "ArchiveTestHelpers.hpp"
 
@@ -2907,6 +2909,141 @@ FRENSIE_UNIT_TEST( EventHandler, update_parallel )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the packed observer data reduction gives the same results as the
+// reduction of each observer (the rendezvous times will be logged)
+FRENSIE_UNIT_TEST( EventHandler, reduceObserverData_packed )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  // Create two identical sets of estimators with many cells
+  std::vector<uint64_t> many_cell_ids( 2000 );
+  std::iota( many_cell_ids.begin(), many_cell_ids.end(), 1 );
+
+  std::vector<double> many_cell_volumes( many_cell_ids.size(), 1.0 );
+
+  std::vector<double> energy_bin_boundaries( {0.0, 0.1, 0.5, 1.0, 5.0, 10.0} );
+
+  std::vector<std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator> >
+    packed_estimators, estimators;
+
+  for( size_t i = 0; i < 5; ++i )
+  {
+    packed_estimators.emplace_back( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator( i, 1.0, many_cell_ids, many_cell_volumes ) );
+    estimators.emplace_back( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator( i, 1.0, many_cell_ids, many_cell_volumes ) );
+  }
+
+  MonteCarlo::EventHandler event_handler;
+
+  for( size_t i = 0; i < packed_estimators.size(); ++i )
+  {
+    packed_estimators[i]->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+    packed_estimators[i]->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>( energy_bin_boundaries );
+    packed_estimators[i]->enableSampleMomentHistogramsOnEntityBins();
+
+    estimators[i]->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+    estimators[i]->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>( energy_bin_boundaries );
+    estimators[i]->enableSampleMomentHistogramsOnEntityBins();
+
+    event_handler.addEstimator( packed_estimators[i] );
+  }
+
+  // Fill the estimators (the contributions are process dependent)
+  MonteCarlo::PhotonState photon( comm->rank() );
+  photon.setWeight( 1.0 + comm->rank() );
+
+  for( size_t history = 0; history < 10; ++history )
+  {
+    for( size_t i = history; i < many_cell_ids.size(); i += 3 )
+    {
+      photon.setEnergy( energy_bin_boundaries[(i+history)%5] + 0.01 );
+
+      for( size_t j = 0; j < packed_estimators.size(); ++j )
+      {
+        packed_estimators[j]->updateFromParticleCollidingInCellEvent( photon, many_cell_ids[i], 1.0 + j );
+        estimators[j]->updateFromParticleCollidingInCellEvent( photon, many_cell_ids[i], 1.0 + j );
+      }
+    }
+
+    for( size_t j = 0; j < packed_estimators.size(); ++j )
+    {
+      packed_estimators[j]->commitHistoryContribution();
+      estimators[j]->commitHistoryContribution();
+    }
+  }
+
+  // Reduce the data with a single packed reduction
+  comm->barrier();
+
+  std::shared_ptr<Utility::Timer> timer = comm->createTimer();
+  timer->start();
+
+  event_handler.reduceObserverData( *comm, 0 );
+
+  timer->stop();
+
+  const double packed_reduction_time = timer->elapsed().count();
+
+  // Reduce the data of each estimator
+  comm->barrier();
+
+  timer = comm->createTimer();
+  timer->start();
+
+  for( size_t i = 0; i < estimators.size(); ++i )
+  {
+    estimators[i]->reduceData( *comm, 0 );
+
+    comm->barrier();
+  }
+
+  timer->stop();
+
+  const double reduction_time = timer->elapsed().count();
+
+  if( comm->rank() == 0 )
+  {
+    FRENSIE_LOG_NOTIFICATION( "Observer data reduction time (" << comm->size()
+                              << " procs): packed = " << packed_reduction_time
+                              << " s, per estimator = " << reduction_time
+                              << " s" );
+  }
+
+  for( size_t i = 0; i < estimators.size(); ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY( std::vector<double>( packed_estimators[i]->getTotalDataFirstMoments().begin(), packed_estimators[i]->getTotalDataFirstMoments().end() ),
+                                     std::vector<double>( estimators[i]->getTotalDataFirstMoments().begin(), estimators[i]->getTotalDataFirstMoments().end() ),
+                                     1e-12 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( std::vector<double>( packed_estimators[i]->getTotalDataSecondMoments().begin(), packed_estimators[i]->getTotalDataSecondMoments().end() ),
+                                     std::vector<double>( estimators[i]->getTotalDataSecondMoments().begin(), estimators[i]->getTotalDataSecondMoments().end() ),
+                                     1e-12 );
+
+    for( size_t j = 0; j < many_cell_ids.size(); j += 7 )
+    {
+      FRENSIE_CHECK_FLOATING_EQUALITY( std::vector<double>( packed_estimators[i]->getEntityBinDataFirstMoments( many_cell_ids[j] ).begin(), packed_estimators[i]->getEntityBinDataFirstMoments( many_cell_ids[j] ).end() ),
+                                       std::vector<double>( estimators[i]->getEntityBinDataFirstMoments( many_cell_ids[j] ).begin(), estimators[i]->getEntityBinDataFirstMoments( many_cell_ids[j] ).end() ),
+                                       1e-12 );
+      FRENSIE_CHECK_FLOATING_EQUALITY( std::vector<double>( packed_estimators[i]->getEntityBinDataFourthMoments( many_cell_ids[j] ).begin(), packed_estimators[i]->getEntityBinDataFourthMoments( many_cell_ids[j] ).end() ),
+                                       std::vector<double>( estimators[i]->getEntityBinDataFourthMoments( many_cell_ids[j] ).begin(), estimators[i]->getEntityBinDataFourthMoments( many_cell_ids[j] ).end() ),
+                                       1e-12 );
+      FRENSIE_CHECK_FLOATING_EQUALITY( std::vector<double>( packed_estimators[i]->getEntityTotalDataFirstMoments( many_cell_ids[j] ).begin(), packed_estimators[i]->getEntityTotalDataFirstMoments( many_cell_ids[j] ).end() ),
+                                       std::vector<double>( estimators[i]->getEntityTotalDataFirstMoments( many_cell_ids[j] ).begin(), estimators[i]->getEntityTotalDataFirstMoments( many_cell_ids[j] ).end() ),
+                                       1e-12 );
+
+      Utility::SampleMomentHistogram<double> packed_histogram, histogram;
+
+      packed_estimators[i]->getEntityBinSampleMomentHistogram( many_cell_ids[j], 1, packed_histogram );
+      estimators[i]->getEntityBinSampleMomentHistogram( many_cell_ids[j], 1, histogram );
+
+      FRENSIE_CHECK_EQUAL( packed_histogram.getNumberOfScores(),
+                           histogram.getNumberOfScores() );
+      FRENSIE_CHECK_EQUAL( packed_histogram.getHistogramValues(),
+                           histogram.getHistogramValues() );
+    }
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that the observer summaries can be printed
 FRENSIE_UNIT_TEST( EventHandler, printObserverSummaries )
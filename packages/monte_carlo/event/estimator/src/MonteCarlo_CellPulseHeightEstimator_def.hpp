@@ -104,7 +104,7 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
   // Make sure that the particle type is assigned
   testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
 
-  unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+  const unsigned contribution_index = this->getHistoryContributionIndex();
 
   double energy_contribution = particle.getWeight()*particle.getEnergy();
 
@@ -112,14 +112,14 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
 
   double charge_contribution = particle.getWeight()*particle.getCharge();
 
-  this->addInfoToUpdateTracker( thread_id,
+  this->addInfoToUpdateTracker( contribution_index,
                                 cell_entering,
                                 particle.getSourceWeight(),
                                 energy_contribution,
                                 charge_contribution );
 
   // Indicate that there is an uncommitted history contribution
-  this->setHasUncommittedHistoryContribution( thread_id );
+  this->setHasUncommittedHistoryContribution( contribution_index );
 }
 
 // Add current history estimator contribution
@@ -135,7 +135,7 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
 {
   // Make sure that the particle type is assigned
   testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
-  unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+  const unsigned contribution_index = this->getHistoryContributionIndex();
 
   double energy_contribution = particle.getWeight()*particle.getEnergy();
 
@@ -145,36 +145,36 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
 
   double charge_contribution = -particle.getWeight()*particle.getCharge();
 
-  this->addInfoToUpdateTracker( thread_id,
+  this->addInfoToUpdateTracker( contribution_index,
                                 cell_leaving,
                                 particle.getSourceWeight(),
                                 energy_contribution,
                                 charge_contribution );
 
   // Indicate that there is an uncommitted history contribution
-  this->setHasUncommittedHistoryContribution( thread_id );
+  this->setHasUncommittedHistoryContribution( contribution_index );
 }
 
 // Add estimator contribution from a portion of the current history
 template<typename ContributionMultiplierPolicy>
 void CellPulseHeightEstimator<ContributionMultiplierPolicy>::commitHistoryContribution()
 {
-  unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+  const unsigned contribution_index = this->getHistoryContributionIndex();
 
   typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator
     cell_data, end_cell_data;
 
-  this->getCellIteratorFromUpdateTracker( thread_id, cell_data, end_cell_data );
+  this->getCellIteratorFromUpdateTracker( contribution_index, cell_data, end_cell_data );
 
   double energy_deposition_in_all_cells = 0.0;
   double charge_deposition_in_all_cells = 0.0;
-  double source_weight = d_update_tracker[thread_id].first;
+  double source_weight = d_update_tracker[contribution_index].first;
 
   size_t bin_index;
   double bin_contribution;
 
   Estimator::DimensionValueMap& thread_dimension_values =
-    d_dimension_values[thread_id];
+    d_dimension_values[contribution_index];
 
   while( cell_data != end_cell_data )
   {
@@ -241,10 +241,10 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::commitHistoryContri
   }
 
   // Reset the update tracker
-  this->resetUpdateTracker( thread_id );
+  this->resetUpdateTracker( contribution_index );
 
   // Reset the has uncommitted history contribution boolean
-  this->unsetHasUncommittedHistoryContribution( thread_id );
+  this->unsetHasUncommittedHistoryContribution( contribution_index );
 }
 
 // Print the estimator data
@@ -268,11 +268,11 @@ CellPulseHeightEstimator<ContributionMultiplierPolicy>::enableThreadSupport(
 
   EntityEstimator::enableThreadSupport( num_threads );
 
-  // Add thread support to update tracker
-  d_update_tracker.resize( num_threads );
+  // Add thread support to update tracker (one for each history in flight)
+  d_update_tracker.resize( this->getNumberOfHistoryContributions( num_threads ) );
 
   // Add thread support to the dimension values
-  d_dimension_values.resize( num_threads );
+  d_dimension_values.resize( d_update_tracker.size() );
 }
 
 // Reset the estimator data
@@ -396,16 +396,16 @@ inline double CellPulseHeightEstimator<ContributionMultiplierPolicy>::calculateH
 // Add info to update tracker
 template<typename ContributionMultiplierPolicy>
 void CellPulseHeightEstimator<ContributionMultiplierPolicy>::addInfoToUpdateTracker(
-                                             const unsigned thread_id,
+                                             const unsigned contribution_index,
                                              const CellIdType cell_id,
                                              const double source_weight,
                                              const double energy_contribution,
                                              const double charge_contribution )
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the contribution index is valid
+  testPrecondition( contribution_index < d_update_tracker.size() );
 
-  SerialUpdateTracker& thread_update_tracker = d_update_tracker[thread_id];
+  SerialUpdateTracker& thread_update_tracker = d_update_tracker[contribution_index];
 
   auto cell_it = thread_update_tracker.second.find( cell_id );
 
@@ -427,28 +427,28 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::addInfoToUpdateTrac
 // Get the entity iterators from the update tracker
 template<typename ContributionMultiplierPolicy>
 void CellPulseHeightEstimator<ContributionMultiplierPolicy>::getCellIteratorFromUpdateTracker(
-                 const unsigned thread_id,
+                 const unsigned contribution_index,
                  typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& start_cell,
                 typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& end_cell ) const
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the contribution index is valid
+  testPrecondition( contribution_index < d_update_tracker.size() );
 
-  start_cell = d_update_tracker[thread_id].second.begin();
-  end_cell = d_update_tracker[thread_id].second.end();
+  start_cell = d_update_tracker[contribution_index].second.begin();
+  end_cell = d_update_tracker[contribution_index].second.end();
 }
 
 // Reset the update tracker
 template<typename ContributionMultiplierPolicy>
 void
 CellPulseHeightEstimator<ContributionMultiplierPolicy>::resetUpdateTracker(
-                                                     const unsigned thread_id )
+                                            const unsigned contribution_index )
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the contribution index is valid
+  testPrecondition( contribution_index < d_update_tracker.size() );
 
-  d_update_tracker[thread_id].first = 0.0;
-  d_update_tracker[thread_id].second.clear();
+  d_update_tracker[contribution_index].first = 0.0;
+  d_update_tracker[contribution_index].second.clear();
 }
 
 // Save the data to an archive
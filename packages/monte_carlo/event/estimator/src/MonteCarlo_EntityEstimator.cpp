@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_EntityEstimator.hpp"
@@ -18,6 +21,7 @@ namespace MonteCarlo{
 
 // Default constructor
 EntityEstimator::EntityEstimator()
+  : d_number_of_tally_threads( 0 )
 { /* ... */ }
 
 // Constructor with no entities (for mesh estimators)
@@ -34,7 +38,12 @@ EntityEstimator::EntityEstimator( const Id id,
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
     d_entity_estimator_histograms_map(),
-    d_entity_norm_constants_map()
+    d_entity_norm_constants_map(),
+    d_number_of_tally_threads( 0 ),
+    d_thread_estimator_total_bin_data(),
+    d_thread_entity_estimator_moments_maps(),
+    d_thread_estimator_total_bin_histograms(),
+    d_thread_entity_estimator_histograms_maps()
 { /* ... */ }
 
 // Return the entity ids associated with this estimator
@@ -189,6 +198,9 @@ void EntityEstimator::takeSnapshot( const uint64_t num_histories_since_last_snap
 {
   // Make sure only the root thread calls this
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  // The snapshot must include the contributions from every thread
+  EntityEstimator::mergeThreadTallies();
   
   if( d_entity_bin_snapshots_enabled )
   {
@@ -482,6 +494,7 @@ void EntityEstimator::enableSampleMomentHistogramsOnEntityBins()
 
   this->initializeEntityEstimatorHistogramsMap();
   this->resizeEstimatorTotalHistograms();
+  this->reinitializeThreadTallies();
 }
 
 // Check if sample moment histograms are enabled on on entity bins
@@ -529,6 +542,56 @@ void EntityEstimator::getTotalBinSampleMomentHistogram(
     histogram = d_estimator_total_bin_histograms[bin_index];
 }
 
+// Enable support for multiple threads
+/*! \details Each worker thread will be given a separate tally that history
+ * contributions get committed to. This removes the need for a critical
+ * section when committing history contributions. The master thread commits
+ * its history contributions directly to the estimator data. The worker
+ * thread tallies are only merged with the estimator data when
+ * EntityEstimator::mergeThreadTallies is called (a snapshot or a reduction
+ * will also merge the thread tallies).
+ */
+void EntityEstimator::enableThreadSupport( const unsigned num_threads )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  Estimator::enableThreadSupport( num_threads );
+
+  this->initializeThreadTallies( num_threads );
+}
+
+// Merge the history contributions that have been committed by each thread
+/*! \details The worker thread tallies are always merged in thread order so
+ * that the merged estimator data does not depend on the order in which the
+ * threads finished committing their history contributions. The worker
+ * thread tallies will be reset after the merge. Only the master thread
+ * should call this method (outside of any parallel regions).
+ */
+void EntityEstimator::mergeThreadTallies()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( this->areThreadTalliesEnabled() )
+  {
+    EntityEstimator::mergeThreadData( d_thread_estimator_total_bin_data,
+                                      d_estimator_total_bin_data );
+
+    EntityEstimator::mergeThreadData( d_thread_entity_estimator_moments_maps,
+                                      d_entity_estimator_moments_map );
+
+    if( d_entity_bin_histograms_enabled )
+    {
+      EntityEstimator::mergeThreadData( d_thread_estimator_total_bin_histograms,
+                                        d_estimator_total_bin_histograms );
+
+      EntityEstimator::mergeThreadData( d_thread_entity_estimator_histograms_maps,
+                                        d_entity_estimator_histograms_map );
+    }
+  }
+}
+
 // Reset the estimator data
 void EntityEstimator::resetData()
 {
@@ -562,6 +625,19 @@ void EntityEstimator::resetData()
         histogram.reset();
     }
   }
+
+  // Reset the thread data
+  for( auto&& thread_data : d_thread_estimator_total_bin_data )
+    EntityEstimator::resetThreadData( thread_data );
+
+  for( auto&& thread_data : d_thread_entity_estimator_moments_maps )
+    EntityEstimator::resetThreadData( thread_data );
+
+  for( auto&& thread_data : d_thread_estimator_total_bin_histograms )
+    EntityEstimator::resetThreadData( thread_data );
+
+  for( auto&& thread_data : d_thread_entity_estimator_histograms_maps )
+    EntityEstimator::resetThreadData( thread_data );
 }
 
 // Reduce estimator data on all processes and collect on the root process
@@ -571,6 +647,9 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
+  // The thread tallies must be merged before the process data is reduced
+  EntityEstimator::mergeThreadTallies();
+
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
@@ -640,6 +719,265 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
   Estimator::reduceData( comm, root_process );
 }
 
+// Return the number of summable values that will be packed for a reduction
+size_t EntityEstimator::getNumberOfPackedReductionValues() const
+{
+  std::set<EntityId> entity_ids;
+
+  this->getEntityIds( entity_ids );
+
+  size_t number_of_values =
+    EntityEstimator::getNumberOfPackedValues( d_estimator_total_bin_data ) +
+    EntityEstimator::getNumberOfPackedEntityValues(
+                                  entity_ids, d_entity_estimator_moments_map );
+
+  if( d_entity_bin_histograms_enabled )
+  {
+    number_of_values +=
+      EntityEstimator::getNumberOfPackedValues( d_estimator_total_bin_histograms ) +
+      EntityEstimator::getNumberOfPackedEntityValues(
+                               entity_ids, d_entity_estimator_histograms_map );
+  }
+
+  return number_of_values;
+}
+
+// Pack the summable estimator data for a reduction
+/*! \details The total bin moments and the entity bin moments are packed
+ * (followed by the total and entity bin histograms if they have been
+ * enabled). The thread tallies will be merged before the data is packed.
+ */
+void EntityEstimator::packReductionData(
+                                 const Utility::ArrayView<double>& packed_data )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure that the packed data array is valid
+  testPrecondition( packed_data.size() ==
+                    EntityEstimator::getNumberOfPackedReductionValues() );
+
+  // The thread tallies must be merged before the process data is packed
+  EntityEstimator::mergeThreadTallies();
+
+  std::set<EntityId> entity_ids;
+
+  this->getEntityIds( entity_ids );
+
+  double* packed_value = packed_data.data();
+
+  EntityEstimator::packValues( d_estimator_total_bin_data, packed_value );
+  EntityEstimator::packEntityValues( entity_ids,
+                                     d_entity_estimator_moments_map,
+                                     packed_value );
+
+  if( d_entity_bin_histograms_enabled )
+  {
+    EntityEstimator::packValues( d_estimator_total_bin_histograms,
+                                 packed_value );
+    EntityEstimator::packEntityValues( entity_ids,
+                                       d_entity_estimator_histograms_map,
+                                       packed_value );
+  }
+
+  // Make sure that all of the values were packed
+  testPostcondition( packed_value == packed_data.data() + packed_data.size() );
+}
+
+// Unpack the summable estimator data (replaces the current data)
+/*! \details The packed data must have the layout created by
+ * packReductionData. The snapshot data will not be changed.
+ */
+void EntityEstimator::unpackReductionData(
+                         const Utility::ArrayView<const double>& packed_data )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure that the packed data array is valid
+  testPrecondition( packed_data.size() ==
+                    EntityEstimator::getNumberOfPackedReductionValues() );
+
+  std::set<EntityId> entity_ids;
+
+  this->getEntityIds( entity_ids );
+
+  const double* packed_value = packed_data.data();
+
+  EntityEstimator::unpackValues( packed_value, d_estimator_total_bin_data );
+  EntityEstimator::unpackEntityValues( entity_ids,
+                                       packed_value,
+                                       d_entity_estimator_moments_map );
+
+  if( d_entity_bin_histograms_enabled )
+  {
+    EntityEstimator::unpackValues( packed_value,
+                                   d_estimator_total_bin_histograms );
+    EntityEstimator::unpackEntityValues( entity_ids,
+                                         packed_value,
+                                         d_entity_estimator_histograms_map );
+  }
+
+  // Make sure that all of the values were unpacked
+  testPostcondition( packed_value == packed_data.data() + packed_data.size() );
+}
+
+// Reduce the estimator data using the reduced packed data (root only)
+/*! \details The snapshot data cannot be summed (the snapshots from each
+ * process are merged) so it will still be gathered on the root process.
+ */
+void EntityEstimator::reducePackedData(
+                  const Utility::Communicator& comm,
+                  const int root_process,
+                  const Utility::ArrayView<const double>& reduced_packed_data )
+{
+  // Make sure the root process is valid
+  testPrecondition( root_process < comm.size() );
+
+  // Only do the reduction if there is more than one process
+  if( comm.size() > 1 )
+  {
+    if( comm.rank() == root_process )
+      EntityEstimator::unpackReductionData( reduced_packed_data );
+
+    if( d_entity_bin_snapshots_enabled )
+    {
+      // Reduce the entity bin snapshot data
+      try{
+        this->reduceEntitySnapshotMaps( comm, root_process, d_entity_estimator_moments_snapshots_map );
+      }
+      EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                               "Unable to perform mpi reduction in entity "
+                               "estimator " << this->getId() << " for entity "
+                               "bin snapshot data!" );
+
+      // Reduce the total bin snapshot data
+      try{
+        this->reduceSnapshots( comm, root_process, d_estimator_total_bin_data_snapshots );
+      }
+      EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                               "Unable to perform mpi reduction in entity "
+                               "estimator " << this->getId() << " for total "
+                               "bin snapshot data!" );
+    }
+  }
+
+  Estimator::reduceData( comm, root_process );
+}
+
+// Return the number of packed values in a collection
+size_t EntityEstimator::getNumberOfPackedValues(
+                             const FourEstimatorMomentsCollection& collection )
+{
+  return 4*collection.size();
+}
+
+// Return the number of packed values in a histogram array
+/*! \details The number of scores is packed after the values of each
+ * histogram.
+ */
+size_t EntityEstimator::getNumberOfPackedValues(
+                              const SampleMomentHistogramArray& histogram_array )
+{
+  size_t number_of_values = 0;
+
+  for( auto&& histogram : histogram_array )
+    number_of_values += histogram.getHistogramValues().size() + 1;
+
+  return number_of_values;
+}
+
+// Pack the collection values
+void EntityEstimator::packValues(
+                             const FourEstimatorMomentsCollection& collection,
+                             double*& packed_value )
+{
+  const size_t size = collection.size();
+
+  packed_value = std::copy( Utility::getCurrentScores<1>( collection ),
+                            Utility::getCurrentScores<1>( collection ) + size,
+                            packed_value );
+
+  packed_value = std::copy( Utility::getCurrentScores<2>( collection ),
+                            Utility::getCurrentScores<2>( collection ) + size,
+                            packed_value );
+
+  packed_value = std::copy( Utility::getCurrentScores<3>( collection ),
+                            Utility::getCurrentScores<3>( collection ) + size,
+                            packed_value );
+
+  packed_value = std::copy( Utility::getCurrentScores<4>( collection ),
+                            Utility::getCurrentScores<4>( collection ) + size,
+                            packed_value );
+}
+
+// Pack the histogram array values
+void EntityEstimator::packValues(
+                             const SampleMomentHistogramArray& histogram_array,
+                             double*& packed_value )
+{
+  for( auto&& histogram : histogram_array )
+  {
+    const std::vector<double>& histogram_values =
+      histogram.getHistogramValues();
+
+    packed_value = std::copy( histogram_values.begin(),
+                              histogram_values.end(),
+                              packed_value );
+
+    *packed_value = histogram.getNumberOfScores();
+
+    ++packed_value;
+  }
+}
+
+// Unpack the collection values
+void EntityEstimator::unpackValues(
+                                 const double*& packed_value,
+                                 FourEstimatorMomentsCollection& collection )
+{
+  const size_t size = collection.size();
+
+  std::copy( packed_value,
+             packed_value + size,
+             Utility::getCurrentScores<1>( collection ) );
+
+  packed_value += size;
+
+  std::copy( packed_value,
+             packed_value + size,
+             Utility::getCurrentScores<2>( collection ) );
+
+  packed_value += size;
+
+  std::copy( packed_value,
+             packed_value + size,
+             Utility::getCurrentScores<3>( collection ) );
+
+  packed_value += size;
+
+  std::copy( packed_value,
+             packed_value + size,
+             Utility::getCurrentScores<4>( collection ) );
+
+  packed_value += size;
+}
+
+// Unpack the histogram array values
+void EntityEstimator::unpackValues(
+                                 const double*& packed_value,
+                                 SampleMomentHistogramArray& histogram_array )
+{
+  for( auto&& histogram : histogram_array )
+  {
+    const size_t size = histogram.getHistogramValues().size();
+
+    histogram.setHistogramValues(
+                          Utility::ArrayView<const double>( packed_value, size ),
+                          static_cast<uint64_t>( packed_value[size] ) );
+
+    packed_value += size + 1;
+  }
+}
+
 // Reduce the entity collection maps
 void EntityEstimator::reduceEntityCollectionMaps(
                     const Utility::Communicator& comm,
@@ -945,6 +1283,9 @@ void EntityEstimator::assignEntities(
   this->resizeEstimatorTotalCollection();
   this->resizeEstimatorTotalSnapshots();
   this->resizeEstimatorTotalHistograms();
+
+  // Resize the thread data
+  this->reinitializeThreadTallies();
 }
 
 // Assign discretization to an estimator dimension
@@ -974,6 +1315,9 @@ void EntityEstimator::assignDiscretization(
 
   // Resize the estimator total histograms
   this->resizeEstimatorTotalHistograms();
+
+  // Resize the thread data
+  this->reinitializeThreadTallies();
 }
 
 // Set the response functions
@@ -999,6 +1343,9 @@ void EntityEstimator::assignResponseFunction(
 
   // Resize the estimator total histograms
   this->resizeEstimatorTotalHistograms();
+
+  // Resize the thread data
+  this->reinitializeThreadTallies();
 }
 
 // Assign the history score pdf bins
@@ -1017,6 +1364,9 @@ void EntityEstimator::assignSampleMomentHistogramBins( const std::shared_ptr<con
         histogram.setBinBoundaries( bins );
     }
   }
+
+  // Reset the thread histogram bins
+  this->reinitializeThreadTallies();
 }
 
 // Commit history contribution to a bin of an entity
@@ -1032,14 +1382,27 @@ void EntityEstimator::commitHistoryContributionToBinOfEntity(
 		    this->getNumberOfBins()*
                     this->getNumberOfResponseFunctions() );
 
-  FourEstimatorMomentsCollection& entity_estimator_moments =
-    d_entity_estimator_moments_map.find( entity_id )->second;
-
-  // Update the moments
-  #pragma omp critical
+  if( this->areThreadTalliesEnabled() )
   {
+    // Update the moments of the thread tally (no critical section needed)
+    FourEstimatorMomentsCollection& entity_estimator_moments =
+      EntityEstimator::getThreadData( d_entity_estimator_moments_map,
+                                      d_thread_entity_estimator_moments_maps,
+                                      Utility::OpenMPProperties::getThreadId() ).find( entity_id )->second;
+
     entity_estimator_moments.addRawScore( bin_index, contribution );
   }
+  else
+  {
+    FourEstimatorMomentsCollection& entity_estimator_moments =
+      d_entity_estimator_moments_map.find( entity_id )->second;
+
+    // Update the moments
+    #pragma omp critical
+    {
+      entity_estimator_moments.addRawScore( bin_index, contribution );
+    }
+  }
 
   this->addHistoryContributionToEntityBinHistogram( entity_id,
                                                     bin_index,
@@ -1061,14 +1424,27 @@ void EntityEstimator::addHistoryContributionToEntityBinHistogram(
 
   if( d_entity_bin_histograms_enabled )
   {
-    Utility::SampleMomentHistogram<double>& histogram =
-      d_entity_estimator_histograms_map.find( entity_id )->second[bin_index];
-
-    // Update the histogram
-    #pragma omp critical
+    if( this->areThreadTalliesEnabled() )
     {
+      // Update the histogram of the thread tally
+      Utility::SampleMomentHistogram<double>& histogram =
+        EntityEstimator::getThreadData( d_entity_estimator_histograms_map,
+                                        d_thread_entity_estimator_histograms_maps,
+                                        Utility::OpenMPProperties::getThreadId() ).find( entity_id )->second[bin_index];
+
       histogram.addRawScore( contribution );
     }
+    else
+    {
+      Utility::SampleMomentHistogram<double>& histogram =
+        d_entity_estimator_histograms_map.find( entity_id )->second[bin_index];
+
+      // Update the histogram
+      #pragma omp critical
+      {
+        histogram.addRawScore( contribution );
+      }
+    }
   }
 }
 
@@ -1082,10 +1458,20 @@ void EntityEstimator::commitHistoryContributionToBinOfTotal(
 		    this->getNumberOfBins()*
                     this->getNumberOfResponseFunctions() );
 
-  // Update the moments
-  #pragma omp critical
+  if( this->areThreadTalliesEnabled() )
+  {
+    // Update the moments of the thread tally (no critical section needed)
+    EntityEstimator::getThreadData( d_estimator_total_bin_data,
+                                    d_thread_estimator_total_bin_data,
+                                    Utility::OpenMPProperties::getThreadId() ).addRawScore( bin_index, contribution );
+  }
+  else
   {
-    d_estimator_total_bin_data.addRawScore( bin_index, contribution );
+    // Update the moments
+    #pragma omp critical
+    {
+      d_estimator_total_bin_data.addRawScore( bin_index, contribution );
+    }
   }
 
   this->addHistoryContributionToTotalBinHistogram( bin_index, contribution );
@@ -1103,12 +1489,22 @@ void EntityEstimator::addHistoryContributionToTotalBinHistogram(
 
   if( d_entity_bin_histograms_enabled )
   {
-    Utility::SampleMomentHistogram<double>& histogram =
-      d_estimator_total_bin_histograms[bin_index];
-
-    #pragma omp critical
+    if( this->areThreadTalliesEnabled() )
     {
-      histogram.addRawScore( contribution );
+      // Update the histogram of the thread tally
+      EntityEstimator::getThreadData( d_estimator_total_bin_histograms,
+                                      d_thread_estimator_total_bin_histograms,
+                                      Utility::OpenMPProperties::getThreadId() )[bin_index].addRawScore( contribution );
+    }
+    else
+    {
+      Utility::SampleMomentHistogram<double>& histogram =
+        d_estimator_total_bin_histograms[bin_index];
+
+      #pragma omp critical
+      {
+        histogram.addRawScore( contribution );
+      }
     }
   }
 }
@@ -1338,6 +1734,151 @@ void EntityEstimator::resizeEstimatorTotalHistograms()
   }
 }
 
+// Check if thread tallies have been enabled
+bool EntityEstimator::areThreadTalliesEnabled() const
+{
+  return d_number_of_tally_threads > 1;
+}
+
+// Return the number of threads that have a separate tally
+unsigned EntityEstimator::getNumberOfTallyThreads() const
+{
+  return d_number_of_tally_threads;
+}
+
+// Initialize the thread tallies
+void EntityEstimator::initializeThreadTallies( const unsigned num_threads )
+{
+  d_number_of_tally_threads = num_threads;
+
+  EntityEstimator::initializeThreadData( d_estimator_total_bin_data,
+                                         num_threads,
+                                         d_thread_estimator_total_bin_data );
+
+  EntityEstimator::initializeThreadData( d_entity_estimator_moments_map,
+                                         num_threads,
+                                         d_thread_entity_estimator_moments_maps );
+
+  EntityEstimator::initializeThreadData( d_estimator_total_bin_histograms,
+                                         num_threads,
+                                         d_thread_estimator_total_bin_histograms );
+
+  EntityEstimator::initializeThreadData( d_entity_estimator_histograms_map,
+                                         num_threads,
+                                         d_thread_entity_estimator_histograms_maps );
+}
+
+// Reinitialize the thread tallies (after the estimator data has been resized)
+/*! \details The thread tallies will be rebuilt from the estimator data so
+ * this should only be called before any history contributions have been
+ * committed to the thread tallies.
+ */
+void EntityEstimator::reinitializeThreadTallies()
+{
+  if( this->areThreadTalliesEnabled() )
+    this->initializeThreadTallies( d_number_of_tally_threads );
+}
+
+// Reset the thread data
+void EntityEstimator::resetThreadData(
+                                 FourEstimatorMomentsCollection& thread_data )
+{
+  thread_data.reset();
+}
+
+// Reset the thread data
+void EntityEstimator::resetThreadData(
+                            EntityEstimatorMomentsCollectionMap& thread_data )
+{
+  for( auto&& entity_data : thread_data )
+    entity_data.second.reset();
+}
+
+// Reset the thread data
+void EntityEstimator::resetThreadData( SampleMomentHistogramArray& thread_data )
+{
+  for( auto&& histogram : thread_data )
+    histogram.reset();
+}
+
+// Reset the thread data
+void EntityEstimator::resetThreadData(
+                   EntityEstimatorSampleMomentHistogramArrayMap& thread_data )
+{
+  for( auto&& entity_data : thread_data )
+  {
+    for( auto&& histogram : entity_data.second )
+      histogram.reset();
+  }
+}
+
+// Merge the worker thread data with the master thread data
+void EntityEstimator::mergeThreadData(
+            std::vector<FourEstimatorMomentsCollection>& worker_thread_data,
+            FourEstimatorMomentsCollection& master_thread_data )
+{
+  for( auto&& thread_data : worker_thread_data )
+  {
+    master_thread_data.mergeCollections( thread_data );
+
+    thread_data.reset();
+  }
+}
+
+// Merge the worker thread data with the master thread data
+void EntityEstimator::mergeThreadData(
+       std::vector<EntityEstimatorMomentsCollectionMap>& worker_thread_data,
+       EntityEstimatorMomentsCollectionMap& master_thread_data )
+{
+  for( auto&& thread_data : worker_thread_data )
+  {
+    for( auto&& entity_data : thread_data )
+    {
+      master_thread_data.find( entity_data.first )->second.mergeCollections( entity_data.second );
+
+      entity_data.second.reset();
+    }
+  }
+}
+
+// Merge the worker thread data with the master thread data
+void EntityEstimator::mergeThreadData(
+                std::vector<SampleMomentHistogramArray>& worker_thread_data,
+                SampleMomentHistogramArray& master_thread_data )
+{
+  for( auto&& thread_data : worker_thread_data )
+  {
+    for( size_t i = 0; i < thread_data.size(); ++i )
+    {
+      master_thread_data[i].mergeHistograms( thread_data[i] );
+
+      thread_data[i].reset();
+    }
+  }
+}
+
+// Merge the worker thread data with the master thread data
+void EntityEstimator::mergeThreadData(
+ std::vector<EntityEstimatorSampleMomentHistogramArrayMap>& worker_thread_data,
+ EntityEstimatorSampleMomentHistogramArrayMap& master_thread_data )
+{
+  for( auto&& thread_data : worker_thread_data )
+  {
+    for( auto&& entity_data : thread_data )
+    {
+      SampleMomentHistogramArray& master_histograms =
+        master_thread_data.find( entity_data.first )->second;
+
+      for( size_t i = 0; i < entity_data.second.size(); ++i )
+      {
+        master_histograms[i].mergeHistograms( entity_data.second[i] );
+
+        entity_data.second[i].reset();
+      }
+    }
+  }
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( EntityEstimator );
 
 } // end MonteCarlo namespace
@@ -184,6 +184,12 @@ public:
       const size_t bin_index,
       Utility::SampleMomentHistogram<double>& histogram ) const final override;
 
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) override;
+
+  //! Merge the history contributions that have been committed by each thread
+  void mergeThreadTallies() override;
+
   //! Reset estimator data
   void resetData() override;
 
@@ -191,6 +197,22 @@ public:
   void reduceData( const Utility::Communicator& comm,
                    const int root_process ) override;
 
+  //! Return the number of summable values that will be packed for a reduction
+  size_t getNumberOfPackedReductionValues() const override;
+
+  //! Pack the summable estimator data for a reduction
+  void packReductionData( const Utility::ArrayView<double>& packed_data ) override;
+
+  //! Unpack the summable estimator data (replaces the current data)
+  void unpackReductionData(
+           const Utility::ArrayView<const double>& packed_data ) override;
+
+  //! Reduce the estimator data using the reduced packed data (root only)
+  void reducePackedData(
+         const Utility::Communicator& comm,
+         const int root_process,
+         const Utility::ArrayView<const double>& reduced_packed_data ) override;
+
 protected:
 
   //! Default constructor
@@ -256,6 +278,98 @@ protected:
                            const int root_process,
                            SampleMomentHistogramArray& histogram_array ) const;
 
+  //! Return the number of packed values in a collection
+  static size_t getNumberOfPackedValues(
+                            const FourEstimatorMomentsCollection& collection );
+
+  //! Return the number of packed values in a histogram array
+  static size_t getNumberOfPackedValues(
+                             const SampleMomentHistogramArray& histogram_array );
+
+  //! Return the number of packed values in an entity map
+  template<typename EntityMap>
+  static size_t getNumberOfPackedEntityValues(
+                                         const std::set<EntityId>& entity_ids,
+                                         const EntityMap& entity_map );
+
+  //! Pack the collection values
+  static void packValues( const FourEstimatorMomentsCollection& collection,
+                          double*& packed_value );
+
+  //! Pack the histogram array values
+  static void packValues( const SampleMomentHistogramArray& histogram_array,
+                          double*& packed_value );
+
+  //! Pack the entity map values (in entity id order)
+  template<typename EntityMap>
+  static void packEntityValues( const std::set<EntityId>& entity_ids,
+                                const EntityMap& entity_map,
+                                double*& packed_value );
+
+  //! Unpack the collection values
+  static void unpackValues( const double*& packed_value,
+                            FourEstimatorMomentsCollection& collection );
+
+  //! Unpack the histogram array values
+  static void unpackValues( const double*& packed_value,
+                            SampleMomentHistogramArray& histogram_array );
+
+  //! Unpack the entity map values (in entity id order)
+  template<typename EntityMap>
+  static void unpackEntityValues( const std::set<EntityId>& entity_ids,
+                                  const double*& packed_value,
+                                  EntityMap& entity_map );
+
+  //! Check if thread tallies have been enabled
+  bool areThreadTalliesEnabled() const;
+
+  //! Return the number of threads that have a separate tally
+  unsigned getNumberOfTallyThreads() const;
+
+  //! Initialize the worker thread data
+  template<typename T>
+  static void initializeThreadData( const T& master_thread_data,
+                                    const unsigned num_threads,
+                                    std::vector<T>& worker_thread_data );
+
+  //! Get the data that a thread commits history contributions to
+  template<typename T>
+  static T& getThreadData( T& master_thread_data,
+                           std::vector<T>& worker_thread_data,
+                           const unsigned thread_id );
+
+  //! Reset the thread data
+  static void resetThreadData( FourEstimatorMomentsCollection& thread_data );
+
+  //! Reset the thread data
+  static void resetThreadData( EntityEstimatorMomentsCollectionMap& thread_data );
+
+  //! Reset the thread data
+  static void resetThreadData( SampleMomentHistogramArray& thread_data );
+
+  //! Reset the thread data
+  static void resetThreadData( EntityEstimatorSampleMomentHistogramArrayMap& thread_data );
+
+  //! Merge the worker thread data with the master thread data
+  static void mergeThreadData(
+                   std::vector<FourEstimatorMomentsCollection>& worker_thread_data,
+                   FourEstimatorMomentsCollection& master_thread_data );
+
+  //! Merge the worker thread data with the master thread data
+  static void mergeThreadData(
+              std::vector<EntityEstimatorMomentsCollectionMap>& worker_thread_data,
+              EntityEstimatorMomentsCollectionMap& master_thread_data );
+
+  //! Merge the worker thread data with the master thread data
+  static void mergeThreadData(
+                       std::vector<SampleMomentHistogramArray>& worker_thread_data,
+                       SampleMomentHistogramArray& master_thread_data );
+
+  //! Merge the worker thread data with the master thread data
+  static void mergeThreadData(
+     std::vector<EntityEstimatorSampleMomentHistogramArrayMap>& worker_thread_data,
+     EntityEstimatorSampleMomentHistogramArrayMap& master_thread_data );
+
 private:
 
   // Initialize entity estimator moments map
@@ -302,6 +416,12 @@ private:
   // Resize the estimator total histograms
   void resizeEstimatorTotalHistograms();
 
+  // Initialize the thread tallies
+  void initializeThreadTallies( const unsigned num_threads );
+
+  // Reinitialize the thread tallies (after the estimator data has been resized)
+  void reinitializeThreadTallies();
+
   // Add contribution to entity bin histogram
   void addHistoryContributionToEntityBinHistogram( const EntityId entity_id,
                                                    const size_t bin_index,
@@ -389,6 +509,21 @@ private:
 
   // The entity normalization constants (surface areas or cell volumes)
   EntityNormConstMap d_entity_norm_constants_map;
+
+  // The number of threads that have a separate tally (not serialized)
+  unsigned d_number_of_tally_threads;
+
+  // The worker thread estimator moments for each bin of the total
+  std::vector<FourEstimatorMomentsCollection> d_thread_estimator_total_bin_data;
+
+  // The worker thread estimator moments for each bin and each entity
+  std::vector<EntityEstimatorMomentsCollectionMap> d_thread_entity_estimator_moments_maps;
+
+  // The worker thread sample moment histograms for each bin of the total
+  std::vector<SampleMomentHistogramArray> d_thread_estimator_total_bin_histograms;
+
+  // The worker thread sample moment histograms for each bin and each entity
+  std::vector<EntityEstimatorSampleMomentHistogramArrayMap> d_thread_entity_estimator_histograms_maps;
 };
 
 } // end MonteCarlo namespace
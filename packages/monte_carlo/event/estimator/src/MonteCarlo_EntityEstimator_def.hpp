@@ -36,7 +36,12 @@ EntityEstimator::EntityEstimator(
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
     d_entity_estimator_histograms_map(),
-    d_entity_norm_constants_map()
+    d_entity_norm_constants_map(),
+    d_number_of_tally_threads( 0 ),
+    d_thread_estimator_total_bin_data(),
+    d_thread_entity_estimator_moments_maps(),
+    d_thread_estimator_total_bin_histograms(),
+    d_thread_entity_estimator_histograms_maps()
 {
   TEST_FOR_EXCEPTION( entity_ids.empty(),
                       std::runtime_error,
@@ -76,7 +81,12 @@ EntityEstimator::EntityEstimator( const Id id,
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
     d_entity_estimator_histograms_map(),
-    d_entity_norm_constants_map()
+    d_entity_norm_constants_map(),
+    d_number_of_tally_threads( 0 ),
+    d_thread_estimator_total_bin_data(),
+    d_thread_entity_estimator_moments_maps(),
+    d_thread_estimator_total_bin_histograms(),
+    d_thread_entity_estimator_histograms_maps()
 {
   TEST_FOR_EXCEPTION( entity_ids.empty(),
                       std::runtime_error,
@@ -155,6 +165,88 @@ void EntityEstimator::initializeEntityNormConstantsMap(
   }
 }
 
+// Initialize the worker thread data
+/*! \details The master thread data will be used as the template for the
+ * data of each worker thread (the master thread commits directly to the
+ * master thread data). The worker thread data will be reset.
+ */
+template<typename T>
+void EntityEstimator::initializeThreadData( const T& master_thread_data,
+                                            const unsigned num_threads,
+                                            std::vector<T>& worker_thread_data )
+{
+  worker_thread_data.clear();
+
+  if( num_threads > 1 )
+  {
+    worker_thread_data.resize( num_threads-1, master_thread_data );
+
+    for( auto&& thread_data : worker_thread_data )
+      EntityEstimator::resetThreadData( thread_data );
+  }
+}
+
+// Get the data that a thread commits history contributions to
+template<typename T>
+inline T& EntityEstimator::getThreadData( T& master_thread_data,
+                                          std::vector<T>& worker_thread_data,
+                                          const unsigned thread_id )
+{
+  // Make sure the thread id is valid
+  testPrecondition( thread_id <= worker_thread_data.size() );
+
+  if( thread_id == 0 )
+    return master_thread_data;
+  else
+    return worker_thread_data[thread_id-1];
+}
+
+// Return the number of packed values in an entity map
+template<typename EntityMap>
+size_t EntityEstimator::getNumberOfPackedEntityValues(
+                                         const std::set<EntityId>& entity_ids,
+                                         const EntityMap& entity_map )
+{
+  size_t number_of_values = 0;
+
+  for( auto&& entity_id : entity_ids )
+  {
+    number_of_values += EntityEstimator::getNumberOfPackedValues(
+                                         entity_map.find( entity_id )->second );
+  }
+
+  return number_of_values;
+}
+
+// Pack the entity map values (in entity id order)
+/*! \details The entity map is unordered so the values are packed in entity
+ * id order to guarantee that the packed values from every process line up.
+ */
+template<typename EntityMap>
+void EntityEstimator::packEntityValues( const std::set<EntityId>& entity_ids,
+                                        const EntityMap& entity_map,
+                                        double*& packed_value )
+{
+  for( auto&& entity_id : entity_ids )
+  {
+    EntityEstimator::packValues( entity_map.find( entity_id )->second,
+                                 packed_value );
+  }
+}
+
+// Unpack the entity map values (in entity id order)
+template<typename EntityMap>
+void EntityEstimator::unpackEntityValues( const std::set<EntityId>& entity_ids,
+                                          const double*& packed_value,
+                                          EntityMap& entity_map )
+{
+  for( auto&& entity_id : entity_ids )
+  {
+    EntityEstimator::unpackValues( packed_value,
+                                   entity_map.find( entity_id )->second );
+  }
+}
+
 // Serialize the entity estimator
 template<typename Archive>
 void EntityEstimator::serialize( Archive& ar, const unsigned version )
@@ -205,20 +205,25 @@ void Estimator::setCosineCutoffValue( const double )
 }
 
 // Check if the estimator has uncommitted history contributions
+/*! \details The contribution index is the thread id unless the threads can
+ * have more than one history in flight (see
+ * MonteCarlo::ParticleHistoryObserver::getHistoryContributionIndex).
+ */
 bool Estimator::hasUncommittedHistoryContribution(
-					       const unsigned thread_id ) const
+				      const unsigned contribution_index ) const
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_has_uncommitted_history_contribution.size());
+  // Make sure the contribution index is valid
+  testPrecondition( contribution_index <
+                    d_has_uncommitted_history_contribution.size() );
 
-  return d_has_uncommitted_history_contribution[thread_id];
+  return d_has_uncommitted_history_contribution[contribution_index];
 }
 
 // Check if the estimator has uncommitted history contributions
 bool Estimator::hasUncommittedHistoryContribution() const
 {
   return this->hasUncommittedHistoryContribution(
-				    Utility::OpenMPProperties::getThreadId() );
+                                         this->getHistoryContributionIndex() );
 }
 
 // Enable support for multiple threads
@@ -227,9 +232,18 @@ void Estimator::enableThreadSupport( const unsigned num_threads )
   // Make sure only the master thread calls this function
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
 
-  d_has_uncommitted_history_contribution.resize( num_threads, false );
+  d_has_uncommitted_history_contribution.resize(
+                 this->getNumberOfHistoryContributions( num_threads ), false );
 }
 
+// Merge the history contributions that have been committed by each thread
+/*! \details Estimators that keep a separate tally for each thread must
+ * override this method. The default implementation does nothing since
+ * all contributions are committed directly to the estimator data.
+ */
+void Estimator::mergeThreadTallies()
+{ /* ... */ }
+
 // Reduce estimator data on all processes and collect on the root process
 void Estimator::reduceData( const Utility::Communicator& comm,
                             const int root_process )
@@ -1007,12 +1021,13 @@ size_t Estimator::getNumberOfAssignedParticleTypes() const
  * to the estimator.
  */
 void Estimator::setHasUncommittedHistoryContribution(
-						     const unsigned thread_id )
+					      const unsigned contribution_index )
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_has_uncommitted_history_contribution.size());
+  // Make sure the contribution index is valid
+  testPrecondition( contribution_index <
+                    d_has_uncommitted_history_contribution.size() );
 
-  d_has_uncommitted_history_contribution[thread_id] = true;
+  d_has_uncommitted_history_contribution[contribution_index] = true;
 }
 
 // Unset the has uncommited history contribution flag
@@ -1020,12 +1035,13 @@ void Estimator::setHasUncommittedHistoryContribution(
  * committed to the estimator
  */
 void Estimator::unsetHasUncommittedHistoryContribution(
-						     const unsigned thread_id )
+					      const unsigned contribution_index )
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_has_uncommitted_history_contribution.size());
+  // Make sure the contribution index is valid
+  testPrecondition( contribution_index <
+                    d_has_uncommitted_history_contribution.size() );
 
-  d_has_uncommitted_history_contribution[thread_id] = false;
+  d_has_uncommitted_history_contribution[contribution_index] = false;
 }
 
 // Reduce a single collection
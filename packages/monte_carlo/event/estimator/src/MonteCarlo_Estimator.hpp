@@ -438,7 +438,8 @@ public:
   virtual void setCosineCutoffValue( const double cosine_cutoff );
 
   //! Check if the estimator has uncommitted history contributions
-  bool hasUncommittedHistoryContribution( const unsigned thread_id ) const;
+  bool hasUncommittedHistoryContribution(
+                                 const unsigned contribution_index ) const;
 
   //! Check if the estimator has uncommitted history contributions
   bool hasUncommittedHistoryContribution() const final override;
@@ -446,6 +447,9 @@ public:
   //! Enable support for multiple threads
   void enableThreadSupport( const unsigned num_threads ) override;
 
+  //! Merge the history contributions that have been committed by each thread
+  virtual void mergeThreadTallies();
+
   //! Reduce estimator data on all processes and collect on the root process
   void reduceData( const Utility::Communicator& comm,
                    const int root_process ) override;
@@ -474,10 +478,12 @@ protected:
   const std::shared_ptr<const std::vector<double> >& getSampleMomentHistogramBins();
 
   //! Set the has uncommitted history contribution flag
-  void setHasUncommittedHistoryContribution( const unsigned thread_id );
+  void setHasUncommittedHistoryContribution(
+                                         const unsigned contribution_index );
 
   //! Unset the has uncommitted history contribution flag
-  void unsetHasUncommittedHistoryContribution( const unsigned thread_id );
+  void unsetHasUncommittedHistoryContribution(
+                                         const unsigned contribution_index );
 
   //! Reduce a single collection
   void reduceCollection(
@@ -30,7 +30,11 @@ StandardEntityEstimator::StandardEntityEstimator(
     d_entity_total_estimator_moment_snapshots_map(),
     d_total_estimator_histograms( 1 ),
     d_entity_total_estimator_histograms_map(),
-    d_update_tracker( 1 )
+    d_update_tracker( 1 ),
+    d_thread_total_estimator_moments(),
+    d_thread_entity_total_estimator_moments_maps(),
+    d_thread_total_estimator_histograms(),
+    d_thread_entity_total_estimator_histograms_maps()
 { /* ... */ }
 
 // Check if total data is available
@@ -133,6 +137,9 @@ void StandardEntityEstimator::takeSnapshot( const uint64_t num_histories_since_l
 {
   // Make sure only the root thread calls this
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  // The snapshot must include the contributions from every thread
+  this->mergeTotalThreadTallies();
   
   d_total_estimator_moment_snapshots.takeSnapshot( num_histories_since_last_snapshot,
                                                    time_since_last_snapshot,
@@ -528,6 +535,20 @@ void StandardEntityEstimator::enableThreadSupport( const unsigned num_threads )
 
   // Add thread support to update tracker
   d_update_tracker.resize( num_threads );
+
+  // Add the total thread tallies
+  this->initializeTotalThreadTallies();
+}
+
+// Merge the history contributions that have been committed by each thread
+void StandardEntityEstimator::mergeThreadTallies()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  this->mergeTotalThreadTallies();
+
+  EntityEstimator::mergeThreadTallies();
 }
 
 // Reset the estimator data
@@ -563,6 +584,19 @@ void StandardEntityEstimator::resetData()
       histogram.reset();
   }
 
+  // Reset the total thread tallies
+  for( auto&& thread_data : d_thread_total_estimator_moments )
+    EntityEstimator::resetThreadData( thread_data );
+
+  for( auto&& thread_data : d_thread_entity_total_estimator_moments_maps )
+    EntityEstimator::resetThreadData( thread_data );
+
+  for( auto&& thread_data : d_thread_total_estimator_histograms )
+    EntityEstimator::resetThreadData( thread_data );
+
+  for( auto&& thread_data : d_thread_entity_total_estimator_histograms_maps )
+    EntityEstimator::resetThreadData( thread_data );
+
   // Reset the update tracker
   for( size_t i = 0; i < d_update_tracker.size(); ++i )
   {
@@ -581,6 +615,9 @@ void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
+  // The thread tallies must be merged before the process data is reduced
+  this->mergeTotalThreadTallies();
+
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
@@ -645,6 +682,185 @@ void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
   EntityEstimator::reduceData( comm, root_process );
 }
 
+// Return the number of summable values that will be packed for a reduction
+size_t StandardEntityEstimator::getNumberOfPackedReductionValues() const
+{
+  return this->getNumberOfPackedTotalReductionValues() +
+    EntityEstimator::getNumberOfPackedReductionValues();
+}
+
+// Pack the summable estimator data for a reduction
+/*! \details The total moments, the entity total moments, the total
+ * histograms and the entity total histograms are packed before the
+ * bin data (see MonteCarlo::EntityEstimator::packReductionData).
+ */
+void StandardEntityEstimator::packReductionData(
+                                 const Utility::ArrayView<double>& packed_data )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure that the packed data array is valid
+  testPrecondition( packed_data.size() ==
+                    this->getNumberOfPackedReductionValues() );
+
+  // The thread tallies must be merged before the process data is packed
+  this->mergeTotalThreadTallies();
+
+  std::set<EntityId> entity_ids;
+
+  this->getEntityIds( entity_ids );
+
+  double* packed_value = packed_data.data();
+
+  EntityEstimator::packValues( d_total_estimator_moments, packed_value );
+  EntityEstimator::packEntityValues( entity_ids,
+                                     d_entity_total_estimator_moments_map,
+                                     packed_value );
+  EntityEstimator::packValues( d_total_estimator_histograms, packed_value );
+  EntityEstimator::packEntityValues( entity_ids,
+                                     d_entity_total_estimator_histograms_map,
+                                     packed_value );
+
+  const size_t number_of_total_values =
+    this->getNumberOfPackedTotalReductionValues();
+
+  // Make sure that all of the total values were packed
+  testInvariant( packed_value == packed_data.data() + number_of_total_values );
+
+  // Pack the bin data
+  EntityEstimator::packReductionData(
+                   Utility::ArrayView<double>( packed_value,
+                                               packed_data.size() -
+                                               number_of_total_values ) );
+}
+
+// Unpack the summable estimator data (replaces the current data)
+void StandardEntityEstimator::unpackReductionData(
+                         const Utility::ArrayView<const double>& packed_data )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure that the packed data array is valid
+  testPrecondition( packed_data.size() ==
+                    this->getNumberOfPackedReductionValues() );
+
+  const double* packed_value = packed_data.data();
+
+  this->unpackTotalValues( packed_value );
+
+  const size_t number_of_total_values =
+    this->getNumberOfPackedTotalReductionValues();
+
+  // Make sure that all of the total values were unpacked
+  testInvariant( packed_value == packed_data.data() + number_of_total_values );
+
+  // Unpack the bin data
+  EntityEstimator::unpackReductionData(
+               Utility::ArrayView<const double>( packed_value,
+                                                 packed_data.size() -
+                                                 number_of_total_values ) );
+}
+
+// Reduce the estimator data using the reduced packed data (root only)
+/*! \details The snapshot data cannot be summed (the snapshots from each
+ * process are merged) so it will still be gathered on the root process.
+ */
+void StandardEntityEstimator::reducePackedData(
+                  const Utility::Communicator& comm,
+                  const int root_process,
+                  const Utility::ArrayView<const double>& reduced_packed_data )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the root process is valid
+  testPrecondition( root_process < comm.size() );
+
+  // Only do the reduction if there is more than one process
+  if( comm.size() > 1 )
+  {
+    if( comm.rank() == root_process )
+    {
+      // Make sure that the reduced packed data array is valid
+      testPrecondition( reduced_packed_data.size() ==
+                        this->getNumberOfPackedReductionValues() );
+
+      const double* packed_value = reduced_packed_data.data();
+
+      this->unpackTotalValues( packed_value );
+    }
+
+    // Reduce the entity snapshot data
+    try{
+      this->reduceEntitySnapshotMaps( comm, root_process, d_entity_total_estimator_moment_snapshots_map );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to perform mpi reduction in "
+                             "standard entity estimator " << this->getId() <<
+                             " for entity total snapshot data!" );
+
+    // Reduce the total snapshot data
+    try{
+      this->reduceSnapshots( comm, root_process, d_total_estimator_moment_snapshots );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to perform mpi reduction in "
+                             "standard entity estimator " << this->getId() <<
+                             " for total snapshot data!" );
+  }
+
+  // Reduce the bin data
+  if( comm.rank() == root_process && comm.size() > 1 )
+  {
+    const size_t number_of_total_values =
+      this->getNumberOfPackedTotalReductionValues();
+
+    EntityEstimator::reducePackedData(
+                comm,
+                root_process,
+                Utility::ArrayView<const double>(
+                         reduced_packed_data.data() + number_of_total_values,
+                         reduced_packed_data.size() - number_of_total_values ) );
+  }
+  else
+  {
+    EntityEstimator::reducePackedData( comm,
+                                       root_process,
+                                       reduced_packed_data );
+  }
+}
+
+// Return the number of summable total values that will be packed
+size_t StandardEntityEstimator::getNumberOfPackedTotalReductionValues() const
+{
+  std::set<EntityId> entity_ids;
+
+  this->getEntityIds( entity_ids );
+
+  return EntityEstimator::getNumberOfPackedValues( d_total_estimator_moments ) +
+    EntityEstimator::getNumberOfPackedEntityValues(
+                           entity_ids, d_entity_total_estimator_moments_map ) +
+    EntityEstimator::getNumberOfPackedValues( d_total_estimator_histograms ) +
+    EntityEstimator::getNumberOfPackedEntityValues(
+                        entity_ids, d_entity_total_estimator_histograms_map );
+}
+
+// Unpack the summable total values
+void StandardEntityEstimator::unpackTotalValues( const double*& packed_value )
+{
+  std::set<EntityId> entity_ids;
+
+  this->getEntityIds( entity_ids );
+
+  EntityEstimator::unpackValues( packed_value, d_total_estimator_moments );
+  EntityEstimator::unpackEntityValues( entity_ids,
+                                       packed_value,
+                                       d_entity_total_estimator_moments_map );
+  EntityEstimator::unpackValues( packed_value, d_total_estimator_histograms );
+  EntityEstimator::unpackEntityValues( entity_ids,
+                                       packed_value,
+                                       d_entity_total_estimator_histograms_map );
+}
+
 // Assign entities
 void StandardEntityEstimator::assignEntities(
                   const EntityEstimator::EntityNormConstMap& entity_norm_data )
@@ -684,6 +900,9 @@ void StandardEntityEstimator::assignEntities(
     d_total_estimator_histograms.resize( this->getNumberOfResponseFunctions(),
                                          default_histogram );
   }
+
+  // Resize the total thread tallies
+  this->initializeTotalThreadTallies();
 }
 
 // Set the response functions
@@ -709,6 +928,9 @@ void StandardEntityEstimator::assignResponseFunction(
     d_total_estimator_histograms.resize( this->getNumberOfResponseFunctions(),
                                          default_histogram );
   }
+
+  // Resize the total thread tallies
+  this->initializeTotalThreadTallies();
 }
 
 // Assign the history score pdf bins
@@ -724,6 +946,9 @@ void StandardEntityEstimator::assignSampleMomentHistogramBins( const std::shared
     for( auto&& histogram : entity_data.second )
       histogram.setBinBoundaries( bins );
   }
+
+  // Reset the total thread tally histogram bins
+  this->initializeTotalThreadTallies();
 }
 
 // Print the estimator data
@@ -911,6 +1136,51 @@ void StandardEntityEstimator::resizeEntityTotalEstimatorMomentsMapCollections()
     entity_data.second.resize( size, default_histogram );
 }
 
+// Initialize the total thread tallies
+/*! \details The total thread tallies will be rebuilt from the estimator
+ * data so this should only be called before any history contributions have
+ * been committed to the total thread tallies.
+ */
+void StandardEntityEstimator::initializeTotalThreadTallies()
+{
+  const unsigned num_threads = this->getNumberOfTallyThreads();
+
+  EntityEstimator::initializeThreadData( d_total_estimator_moments,
+                                         num_threads,
+                                         d_thread_total_estimator_moments );
+
+  EntityEstimator::initializeThreadData( d_entity_total_estimator_moments_map,
+                                         num_threads,
+                                         d_thread_entity_total_estimator_moments_maps );
+
+  EntityEstimator::initializeThreadData( d_total_estimator_histograms,
+                                         num_threads,
+                                         d_thread_total_estimator_histograms );
+
+  EntityEstimator::initializeThreadData( d_entity_total_estimator_histograms_map,
+                                         num_threads,
+                                         d_thread_entity_total_estimator_histograms_maps );
+}
+
+// Merge the total thread tallies
+void StandardEntityEstimator::mergeTotalThreadTallies()
+{
+  if( this->areThreadTalliesEnabled() )
+  {
+    EntityEstimator::mergeThreadData( d_thread_total_estimator_moments,
+                                      d_total_estimator_moments );
+
+    EntityEstimator::mergeThreadData( d_thread_entity_total_estimator_moments_maps,
+                                      d_entity_total_estimator_moments_map );
+
+    EntityEstimator::mergeThreadData( d_thread_total_estimator_histograms,
+                                      d_total_estimator_histograms );
+
+    EntityEstimator::mergeThreadData( d_thread_entity_total_estimator_histograms_maps,
+                                      d_entity_total_estimator_histograms_map );
+  }
+}
+
 // Commit hist. contr. to the total for a response function of an entity
 void StandardEntityEstimator::commitHistoryContributionToTotalOfEntity(
 					const EntityId entity_id,
@@ -925,15 +1195,29 @@ void StandardEntityEstimator::commitHistoryContributionToTotalOfEntity(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  Estimator::FourEstimatorMomentsCollection&
-    entity_total_estimator_moments_collection =
-    d_entity_total_estimator_moments_map.find( entity_id )->second;
-
-  // Update the moments
-  #pragma omp critical
+  if( this->areThreadTalliesEnabled() )
   {
+    // Update the moments of the thread tally (no critical section needed)
+    Estimator::FourEstimatorMomentsCollection&
+      entity_total_estimator_moments_collection =
+      EntityEstimator::getThreadData( d_entity_total_estimator_moments_map,
+                                      d_thread_entity_total_estimator_moments_maps,
+                                      Utility::OpenMPProperties::getThreadId() ).find( entity_id )->second;
+
     entity_total_estimator_moments_collection.addRawScore( response_function_index, contribution );
   }
+  else
+  {
+    Estimator::FourEstimatorMomentsCollection&
+      entity_total_estimator_moments_collection =
+      d_entity_total_estimator_moments_map.find( entity_id )->second;
+
+    // Update the moments
+    #pragma omp critical
+    {
+      entity_total_estimator_moments_collection.addRawScore( response_function_index, contribution );
+    }
+  }
 
   this->addHistoryContributionToEntityBinHistogram( entity_id, response_function_index, contribution );
 }
@@ -952,14 +1236,27 @@ void StandardEntityEstimator::addHistoryContributionToEntityBinHistogram(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  Utility::SampleMomentHistogram<double>& histogram =
-    d_entity_total_estimator_histograms_map.find( entity_id )->second[response_function_index];
-
-  // Update the histogram
-  #pragma omp critical
+  if( this->areThreadTalliesEnabled() )
   {
+    // Update the histogram of the thread tally
+    Utility::SampleMomentHistogram<double>& histogram =
+      EntityEstimator::getThreadData( d_entity_total_estimator_histograms_map,
+                                      d_thread_entity_total_estimator_histograms_maps,
+                                      Utility::OpenMPProperties::getThreadId() ).find( entity_id )->second[response_function_index];
+
     histogram.addRawScore( contribution );
   }
+  else
+  {
+    Utility::SampleMomentHistogram<double>& histogram =
+      d_entity_total_estimator_histograms_map.find( entity_id )->second[response_function_index];
+
+    // Update the histogram
+    #pragma omp critical
+    {
+      histogram.addRawScore( contribution );
+    }
+  }
 }  
 
 // Commit history contr. to the total for a response function of an estimator
@@ -973,10 +1270,20 @@ void StandardEntityEstimator::commitHistoryContributionToTotalOfEstimator(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  // Update the moments
-  #pragma omp critical
+  if( this->areThreadTalliesEnabled() )
   {
-    d_total_estimator_moments.addRawScore( response_function_index, contribution );
+    // Update the moments of the thread tally (no critical section needed)
+    EntityEstimator::getThreadData( d_total_estimator_moments,
+                                    d_thread_total_estimator_moments,
+                                    Utility::OpenMPProperties::getThreadId() ).addRawScore( response_function_index, contribution );
+  }
+  else
+  {
+    // Update the moments
+    #pragma omp critical
+    {
+      d_total_estimator_moments.addRawScore( response_function_index, contribution );
+    }
   }
 
   this->addHistoryContributionToTotalBinHistogram( response_function_index,
@@ -994,13 +1301,23 @@ void StandardEntityEstimator::addHistoryContributionToTotalBinHistogram(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  Utility::SampleMomentHistogram<double>& histogram =
-    d_total_estimator_histograms[response_function_index];
-  
-  // Update the histogram
-  #pragma omp critical
+  if( this->areThreadTalliesEnabled() )
   {
-    histogram.addRawScore( contribution );
+    // Update the histogram of the thread tally
+    EntityEstimator::getThreadData( d_total_estimator_histograms,
+                                    d_thread_total_estimator_histograms,
+                                    Utility::OpenMPProperties::getThreadId() )[response_function_index].addRawScore( contribution );
+  }
+  else
+  {
+    Utility::SampleMomentHistogram<double>& histogram =
+      d_total_estimator_histograms[response_function_index];
+
+    // Update the histogram
+    #pragma omp critical
+    {
+      histogram.addRawScore( contribution );
+    }
   }
 }
 
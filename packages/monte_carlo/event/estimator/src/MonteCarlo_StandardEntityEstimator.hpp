@@ -19,10 +19,12 @@ namespace MonteCarlo{
 
 /*! The standard entity estimator class
  * \details This class has been set up to get correct results with multiple
- * threads. However, the commitHistoryContribution member function call should
- * only appear within an omp critical block. Use the enable thread support
- * member function to set up an instance of this class for the requested number
- * of threads. The classes default initialization is for a single thread.
+ * threads. Use the enable thread support member function to set up an
+ * instance of this class for the requested number of threads. Each thread
+ * will then commit its history contributions to a separate tally, which
+ * will be merged with the estimator data when a snapshot is taken, when the
+ * data is reduced or when the mergeThreadTallies member function is called.
+ * The classes default initialization is for a single thread.
  */
 class StandardEntityEstimator : public EntityEstimator
 {
@@ -182,6 +184,9 @@ public:
   //! Enable support for multiple threads
   void enableThreadSupport( const unsigned num_threads ) final override;
 
+  //! Merge the history contributions that have been committed by each thread
+  void mergeThreadTallies() final override;
+
   //! Reset estimator data
   void resetData() final override;
 
@@ -189,6 +194,22 @@ public:
   void reduceData( const Utility::Communicator& comm,
                    const int root_process ) final override;
 
+  //! Return the number of summable values that will be packed for a reduction
+  size_t getNumberOfPackedReductionValues() const final override;
+
+  //! Pack the summable estimator data for a reduction
+  void packReductionData( const Utility::ArrayView<double>& packed_data ) final override;
+
+  //! Unpack the summable estimator data (replaces the current data)
+  void unpackReductionData(
+     const Utility::ArrayView<const double>& packed_data ) final override;
+
+  //! Reduce the estimator data using the reduced packed data (root only)
+  void reducePackedData(
+   const Utility::Communicator& comm,
+   const int root_process,
+   const Utility::ArrayView<const double>& reduced_packed_data ) final override;
+
 protected:
 
   //! Default constructor
@@ -234,6 +255,18 @@ private:
   // Resize the entity total estimator moments map collections
   void resizeEntityTotalEstimatorMomentsMapCollections();
 
+  // Initialize the total thread tallies
+  void initializeTotalThreadTallies();
+
+  // Merge the total thread tallies
+  void mergeTotalThreadTallies();
+
+  // Return the number of summable total values that will be packed
+  size_t getNumberOfPackedTotalReductionValues() const;
+
+  // Unpack the summable total values
+  void unpackTotalValues( const double*& packed_value );
+
   // Commit history contr. to the total for a response function of an entity
   void commitHistoryContributionToTotalOfEntity(
 					const EntityId entity_id,
@@ -315,6 +348,18 @@ private:
 
   // The entities/bins that have been updated
   ParallelUpdateTracker d_update_tracker;
+
+  // The worker thread total estimator moments (not serialized)
+  std::vector<Estimator::FourEstimatorMomentsCollection> d_thread_total_estimator_moments;
+
+  // The worker thread total estimator moments for each entity
+  std::vector<EntityEstimatorMomentsCollectionMap> d_thread_entity_total_estimator_moments_maps;
+
+  // The worker thread sample moment histograms across all entities
+  std::vector<SampleMomentHistogramArray> d_thread_total_estimator_histograms;
+
+  // The worker thread total sample moment histograms for each entity
+  std::vector<EntityEstimatorSampleMomentHistogramArrayMap> d_thread_entity_total_estimator_histograms_maps;
 };
 
 } // end MonteCarlo namespace
@@ -25,7 +25,11 @@ StandardEntityEstimator::StandardEntityEstimator(
     d_entity_total_estimator_moment_snapshots_map(),
     d_total_estimator_histograms( 1, Utility::SampleMomentHistogram<double>( this->getSampleMomentHistogramBins() ) ),
     d_entity_total_estimator_histograms_map(),
-    d_update_tracker( 1 )
+    d_update_tracker( 1 ),
+    d_thread_total_estimator_moments(),
+    d_thread_entity_total_estimator_moments_maps(),
+    d_thread_total_estimator_histograms(),
+    d_thread_entity_total_estimator_histograms_maps()
 {
   this->initializeMomentsMaps( entity_ids );
 }
@@ -43,7 +47,11 @@ StandardEntityEstimator::StandardEntityEstimator(
     d_entity_total_estimator_moment_snapshots_map(),
     d_total_estimator_histograms( 1, Utility::SampleMomentHistogram<double>( this->getSampleMomentHistogramBins() ) ),
     d_entity_total_estimator_histograms_map(),
-    d_update_tracker( 1 )
+    d_update_tracker( 1 ),
+    d_thread_total_estimator_moments(),
+    d_thread_entity_total_estimator_moments_maps(),
+    d_thread_total_estimator_histograms(),
+    d_thread_entity_total_estimator_histograms_maps()
 {
   this->initializeMomentsMaps( entity_ids );
 }
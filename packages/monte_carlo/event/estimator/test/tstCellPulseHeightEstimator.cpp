@@ -483,6 +483,11 @@ FRENSIE_UNIT_TEST( CellPulseHeightEstimator,
     estimator_3_base->commitHistoryContribution();
   }
 
+  // Merge the contributions committed by each thread
+  estimator_1->mergeThreadTallies();
+  estimator_2->mergeThreadTallies();
+  estimator_3->mergeThreadTallies();
+
   MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( threads );
   MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
 
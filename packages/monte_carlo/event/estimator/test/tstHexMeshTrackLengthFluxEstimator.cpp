@@ -1585,6 +1585,11 @@ FRENSIE_UNIT_TEST( HexMeshTrackLengthFluxEstimator,
     estimator_3_base->commitHistoryContribution();
   }
 
+  // Merge the contributions committed by each thread
+  estimator_1_base->mergeThreadTallies();
+  estimator_2_base->mergeThreadTallies();
+  estimator_3_base->mergeThreadTallies();
+
   FRENSIE_CHECK( !estimator_1_base->hasUncommittedHistoryContribution() );
   FRENSIE_CHECK( !estimator_2_base->hasUncommittedHistoryContribution() );
   FRENSIE_CHECK( !estimator_3_base->hasUncommittedHistoryContribution() );
@@ -1178,6 +1178,9 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator,
     estimator->commitHistoryContribution();
   }
 
+  // Merge the contributions committed by each thread
+  estimator->mergeThreadTallies();
+
   for( unsigned i = 0; i < threads; ++i )
   {
     FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution( i ) );
@@ -1568,6 +1571,9 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator,
     estimator->commitHistoryContribution();
   }
 
+  // Merge the contributions committed by each thread
+  estimator->mergeThreadTallies();
+
   for( unsigned i = 0; i < threads; ++i )
   {
     FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution( i ) );
@@ -2163,6 +2169,9 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator,
     estimator->commitHistoryContribution();
   }
 
+  // Merge the contributions committed by each thread
+  estimator->mergeThreadTallies();
+
   for( unsigned i = 0; i < threads; ++i )
   {
     FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution() );
@@ -2354,6 +2363,88 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the contributions of one history are not carried over to the
+// next history
+FRENSIE_UNIT_TEST( StandardEntityEstimator,
+                   commitHistoryContribution_multiple_histories )
+{
+  std::shared_ptr<TestStandardEntityEstimator> estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  // bin 0 (E=0, Mu=0, T=0, Col=0)
+  MonteCarlo::PhotonState particle( 0ull );
+  MonteCarlo::ObserverParticleStateWrapper particle_wrapper( particle );
+
+  particle.setEnergy( 1e-2 );
+  particle_wrapper.setAngleCosine( -0.5 );
+  particle.setTime( 5e-6 );
+
+  // First history - only entity 0 is updated
+  estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+  estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+
+  estimator->commitHistoryContribution();
+
+  // Second history - only entity 1 is updated
+  estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+
+  estimator->commitHistoryContribution();
+
+  FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution() );
+
+  // Check the total bin data moments
+  std::vector<double> expected_first_moments( 32, 0.0 );
+  expected_first_moments[0] = 3.0;
+  expected_first_moments[16] = 3.0;
+
+  std::vector<double> expected_second_moments( 32, 0.0 );
+  expected_second_moments[0] = 5.0;
+  expected_second_moments[16] = 5.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataFirstMoments(),
+                       expected_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataSecondMoments(),
+                       expected_second_moments );
+
+  // Check the entity bin data moments
+  expected_first_moments[0] = 2.0;
+  expected_first_moments[16] = 2.0;
+  expected_second_moments[0] = 4.0;
+  expected_second_moments[16] = 4.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 0 ),
+                       expected_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 0 ),
+                       expected_second_moments );
+
+  expected_first_moments[0] = 1.0;
+  expected_first_moments[16] = 1.0;
+  expected_second_moments[0] = 1.0;
+  expected_second_moments[16] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 1 ),
+                       expected_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 1 ),
+                       expected_second_moments );
+
+  // Check the entity total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 0 ),
+                       std::vector<double>( 2, 2.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataSecondMoments( 0 ),
+                       std::vector<double>( 2, 4.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 1 ),
+                       std::vector<double>( 2, 1.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataSecondMoments( 1 ),
+                       std::vector<double>( 2, 1.0 ) );
+
+  // Check the total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataFirstMoments(),
+                       std::vector<double>( 2, 3.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataSecondMoments(),
+                       std::vector<double>( 2, 5.0 ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a snapshot of the estimator state can be made
 FRENSIE_UNIT_TEST( StandardEntityEstimator, takeSnapshot_no_bin_snapshots )
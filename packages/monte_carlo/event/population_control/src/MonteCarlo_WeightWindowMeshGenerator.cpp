@@ -0,0 +1,322 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <limits>
+#include <algorithm>
+#include <map>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+WeightWindowMeshGenerator::WeightWindowMeshGenerator(
+                              const std::shared_ptr<const Utility::Mesh>& mesh,
+                              const double max_lower_weight,
+                              const double upper_to_lower_weight_ratio,
+                              const double survival_to_lower_weight_ratio,
+                              const double max_relative_error )
+  : d_mesh( mesh ),
+    d_max_lower_weight( max_lower_weight ),
+    d_upper_to_lower_weight_ratio( upper_to_lower_weight_ratio ),
+    d_survival_to_lower_weight_ratio( survival_to_lower_weight_ratio ),
+    d_max_relative_error( max_relative_error ),
+    d_energy_bin_boundaries(),
+    d_weight_window_map(),
+    d_figures_of_merit()
+{
+  // Make sure that the mesh is valid
+  testPrecondition( mesh.get() );
+  // Make sure that the weight window parameters are valid
+  testPrecondition( max_lower_weight > 0.0 );
+  testPrecondition( survival_to_lower_weight_ratio >= 1.0 );
+  testPrecondition( upper_to_lower_weight_ratio >=
+                    survival_to_lower_weight_ratio );
+  testPrecondition( max_relative_error > 0.0 );
+}
+
+// Generate a weight window mesh from the mesh flux estimator results
+/*! \details The estimator must be a mesh estimator that uses the generator
+ * mesh (the estimator entities must be the mesh element handles). Only the
+ * energy dimension can be discretized and only the first response function
+ * will be used. The number of histories and the elapsed time must have been
+ * set (MonteCarlo::ParticleHistoryObserver::setNumberOfHistories and
+ * MonteCarlo::ParticleHistoryObserver::setElapsedTime).
+ */
+std::shared_ptr<WeightWindowMesh>
+WeightWindowMeshGenerator::generateWeightWindowMesh(
+                                       const Estimator& mesh_flux_estimator )
+{
+  // Make sure that the number of histories and the elapsed time are valid
+  testPrecondition( ParticleHistoryObserver::getNumberOfHistories() > 0 );
+  testPrecondition( ParticleHistoryObserver::getElapsedTime() > 0.0 );
+
+  TEST_FOR_EXCEPTION( !mesh_flux_estimator.isMeshEstimator(),
+                      std::runtime_error,
+                      "A weight window mesh can only be generated from a "
+                      "mesh estimator (estimator "
+                      << mesh_flux_estimator.getId() << " is not a mesh "
+                      "estimator)!" );
+
+  this->extractEnergyDiscretization( mesh_flux_estimator );
+
+  const size_t number_of_bins = mesh_flux_estimator.getNumberOfBins();
+
+  // Process the element flux estimates
+  std::unordered_map<Utility::Mesh::ElementHandle,std::map<std::string,std::vector<double> > > element_processed_data;
+
+  std::vector<double> max_bin_flux( number_of_bins, 0.0 );
+
+  for( Utility::Mesh::ElementHandleIterator element_it =
+         d_mesh->getStartElementHandleIterator();
+       element_it != d_mesh->getEndElementHandleIterator();
+       ++element_it )
+  {
+    TEST_FOR_EXCEPTION( !mesh_flux_estimator.isEntityAssigned( *element_it ),
+                        std::runtime_error,
+                        "Mesh element " << *element_it << " is not assigned "
+                        "to estimator " << mesh_flux_estimator.getId() <<
+                        " (the estimator mesh must be the generator mesh)!" );
+
+    std::map<std::string,std::vector<double> >& processed_data =
+      element_processed_data[*element_it];
+
+    mesh_flux_estimator.getEntityBinProcessedData( *element_it,
+                                                   processed_data );
+
+    const std::vector<double>& mean = processed_data["mean"];
+    const std::vector<double>& relative_error = processed_data["re"];
+
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      if( this->isFluxEstimateReliable( mean[i], relative_error[i] ) )
+        max_bin_flux[i] = std::max( max_bin_flux[i], mean[i] );
+    }
+  }
+
+  // Update the weight windows
+  for( auto&& element_data : element_processed_data )
+  {
+    const std::vector<double>& mean = element_data.second["mean"];
+    const std::vector<double>& relative_error = element_data.second["re"];
+
+    std::vector<WeightWindow>& element_weight_windows =
+      d_weight_window_map[element_data.first];
+
+    // No weight window will be applied to bins that have never been
+    // reliably estimated
+    if( element_weight_windows.empty() )
+    {
+      WeightWindow weight_window;
+      weight_window.lower_weight = 0.0;
+      weight_window.survival_weight = 0.0;
+      weight_window.upper_weight = std::numeric_limits<double>::max();
+
+      element_weight_windows.resize( number_of_bins, weight_window );
+    }
+
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      if( this->isFluxEstimateReliable( mean[i], relative_error[i] ) )
+      {
+        const double lower_weight =
+          d_max_lower_weight*mean[i]/max_bin_flux[i];
+
+        element_weight_windows[i].lower_weight = lower_weight;
+        element_weight_windows[i].survival_weight =
+          d_survival_to_lower_weight_ratio*lower_weight;
+        element_weight_windows[i].upper_weight =
+          d_upper_to_lower_weight_ratio*lower_weight;
+      }
+    }
+  }
+
+  // Record the figure of merit of this iteration
+  d_figures_of_merit.push_back(
+                       this->calculateFigureOfMerit( mesh_flux_estimator ) );
+
+  FRENSIE_LOG_NOTIFICATION( "Weight window mesh generator iteration "
+                            << d_figures_of_merit.size() << ": mesh figure "
+                            "of merit = " << d_figures_of_merit.back() <<
+                            " (improvement = "
+                            << this->getFigureOfMeritImprovement() << ")" );
+
+  // Create the weight window mesh
+  std::shared_ptr<WeightWindowMesh>
+    weight_window_mesh( new WeightWindowMesh );
+
+  weight_window_mesh->setMesh( d_mesh );
+
+  if( !d_energy_bin_boundaries.empty() )
+  {
+    weight_window_mesh->setDiscretization<OBSERVER_ENERGY_DIMENSION>(
+                                                    d_energy_bin_boundaries );
+  }
+
+  weight_window_mesh->setWeightWindowMap( d_weight_window_map );
+
+  return weight_window_mesh;
+}
+
+// Extract the energy discretization of the mesh flux estimator
+/*! \details The weight windows of the previous iterations can only be
+ * reused if the energy discretization does not change.
+ */
+void WeightWindowMeshGenerator::extractEnergyDiscretization(
+                                       const Estimator& mesh_flux_estimator )
+{
+  std::vector<ObserverPhaseSpaceDimension> discretized_dimensions;
+
+  mesh_flux_estimator.getDiscretizedDimensions( discretized_dimensions );
+
+  std::vector<double> energy_bin_boundaries;
+
+  for( size_t i = 0; i < discretized_dimensions.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( discretized_dimensions[i] != OBSERVER_ENERGY_DIMENSION,
+                        std::runtime_error,
+                        "Weight window meshes can only be generated from "
+                        "mesh estimators with an energy discretization ("
+                        << discretized_dimensions[i] << " is discretized in "
+                        "estimator " << mesh_flux_estimator.getId() << ")!" );
+
+    mesh_flux_estimator.getDiscretization<OBSERVER_ENERGY_DIMENSION>(
+                                                      energy_bin_boundaries );
+  }
+
+  TEST_FOR_EXCEPTION( !d_figures_of_merit.empty() &&
+                      energy_bin_boundaries != d_energy_bin_boundaries,
+                      std::runtime_error,
+                      "The energy discretization of estimator "
+                      << mesh_flux_estimator.getId() << " does not match "
+                      "the energy discretization of the previous weight "
+                      "window mesh generator iterations!" );
+
+  d_energy_bin_boundaries.swap( energy_bin_boundaries );
+}
+
+// Check if a bin flux estimate is reliable
+inline bool WeightWindowMeshGenerator::isFluxEstimateReliable(
+                                      const double mean,
+                                      const double relative_error ) const
+{
+  return mean > 0.0 && relative_error <= d_max_relative_error;
+}
+
+// Calculate the mesh figure of merit
+/*! \details Bins that have not been scored are assigned a relative error of
+ * one. A mesh figure of merit of zero will be returned if every bin has a
+ * relative error of zero (e.g. a single history).
+ */
+double WeightWindowMeshGenerator::calculateFigureOfMerit(
+                                 const Estimator& mesh_flux_estimator ) const
+{
+  const size_t number_of_bins = mesh_flux_estimator.getNumberOfBins();
+
+  double squared_relative_error_sum = 0.0;
+
+  for( Utility::Mesh::ElementHandleIterator element_it =
+         d_mesh->getStartElementHandleIterator();
+       element_it != d_mesh->getEndElementHandleIterator();
+       ++element_it )
+  {
+    std::vector<double> mean, relative_error, vov, fom;
+
+    mesh_flux_estimator.getEntityBinProcessedData( *element_it,
+                                                   mean,
+                                                   relative_error,
+                                                   vov,
+                                                   fom );
+
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      if( mean[i] > 0.0 )
+        squared_relative_error_sum += relative_error[i]*relative_error[i];
+      else
+        squared_relative_error_sum += 1.0;
+    }
+  }
+
+  if( squared_relative_error_sum > 0.0 )
+  {
+    const double average_squared_relative_error = squared_relative_error_sum/
+      (number_of_bins*d_mesh->getNumberOfElements());
+
+    return 1.0/(average_squared_relative_error*
+                ParticleHistoryObserver::getElapsedTime());
+  }
+  else
+    return 0.0;
+}
+
+// Return the mesh
+std::shared_ptr<const Utility::Mesh> WeightWindowMeshGenerator::getMesh() const
+{
+  return d_mesh;
+}
+
+// Return the number of iterations that have been completed
+size_t WeightWindowMeshGenerator::getNumberOfIterations() const
+{
+  return d_figures_of_merit.size();
+}
+
+// Return the mesh figure of merit of each iteration
+const std::vector<double>&
+WeightWindowMeshGenerator::getFiguresOfMerit() const
+{
+  return d_figures_of_merit;
+}
+
+// Return the figure of merit improvement of the last iteration
+/*! \details The improvement is the ratio of the mesh figure of merit of the
+ * last iteration to the mesh figure of merit of the previous iteration. An
+ * improvement of one will be returned if fewer than two iterations have been
+ * completed.
+ */
+double WeightWindowMeshGenerator::getFigureOfMeritImprovement() const
+{
+  if( d_figures_of_merit.size() < 2 )
+    return 1.0;
+  else
+  {
+    const double previous_fom =
+      d_figures_of_merit[d_figures_of_merit.size()-2];
+
+    if( previous_fom > 0.0 )
+      return d_figures_of_merit.back()/previous_fom;
+    else
+      return 1.0;
+  }
+}
+
+// Return the weight window map of the last iteration
+const WeightWindowMeshGenerator::WeightWindowMap&
+WeightWindowMeshGenerator::getWeightWindowMap() const
+{
+  return d_weight_window_map;
+}
+
+// Reset the generator (the iteration history will be cleared)
+void WeightWindowMeshGenerator::reset()
+{
+  d_energy_bin_boundaries.clear();
+  d_weight_window_map.clear();
+  d_figures_of_merit.clear();
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
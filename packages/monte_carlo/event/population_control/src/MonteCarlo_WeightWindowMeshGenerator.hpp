@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+#define MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_Estimator.hpp"
+#include "Utility_Mesh.hpp"
+
+namespace MonteCarlo{
+
+/*! The weight window mesh generator class
+ *
+ * Weight window meshes are generated iteratively from the results of a
+ * forward mesh flux estimator (method of automatic generation of importances
+ * by calculation - MAGIC). After each iteration the lower weight of each
+ * mesh element and energy bin is set proportional to the estimated flux
+ * (normalized so that the maximum lower weight in each energy bin has the
+ * requested value). Bins with unreliable flux estimates keep the weight
+ * windows from the previous iteration (no weight window is applied if a bin
+ * has never been reliably estimated). The next iteration should be run with
+ * the generated weight window mesh, which will push particles into the
+ * poorly sampled regions of the mesh. The mesh figure of merit
+ * (1/(T*<R^2>), where <R^2> is the average squared relative error of the
+ * element fluxes and unscored bins have a relative error of 1) is recorded
+ * after each iteration so that the improvement can be monitored.
+ */
+class WeightWindowMeshGenerator
+{
+
+public:
+
+  //! Typedef for the weight window map
+  typedef std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> > WeightWindowMap;
+
+  //! Constructor
+  WeightWindowMeshGenerator( const std::shared_ptr<const Utility::Mesh>& mesh,
+                             const double max_lower_weight = 0.5,
+                             const double upper_to_lower_weight_ratio = 5.0,
+                             const double survival_to_lower_weight_ratio = 3.0,
+                             const double max_relative_error = 0.5 );
+
+  //! Destructor
+  ~WeightWindowMeshGenerator()
+  { /* ... */ }
+
+  //! Generate a weight window mesh from the mesh flux estimator results
+  std::shared_ptr<WeightWindowMesh> generateWeightWindowMesh(
+                                      const Estimator& mesh_flux_estimator );
+
+  //! Return the mesh
+  std::shared_ptr<const Utility::Mesh> getMesh() const;
+
+  //! Return the number of iterations that have been completed
+  size_t getNumberOfIterations() const;
+
+  //! Return the mesh figure of merit of each iteration
+  const std::vector<double>& getFiguresOfMerit() const;
+
+  //! Return the figure of merit improvement of the last iteration
+  double getFigureOfMeritImprovement() const;
+
+  //! Return the weight window map of the last iteration
+  const WeightWindowMap& getWeightWindowMap() const;
+
+  //! Reset the generator (the iteration history will be cleared)
+  void reset();
+
+private:
+
+  // Extract the energy discretization of the mesh flux estimator
+  void extractEnergyDiscretization( const Estimator& mesh_flux_estimator );
+
+  // Check if a bin flux estimate is reliable
+  bool isFluxEstimateReliable( const double mean,
+                               const double relative_error ) const;
+
+  // Calculate the mesh figure of merit
+  double calculateFigureOfMerit( const Estimator& mesh_flux_estimator ) const;
+
+  // The mesh
+  std::shared_ptr<const Utility::Mesh> d_mesh;
+
+  // The maximum lower weight
+  double d_max_lower_weight;
+
+  // The upper to lower weight ratio
+  double d_upper_to_lower_weight_ratio;
+
+  // The survival to lower weight ratio
+  double d_survival_to_lower_weight_ratio;
+
+  // The maximum relative error of a reliable flux estimate
+  double d_max_relative_error;
+
+  // The energy bin boundaries (empty if energy is not discretized)
+  std::vector<double> d_energy_bin_boundaries;
+
+  // The weight window map of the last iteration
+  WeightWindowMap d_weight_window_map;
+
+  // The mesh figure of merit of each iteration
+  std::vector<double> d_figures_of_merit;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,228 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstWeightWindowMeshGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <memory>
+#include <limits>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Utility::Mesh> hex_mesh;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a mesh flux estimator with two energy bins
+std::shared_ptr<MonteCarlo::Estimator> createMeshFluxEstimator()
+{
+  std::shared_ptr<MonteCarlo::Estimator> estimator(
+    new MonteCarlo::MeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>(
+                                                                  0,
+                                                                  1.0,
+                                                                  hex_mesh ) );
+
+  std::vector<double> energy_bin_boundaries( {0.0, 1.0, 20.0} );
+
+  estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                                       energy_bin_boundaries );
+
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  return estimator;
+}
+
+// Add a history that crosses the first (and optionally the second) element
+void addHistory( MonteCarlo::Estimator& estimator,
+                 const bool cross_second_element )
+{
+  MonteCarlo::PhotonState particle( 0 );
+  particle.setEnergy( 0.5 );
+  particle.setWeight( 1.0 );
+
+  double start_point[3] = {0.0, 0.5, 0.5};
+  double end_point[3] = {(cross_second_element ? 2.0 : 1.0), 0.5, 0.5};
+
+  dynamic_cast<MonteCarlo::ParticleSubtrackEndingGlobalEventObserver&>( estimator ).updateFromGlobalParticleSubtrackEndingEvent( particle, start_point, end_point );
+
+  estimator.commitHistoryContribution();
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the generator can be constructed
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, constructor )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( hex_mesh );
+
+  FRENSIE_CHECK( generator.getMesh() == hex_mesh );
+  FRENSIE_CHECK_EQUAL( generator.getNumberOfIterations(), 0 );
+  FRENSIE_CHECK( generator.getFiguresOfMerit().empty() );
+  FRENSIE_CHECK_EQUAL( generator.getFigureOfMeritImprovement(), 1.0 );
+  FRENSIE_CHECK( generator.getWeightWindowMap().empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that weight window meshes can be generated iteratively
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, generateWeightWindowMesh )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( hex_mesh );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator =
+    createMeshFluxEstimator();
+
+  // First iteration: element 0 flux = 1 (re = 0), element 1 flux = 0.5
+  // (re = 0.5), the second energy bin is not scored
+  addHistory( *estimator, true );
+  addHistory( *estimator, false );
+  addHistory( *estimator, true );
+  addHistory( *estimator, false );
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 4 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_window_mesh =
+    generator.generateWeightWindowMesh( *estimator );
+
+  FRENSIE_REQUIRE( weight_window_mesh.get() != NULL );
+  FRENSIE_CHECK( weight_window_mesh->getMesh() == hex_mesh );
+  FRENSIE_CHECK_EQUAL( weight_window_mesh->getNumberOfBins(), 2 );
+  FRENSIE_CHECK_EQUAL( generator.getNumberOfIterations(), 1 );
+
+  const MonteCarlo::WeightWindowMeshGenerator::WeightWindowMap&
+    weight_window_map = weight_window_mesh->getWeightWindowMap();
+
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.size(), 2 );
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.at( 0 ).size(), 2 );
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.at( 1 ).size(), 2 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].lower_weight, 0.5, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].survival_weight, 1.5, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].upper_weight, 2.5, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].lower_weight, 0.25, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].survival_weight, 0.75, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].upper_weight, 1.25, 1e-12 );
+
+  // No weight windows in the bins that have not been scored
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 0 )[1].lower_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 0 )[1].upper_weight,
+                       std::numeric_limits<double>::max() );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 1 )[1].lower_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 1 )[1].upper_weight,
+                       std::numeric_limits<double>::max() );
+
+  // <R^2> = (0 + 0.25 + 1 + 1)/4
+  FRENSIE_REQUIRE_EQUAL( generator.getFiguresOfMerit().size(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( generator.getFiguresOfMerit()[0],
+                                   1.0/0.5625,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( generator.getFigureOfMeritImprovement(), 1.0 );
+
+  // Second iteration: only element 0 is scored - the element 1 weight
+  // windows from the previous iteration will be kept
+  estimator->resetData();
+
+  addHistory( *estimator, false );
+  addHistory( *estimator, false );
+  addHistory( *estimator, false );
+  addHistory( *estimator, false );
+
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 0.5 );
+
+  weight_window_mesh = generator.generateWeightWindowMesh( *estimator );
+
+  FRENSIE_CHECK_EQUAL( generator.getNumberOfIterations(), 2 );
+
+  const MonteCarlo::WeightWindowMeshGenerator::WeightWindowMap&
+    new_weight_window_map = weight_window_mesh->getWeightWindowMap();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( new_weight_window_map.at( 0 )[0].lower_weight, 0.5, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( new_weight_window_map.at( 1 )[0].lower_weight, 0.25, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( new_weight_window_map.at( 1 )[0].upper_weight, 1.25, 1e-12 );
+
+  // <R^2> = (0 + 1 + 1 + 1)/4
+  FRENSIE_REQUIRE_EQUAL( generator.getFiguresOfMerit().size(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( generator.getFiguresOfMerit()[1],
+                                   1.0/(0.75*0.5),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( generator.getFigureOfMeritImprovement(),
+                                   0.5625/0.375,
+                                   1e-12 );
+
+  // Reset the generator
+  generator.reset();
+
+  FRENSIE_CHECK_EQUAL( generator.getNumberOfIterations(), 0 );
+  FRENSIE_CHECK( generator.getWeightWindowMap().empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the estimator discretization must be compatible
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator,
+                   generateWeightWindowMesh_bad_discretization )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( hex_mesh );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator =
+    createMeshFluxEstimator();
+
+  addHistory( *estimator, true );
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 1 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  generator.generateWeightWindowMesh( *estimator );
+
+  // The energy discretization cannot change between iterations
+  std::shared_ptr<MonteCarlo::Estimator> new_estimator(
+    new MonteCarlo::MeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>(
+                                                                  1,
+                                                                  1.0,
+                                                                  hex_mesh ) );
+
+  FRENSIE_CHECK_THROW( generator.generateWeightWindowMesh( *new_estimator ),
+                       std::runtime_error );
+
+  // Only the energy dimension can be discretized
+  generator.reset();
+
+  new_estimator->setDiscretization<MonteCarlo::OBSERVER_TIME_DIMENSION>(
+                                      std::vector<double>( {0.0, 1.0} ) );
+
+  FRENSIE_CHECK_THROW( generator.generateWeightWindowMesh( *new_estimator ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  std::vector<double> x_planes = {0.0, 1.0, 2.0};
+  std::vector<double> y_planes = {0.0, 1.0};
+  std::vector<double> z_planes = {0.0, 1.0};
+
+  hex_mesh.reset( new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstWeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -9,13 +9,33 @@
 #ifndef MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_HPP
 #define MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_HPP
 
+// Std Lib Includes
+#include <vector>
+
 // FRENSIE Includes
 #include "MonteCarlo_StandardParticleSimulationManager.hpp"
 #include "Utility_Communicator.hpp"
+#include "Utility_Timer.hpp"
 
 namespace MonteCarlo{
 
-//! The batched distributed standard particle simulation manager
+/*! The batched distributed standard particle simulation manager
+ *
+ * The root process coordinates the workers and simulates small tasks
+ * whenever no worker is waiting for a new task. The size of the tasks that
+ * are assigned to each worker is scaled by the measured throughput of the
+ * worker relative to the average worker throughput.
+ *
+ * When overlapped rendezvous mode is on (see
+ * MonteCarlo::SimulationGeneralProperties) the workers do not stop at a
+ * rendezvous. Each worker sends the change in its summable estimator data
+ * since its last contribution to the root process without blocking and then
+ * requests more work. Once every worker has contributed the root process
+ * archives the combined data (the snapshots and the source sampling
+ * statistics in these intermediate archives are from the root process only)
+ * and restores its own data. All data is fully reduced at the end of the
+ * simulation.
+ */
 template<ParticleModeType mode>
 class BatchedDistributedStandardParticleSimulationManager : public StandardParticleSimulationManager<mode>
 {
@@ -69,14 +89,52 @@ private:
   // Tell workers to stop working
   void stopWorkersAndRecordWork( const bool simulation_complete,
                                  const bool rendezvous_required,
-                                 const uint64_t batch_number );
+                                 const uint64_t histories_assigned );
 
   // Check for idle worker
   bool isIdleWorkerPresent( Utility::Communicator::Status& idle_worker_info );
 
   // Assign work to idle worker
-  void assignWorkToIdleWorker( const Utility::Communicator::Status& idle_worker_info,
-                               const std::pair<uint64_t,uint64_t>& task );
+  uint64_t assignWorkToIdleWorker(
+                         const Utility::Communicator::Status& idle_worker_info,
+                         const uint64_t task_start_history,
+                         const uint64_t remaining_histories );
+
+  // Update the throughput of a worker that has completed its task
+  void updateWorkerThroughput( const int worker );
+
+  // Calculate the task size for a worker
+  uint64_t calculateWorkerTaskSize( const int worker,
+                                    const uint64_t remaining_histories ) const;
+
+  // Complete a task on the root process
+  uint64_t completeRootTask( const uint64_t task_start_history,
+                             const uint64_t remaining_histories );
+
+  // Start an overlapped rendezvous
+  void startOverlappedRendezvous( const uint64_t histories_assigned );
+
+  // Notify an idle worker of the overlapped rendezvous
+  void notifyIdleWorkerOfRendezvous(
+                        const Utility::Communicator::Status& idle_worker_info );
+
+  // Receive the overlapped rendezvous contributions that have arrived
+  void receiveRendezvousContributions();
+
+  // Wait for every worker to contribute to the overlapped rendezvous
+  void waitForRendezvousContributions();
+
+  // Check if every worker has contributed to the overlapped rendezvous
+  bool haveAllWorkersContributedToRendezvous() const;
+
+  // Complete the overlapped rendezvous
+  void completeOverlappedRendezvous();
+
+  // Check if histories can be simulated while a rendezvous is pending
+  bool isWorkAllowedDuringRendezvous() const;
+
+  // Contribute to the overlapped rendezvous (workers only)
+  void contributeToOverlappedRendezvous();
 
   // Complete assigned work
   void work();
@@ -86,6 +144,55 @@ private:
 
   // The number of batches per rendezvous
   uint64_t d_batches_per_rendezvous;
+
+  // The size of the task assigned to each worker (0 = no task)
+  std::vector<uint64_t> d_worker_task_sizes;
+
+  // The task timer for each worker
+  std::vector<std::shared_ptr<Utility::Timer> > d_worker_task_timers;
+
+  // The measured throughput of each worker (histories/s, 0 = unknown)
+  std::vector<double> d_worker_throughputs;
+
+  // The overlapped rendezvous state of a worker
+  enum WorkerRendezvousState{
+    RENDEZVOUS_NOT_NOTIFIED = 0,
+    RENDEZVOUS_NOTIFIED,
+    RENDEZVOUS_CONTRIBUTED
+  };
+
+  // Overlapped rendezvous mode
+  bool d_overlapped_rendezvous_mode_on;
+
+  // The number of histories that will be simulated (0 = no history limit)
+  uint64_t d_number_of_histories;
+
+  // Records if an overlapped rendezvous is pending (root only)
+  bool d_rendezvous_pending;
+
+  // Records if the simulation was complete at the last overlapped rendezvous
+  bool d_rendezvous_simulation_complete;
+
+  // The overlapped rendezvous state of each worker (root only)
+  std::vector<WorkerRendezvousState> d_worker_rendezvous_states;
+
+  // The packed root data at the start of the pending rendezvous (root only)
+  std::vector<double> d_root_rendezvous_data;
+
+  // The sum of the packed worker contributions (root only)
+  std::vector<double> d_worker_rendezvous_data;
+
+  // The packed data at the last rendezvous contribution (workers only)
+  std::vector<double> d_contributed_rendezvous_data;
+
+  // The rendezvous contribution that is being sent (workers only)
+  std::vector<double> d_rendezvous_contribution;
+
+  // The rendezvous contribution request (workers only)
+  Utility::Communicator::Request d_rendezvous_contribution_request;
+
+  // The max factor that a worker task size can be scaled by
+  static const double s_max_task_size_scale_factor;
 };
   
 } // end MonteCarlo namespace
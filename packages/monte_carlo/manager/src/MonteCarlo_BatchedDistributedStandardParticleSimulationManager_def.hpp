@@ -9,11 +9,18 @@
 #ifndef MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 #define MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
+// Initialize static member data
+template<ParticleModeType mode>
+const double BatchedDistributedStandardParticleSimulationManager<mode>::s_max_task_size_scale_factor = 4.0;
+
 // Constructor
 template<ParticleModeType mode>
 BatchedDistributedStandardParticleSimulationManager<mode>::BatchedDistributedStandardParticleSimulationManager(
@@ -41,13 +48,24 @@ BatchedDistributedStandardParticleSimulationManager<mode>::BatchedDistributedSta
                                              rendezvous_number,
                                              use_single_rendezvous_file ),
   d_comm( comm ),
-  d_batches_per_rendezvous( 0 )
+  d_batches_per_rendezvous( 0 ),
+  d_worker_task_sizes( comm->size(), 0 ),
+  d_worker_task_timers( comm->size() ),
+  d_worker_throughputs( comm->size(), 0.0 ),
+  d_overlapped_rendezvous_mode_on( properties->isOverlappedRendezvousModeOn() ),
+  d_number_of_histories( properties->getNumberOfHistories() ),
+  d_rendezvous_pending( false ),
+  d_rendezvous_simulation_complete( false ),
+  d_worker_rendezvous_states( comm->size(), RENDEZVOUS_NOT_NOTIFIED )
 {
   // Make sure that the communicator pointer is valid
   testPrecondition( comm.get() );
   // Make sure that the communicator is not a serial communicator
   testPrecondition( comm->size() > 1 );
 
+  for( size_t i = 0; i < d_worker_task_timers.size(); ++i )
+    d_worker_task_timers[i] = comm->createTimer();
+
   // Calculate the batch size
   d_batches_per_rendezvous =
     properties->getNumberOfBatchesPerProcessor()*(comm->size()-1);
@@ -126,6 +144,8 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
 
   if( d_comm->rank() == 0 )
   {
+    this->waitForRendezvousArchive();
+    
     FRENSIE_LOG_NOTIFICATION( "Simulation finished. " );
     
     FRENSIE_FLUSH_ALL_LOGS();
@@ -135,14 +155,17 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
 }
 
 // Coorindate workers
+/*! \details The root process will never block while waiting for a worker to
+ * become idle. When no idle worker is present the root process will complete
+ * a small task itself. In overlapped rendezvous mode the root process will
+ * only block when the next rendezvous batch has been assigned before every
+ * worker has contributed to the pending rendezvous.
+ */
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorkers()
 {
-  // The current batch number
-  uint64_t batch_number = 0;
-
-  // The batch info (start history, end history + 1)
-  std::pair<uint64_t,uint64_t> task;
+  // The number of histories that have been assigned in this rendezvous batch
+  uint64_t histories_assigned = 0;
 
   // The idle worker info
   Utility::Communicator::Status idle_worker_info;
@@ -151,42 +174,92 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorker
   
   while( true )
   {
-    if( this->isSimulationComplete() )
+    // Collect the overlapped rendezvous contributions that have arrived
+    if( d_rendezvous_pending )
     {
-      this->stopWorkersAndRecordWork( true, rendezvous_required, batch_number );
+      this->receiveRendezvousContributions();
+
+      if( this->haveAllWorkersContributedToRendezvous() )
+        this->completeOverlappedRendezvous();
+    }
+    
+    if( this->isSimulationComplete() || d_rendezvous_simulation_complete )
+    {
+      // The worker data has never been reduced in overlapped rendezvous mode
+      if( d_overlapped_rendezvous_mode_on )
+      {
+        if( d_rendezvous_pending )
+          this->waitForRendezvousContributions();
+
+        rendezvous_required = true;
+      }
+      
+      this->stopWorkersAndRecordWork( true,
+                                      rendezvous_required,
+                                      histories_assigned );
 
       break;
     }
-    else if( batch_number == d_batches_per_rendezvous )
+    else if( histories_assigned == this->getRendezvousBatchSize() ||
+             (d_rendezvous_pending && !this->isWorkAllowedDuringRendezvous()) )
     {
-      this->stopWorkersAndRecordWork( false, true, batch_number );
+      if( d_overlapped_rendezvous_mode_on )
+      {
+        // Wait for the pending rendezvous before starting a new one
+        if( d_rendezvous_pending )
+        {
+          this->waitForRendezvousContributions();
+          this->completeOverlappedRendezvous();
+        }
+        else
+        {
+          this->startOverlappedRendezvous( histories_assigned );
+
+          // Reset the number of histories assigned
+          histories_assigned = 0;
+        }
+      }
+      else
+      {
+        this->stopWorkersAndRecordWork( false, true, histories_assigned );
       
-      // The rendezvous is complete
-      rendezvous_required = false;
+        // The rendezvous is complete
+        rendezvous_required = false;
       
-      // Reset the batch number
-      batch_number = 0;
+        // Reset the number of histories assigned
+        histories_assigned = 0;
+      }
       
       continue;
     }
     else if( this->isIdleWorkerPresent( idle_worker_info ) )
     {
-      // Set the batch start history
-      task.first = this->getNextHistory() + batch_number*this->getBatchSize();
-      
-      task.second = task.first + this->getBatchSize();
-
-      // Check if the size of the last batch is correct
-      if( batch_number == d_batches_per_rendezvous - 1 )
+      // Workers must contribute to the pending rendezvous before working
+      if( d_rendezvous_pending &&
+          d_worker_rendezvous_states[idle_worker_info.source()] ==
+          RENDEZVOUS_NOT_NOTIFIED )
       {
-        task.second += this->getRendezvousBatchSize() -
-          d_batches_per_rendezvous*this->getBatchSize();
-      }
+        this->notifyIdleWorkerOfRendezvous( idle_worker_info );
 
-      this->assignWorkToIdleWorker( idle_worker_info, task );
-
-      // Increment the batch number
-      ++batch_number;
+        continue;
+      }
+      
+      histories_assigned +=
+        this->assignWorkToIdleWorker( idle_worker_info,
+                                      this->getNextHistory() +
+                                      histories_assigned,
+                                      this->getRendezvousBatchSize() -
+                                      histories_assigned );
+      
+      // A rendezvous is required
+      rendezvous_required = true;
+    }
+    else
+    {
+      histories_assigned +=
+        this->completeRootTask( this->getNextHistory() + histories_assigned,
+                                this->getRendezvousBatchSize() -
+                                histories_assigned );
 
       // A rendezvous is required
       rendezvous_required = true;
@@ -197,9 +270,9 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorker
 // Tell workers to stop working
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::stopWorkersAndRecordWork(
-                                                const bool simulation_complete,
-                                                const bool rendezvous_required,
-                                                const uint64_t batch_number )
+                                            const bool simulation_complete,
+                                            const bool rendezvous_required,
+                                            const uint64_t histories_assigned )
 {
   // The idle worker messages
   std::vector<int> idle_worker_messages( d_comm->size()-1 );
@@ -247,11 +320,11 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::stopWorkersAndRe
 
   Utility::wait( requests, statuses );
 
+  // The last task timings include the rendezvous wait - discard them
+  std::fill( d_worker_task_sizes.begin(), d_worker_task_sizes.end(), 0 );
+
   // Increment the next history
-  if( batch_number == d_batches_per_rendezvous )
-    this->incrementNextHistory( this->getRendezvousBatchSize() );
-  else
-    this->incrementNextHistory( batch_number*this->getBatchSize() );
+  this->incrementNextHistory( histories_assigned );
 
   // Rendezvous after rendezvous batch completed
   if( !simulation_complete )
@@ -266,9 +339,9 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::stopWorkersAndRe
 template<ParticleModeType mode>
 bool BatchedDistributedStandardParticleSimulationManager<mode>::isIdleWorkerPresent( Utility::Communicator::Status& idle_worker_info )
 {
-  // Probe for an idle worker
+  // Probe for an idle worker (rendezvous contributions use tag 1)
   try{
-    idle_worker_info = Utility::iprobe<int>( *d_comm );
+    idle_worker_info = Utility::iprobe<int>( *d_comm, 0 );
   }
   EXCEPTION_CATCH_RETHROW( std::runtime_error,
                            "Unable to probe for idle worker on root "
@@ -278,11 +351,18 @@ bool BatchedDistributedStandardParticleSimulationManager<mode>::isIdleWorkerPres
 }
 
 // Assign work to idle worker
+/*! \details The number of histories assigned to the worker will be
+ * returned.
+ */
 template<ParticleModeType mode>
-void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdleWorker(
+uint64_t BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdleWorker(
                          const Utility::Communicator::Status& idle_worker_info,
-                         const std::pair<uint64_t,uint64_t>& task )
+                         const uint64_t task_start_history,
+                         const uint64_t remaining_histories )
 {
+  // Make sure that there is work to assign
+  testPrecondition( remaining_histories > 0 );
+  
   // Contact the idle worker
   int idle_worker_message;
   
@@ -297,6 +377,16 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdle
                            "worker process "
                            << idle_worker_info.source() << "!" );
 
+  const int worker = idle_worker_info.source();
+
+  this->updateWorkerThroughput( worker );
+
+  // The batch info (start history, end history + 1)
+  std::pair<uint64_t,uint64_t> task;
+  task.first = task_start_history;
+  task.second = task_start_history +
+    this->calculateWorkerTaskSize( worker, remaining_histories );
+
   // Assign the task to the worker
   try{
     Utility::send( *d_comm,
@@ -308,6 +398,357 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdle
                            "Unable to send the work task from the root "
                            "process to worker process "
                            << idle_worker_info.source() << "!" );
+
+  // Time the task
+  d_worker_task_sizes[worker] = task.second - task.first;
+
+  d_worker_task_timers[worker]->stop();
+  d_worker_task_timers[worker]->start();
+
+  return d_worker_task_sizes[worker];
+}
+
+// Update the throughput of a worker that has completed its task
+/*! \details The throughput is a running average (with equal weight given to
+ * the latest measurement and all previous measurements).
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::updateWorkerThroughput( const int worker )
+{
+  if( d_worker_task_sizes[worker] > 0 )
+  {
+    d_worker_task_timers[worker]->stop();
+
+    const double task_time = d_worker_task_timers[worker]->elapsed().count();
+
+    if( task_time > 0.0 )
+    {
+      const double throughput = d_worker_task_sizes[worker]/task_time;
+
+      if( d_worker_throughputs[worker] > 0.0 )
+      {
+        d_worker_throughputs[worker] =
+          0.5*(d_worker_throughputs[worker] + throughput);
+      }
+      else
+        d_worker_throughputs[worker] = throughput;
+    }
+
+    d_worker_task_sizes[worker] = 0;
+  }
+}
+
+// Calculate the task size for a worker
+/*! \details The batch size will be scaled by the throughput of the worker
+ * relative to the average throughput of all workers that have been
+ * measured so that every task takes roughly the same amount of time. The
+ * scale factor is limited to [1/s,s] where s is the max task size scale
+ * factor.
+ */
+template<ParticleModeType mode>
+uint64_t BatchedDistributedStandardParticleSimulationManager<mode>::calculateWorkerTaskSize(
+                                  const int worker,
+                                  const uint64_t remaining_histories ) const
+{
+  uint64_t task_size = this->getBatchSize();
+
+  if( d_worker_throughputs[worker] > 0.0 )
+  {
+    double throughput_sum = 0.0;
+    size_t measured_workers = 0;
+
+    for( size_t i = 1; i < d_worker_throughputs.size(); ++i )
+    {
+      if( d_worker_throughputs[i] > 0.0 )
+      {
+        throughput_sum += d_worker_throughputs[i];
+        ++measured_workers;
+      }
+    }
+
+    double scale_factor =
+      d_worker_throughputs[worker]*measured_workers/throughput_sum;
+
+    scale_factor = std::min( scale_factor, s_max_task_size_scale_factor );
+    scale_factor = std::max( scale_factor, 1.0/s_max_task_size_scale_factor );
+
+    task_size = (uint64_t)(task_size*scale_factor);
+
+    if( task_size == 0 )
+      task_size = 1;
+  }
+
+  return std::min( task_size, remaining_histories );
+}
+
+// Complete a task on the root process
+/*! \details The root task size is the batch size divided by the number of
+ * processes so that idle workers never wait long for a new task. The number
+ * of histories completed will be returned.
+ */
+template<ParticleModeType mode>
+uint64_t BatchedDistributedStandardParticleSimulationManager<mode>::completeRootTask(
+                                          const uint64_t task_start_history,
+                                          const uint64_t remaining_histories )
+{
+  // Make sure that there is work to complete
+  testPrecondition( remaining_histories > 0 );
+  
+  uint64_t task_size = this->getBatchSize()/d_comm->size();
+
+  if( task_size == 0 )
+    task_size = 1;
+
+  task_size = std::min( task_size, remaining_histories );
+
+  this->runSimulationBatch( task_start_history,
+                            task_start_history + task_size );
+
+  return task_size;
+}
+
+// Start an overlapped rendezvous
+/*! \details The root process data is packed at the start of the rendezvous
+ * so that the root process can continue to complete tasks from the next
+ * rendezvous batch while the workers contribute.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::startOverlappedRendezvous( const uint64_t histories_assigned )
+{
+  // Make sure that a rendezvous is not pending
+  testPrecondition( !d_rendezvous_pending );
+
+  // Increment the next history
+  this->incrementNextHistory( histories_assigned );
+
+  this->packReductionData( d_root_rendezvous_data );
+
+  if( d_worker_rendezvous_data.size() != d_root_rendezvous_data.size() )
+    d_worker_rendezvous_data.assign( d_root_rendezvous_data.size(), 0.0 );
+
+  std::fill( d_worker_rendezvous_states.begin(),
+             d_worker_rendezvous_states.end(),
+             RENDEZVOUS_NOT_NOTIFIED );
+
+  // The root process does not need to be notified
+  d_worker_rendezvous_states.front() = RENDEZVOUS_CONTRIBUTED;
+
+  d_rendezvous_pending = true;
+}
+
+// Notify an idle worker of the overlapped rendezvous
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::notifyIdleWorkerOfRendezvous(
+                        const Utility::Communicator::Status& idle_worker_info )
+{
+  // Contact the idle worker
+  int idle_worker_message;
+  
+  try{
+    Utility::receive( *d_comm,
+                      idle_worker_info.source(),
+                      idle_worker_info.tag(),
+                      idle_worker_message );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to receive message on root process from "
+                           "worker process "
+                           << idle_worker_info.source() << "!" );
+
+  const int worker = idle_worker_info.source();
+
+  this->updateWorkerThroughput( worker );
+
+  // The rendezvous message
+  std::pair<uint64_t,uint64_t> rendezvous_message = std::make_pair( 0, 0 );
+
+  try{
+    Utility::send( *d_comm,
+                   idle_worker_info.source(),
+                   idle_worker_info.tag(),
+                   rendezvous_message );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to send the rendezvous message from the "
+                           "root process to worker process "
+                           << idle_worker_info.source() << "!" );
+
+  d_worker_rendezvous_states[worker] = RENDEZVOUS_NOTIFIED;
+}
+
+// Receive the overlapped rendezvous contributions that have arrived
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::receiveRendezvousContributions()
+{
+  std::vector<double> contribution;
+  
+  for( int i = 1; i < d_comm->size(); ++i )
+  {
+    if( d_worker_rendezvous_states[i] != RENDEZVOUS_NOTIFIED )
+      continue;
+
+    Utility::Communicator::Status contribution_info;
+
+    try{
+      contribution_info = Utility::iprobe<double>( *d_comm, i, 1 );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to probe for rendezvous contribution "
+                             "from worker process " << i << "!" );
+
+    if( !contribution_info.hasMessageDetails() )
+      continue;
+
+    contribution.resize( d_worker_rendezvous_data.size() );
+
+    try{
+      Utility::receive( *d_comm, i, 1, Utility::arrayView( contribution ) );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to receive rendezvous contribution on "
+                             "root process from worker process " << i << "!" );
+
+    for( size_t j = 0; j < contribution.size(); ++j )
+      d_worker_rendezvous_data[j] += contribution[j];
+
+    d_worker_rendezvous_states[i] = RENDEZVOUS_CONTRIBUTED;
+  }
+}
+
+// Wait for every worker to contribute to the overlapped rendezvous
+/*! \details Only the workers that have not been notified yet will be
+ * contacted. Any other idle worker will be left waiting.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::waitForRendezvousContributions()
+{
+  while( !this->haveAllWorkersContributedToRendezvous() )
+  {
+    for( int i = 1; i < d_comm->size(); ++i )
+    {
+      if( d_worker_rendezvous_states[i] != RENDEZVOUS_NOT_NOTIFIED )
+        continue;
+
+      Utility::Communicator::Status idle_worker_info;
+
+      try{
+        idle_worker_info = Utility::iprobe<int>( *d_comm, i, 0 );
+      }
+      EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                               "Unable to probe for idle worker " << i <<
+                               " on root process!" );
+
+      if( idle_worker_info.hasMessageDetails() )
+        this->notifyIdleWorkerOfRendezvous( idle_worker_info );
+    }
+
+    this->receiveRendezvousContributions();
+  }
+}
+
+// Check if every worker has contributed to the overlapped rendezvous
+template<ParticleModeType mode>
+bool BatchedDistributedStandardParticleSimulationManager<mode>::haveAllWorkersContributedToRendezvous() const
+{
+  return std::all_of( d_worker_rendezvous_states.begin(),
+                      d_worker_rendezvous_states.end(),
+                      []( const WorkerRendezvousState state ){
+                        return state == RENDEZVOUS_CONTRIBUTED; } );
+}
+
+// Complete the overlapped rendezvous
+/*! \details The combined data is only loaded by the root process while the
+ * rendezvous archive is serialized. The root process data is restored
+ * afterwards so that the final reduction does not count the worker data
+ * twice. Only the summable observer data is combined - the observer
+ * snapshots and the source sampling statistics are those of the root
+ * process. The archive is therefore marked as an intermediate archive that
+ * cannot be used to restart the simulation. No archive will be written if
+ * the combined data shows that the simulation is complete (the final
+ * rendezvous, which reduces all data, will write it).
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::completeOverlappedRendezvous()
+{
+  // Make sure that a rendezvous is pending
+  testPrecondition( d_rendezvous_pending );
+  // Make sure that every worker has contributed
+  testPrecondition( this->haveAllWorkersContributedToRendezvous() );
+  
+  d_rendezvous_pending = false;
+
+  std::vector<double> root_data;
+
+  this->packReductionData( root_data );
+
+  std::vector<double> combined_data( d_worker_rendezvous_data );
+
+  for( size_t i = 0; i < combined_data.size(); ++i )
+    combined_data[i] += d_root_rendezvous_data[i];
+
+  this->unpackReductionData( combined_data );
+
+  d_rendezvous_simulation_complete = this->isSimulationComplete();
+
+  if( !d_rendezvous_simulation_complete )
+    this->intermediateRendezvous();
+
+  this->unpackReductionData( root_data );
+}
+
+// Check if histories can be simulated while a rendezvous is pending
+/*! \details When a history limit has been set histories from the next
+ * rendezvous batch will only be simulated if the limit has not been
+ * reached. This prevents histories beyond the limit from being simulated
+ * before the pending rendezvous shows that the simulation is complete.
+ */
+template<ParticleModeType mode>
+bool BatchedDistributedStandardParticleSimulationManager<mode>::isWorkAllowedDuringRendezvous() const
+{
+  return d_number_of_histories == 0 ||
+    this->getNextHistory() < d_number_of_histories;
+}
+
+// Contribute to the overlapped rendezvous (workers only)
+/*! \details The change in the packed data since the last contribution will
+ * be sent to the root process without blocking. The worker data is not
+ * reset (the snapshots remain valid) - it will be reduced at the end of the
+ * simulation.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::contributeToOverlappedRendezvous()
+{
+  std::vector<double> packed_data;
+
+  this->packReductionData( packed_data );
+
+  if( d_contributed_rendezvous_data.size() != packed_data.size() )
+    d_contributed_rendezvous_data.assign( packed_data.size(), 0.0 );
+
+  // The previous contribution must be sent before the buffer is reused
+  d_rendezvous_contribution_request.wait();
+
+  d_rendezvous_contribution.resize( packed_data.size() );
+
+  for( size_t i = 0; i < packed_data.size(); ++i )
+  {
+    d_rendezvous_contribution[i] =
+      packed_data[i] - d_contributed_rendezvous_data[i];
+  }
+
+  d_contributed_rendezvous_data.swap( packed_data );
+
+  try{
+    d_rendezvous_contribution_request =
+      Utility::isend( *d_comm,
+                      0,
+                      1,
+                      Utility::arrayViewOfConst( d_rendezvous_contribution ) );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Worker process " << d_comm->rank() <<
+                           " unable to send rendezvous contribution to root "
+                           "process!" );
 }
 
 // Complete assigned work
@@ -339,8 +780,14 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::work()
     // Run the simulation batch
     if( task.first != task.second )
       this->runSimulationBatch( task.first, task.second );
+    // Contribute to the overlapped rendezvous and keep working
+    else if( task.first == 0 && d_overlapped_rendezvous_mode_on )
+      this->contributeToOverlappedRendezvous();
     else
     {
+      // The last contribution must be sent before the final reduction
+      d_rendezvous_contribution_request.wait();
+      
       // Rendezvous with the root process
       if( task.first < 2 )
         this->rendezvous();
@@ -378,6 +825,9 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::signalHandler( i
 { /* ... */ }
 
 // Rendezvous (cache state)
+/*! \details The workers will not wait for the root process to archive the
+ * reduced data.
+ */
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::rendezvous()
 {
@@ -385,8 +835,6 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::rendezvous()
 
   if( d_comm->rank() == 0 )
     ParticleSimulationManager::rendezvous();
-
-  d_comm->barrier();
 }
   
 } // end MonteCarlo namespace
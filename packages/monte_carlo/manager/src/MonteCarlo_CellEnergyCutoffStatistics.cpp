@@ -0,0 +1,437 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CellEnergyCutoffStatistics.cpp
+//! \author Alex Robinson
+//! \brief  Cell energy cutoff statistics class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_CellEnergyCutoffStatistics.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+CellEnergyCutoffStatistics::CellEnergyCutoffStatistics(
+                                     const Geometry::Model::CellIdSet& cells )
+  : d_cells( cells.begin(), cells.end() ),
+    d_number_of_threads( 0 ),
+    d_thread_statistics( nullptr, ThreadStatisticsDeleter() )
+{
+  std::sort( d_cells.begin(), d_cells.end() );
+
+  this->enableThreadSupport( 1 );
+}
+
+// Enable thread support
+/*! \details Only the master thread should call this method. Any recorded
+ * statistics will be lost.
+ */
+void CellEnergyCutoffStatistics::enableThreadSupport(
+                                             const unsigned number_of_threads )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the number of threads is valid
+  testPrecondition( number_of_threads > 0 );
+
+  d_number_of_threads = number_of_threads;
+
+  d_thread_statistics =
+    std::unique_ptr<ThreadStatistics[],ThreadStatisticsDeleter>(
+                          createThreadStatistics( number_of_threads ),
+                          ThreadStatisticsDeleter( number_of_threads ) );
+
+  for( unsigned i = 0; i < number_of_threads; ++i )
+    this->resetThreadStatistics( d_thread_statistics[i] );
+}
+
+// Destroy the statistics and free their memory
+void CellEnergyCutoffStatistics::ThreadStatisticsDeleter::operator()(
+                                          ThreadStatistics* statistics ) const
+{
+  for( unsigned i = 0; i < number_of_statistics; ++i )
+    statistics[i].~ThreadStatistics();
+
+  free( statistics );
+}
+
+// Create the (aligned) thread statistics array
+/*! \details Operator new[] is not required to respect the extended alignment
+ * of the statistics before C++17 so the memory is allocated with
+ * posix_memalign.
+ */
+auto CellEnergyCutoffStatistics::createThreadStatistics(
+                   const unsigned number_of_statistics ) -> ThreadStatistics*
+{
+  void* statistics_memory = NULL;
+
+  if( posix_memalign( &statistics_memory,
+                      alignof(ThreadStatistics),
+                      number_of_statistics*sizeof(ThreadStatistics) ) != 0 )
+    throw std::bad_alloc();
+
+  ThreadStatistics* statistics =
+    static_cast<ThreadStatistics*>( statistics_memory );
+
+  for( unsigned i = 0; i < number_of_statistics; ++i )
+    new (statistics + i) ThreadStatistics;
+
+  return statistics;
+}
+
+// Record a particle that was terminated by a cell energy cutoff
+/*! \details This method is thread-safe (if thread support has been enabled).
+ */
+void CellEnergyCutoffStatistics::recordCellEnergyCutoffTermination(
+                                  const Geometry::Model::EntityId cell,
+                                  const double estimated_avoided_subtracks )
+{
+  // Make sure thread support has been set up correctly
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_number_of_threads );
+  // Make sure the estimated number of avoided subtracks is valid
+  testPrecondition( estimated_avoided_subtracks >= 0.0 );
+
+  size_t cell_index = this->getCellIndex( cell );
+
+  if( cell_index < d_cells.size() )
+  {
+    ThreadStatistics& statistics =
+      d_thread_statistics[Utility::OpenMPProperties::getThreadId()];
+
+    ++statistics.cell_energy_cutoff_terminations[cell_index];
+
+    statistics.estimated_avoided_subtracks[cell_index] +=
+      estimated_avoided_subtracks;
+  }
+}
+
+// Record a particle that was terminated by range rejection
+/*! \details This method is thread-safe (if thread support has been enabled).
+ */
+void CellEnergyCutoffStatistics::recordRangeRejectionTermination(
+                                  const Geometry::Model::EntityId cell,
+                                  const double estimated_avoided_subtracks )
+{
+  // Make sure thread support has been set up correctly
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_number_of_threads );
+  // Make sure the estimated number of avoided subtracks is valid
+  testPrecondition( estimated_avoided_subtracks >= 0.0 );
+
+  size_t cell_index = this->getCellIndex( cell );
+
+  if( cell_index < d_cells.size() )
+  {
+    ThreadStatistics& statistics =
+      d_thread_statistics[Utility::OpenMPProperties::getThreadId()];
+
+    ++statistics.range_rejection_terminations[cell_index];
+
+    statistics.estimated_avoided_subtracks[cell_index] +=
+      estimated_avoided_subtracks;
+  }
+}
+
+// Record the time spent simulating a subtrack (s)
+/*! \details This method is thread-safe (if thread support has been enabled).
+ */
+void CellEnergyCutoffStatistics::recordSubtrackTime( const double subtrack_time )
+{
+  // Make sure thread support has been set up correctly
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_number_of_threads );
+
+  ThreadStatistics& statistics =
+    d_thread_statistics[Utility::OpenMPProperties::getThreadId()];
+
+  statistics.subtrack_time += subtrack_time;
+  ++statistics.number_of_subtracks;
+}
+
+// Return the number of cell energy cutoff terminations in a cell
+uint64_t CellEnergyCutoffStatistics::getNumberOfCellEnergyCutoffTerminations(
+                                   const Geometry::Model::EntityId cell ) const
+{
+  size_t cell_index = this->getCellIndex( cell );
+
+  uint64_t terminations = 0;
+
+  if( cell_index < d_cells.size() )
+  {
+    for( unsigned i = 0; i < d_number_of_threads; ++i )
+    {
+      terminations +=
+        d_thread_statistics[i].cell_energy_cutoff_terminations[cell_index];
+    }
+  }
+
+  return terminations;
+}
+
+// Return the number of range rejection terminations in a cell
+uint64_t CellEnergyCutoffStatistics::getNumberOfRangeRejectionTerminations(
+                                   const Geometry::Model::EntityId cell ) const
+{
+  size_t cell_index = this->getCellIndex( cell );
+
+  uint64_t terminations = 0;
+
+  if( cell_index < d_cells.size() )
+  {
+    for( unsigned i = 0; i < d_number_of_threads; ++i )
+    {
+      terminations +=
+        d_thread_statistics[i].range_rejection_terminations[cell_index];
+    }
+  }
+
+  return terminations;
+}
+
+// Return the estimated number of avoided subtracks in a cell
+double CellEnergyCutoffStatistics::getEstimatedNumberOfAvoidedSubtracks(
+                                   const Geometry::Model::EntityId cell ) const
+{
+  size_t cell_index = this->getCellIndex( cell );
+
+  double avoided_subtracks = 0.0;
+
+  if( cell_index < d_cells.size() )
+  {
+    for( unsigned i = 0; i < d_number_of_threads; ++i )
+    {
+      avoided_subtracks +=
+        d_thread_statistics[i].estimated_avoided_subtracks[cell_index];
+    }
+  }
+
+  return avoided_subtracks;
+}
+
+// Return the mean time per subtrack (s)
+double CellEnergyCutoffStatistics::getMeanSubtrackTime() const
+{
+  double subtrack_time = 0.0;
+  uint64_t number_of_subtracks = 0;
+
+  for( unsigned i = 0; i < d_number_of_threads; ++i )
+  {
+    subtrack_time += d_thread_statistics[i].subtrack_time;
+    number_of_subtracks += d_thread_statistics[i].number_of_subtracks;
+  }
+
+  if( number_of_subtracks > 0 )
+    return subtrack_time/number_of_subtracks;
+  else
+    return 0.0;
+}
+
+// Return the estimated time saved in a cell (s)
+double CellEnergyCutoffStatistics::getEstimatedTimeSaved(
+                                   const Geometry::Model::EntityId cell ) const
+{
+  return this->getEstimatedNumberOfAvoidedSubtracks( cell )*
+    this->getMeanSubtrackTime();
+}
+
+// Reset the statistics
+/*! \details Only the master thread should call this method.
+ */
+void CellEnergyCutoffStatistics::resetData()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( unsigned i = 0; i < d_number_of_threads; ++i )
+    this->resetThreadStatistics( d_thread_statistics[i] );
+}
+
+// Reduce the statistics on all processes in comm and collect on the root
+/*! \details Only the master thread should call this method. The statistics
+ * will be reset on all processes except the root process.
+ */
+void CellEnergyCutoffStatistics::reduceData( const Utility::Communicator& comm,
+                                             const int root_process )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure that the root process is valid
+  testPrecondition( root_process < comm.size() );
+
+  // Only do the reduction if there is more than one process
+  if( comm.size() > 1 )
+  {
+    std::vector<double> packed_data;
+
+    this->packData( packed_data );
+
+    try{
+      if( comm.rank() != root_process )
+      {
+        Utility::reduce( comm,
+                         packed_data,
+                         std::plus<double>(),
+                         root_process );
+      }
+      else
+      {
+        Utility::reduce( comm,
+                         std::vector<double>( packed_data ),
+                         packed_data,
+                         std::plus<double>(),
+                         root_process );
+      }
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "unable to reduce the cell energy cutoff "
+                             "statistics!" );
+
+    if( comm.rank() == root_process )
+      this->unpackData( packed_data );
+    else
+      this->resetData();
+  }
+}
+
+// Print a summary of the statistics
+/*! \details Only the cells where particles were terminated will be printed.
+ * Only the master thread should call this method.
+ */
+void CellEnergyCutoffStatistics::printSummary( std::ostream& os ) const
+{
+  os << "Cell Energy Cutoff Summary..." << "\n"
+     << "  Mean subtrack time (s): " << this->getMeanSubtrackTime() << "\n";
+
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    uint64_t cell_energy_cutoff_terminations =
+      this->getNumberOfCellEnergyCutoffTerminations( d_cells[i] );
+
+    uint64_t range_rejection_terminations =
+      this->getNumberOfRangeRejectionTerminations( d_cells[i] );
+
+    if( cell_energy_cutoff_terminations > 0 ||
+        range_rejection_terminations > 0 )
+    {
+      os << "  Cell " << d_cells[i] << ":\n"
+         << "    Cell energy cutoff terminations: "
+         << cell_energy_cutoff_terminations << "\n"
+         << "    Range rejection terminations: "
+         << range_rejection_terminations << "\n"
+         << "    Estimated avoided subtracks: "
+         << this->getEstimatedNumberOfAvoidedSubtracks( d_cells[i] ) << "\n"
+         << "    Estimated time saved (s): "
+         << this->getEstimatedTimeSaved( d_cells[i] ) << "\n";
+    }
+  }
+
+  os << std::flush;
+}
+
+// Log a summary of the statistics
+void CellEnergyCutoffStatistics::logSummary() const
+{
+  std::ostringstream oss;
+
+  this->printSummary( oss );
+
+  FRENSIE_LOG_NOTIFICATION( oss.str() );
+}
+
+// Return the index of a cell
+/*! \details The number of cells will be returned if the cell is not found.
+ */
+size_t CellEnergyCutoffStatistics::getCellIndex(
+                                   const Geometry::Model::EntityId cell ) const
+{
+  std::vector<Geometry::Model::EntityId>::const_iterator cell_it =
+    std::lower_bound( d_cells.begin(), d_cells.end(), cell );
+
+  if( cell_it != d_cells.end() && *cell_it == cell )
+    return cell_it - d_cells.begin();
+  else
+    return d_cells.size();
+}
+
+// Reset the statistics of a thread
+void CellEnergyCutoffStatistics::resetThreadStatistics(
+                                         ThreadStatistics& statistics ) const
+{
+  statistics.cell_energy_cutoff_terminations.assign( d_cells.size(), 0 );
+  statistics.range_rejection_terminations.assign( d_cells.size(), 0 );
+  statistics.estimated_avoided_subtracks.assign( d_cells.size(), 0.0 );
+  statistics.subtrack_time = 0.0;
+  statistics.number_of_subtracks = 0;
+}
+
+// Pack the statistics (summed over all threads)
+/*! \details The counters are packed as doubles so that all of the statistics
+ * can be reduced with a single reduce operation.
+ */
+void CellEnergyCutoffStatistics::packData(
+                                     std::vector<double>& packed_data ) const
+{
+  packed_data.assign( 3*d_cells.size() + 2, 0.0 );
+
+  for( unsigned i = 0; i < d_number_of_threads; ++i )
+  {
+    const ThreadStatistics& statistics = d_thread_statistics[i];
+
+    for( size_t j = 0; j < d_cells.size(); ++j )
+    {
+      packed_data[j] += statistics.cell_energy_cutoff_terminations[j];
+      packed_data[d_cells.size()+j] +=
+        statistics.range_rejection_terminations[j];
+      packed_data[2*d_cells.size()+j] +=
+        statistics.estimated_avoided_subtracks[j];
+    }
+
+    packed_data[3*d_cells.size()] += statistics.subtrack_time;
+    packed_data[3*d_cells.size()+1] += statistics.number_of_subtracks;
+  }
+}
+
+// Unpack the statistics (assigned to the master thread)
+void CellEnergyCutoffStatistics::unpackData(
+                                     const std::vector<double>& packed_data )
+{
+  // Make sure the packed data is valid
+  testPrecondition( packed_data.size() == 3*d_cells.size() + 2 );
+
+  this->resetData();
+
+  ThreadStatistics& statistics = d_thread_statistics[0];
+
+  for( size_t j = 0; j < d_cells.size(); ++j )
+  {
+    statistics.cell_energy_cutoff_terminations[j] =
+      (uint64_t)packed_data[j];
+    statistics.range_rejection_terminations[j] =
+      (uint64_t)packed_data[d_cells.size()+j];
+    statistics.estimated_avoided_subtracks[j] =
+      packed_data[2*d_cells.size()+j];
+  }
+
+  statistics.subtrack_time = packed_data[3*d_cells.size()];
+  statistics.number_of_subtracks =
+    (uint64_t)packed_data[3*d_cells.size()+1];
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CellEnergyCutoffStatistics.cpp
+//---------------------------------------------------------------------------//
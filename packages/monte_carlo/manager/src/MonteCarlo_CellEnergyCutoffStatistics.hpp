@@ -0,0 +1,161 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CellEnergyCutoffStatistics.hpp
+//! \author Alex Robinson
+//! \brief  Cell energy cutoff statistics class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CELL_ENERGY_CUTOFF_STATISTICS_HPP
+#define MONTE_CARLO_CELL_ENERGY_CUTOFF_STATISTICS_HPP
+
+// Std Lib Includes
+#include <stdint.h>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// FRENSIE Includes
+#include "Geometry_Model.hpp"
+#include "Utility_Communicator.hpp"
+
+namespace MonteCarlo{
+
+//! The cell energy cutoff statistics class
+/*! \details Records the number of particles that were terminated early in
+ * each cell, either because their energy fell below the cell energy cutoff
+ * or because they were range rejected. The time saved in a cell is estimated
+ * from the number of subtracks that the terminated particles would have
+ * needed to reach the global energy cutoff and the measured mean time per
+ * subtrack. All counters are kept per thread so that no synchronization is
+ * needed while recording.
+ */
+class CellEnergyCutoffStatistics
+{
+
+public:
+
+  //! Constructor
+  CellEnergyCutoffStatistics( const Geometry::Model::CellIdSet& cells );
+
+  //! Destructor
+  ~CellEnergyCutoffStatistics()
+  { /* ... */ }
+
+  //! Enable thread support
+  void enableThreadSupport( const unsigned number_of_threads );
+
+  //! Record a particle that was terminated by a cell energy cutoff
+  void recordCellEnergyCutoffTermination(
+                                 const Geometry::Model::EntityId cell,
+                                 const double estimated_avoided_subtracks );
+
+  //! Record a particle that was terminated by range rejection
+  void recordRangeRejectionTermination(
+                                 const Geometry::Model::EntityId cell,
+                                 const double estimated_avoided_subtracks );
+
+  //! Record the time spent simulating a subtrack (s)
+  void recordSubtrackTime( const double subtrack_time );
+
+  //! Return the number of cell energy cutoff terminations in a cell
+  uint64_t getNumberOfCellEnergyCutoffTerminations(
+                                  const Geometry::Model::EntityId cell ) const;
+
+  //! Return the number of range rejection terminations in a cell
+  uint64_t getNumberOfRangeRejectionTerminations(
+                                  const Geometry::Model::EntityId cell ) const;
+
+  //! Return the estimated number of avoided subtracks in a cell
+  double getEstimatedNumberOfAvoidedSubtracks(
+                                  const Geometry::Model::EntityId cell ) const;
+
+  //! Return the mean time per subtrack (s)
+  double getMeanSubtrackTime() const;
+
+  //! Return the estimated time saved in a cell (s)
+  double getEstimatedTimeSaved( const Geometry::Model::EntityId cell ) const;
+
+  //! Reset the statistics
+  void resetData();
+
+  //! Reduce the statistics on all processes in comm and collect on the root
+  void reduceData( const Utility::Communicator& comm,
+                   const int root_process );
+
+  //! Print a summary of the statistics
+  void printSummary( std::ostream& os ) const;
+
+  //! Log a summary of the statistics
+  void logSummary() const;
+
+private:
+
+  // The statistics of a thread (padded to avoid false sharing)
+  struct alignas(64) ThreadStatistics
+  {
+    // The number of cell energy cutoff terminations in each cell
+    std::vector<uint64_t> cell_energy_cutoff_terminations;
+
+    // The number of range rejection terminations in each cell
+    std::vector<uint64_t> range_rejection_terminations;
+
+    // The estimated number of avoided subtracks in each cell
+    std::vector<double> estimated_avoided_subtracks;
+
+    // The time spent simulating subtracks (s)
+    double subtrack_time;
+
+    // The number of timed subtracks
+    uint64_t number_of_subtracks;
+  };
+
+  // The thread statistics array deleter
+  struct ThreadStatisticsDeleter
+  {
+    // Constructor
+    ThreadStatisticsDeleter( const unsigned number_of_statistics = 0 )
+      : number_of_statistics( number_of_statistics )
+    { /* ... */ }
+
+    // Destroy the statistics and free their memory
+    void operator()( ThreadStatistics* statistics ) const;
+
+    // The number of statistics
+    unsigned number_of_statistics;
+  };
+
+  // Create the (aligned) thread statistics array
+  static ThreadStatistics* createThreadStatistics(
+                                        const unsigned number_of_statistics );
+
+  // Return the index of a cell
+  size_t getCellIndex( const Geometry::Model::EntityId cell ) const;
+
+  // Reset the statistics of a thread
+  void resetThreadStatistics( ThreadStatistics& statistics ) const;
+
+  // Pack the statistics (summed over all threads)
+  void packData( std::vector<double>& packed_data ) const;
+
+  // Unpack the statistics (assigned to the master thread)
+  void unpackData( const std::vector<double>& packed_data );
+
+  // The cells (sorted)
+  std::vector<Geometry::Model::EntityId> d_cells;
+
+  // The number of threads
+  unsigned d_number_of_threads;
+
+  // The statistics of each thread
+  std::unique_ptr<ThreadStatistics[],ThreadStatisticsDeleter>
+  d_thread_statistics;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_CELL_ENERGY_CUTOFF_STATISTICS_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CellEnergyCutoffStatistics.hpp
+//---------------------------------------------------------------------------//
@@ -9,10 +9,18 @@
 // Std Lib Includes
 #include <csignal>
 #include <fstream>
+#include <algorithm>
+#include <limits>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManager.hpp"
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_WorkStealingHistoryScheduler.hpp"
+#include "MonteCarlo_ParticleHistoryObserver.hpp"
+#include "MonteCarlo_ParticleModeTypeTraits.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_JustInTimeInitializer.hpp"
@@ -62,12 +70,14 @@ ParticleSimulationManager::ParticleSimulationManager(
     d_population_controller( population_controller ),
     d_collision_forcer( collision_forcer ),
     d_weight_roulette( std::make_shared<StandardWeightCutoffRoulette>() ),
+    d_cell_energy_cutoff_statistics(),
     d_properties( properties ),
     d_next_history( next_history ),
     d_rendezvous_number( rendezvous_number ),
     d_rendezvous_batch_size( 0 ),
     d_batch_size( 0 ),
     d_use_single_rendezvous_file( use_single_rendezvous_file ),
+    d_rendezvous_archive_restartable( true ),
     d_end_simulation( false ),
     d_exit_simulation( false )
 {
@@ -111,6 +121,14 @@ ParticleSimulationManager::ParticleSimulationManager(
 
   // Set the cutoff weight roulette
   this->setCutoffWeightRoulette();
+
+  // Set up the cell energy cutoff statistics (termination cells are ignored)
+  Geometry::Model::CellIdSet cells;
+
+  d_model->getUnfilledModel().getCells( cells, true, false );
+
+  d_cell_energy_cutoff_statistics.reset(
+                                    new CellEnergyCutoffStatistics( cells ) );
 }
 
 // Return the next history that will be completed
@@ -197,6 +215,7 @@ void ParticleSimulationManager::setSimulationName( const std::string& new_name )
     d_simulation_name = new_name;
 
   this->basicRendezvous();
+  this->waitForRendezvousArchive();
 }
 
 // Get the simulation archive type
@@ -215,6 +234,7 @@ void ParticleSimulationManager::setSimulationArchiveType( const std::string& arc
     d_archive_type = archive_type;
 
   this->basicRendezvous();
+  this->waitForRendezvousArchive();
 }
 
 // Set the simulation name and archive type
@@ -232,6 +252,7 @@ void ParticleSimulationManager::setSimulationNameAndArchiveType(
     d_archive_type = archive_type;
 
   this->basicRendezvous();
+  this->waitForRendezvousArchive();
 }
 
 // Set the cutoff weight roulette
@@ -410,6 +431,8 @@ void ParticleSimulationManager::runSimulation()
   if( !d_exit_simulation && rendezvous_needed )
     this->rendezvous();
 
+  this->waitForRendezvousArchive();
+
   // The simulation has finished
   this->registerSimulationStoppedEvent();
 
@@ -462,17 +485,65 @@ const CollisionForcer& ParticleSimulationManager::getCollisionForcer() const
   return *d_collision_forcer;
 }
 
+// Get the cell energy cutoff statistics
+const CellEnergyCutoffStatistics&
+ParticleSimulationManager::getCellEnergyCutoffStatistics() const
+{
+  return *d_cell_energy_cutoff_statistics;
+}
+
+// Return the max energy at which an electron can be range rejected
+/*! \details An electron can only create photons (bremsstrahlung and
+ * fluorescence) with energies below its own energy. An electron will
+ * therefore only be range rejected once it can no longer create a photon
+ * that would be transported. The knock-on and Auger electrons that it could
+ * still create have lower energies and cannot leave the cell either.
+ */
+double ParticleSimulationManager::getMaxElectronRangeRejectionEnergy() const
+{
+  if( isParticleTypeCompatible( d_properties->getParticleMode(), PHOTON ) )
+    return d_properties->getMinPhotonEnergy();
+  else
+    return std::numeric_limits<double>::infinity();
+}
+
+// Check if the cell energy cutoff statistics are being collected
+/*! \details The statistics are only collected when range rejection is on
+ * or when a cell electron energy cutoff has been set.
+ */
+bool ParticleSimulationManager::areCellEnergyCutoffStatisticsActive() const
+{
+  return d_properties->isElectronRangeRejectionModeOn() ||
+    d_properties->hasMinElectronEnergyInCells();
+}
+
 // Enable thread support
 void ParticleSimulationManager::enableThreadSupport()
 {
   // Set up the random number generator for the number of threads requested
+  Utility::RandomNumberGenerator::setGeneratorType(
+                             d_properties->getRandomNumberGeneratorType() );
+
   Utility::RandomNumberGenerator::createStreams();
 
   // Enable source thread support
   d_source->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
 
+  // Each history in an event-based batch needs its own observer history
+  // contribution slot
+  if( d_properties->isEventBasedTransportModeOn() )
+  {
+    ParticleHistoryObserver::setNumberOfHistoryContributionSlotsPerThread(
+                            d_properties->getEventBasedHistoryBatchSize() );
+  }
+  else
+    ParticleHistoryObserver::setNumberOfHistoryContributionSlotsPerThread( 1 );
+
   // Enable event handler thread support
   d_event_handler->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  // Enable cell energy cutoff statistics thread support
+  d_cell_energy_cutoff_statistics->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
 }
 
 // Reset data
@@ -480,6 +551,7 @@ void ParticleSimulationManager::resetData()
 {
   d_event_handler->resetObserverData();
   d_source->resetData();
+  d_cell_energy_cutoff_statistics->resetData();
 }
 
 // Reduce distributed data
@@ -490,10 +562,30 @@ void ParticleSimulationManager::reduceData( const Utility::Communicator& comm,
 
   d_source->reduceData( comm, root_process );
   d_event_handler->reduceObserverData( comm, root_process );
+  d_cell_energy_cutoff_statistics->reduceData( comm, root_process );
 
   comm.barrier();
 }
 
+// Pack the summable simulation data (see EventHandler::packObserverData)
+/*! \details The source sampling statistics cannot be summed and will not be
+ * packed.
+ */
+void ParticleSimulationManager::packReductionData(
+                                            std::vector<double>& packed_data )
+{
+  packed_data.resize( d_event_handler->getNumberOfPackedObserverValues() );
+
+  d_event_handler->packObserverData( Utility::arrayView( packed_data ) );
+}
+
+// Unpack the summable simulation data (replaces the current data)
+void ParticleSimulationManager::unpackReductionData(
+                                      const std::vector<double>& packed_data )
+{
+  d_event_handler->unpackObserverData( Utility::arrayViewOfConst( packed_data ) );
+}
+
 // Register simulation started event
 void ParticleSimulationManager::registerSimulationStartedEvent()
 {
@@ -515,25 +607,103 @@ bool ParticleSimulationManager::isSimulationComplete()
 // Rendezvous (cache state)
 void ParticleSimulationManager::rendezvous()
 {
-  this->basicRendezvous();
+  if( d_properties->isIncrementalRendezvousModeOn() )
+    this->incrementalRendezvous();
+  else
+    this->basicRendezvous();
 
   ++d_rendezvous_number;
 }
 
+// Rendezvous (cache a state that cannot be used to restart)
+/*! \details The rendezvous archive will be marked as an intermediate
+ * archive. This should be used when only part of the simulation state has
+ * been combined from every process (e.g. during an overlapped rendezvous).
+ * The simulation factory will refuse to restart from an intermediate
+ * archive.
+ */
+void ParticleSimulationManager::intermediateRendezvous()
+{
+  d_rendezvous_archive_restartable = false;
+
+  ParticleSimulationManager::rendezvous();
+
+  d_rendezvous_archive_restartable = true;
+}
+
+// Wait for the asynchronous rendezvous archive to be written
+void ParticleSimulationManager::waitForRendezvousArchive()
+{
+  if( d_rendezvous_writer.joinable() )
+    d_rendezvous_writer.join();
+}
+
 // Conduct a basic rendezvous
-void ParticleSimulationManager::basicRendezvous() const
+/*! \details The complete simulation state is serialized in memory and then
+ * written to disk by a background thread (h5fa archives are always written
+ * directly).
+ */
+void ParticleSimulationManager::basicRendezvous()
 {
-  std::string archive_name( d_simulation_name );
-  archive_name += "_rendezvous";
+  std::string archive_name = this->getRendezvousArchiveName();
 
-  if( !d_use_single_rendezvous_file )
+  FRENSIE_LOG_NOTIFICATION( " Rendezvous "
+                            << d_rendezvous_number << ": "
+                            << d_next_history );
+
+  FRENSIE_FLUSH_ALL_LOGS();
+
+  // Make sure that the previous rendezvous archive has been written
+  this->waitForRendezvousArchive();
+
+  ParticleSimulationManagerFactory
+    tmp_factory( d_model,
+                 d_source,
+                 d_event_handler,
+                 d_population_controller,
+                 d_collision_forcer,
+                 d_properties,
+                 d_simulation_name,
+                 d_archive_type,
+                 d_next_history,
+                 d_rendezvous_number+1,
+                 d_use_single_rendezvous_file );
+
+  tmp_factory.d_restartable = d_rendezvous_archive_restartable;
+
+  if( d_archive_type == "h5fa" )
+    tmp_factory.saveToFile( archive_name, true );
+  else
   {
-    archive_name += "_";
-    archive_name += Utility::toString( d_rendezvous_number );
+    // Snapshot the state before the simulation continues
+    std::string archive_buffer;
+
+    tmp_factory.saveToBuffer( "." + d_archive_type, archive_buffer );
+
+    d_rendezvous_writer =
+      std::thread( &ParticleSimulationManager::writeRendezvousArchive,
+                   archive_name,
+                   std::move( archive_buffer ) );
   }
-  
-  archive_name += ".";
-  archive_name += d_archive_type;
+}
+
+// Conduct an incremental rendezvous
+/*! \details The complete simulation state will only be archived when the
+ * base rendezvous archive for the current simulation name and archive type
+ * has not been created. Every rendezvous archive will only store the
+ * estimators, the source sampling statistics and the history counters along
+ * with the name of the base archive. The rendezvous archive is serialized in
+ * memory and then written to disk by a background thread so that the
+ * simulation can continue while the file is being written (this is not
+ * possible with h5fa archives, which are always written directly).
+ */
+void ParticleSimulationManager::incrementalRendezvous()
+{
+  std::string archive_name = this->getRendezvousArchiveName();
+
+  std::string base_archive_name( d_simulation_name );
+  base_archive_name += "_rendezvous_base.";
+  base_archive_name += d_archive_type;
 
   FRENSIE_LOG_NOTIFICATION( " Rendezvous "
                             << d_rendezvous_number << ": "
@@ -541,6 +711,9 @@ void ParticleSimulationManager::basicRendezvous() const
 
   FRENSIE_FLUSH_ALL_LOGS();
 
+  // Make sure that the previous rendezvous archive has been written
+  this->waitForRendezvousArchive();
+
   ParticleSimulationManagerFactory
     tmp_factory( d_model,
                  d_source,
@@ -554,7 +727,85 @@ void ParticleSimulationManager::basicRendezvous() const
                  d_rendezvous_number+1,
                  d_use_single_rendezvous_file );
 
-  tmp_factory.saveToFile( archive_name, true );
+  tmp_factory.d_restartable = d_rendezvous_archive_restartable;
+
+  // Archive the complete simulation state once
+  if( base_archive_name != d_base_rendezvous_archive_name )
+  {
+    tmp_factory.saveToFile( base_archive_name, true );
+
+    d_base_rendezvous_archive_name = base_archive_name;
+  }
+
+  // The base archive is always stored in the rendezvous archive directory
+  tmp_factory.d_base_archive_name =
+    boost::filesystem::path( base_archive_name ).filename().string();
+
+  if( d_archive_type == "h5fa" )
+    tmp_factory.saveToFile( archive_name, true );
+  else
+  {
+    // Snapshot the state before the simulation continues
+    std::string archive_buffer;
+
+    tmp_factory.saveToBuffer( "." + d_archive_type, archive_buffer );
+
+    d_rendezvous_writer =
+      std::thread( &ParticleSimulationManager::writeRendezvousArchive,
+                   archive_name,
+                   std::move( archive_buffer ) );
+  }
+}
+
+// Get the rendezvous archive name
+std::string ParticleSimulationManager::getRendezvousArchiveName() const
+{
+  std::string archive_name( d_simulation_name );
+  archive_name += "_rendezvous";
+
+  if( !d_use_single_rendezvous_file )
+  {
+    archive_name += "_";
+    archive_name += Utility::toString( d_rendezvous_number );
+  }
+
+  archive_name += ".";
+  archive_name += d_archive_type;
+
+  return archive_name;
+}
+
+// Write a serialized rendezvous archive
+/*! \details The archive will be written to a temporary file first so that
+ * an incomplete archive never replaces a valid one.
+ */
+void ParticleSimulationManager::writeRendezvousArchive(
+                                        const std::string& archive_name,
+                                        const std::string& archive_buffer )
+{
+  std::string tmp_archive_name( archive_name );
+  tmp_archive_name += ".tmp";
+
+  bool archive_written;
+
+  {
+    std::ofstream archive_file( tmp_archive_name, std::ofstream::binary );
+
+    archive_file.write( archive_buffer.data(), archive_buffer.size() );
+
+    archive_written = archive_file.good();
+  }
+
+  boost::system::error_code error;
+
+  if( archive_written )
+    boost::filesystem::rename( tmp_archive_name, archive_name, error );
+
+  if( !archive_written || error )
+  {
+    FRENSIE_LOG_ERROR( "The rendezvous archive " << archive_name <<
+                       " could not be written!" );
+  }
 }
 
 // Print the simulation data to the desired stream
@@ -562,6 +813,9 @@ void ParticleSimulationManager::printSimulationSummary( std::ostream& os ) const
 {
   d_source->printSummary( os );
   d_event_handler->printObserverSummaries( os );
+
+  if( this->areCellEnergyCutoffStatisticsActive() )
+    d_cell_energy_cutoff_statistics->printSummary( os );
 }
 
 // Log the simulation data
@@ -569,6 +823,9 @@ void ParticleSimulationManager::logSimulationSummary() const
 {
   d_source->logSummary();
   d_event_handler->logObserverSummaries();
+
+  if( this->areCellEnergyCutoffStatisticsActive() )
+    d_cell_energy_cutoff_statistics->logSummary();
 }
 
 // Run the simulation batch
@@ -617,6 +874,9 @@ void ParticleSimulationManager::runSimulationBatch(
 }
 
 // Run the simulation micro batch
+/*! \details The histories will be distributed over the threads using the
+ * history schedule that has been requested.
+ */
 void ParticleSimulationManager::runSimulationMicroBatch(
                                             const uint64_t batch_start_history,
                                             const uint64_t batch_end_history )
@@ -624,74 +884,301 @@ void ParticleSimulationManager::runSimulationMicroBatch(
   // Make sure the history range is valid
   testPrecondition( batch_start_history < batch_end_history );
 
+  const HistoryScheduleType schedule_type =
+    d_properties->getHistoryScheduleType();
+
+  const int chunk_size = (int)std::min<uint64_t>(
+                                 d_properties->getHistoryScheduleChunkSize(),
+                                 std::numeric_limits<int>::max() );
+
+  std::unique_ptr<WorkStealingHistoryScheduler> work_stealing_scheduler;
+
+  if( schedule_type == WORK_STEALING_HISTORY_SCHEDULE )
+  {
+    work_stealing_scheduler.reset( new WorkStealingHistoryScheduler(
+                  batch_start_history,
+                  batch_end_history,
+                  Utility::OpenMPProperties::getRequestedNumberOfThreads(),
+                  d_properties->getHistoryScheduleChunkSize() ) );
+  }
+
+  const bool event_based_transport =
+    d_properties->isEventBasedTransportModeOn();
+
+  const size_t event_based_history_batch_size =
+    d_properties->getEventBasedHistoryBatchSize();
+
   #pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
   {
     // Create a bank for each thread
-    ParticleBank source_bank, bank;
+    ParticleBank source_bank;
+    ParticleBank bank( d_properties->isPooledParticleBankModeOn() );
+
+    // The particle that is currently being simulated
+    std::shared_ptr<ParticleState> particle;
 
-    #pragma omp for
-    for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+    // The histories that will be simulated together (event-based mode only)
+    std::vector<uint64_t> history_batch;
+
+    // The state of each history in a batch (reused by every batch)
+    std::vector<Details::EventBasedHistory> history_batch_states;
+
+    if( event_based_transport )
     {
-      // End the simulation if requested (by the signal handler)
-      // Note: Conformal OpenMP code cannot have a break statement. Therefore
-      //       we will simply loop through remaining histories without doing
-      //       anything if the simulation needs to be ended.
-      if( d_exit_simulation )
-        continue;
-
-      // Initialize the random number generator for this history
-      Utility::RandomNumberGenerator::initialize( history );
-
-      // Sample a particle state from the source
-      try{
-        d_source->sampleParticleState( source_bank, history );
-      }
-      catch( const Geometry::GeometryError& exception )
+      history_batch.reserve( event_based_history_batch_size );
+      history_batch_states.reserve( event_based_history_batch_size );
+    }
+
+    auto simulate_history = [&]( const uint64_t history ){
+      if( event_based_transport )
       {
-        LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
+        history_batch.push_back( history );
 
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+        if( history_batch.size() == event_based_history_batch_size )
+        {
+          this->simulateHistoriesEventBased( history_batch,
+                                             history_batch_states );
 
-        continue;
+          history_batch.clear();
+        }
       }
-      catch( const std::runtime_error& exception )
+      else
+        this->simulateHistory( history, source_bank, bank, particle );
+    };
+
+    // Note: All threads will take the same branch so each worksharing loop
+    //       will be encountered by the entire team
+    switch( schedule_type )
+    {
+      case DYNAMIC_HISTORY_SCHEDULE:
       {
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+        #pragma omp for schedule( dynamic, chunk_size )
+        for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+          simulate_history( history );
 
-        continue;
+        break;
       }
-      // The source has likely been constructed incorrectly
-      catch( const std::logic_error& exception )
+      case GUIDED_HISTORY_SCHEDULE:
       {
-        FRENSIE_LOG_ERROR( "There is an issue with the source!" );
+        #pragma omp for schedule( guided, chunk_size )
+        for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+          simulate_history( history );
 
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+        break;
+      }
+      case WORK_STEALING_HISTORY_SCHEDULE:
+      {
+        const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
-        d_exit_simulation = true;
+        uint64_t range_start_history, range_end_history;
 
-        continue;
-      }
+        // Note: If the team is smaller than requested the ranges assigned to
+        //       the missing threads will be stolen by the other threads
+        while( work_stealing_scheduler->getNextHistoryRange( thread_id,
+                                                             range_start_history,
+                                                             range_end_history ) )
+        {
+          for( uint64_t history = range_start_history; history < range_end_history; ++history )
+            simulate_history( history );
+        }
 
-      // Simulate the particles generated by the source first
-      while( source_bank.size() > 0 )
+        break;
+      }
+      default:
       {
-        this->simulateUnresolvedParticle( source_bank.top(), bank, true );
-
-        source_bank.pop();
+        #pragma omp for
+        for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+          simulate_history( history );
       }
+    }
 
-      // This history only ends when the particle bank is empty
-      while( bank.size() > 0 )
-      {
-        this->simulateUnresolvedParticle( bank.top(), bank, false );
+    // Simulate the histories in the last (partial) batch
+    if( !history_batch.empty() )
+      this->simulateHistoriesEventBased( history_batch, history_batch_states );
+  }
+}
 
-        bank.pop();
-      }
+// Simulate a history
+void ParticleSimulationManager::simulateHistory(
+                                      const uint64_t history,
+                                      ParticleBank& source_bank,
+                                      ParticleBank& bank,
+                                      std::shared_ptr<ParticleState>& particle )
+{
+  // End the simulation if requested (by the signal handler)
+  // Note: Conformal OpenMP code cannot have a break statement. Therefore
+  //       we will simply loop through remaining histories without doing
+  //       anything if the simulation needs to be ended.
+  if( d_exit_simulation )
+    return;
+
+  // Initialize the random number generator for this history
+  Utility::RandomNumberGenerator::initialize( history );
+
+  // Sample a particle state from the source
+  if( !this->sampleSourceParticles( history, source_bank ) )
+    return;
+
+  // Simulate the particles generated by the source first
+  while( source_bank.size() > 0 )
+  {
+    this->simulateUnresolvedParticle( source_bank.top(), bank, true );
+
+    source_bank.pop();
+  }
+
+  // This history only ends when the particle bank is empty
+  // Note: the particle must be released from the bank before it is
+  //       simulated since a pooled bank is a stack (the particle would
+  //       no longer be on top once its progeny have been banked).
+  while( bank.size() > 0 )
+  {
+    bank.releaseTop( particle );
+
+    this->simulateUnresolvedParticle( *particle, bank, false );
+
+    bank.recycle( particle );
+  }
+
+  // History complete - commit all observer history contributions
+  d_event_handler->commitObserverHistoryContributions();
+}
+
+// Sample the source particles of a history
+/*! \details The random number generator must already be initialized for the
+ * history. If the source particles cannot be sampled the history will not
+ * be simulated (false will be returned).
+ */
+bool ParticleSimulationManager::sampleSourceParticles(
+                                                     const uint64_t history,
+                                                     ParticleBank& source_bank )
+{
+  try{
+    d_source->sampleParticleState( source_bank, history );
+  }
+  catch( const Geometry::GeometryError& exception )
+  {
+    LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
+
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    return false;
+  }
+  catch( const std::runtime_error& exception )
+  {
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    return false;
+  }
+  // The source has likely been constructed incorrectly
+  catch( const std::logic_error& exception )
+  {
+    FRENSIE_LOG_ERROR( "There is an issue with the source!" );
+
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    d_exit_simulation = true;
+
+    return false;
+  }
+
+  return true;
+}
+
+// Simulate a batch of histories using event-based tracking
+/*! \details The current particle of every history in the batch is simulated
+ * together using event-based tracking. When the current particle of a
+ * history is gone the next particle of that history is released from its
+ * banks (source particles first) in the same order that is used in
+ * history-based mode. Since each history also has its own random number
+ * stream state and observer history contribution slot, the histories are
+ * simulated exactly as they would be in history-based mode. The observer
+ * history contributions are committed in history order once every history
+ * in the batch is complete.
+ */
+void ParticleSimulationManager::simulateHistoriesEventBased(
+                     const std::vector<uint64_t>& histories,
+                     std::vector<Details::EventBasedHistory>& history_states )
+{
+  // Make sure the batch is valid
+  testPrecondition( histories.size() <=
+                    ParticleHistoryObserver::getNumberOfHistoryContributionSlotsPerThread() );
+
+  // End the simulation if requested (by the signal handler)
+  if( d_exit_simulation )
+    return;
+
+  // Create the history states that are needed (they are reused by every
+  // batch)
+  while( history_states.size() < histories.size() )
+  {
+    history_states.emplace_back( history_states.size(),
+                                 d_properties->isPooledParticleBankModeOn() );
+  }
+
+  // Sample the source particles of every history
+  for( size_t i = 0; i < histories.size(); ++i )
+  {
+    Details::EventBasedHistory& history_state = history_states[i];
+
+    history_state.history_number = histories[i];
+
+    // Initialize the random number generator for this history
+    Utility::RandomNumberGenerator::initialize( histories[i] );
+
+    ParticleHistoryObserver::setHistoryContributionSlot(
+                                               history_state.contribution_slot );
+
+    history_state.source_sampled =
+      this->sampleSourceParticles( histories[i], history_state.source_bank );
+
+    // Discard the source particles of a history that cannot be simulated
+    if( !history_state.source_sampled )
+    {
+      while( history_state.source_bank.size() > 0 )
+        history_state.source_bank.pop();
+    }
+
+    history_state.deactivate();
+  }
+
+  // Simulate the histories one particle at a time until they are complete
+  std::vector<Details::EventBasedHistory*> active_histories;
+  active_histories.reserve( histories.size() );
+
+  while( true )
+  {
+    for( size_t i = 0; i < histories.size(); ++i )
+    {
+      if( history_states[i].releaseNextParticle() )
+        active_histories.push_back( &history_states[i] );
+    }
+
+    if( active_histories.empty() )
+      break;
+
+    this->simulateUnresolvedParticles( active_histories );
+
+    for( size_t i = 0; i < active_histories.size(); ++i )
+      active_histories[i]->recycleParticle();
+
+    active_histories.clear();
+  }
+
+  // Histories complete - commit all observer history contributions in
+  // history order
+  for( size_t i = 0; i < histories.size(); ++i )
+  {
+    if( history_states[i].source_sampled )
+    {
+      ParticleHistoryObserver::setHistoryContributionSlot(
+                                         history_states[i].contribution_slot );
 
-      // History complete - commit all observer history contributions
       d_event_handler->commitObserverHistoryContributions();
     }
   }
+
+  ParticleHistoryObserver::setHistoryContributionSlot( 0 );
 }
 
 // The signal handler
@@ -11,6 +11,8 @@
 
 // Std Lib Includes
 #include <memory>
+#include <vector>
+#include <thread>
 
 // Boost Includes
 #include <boost/filesystem/path.hpp>
@@ -25,12 +27,24 @@
 #include "MonteCarlo_CollisionKernel.hpp"
 #include "MonteCarlo_TransportKernel.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
+#include "MonteCarlo_CellEnergyCutoffStatistics.hpp"
 #include "Utility_Communicator.hpp"
 
 extern "C" void __custom_signal_handler__( int signal );
 
 namespace MonteCarlo{
 
+namespace Details{
+
+//! The event-based history class
+struct EventBasedHistory;
+
+//! The event-based track class
+template<typename State>
+struct EventBasedTrack;
+
+} // end Details namespace
+
 //! The particle simulation manager base class
 class ParticleSimulationManager : public std::enable_shared_from_this<ParticleSimulationManager>
 {
@@ -39,7 +53,7 @@ public:
 
   //! Destructor
   virtual ~ParticleSimulationManager()
-  { /* ... */ }
+  { this->waitForRendezvousArchive(); }
 
   //! Return the next history that will be completed
   uint64_t getNextHistory() const;
@@ -65,6 +79,9 @@ public:
   //! Return the event handler
   EventHandler& getEventHandler();
 
+  //! Return the cell energy cutoff statistics
+  const CellEnergyCutoffStatistics& getCellEnergyCutoffStatistics() const;
+
   //! Return the simulation properties
   const SimulationProperties& getSimulationProperties() const;
 
@@ -155,6 +172,15 @@ protected:
                                     ParticleBank& bank,
                                     const bool source_particle );
 
+  //! Simulate the current particle of each history using event-based tracking
+  virtual void simulateUnresolvedParticles(
+          const std::vector<Details::EventBasedHistory*>& histories ) = 0;
+
+  //! Simulate the current (resolved) particle of each history (event-based)
+  template<typename State>
+  void simulateParticlesEventBased(
+          const std::vector<Details::EventBasedHistory*>& histories );
+
   //! Get the collision forcer
   const CollisionForcer& getCollisionForcer() const;
 
@@ -168,6 +194,12 @@ protected:
   void reduceData( const Utility::Communicator& comm,
                    const int root_process );
 
+  //! Pack the summable simulation data (see EventHandler::packObserverData)
+  void packReductionData( std::vector<double>& packed_data );
+
+  //! Unpack the summable simulation data (replaces the current data)
+  void unpackReductionData( const std::vector<double>& packed_data );
+
   //! Register simulation started event
   void registerSimulationStartedEvent();
 
@@ -180,6 +212,12 @@ protected:
   //! Rendezvous (cache state)
   virtual void rendezvous();
 
+  //! Rendezvous (cache a state that cannot be used to restart)
+  void intermediateRendezvous();
+
+  //! Wait for the asynchronous rendezvous archive to be written
+  void waitForRendezvousArchive();
+
   //! The signal handler
   virtual void signalHandler( int signal );
 
@@ -210,6 +248,21 @@ private:
   void runSimulationMicroBatch( const uint64_t batch_start_history,
                                 const uint64_t batch_end_history );
 
+  // Simulate a history
+  void simulateHistory( const uint64_t history,
+                        ParticleBank& source_bank,
+                        ParticleBank& bank,
+                        std::shared_ptr<ParticleState>& particle );
+
+  // Simulate a batch of histories using event-based tracking
+  void simulateHistoriesEventBased(
+                    const std::vector<uint64_t>& histories,
+                    std::vector<Details::EventBasedHistory>& history_states );
+
+  // Sample the source particles of a history
+  bool sampleSourceParticles( const uint64_t history,
+                              ParticleBank& source_bank );
+
   // Simulate a resolved particle implementation
   template<typename State, typename SimulateParticleTrackMethod>
   void simulateParticleImpl( ParticleState& unresolved_particle,
@@ -248,6 +301,21 @@ private:
                                          const double optical_path,
                                          const bool starting_from_source );
 
+  // Start a new event-based track for every particle that is still alive
+  template<typename State>
+  void startEventBasedTracks(
+            std::vector<Details::EventBasedTrack<State> >& tracks,
+            std::vector<Details::EventBasedTrack<State>*>& active_tracks );
+
+  // Advance every active event-based track by one event
+  template<typename State>
+  void advanceEventBasedTracks(
+                std::vector<Details::EventBasedTrack<State>*>& active_tracks );
+
+  // End an event-based track
+  template<typename State>
+  void endEventBasedTrack( Details::EventBasedTrack<State>& track );
+
   // Advance a particle to the cell boundary
   template<typename State>
   void advanceParticleToCellBoundary(
@@ -269,8 +337,28 @@ private:
   void collideWithCellMaterial( State& particle,
                                 ParticleBank& bank );
 
+  // Check if a particle should be terminated early in its current cell
+  template<typename State>
+  bool terminateParticleInCell( State& particle );
+
+  // Return the max energy at which an electron can be range rejected
+  double getMaxElectronRangeRejectionEnergy() const;
+
+  // Check if the cell energy cutoff statistics are being collected
+  bool areCellEnergyCutoffStatisticsActive() const;
+
   // Conduct a basic rendezvous
-  void basicRendezvous() const;
+  void basicRendezvous();
+
+  // Conduct an incremental rendezvous
+  void incrementalRendezvous();
+
+  // Get the rendezvous archive name
+  std::string getRendezvousArchiveName() const;
+
+  // Write a serialized rendezvous archive
+  static void writeRendezvousArchive( const std::string& archive_name,
+                                      const std::string& archive_buffer );
 
   // Declare the custom signal handler as a friend
   friend void ::__custom_signal_handler__( int );
@@ -305,6 +393,9 @@ private:
   // The weight cutoff roulette
   std::shared_ptr<StandardWeightCutoffRoulette> d_weight_roulette;
 
+  // The cell energy cutoff statistics
+  std::unique_ptr<CellEnergyCutoffStatistics> d_cell_energy_cutoff_statistics;
+
   // The simulation properties
   std::shared_ptr<const SimulationProperties> d_properties;
 
@@ -323,6 +414,15 @@ private:
   // Use a single rendezvous file
   bool d_use_single_rendezvous_file;
 
+  // The base rendezvous archive name (incremental rendezvous mode only)
+  std::string d_base_rendezvous_archive_name;
+
+  // Check if the rendezvous archives can be used to restart a simulation
+  bool d_rendezvous_archive_restartable;
+
+  // The asynchronous rendezvous archive writer
+  std::thread d_rendezvous_writer;
+
   // Flag for ending simulation early
   bool d_end_simulation;
 
@@ -15,6 +15,7 @@
 #include "Utility_GlobalMPISession.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -22,6 +23,14 @@ namespace MonteCarlo{
 // Initialize static member data
 const std::string ParticleSimulationManagerFactory::s_archive_name( "manager" );
 
+// Default constructor
+ParticleSimulationManagerFactory::ParticleSimulationManagerFactory()
+  : d_next_history( 0 ),
+    d_rendezvous_number( 0 ),
+    d_use_single_rendezvous_file( true ),
+    d_restartable( true )
+{ /* ... */ }
+
 // Archive constructor
 ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
                 const std::shared_ptr<const FilledGeometryModel>& model,
@@ -45,7 +54,8 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
     d_properties( properties ),
     d_next_history( next_history ),
     d_rendezvous_number( rendezvous_number ),
-    d_use_single_rendezvous_file( use_single_rendezvous_file )
+    d_use_single_rendezvous_file( use_single_rendezvous_file ),
+    d_restartable( true )
 { 
   TEST_FOR_EXCEPTION( next_history == std::numeric_limits<uint64_t>::max(),
                       std::runtime_error,
@@ -76,7 +86,8 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
     d_properties( properties ),
     d_next_history( 0 ),
     d_rendezvous_number( 0 ),
-    d_use_single_rendezvous_file( true )
+    d_use_single_rendezvous_file( true ),
+    d_restartable( true )
 {
   // Make sure that the model pointer is valid
   testPrecondition( model.get() );
@@ -102,7 +113,7 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
                           const boost::filesystem::path& archived_manager_name,
                           const unsigned threads )
 {
-  this->loadFromFile( archived_manager_name );
+  this->loadRestartArchive( archived_manager_name );
 
   // Update the properties
   Utility::OpenMPProperties::setNumberOfThreads( threads );
@@ -116,7 +127,7 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
                           const uint64_t number_of_additional_histories,
                           const unsigned threads )
 {
-  this->loadFromFile( archived_manager_name );
+  this->loadRestartArchive( archived_manager_name );
 
   // Update the properties
   const_cast<SimulationProperties&>( *d_properties ).setNumberOfHistories( number_of_additional_histories );
@@ -132,7 +143,7 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
                           const double wall_time,
                           const unsigned threads )
 {
-  this->loadFromFile( archived_manager_name );
+  this->loadRestartArchive( archived_manager_name );
 
   // Update the properties
   const_cast<SimulationProperties&>( *d_properties ).setSimulationWallTime( wall_time );
@@ -151,7 +162,7 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
                           const double wall_time,
                           const unsigned threads )
 {
-  this->loadFromFile( archived_manager_name );
+  this->loadRestartArchive( archived_manager_name );
 
   // Update the properties
   const_cast<SimulationProperties&>( *d_properties ).setNumberOfHistories( number_of_additional_histories );
@@ -182,7 +193,7 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
                       const SimulationGeneralProperties& updated_general_props,
                       const unsigned threads )
 {
-  this->loadFromFile( archived_manager_name );
+  this->loadRestartArchive( archived_manager_name );
 
   // Update the properties
   const_cast<SimulationProperties&>( *d_properties ).setNumberOfHistories( updated_general_props.getNumberOfHistories() );
@@ -216,6 +227,72 @@ void ParticleSimulationManagerFactory::loadFromFileImpl(
   // The bpis pointer must be restored to its original value so that libraries
   // that expect it to be non-NULL behave correctly
   this->restoreBpisPointer<Data::ZAID>( extension, zaid_bpis );
+
+  // Load the remaining data from the base archive
+  if( !d_base_archive_name.empty() )
+    this->loadBaseArchive( archive_name_with_path );
+}
+
+// Load an archive that will be used to restart a simulation
+/*! \details Intermediate rendezvous archives (e.g. the archives written
+ * during an overlapped rendezvous) do not store a consistent simulation state
+ * and will be refused.
+ */
+void ParticleSimulationManagerFactory::loadRestartArchive(
+                        const boost::filesystem::path& archive_name_with_path )
+{
+  this->loadFromFile( archive_name_with_path );
+
+  TEST_FOR_EXCEPTION( !d_restartable,
+                      std::runtime_error,
+                      "The rendezvous archive "
+                      << archive_name_with_path.string() <<
+                      " is an intermediate archive that cannot be used to "
+                      "restart a simulation (only the estimator moments "
+                      "have been combined from every process)!" );
+}
+
+// Load the base archive of an incremental rendezvous archive
+/*! \details The base archive must be in the same directory as the
+ * incremental rendezvous archive. The model, source, population controller,
+ * collision forcer and properties will be taken from the base archive. The
+ * source sampling statistics from the incremental rendezvous archive will
+ * then be restored.
+ */
+void ParticleSimulationManagerFactory::loadBaseArchive(
+                        const boost::filesystem::path& archive_name_with_path )
+{
+  boost::filesystem::path base_archive_name_with_path =
+    archive_name_with_path.parent_path() / d_base_archive_name;
+
+  TEST_FOR_EXCEPTION( !boost::filesystem::exists( base_archive_name_with_path ),
+                      std::runtime_error,
+                      "The base archive (" 
+                      << base_archive_name_with_path.string() <<
+                      ") of rendezvous archive "
+                      << archive_name_with_path.string() <<
+                      " does not exist!" );
+
+  ParticleSimulationManagerFactory base_factory;
+  base_factory.loadFromFile( base_archive_name_with_path );
+
+  TEST_FOR_EXCEPTION( !base_factory.d_base_archive_name.empty(),
+                      std::runtime_error,
+                      "The base archive ("
+                      << base_archive_name_with_path.string() <<
+                      ") is not a complete simulation archive!" );
+
+  d_model = base_factory.d_model;
+  d_source = base_factory.d_source;
+  d_population_controller = base_factory.d_population_controller;
+  d_collision_forcer = base_factory.d_collision_forcer;
+  d_properties = base_factory.d_properties;
+
+  // Restore the source sampling statistics
+  d_source->setSamplingStatistics( d_source_sampling_statistics );
+
+  d_source_sampling_statistics.clear();
+  d_base_archive_name.clear();
 }
 
 // Archive the object (implementation)
@@ -238,6 +315,60 @@ void ParticleSimulationManagerFactory::saveToFileImpl(
   this->restoreBposPointer<Data::ZAID>( extension, zaid_bpos );
 }
 
+// Archive the object to an in-memory buffer
+/*! \details The extension will be used to determine the archive type
+ * (e.g. .xml, .txt, .bin). The h5fa archive type is not supported.
+ */
+void ParticleSimulationManagerFactory::saveToBuffer(
+                                          const std::string& extension,
+                                          std::string& archive_buffer ) const
+{
+  // The bpos pointer must be NULL. Depending on the libraries that have been
+  // loaded the bpos might be initialized to a non-NULL value
+  const boost::archive::detail::basic_pointer_oserializer* zaid_bpos =
+    this->resetBposPointer<Data::ZAID>( extension );
+
+  std::ostringstream oss;
+
+  try{
+    if( extension == ".xml" )
+    {
+      boost::archive::xml_oarchive archive( oss );
+
+      archive << boost::serialization::make_nvp( this->getArchiveName(), *this );
+    }
+    else if( extension == ".txt" )
+    {
+      boost::archive::text_oarchive archive( oss );
+
+      archive << boost::serialization::make_nvp( this->getArchiveName(), *this );
+    }
+    else if( extension == ".bin" )
+    {
+      boost::archive::binary_oarchive archive( oss );
+
+      archive << boost::serialization::make_nvp( this->getArchiveName(), *this );
+    }
+    else
+    {
+      THROW_EXCEPTION( std::runtime_error,
+                       "Cannot create an in-memory archive because the "
+                       "extension type (" << extension << ") is not "
+                       "supported!" );
+    }
+  }
+  EXCEPTION_CATCH_RETHROW_AS( std::exception,
+                              std::runtime_error,
+                              "Unable to save the object to an in-memory "
+                              "archive!" );
+
+  // The bpos pointer must be restored to its original value so that libraries
+  // that expect it to be non-NULL behave correctly
+  this->restoreBposPointer<Data::ZAID>( extension, zaid_bpos );
+
+  archive_buffer = oss.str();
+}
+
 // Set the weight windows that will be used by the manager
 void ParticleSimulationManagerFactory::setPopulationControl(
                     const std::shared_ptr<PopulationControl>& population_controller )
@@ -96,6 +96,9 @@ protected:
 
 private:
 
+  // Default constructor
+  ParticleSimulationManagerFactory();
+
   //! Archive constructor
   ParticleSimulationManagerFactory(
                 const std::shared_ptr<const FilledGeometryModel>& model,
@@ -113,9 +116,25 @@ private:
   // The name that will be used when archiving the object
   const char* getArchiveName() const final override;
 
-  // Serialize the simulation manager data 
+  // Archive the object to an in-memory buffer
+  void saveToBuffer( const std::string& extension,
+                     std::string& archive_buffer ) const;
+
+  // Load an archive that will be used to restart a simulation
+  void loadRestartArchive( const boost::filesystem::path& archive_name_with_path );
+
+  // Load the base archive of an incremental rendezvous archive
+  void loadBaseArchive( const boost::filesystem::path& archive_name_with_path );
+
+  // Save the simulation manager data to an archive
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version );
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the simulation manager data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
 
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
@@ -162,6 +181,16 @@ private:
   // Use a single rendezvous file
   bool d_use_single_rendezvous_file;
 
+  // Check if the archived state can be used to restart a simulation
+  bool d_restartable;
+
+  // The base archive name (only used by incremental rendezvous archives)
+  std::string d_base_archive_name;
+
+  // The source sampling statistics (only used by incremental rendezvous
+  // archives)
+  ParticleSource::SamplingStatisticsArray d_source_sampling_statistics;
+
   // The communicator
   std::shared_ptr<const Utility::Communicator> d_comm;
 
@@ -170,25 +199,96 @@ private:
 };
 
 // Save the data to an archive
+/*! \details If a base archive name has been set only the data that changes
+ * during a simulation will be saved (incremental rendezvous archive).
+ */
 template<typename Archive>
-void ParticleSimulationManagerFactory::serialize( Archive& ar, const unsigned version )
+void ParticleSimulationManagerFactory::save( Archive& ar, const unsigned version ) const
 {
   ar & BOOST_SERIALIZATION_NVP( d_simulation_name );
   ar & BOOST_SERIALIZATION_NVP( d_archive_type );
-  ar & BOOST_SERIALIZATION_NVP( d_model );
-  ar & BOOST_SERIALIZATION_NVP( d_source );
+  ar & BOOST_SERIALIZATION_NVP( d_base_archive_name );
+
+  if( d_base_archive_name.empty() )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_model );
+    ar & BOOST_SERIALIZATION_NVP( d_source );
+  }
+  else
+  {
+    ParticleSource::SamplingStatisticsArray source_sampling_statistics;
+    d_source->getSamplingStatistics( source_sampling_statistics );
+
+    ar & BOOST_SERIALIZATION_NVP( source_sampling_statistics );
+  }
+
   ar & BOOST_SERIALIZATION_NVP( d_event_handler );
-  ar & BOOST_SERIALIZATION_NVP( d_population_controller );
-  ar & BOOST_SERIALIZATION_NVP( d_collision_forcer );
-  ar & BOOST_SERIALIZATION_NVP( d_properties );
+
+  if( d_base_archive_name.empty() )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_population_controller );
+    ar & BOOST_SERIALIZATION_NVP( d_collision_forcer );
+    ar & BOOST_SERIALIZATION_NVP( d_properties );
+  }
+
   ar & BOOST_SERIALIZATION_NVP( d_next_history );
   ar & BOOST_SERIALIZATION_NVP( d_rendezvous_number );
   ar & BOOST_SERIALIZATION_NVP( d_use_single_rendezvous_file );
+  ar & BOOST_SERIALIZATION_NVP( d_restartable );
+}
+
+// Load the data from an archive
+/*! \details If a base archive name is loaded the remaining data must be
+ * loaded from the base archive (see
+ * MonteCarlo::ParticleSimulationManagerFactory::loadBaseArchive).
+ */
+template<typename Archive>
+void ParticleSimulationManagerFactory::load( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_simulation_name );
+  ar & BOOST_SERIALIZATION_NVP( d_archive_type );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_base_archive_name );
+  else
+    d_base_archive_name.clear();
+
+  if( d_base_archive_name.empty() )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_model );
+    ar & BOOST_SERIALIZATION_NVP( d_source );
+  }
+  else
+  {
+    ParticleSource::SamplingStatisticsArray source_sampling_statistics;
+
+    ar & BOOST_SERIALIZATION_NVP( source_sampling_statistics );
+
+    d_source_sampling_statistics.swap( source_sampling_statistics );
+  }
+
+  ar & BOOST_SERIALIZATION_NVP( d_event_handler );
+
+  if( d_base_archive_name.empty() )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_population_controller );
+    ar & BOOST_SERIALIZATION_NVP( d_collision_forcer );
+    ar & BOOST_SERIALIZATION_NVP( d_properties );
+  }
+
+  ar & BOOST_SERIALIZATION_NVP( d_next_history );
+  ar & BOOST_SERIALIZATION_NVP( d_rendezvous_number );
+  ar & BOOST_SERIALIZATION_NVP( d_use_single_rendezvous_file );
+
+  if( version > 1 )
+    ar & BOOST_SERIALIZATION_NVP( d_restartable );
+  else
+    d_restartable = true;
 }
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ParticleSimulationManagerFactory, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ParticleSimulationManagerFactory, MonteCarlo, 2 );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleSimulationManagerFactory );
 
 #endif // end FRENSIE_PARTICLE_SIMULATION_MANAGER_FACTORY_HPP
@@ -12,6 +12,12 @@
 // Std Lib Includes
 #include <functional>
 #include <type_traits>
+#include <algorithm>
+#include <chrono>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleHistoryObserver.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
 
 //! Log lost particle details
 #define LOG_LOST_PARTICLE_DETAILS( particle )   \
@@ -50,21 +56,6 @@
     __VA_ARGS__;                                        \
   }
 
-//! Macro for catching a lost particle
-#define CATCH_LOST_PARTICLE_AND_CONTINUE( particle, ... )     \
-  catch( const std::runtime_error& exception )                \
-  {                                                   \
-    particle.setAsLost();                               \
-                                                        \
-    LOG_LOST_PARTICLE_DETAILS( particle );              \
-                                                        \
-    FRENSIE_LOG_NESTED_ERROR( exception.what() );       \
-                                                        \
-    __VA_ARGS__;                                        \
-                                                        \
-    continue;                                           \
-  }
-
 namespace MonteCarlo{
 
 namespace Details{
@@ -126,6 +117,216 @@ struct RaySafetyHelper<State,typename std::enable_if<std::is_base_of<MonteCarlo:
   }
 };
 
+//! \brief The cell energy cutoff helper class
+template<typename State>
+struct CellEnergyCutoffHelper
+{
+  //! Check if the particle cannot escape its cell before reaching the cutoff
+  static inline bool isRangeRejected( const FilledGeometryModel&,
+                                      const State&,
+                                      const double )
+  { return false; }
+
+  //! Estimate the number of subtracks avoided by terminating the particle
+  static inline double estimateNumberOfAvoidedSubtracks(
+                                                   const FilledGeometryModel&,
+                                                   const State&,
+                                                   const double )
+  { return 0.0; }
+};
+
+//! \brief The cell energy cutoff helper class (electron specialization)
+template<>
+struct CellEnergyCutoffHelper<ElectronState>
+{
+  //! Check if the particle cannot escape its cell before reaching the cutoff
+  static inline bool isRangeRejected( const FilledGeometryModel& model,
+                                      const ElectronState& particle,
+                                      const double cutoff_energy )
+  {
+    // The ray safety distance is a lower bound on the distance to the
+    // closest boundary of the cell (zero if it is unknown)
+    if( particle.getRaySafetyDistance() > 0.0 &&
+        !model.isCellVoid<ElectronState>( particle.getCell() ) )
+    {
+      const ElectronMaterial& material =
+        *static_cast<const FilledElectronGeometryModel&>( model ).getMaterial(
+                                                         particle.getCell() );
+
+      return material.getCSDARange( particle.getEnergy(), cutoff_energy ) <
+        particle.getRaySafetyDistance();
+    }
+    else
+      return false;
+  }
+
+  //! Estimate the number of subtracks avoided by terminating the particle
+  static inline double estimateNumberOfAvoidedSubtracks(
+                                            const FilledGeometryModel& model,
+                                            const ElectronState& particle,
+                                            const double cutoff_energy )
+  {
+    if( !model.isCellVoid<ElectronState>( particle.getCell() ) )
+    {
+      const ElectronMaterial& material =
+        *static_cast<const FilledElectronGeometryModel&>( model ).getMaterial(
+                                                         particle.getCell() );
+
+      const double range =
+        material.getCSDARange( particle.getEnergy(), cutoff_energy );
+
+      if( range < std::numeric_limits<double>::infinity() )
+      {
+        return material.getMacroscopicTotalCrossSection( particle.getEnergy() )*
+          range;
+      }
+    }
+
+    return 0.0;
+  }
+};
+
+//! \brief The event-based history class
+struct EventBasedHistory
+{
+  //! Constructor
+  EventBasedHistory( const unsigned slot, const bool pooled_bank_mode )
+    : history_number( 0 ),
+      contribution_slot( slot ),
+      random_number_stream_state(),
+      source_bank(),
+      bank( pooled_bank_mode ),
+      particle(),
+      source_particle( false ),
+      source_sampled( false )
+  { /* ... */ }
+
+  //! Make this the history that the calling thread contributes to
+  void activate() const
+  {
+    Utility::RandomNumberGenerator::restoreStreamState(
+                                                  random_number_stream_state );
+
+    ParticleHistoryObserver::setHistoryContributionSlot( contribution_slot );
+  }
+
+  //! Save the random number stream state of the history
+  void deactivate()
+  {
+    Utility::RandomNumberGenerator::saveStreamState(
+                                                  random_number_stream_state );
+  }
+
+  //! Release the next particle (the source particles are released first)
+  bool releaseNextParticle()
+  {
+    if( source_bank.size() > 0 )
+    {
+      source_bank.releaseTop( particle );
+
+      source_particle = true;
+    }
+    else if( bank.size() > 0 )
+    {
+      bank.releaseTop( particle );
+
+      source_particle = false;
+    }
+    else
+      return false;
+
+    return true;
+  }
+
+  //! Recycle the current particle
+  void recycleParticle()
+  {
+    if( source_particle )
+      source_bank.recycle( particle );
+    else
+      bank.recycle( particle );
+  }
+
+  //! The history number
+  uint64_t history_number;
+
+  //! The observer history contribution slot used by the history
+  unsigned contribution_slot;
+
+  //! The random number stream state of the history
+  Utility::RandomNumberGenerator::StreamState random_number_stream_state;
+
+  //! The source particles of the history that have not been simulated
+  ParticleBank source_bank;
+
+  //! The banked particles of the history that have not been simulated
+  ParticleBank bank;
+
+  //! The particle that is currently being simulated
+  std::shared_ptr<ParticleState> particle;
+
+  //! Records if the current particle was generated by the source
+  bool source_particle;
+
+  //! Records if the source particles were sampled successfully
+  bool source_sampled;
+};
+
+//! \brief The event-based track class
+template<typename State>
+struct EventBasedTrack
+{
+  //! The next event that will occur on the track
+  enum Event{
+    SURFACE_CROSSING_EVENT = 0,
+    COLLISION_EVENT,
+    TRACK_ENDING_EVENT
+  };
+
+  //! Constructor
+  EventBasedTrack( EventBasedHistory& particle_history )
+    : history( &particle_history ),
+      particle( &dynamic_cast<State&>( *particle_history.particle ) ),
+      starting_from_source( particle_history.source_particle ),
+      next_event( TRACK_ENDING_EVENT ),
+      remaining_track_op( 0.0 ),
+      cell_total_macro_cross_section( 0.0 ),
+      distance_to_surface_hit( 0.0 ),
+      surface_hit(),
+      global_subtrack_ending_event_dispatched( false )
+  { /* ... */ }
+
+  //! The history that the particle belongs to
+  EventBasedHistory* history;
+
+  //! The particle being tracked
+  State* particle;
+
+  //! Records if the next track will start from a source point
+  bool starting_from_source;
+
+  //! The next event
+  Event next_event;
+
+  //! The remaining optical path of the track
+  double remaining_track_op;
+
+  //! The total macroscopic cross section of the current cell
+  double cell_total_macro_cross_section;
+
+  //! The distance to the next surface hit
+  double distance_to_surface_hit;
+
+  //! The next surface hit
+  Geometry::Model::EntityId surface_hit;
+
+  //! The track start point
+  double track_start_point[3];
+
+  //! Records if the global subtrack ending event has been dispatched
+  bool global_subtrack_ending_event_dispatched;
+};
+
 } // end Details namespace
 
 // Simulate a resolved particle
@@ -170,6 +371,300 @@ void ParticleSimulationManager::simulateParticleAlternative(
                                                       std::placeholders::_4 ) );
 }
 
+// Simulate the current (resolved) particle of each history (event-based)
+/*! \details Instead of following each particle until it is gone, every
+ * particle track is advanced one event (cross section lookup, ray fire,
+ * surface crossing or collision) at a time. Before every event the active
+ * tracks are sorted by cell so that the same material data is used by
+ * consecutive particles. The random number stream and the observer
+ * contribution slot of a history are activated before any of its particle's
+ * events that can use them. Forced collisions cannot be done with this
+ * tracking method.
+ */
+template<typename State>
+void ParticleSimulationManager::simulateParticlesEventBased(
+                   const std::vector<Details::EventBasedHistory*>& histories )
+{
+  // Resolve the particle states
+  std::vector<Details::EventBasedTrack<State> > tracks;
+  tracks.reserve( histories.size() );
+
+  for( size_t i = 0; i < histories.size(); ++i )
+  {
+    // Make sure that the particle is embedded in the model
+    testPrecondition( histories[i]->particle->isEmbeddedInModel( *d_model ) );
+
+    tracks.emplace_back( *histories[i] );
+  }
+
+  std::vector<Details::EventBasedTrack<State>*> active_tracks;
+  active_tracks.reserve( tracks.size() );
+
+  // Simulate particle subtracks of random optical path length until all
+  // of the particles are gone
+  while( true )
+  {
+    this->startEventBasedTracks( tracks, active_tracks );
+
+    if( active_tracks.empty() )
+      break;
+
+    while( !active_tracks.empty() )
+      this->advanceEventBasedTracks( active_tracks );
+  }
+}
+
+// Start a new event-based track for every particle that is still alive
+template<typename State>
+void ParticleSimulationManager::startEventBasedTracks(
+                 std::vector<Details::EventBasedTrack<State> >& tracks,
+                 std::vector<Details::EventBasedTrack<State>*>& active_tracks )
+{
+  // Remove the tracks of particles that are gone
+  tracks.erase( std::remove_if( tracks.begin(),
+                                tracks.end(),
+                                []( const Details::EventBasedTrack<State>& track ){ return !(*track.particle); } ),
+                tracks.end() );
+
+  for( size_t i = 0; i < tracks.size(); ++i )
+  {
+    Details::EventBasedTrack<State>& track = tracks[i];
+    State& particle = *track.particle;
+
+    track.history->activate();
+
+    // Check if the particle energy is outside of the energy limits
+    if( particle.getEnergy() < d_properties->getMinParticleEnergy<State>() )
+    {
+      if( track.starting_from_source )
+      {
+        FRENSIE_LOG_WARNING( particle.getParticleType() <<
+                             " born below global cutoff energy. Check source "
+                             "definition!\n" << particle );
+      }
+
+      particle.setAsGone();
+    }
+    else if( particle.getEnergy() > d_properties->getMaxParticleEnergy<State>() )
+    {
+      if( track.starting_from_source )
+      {
+        FRENSIE_LOG_WARNING( particle.getParticleType() <<
+                             " born above global max energy. Check source "
+                             "definition!\n" << particle );
+      }
+
+      particle.setAsGone();
+    }
+    // Check if the particle should be terminated in its current cell
+    else if( !track.starting_from_source &&
+             this->terminateParticleInCell( particle ) )
+    { /* ... */ }
+    else if( track.starting_from_source )
+    {
+      d_population_controller->checkParticleWithPopulationController(
+                                                  particle, track.history->bank );
+    }
+    // Roulette the particle if it is below the threshold weight
+    else
+      d_weight_roulette->rouletteParticleWeight( particle );
+
+    if( particle )
+    {
+      track.remaining_track_op =
+        d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite();
+
+      track.track_start_point[0] = particle.getXPosition();
+      track.track_start_point[1] = particle.getYPosition();
+      track.track_start_point[2] = particle.getZPosition();
+
+      track.global_subtrack_ending_event_dispatched = false;
+
+      // If the particle started from a source point, update the relevant
+      // particle entering cell event observers
+      if( track.starting_from_source )
+      {
+        d_event_handler->updateObserversFromParticleEnteringCellEvent(
+                                                particle, particle.getCell() );
+      }
+
+      active_tracks.push_back( &track );
+    }
+
+    track.history->deactivate();
+
+    // Only the first track can start from a source point
+    track.starting_from_source = false;
+  }
+}
+
+// Advance every active event-based track by one event
+template<typename State>
+void ParticleSimulationManager::advanceEventBasedTracks(
+                 std::vector<Details::EventBasedTrack<State>*>& active_tracks )
+{
+  typedef Details::EventBasedTrack<State> Track;
+
+  // Sort the tracks by cell so that the same material data is used by
+  // consecutive particles
+  std::stable_sort( active_tracks.begin(),
+                    active_tracks.end(),
+                    []( const Track* track_a, const Track* track_b ){ return track_a->particle->getCell() < track_b->particle->getCell(); } );
+
+  // Get the total cross section for the cell of each track
+  for( size_t i = 0; i < active_tracks.size(); ++i )
+  {
+    Track& track = *active_tracks[i];
+
+    if( !d_model->isCellVoid<State>( track.particle->getCell() ) )
+    {
+      track.cell_total_macro_cross_section =
+        d_model->getMacroscopicTotalForwardCrossSectionQuick( *track.particle );
+    }
+    else
+      track.cell_total_macro_cross_section = 0.0;
+  }
+
+  // Fire a ray through the cell currently containing each particle
+  for( size_t i = 0; i < active_tracks.size(); ++i )
+  {
+    Track& track = *active_tracks[i];
+    State& particle = *track.particle;
+
+    double cell_distance_to_collision =
+      track.remaining_track_op/track.cell_total_macro_cross_section;
+
+    try{
+      track.distance_to_surface_hit =
+        Details::RaySafetyHelper<State>::getDistanceToSurfaceHit(
+                                                 particle,
+                                                 track.surface_hit,
+                                                 cell_distance_to_collision );
+
+      // Convert the distance to the surface to optical path
+      if( track.distance_to_surface_hit*track.cell_total_macro_cross_section <
+          track.remaining_track_op )
+        track.next_event = Track::SURFACE_CROSSING_EVENT;
+      else
+        track.next_event = Track::COLLISION_EVENT;
+    }
+    CATCH_LOST_PARTICLE( particle, track.next_event = Track::TRACK_ENDING_EVENT );
+  }
+
+  // Move the particles that pass through their cell to the next cell
+  for( size_t i = 0; i < active_tracks.size(); ++i )
+  {
+    Track& track = *active_tracks[i];
+    State& particle = *track.particle;
+
+    if( track.next_event != Track::SURFACE_CROSSING_EVENT )
+      continue;
+
+    const double op_to_surface_hit =
+      track.distance_to_surface_hit*track.cell_total_macro_cross_section;
+
+    track.history->activate();
+
+    try{
+      this->advanceParticleToCellBoundary( particle,
+                                           track.surface_hit,
+                                           track.distance_to_surface_hit );
+
+      // The particle has exited the geometry
+      if( d_model->isTerminationCell( particle.getCell() ) )
+      {
+        particle.setAsGone();
+
+        track.next_event = Track::TRACK_ENDING_EVENT;
+      }
+      else
+      {
+        // Update the remaining subtrack mfp
+        track.remaining_track_op -= op_to_surface_hit;
+
+        // Set the ray safety distance to zero
+        particle.setRaySafetyDistance( 0.0 );
+      }
+    }
+    CATCH_LOST_PARTICLE( particle, track.next_event = Track::TRACK_ENDING_EVENT );
+
+    track.history->deactivate();
+  }
+
+  // Collide the remaining particles with the material in their cell (the
+  // tracks are still sorted by the collision cell)
+  for( size_t i = 0; i < active_tracks.size(); ++i )
+  {
+    Track& track = *active_tracks[i];
+    State& particle = *track.particle;
+
+    if( track.next_event != Track::COLLISION_EVENT )
+      continue;
+
+    const double cell_distance_to_collision =
+      track.remaining_track_op/track.cell_total_macro_cross_section;
+
+    track.history->activate();
+
+    this->advanceParticleToCollisionSite(
+                               particle,
+                               track.remaining_track_op,
+                               cell_distance_to_collision,
+                               track.track_start_point,
+                               track.global_subtrack_ending_event_dispatched );
+
+    // Update the particle's ray safety distance
+    Details::RaySafetyHelper<State>::updateRaySafetyDistance(
+                                                  particle,
+                                                  cell_distance_to_collision );
+
+    this->collideWithCellMaterial( particle, track.history->bank );
+
+    track.history->deactivate();
+
+    // This track is finished
+    track.next_event = Track::TRACK_ENDING_EVENT;
+  }
+
+  // End the finished tracks
+  for( size_t i = 0; i < active_tracks.size(); ++i )
+  {
+    if( active_tracks[i]->next_event == Track::TRACK_ENDING_EVENT )
+    {
+      active_tracks[i]->history->activate();
+
+      this->endEventBasedTrack( *active_tracks[i] );
+
+      active_tracks[i]->history->deactivate();
+    }
+  }
+
+  active_tracks.erase( std::remove_if( active_tracks.begin(),
+                                       active_tracks.end(),
+                                       []( const Track* track ){ return track->next_event == Track::TRACK_ENDING_EVENT; } ),
+                       active_tracks.end() );
+}
+
+// End an event-based track
+template<typename State>
+void ParticleSimulationManager::endEventBasedTrack(
+                                       Details::EventBasedTrack<State>& track )
+{
+  if( !track.global_subtrack_ending_event_dispatched )
+  {
+    d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                   *track.particle,
+                                                   track.track_start_point,
+                                                   track.particle->getPosition() );
+  }
+
+  if( !(*track.particle) )
+  {
+    d_event_handler->updateObserversFromParticleGoneGlobalEvent(
+                                                             *track.particle );
+  }
+}
+
 // Simulate a resolved particle implementation
 template<typename State, typename SimulateParticleTrackMethod>
 void ParticleSimulationManager::simulateParticleImpl(
@@ -184,6 +679,9 @@ void ParticleSimulationManager::simulateParticleImpl(
   // Resolve the particle state
   State& particle = dynamic_cast<State&>( unresolved_particle );
 
+  // Only time the subtracks if the cell energy cutoff statistics are needed
+  const bool time_subtracks = this->areCellEnergyCutoffStatisticsActive();
+
   // Simulate a particle subtrack of random optical path length starting from a
   // source point
   if( source_particle )
@@ -233,20 +731,89 @@ void ParticleSimulationManager::simulateParticleImpl(
       particle.setAsGone();
       break;
     }
+    // Check if the particle should be terminated in its current cell
+    if( this->terminateParticleInCell( particle ) )
+      break;
 
     // Roulette the particle if it is below the threshold weight
     d_weight_roulette->rouletteParticleWeight( particle );
 
     if( particle )
     {
-      simulate_particle_track( particle,
-                               bank,
-                               d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite(),
-                               false );
+      if( time_subtracks )
+      {
+        std::chrono::steady_clock::time_point start_time =
+          std::chrono::steady_clock::now();
+
+        simulate_particle_track( particle,
+                                 bank,
+                                 d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite(),
+                                 false );
+
+        d_cell_energy_cutoff_statistics->recordSubtrackTime(
+                 std::chrono::duration<double>( std::chrono::steady_clock::now() -
+                                                start_time ).count() );
+      }
+      else
+      {
+        simulate_particle_track( particle,
+                                 bank,
+                                 d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite(),
+                                 false );
+      }
     }
   }
 }
 
+// Check if a particle should be terminated early in its current cell
+/*! \details A particle will be terminated if its energy is below the energy
+ * cutoff of its current cell or if it is range rejected (its continuous
+ * slowing down range to the cell energy cutoff is less than the distance to
+ * the closest boundary of the cell). A particle will only be range rejected
+ * once it can no longer create a photon that would be transported (see
+ * getMaxElectronRangeRejectionEnergy). The global energy limits must be
+ * checked before calling this method.
+ */
+template<typename State>
+bool ParticleSimulationManager::terminateParticleInCell( State& particle )
+{
+  const double cell_min_energy =
+    d_properties->getMinParticleEnergyInCell<State>( particle.getCell() );
+
+  if( particle.getEnergy() < cell_min_energy )
+  {
+    d_cell_energy_cutoff_statistics->recordCellEnergyCutoffTermination(
+         particle.getCell(),
+         Details::CellEnergyCutoffHelper<State>::estimateNumberOfAvoidedSubtracks(
+                         *d_model,
+                         particle,
+                         d_properties->getMinParticleEnergy<State>() ) );
+
+    particle.setAsGone();
+
+    return true;
+  }
+  else if( d_properties->isElectronRangeRejectionModeOn() &&
+           particle.getEnergy() <=
+           this->getMaxElectronRangeRejectionEnergy() &&
+           Details::CellEnergyCutoffHelper<State>::isRangeRejected(
+                                         *d_model, particle, cell_min_energy ) )
+  {
+    d_cell_energy_cutoff_statistics->recordRangeRejectionTermination(
+         particle.getCell(),
+         Details::CellEnergyCutoffHelper<State>::estimateNumberOfAvoidedSubtracks(
+                         *d_model,
+                         particle,
+                         d_properties->getMinParticleEnergy<State>() ) );
+
+    particle.setAsGone();
+
+    return true;
+  }
+  else
+    return false;
+}
+
 // Simulate an unresolved particle track
 template<typename State>
 void ParticleSimulationManager::simulateUnresolvedParticleTrack(
@@ -668,16 +1235,12 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
                                                                       split_particle_bank );
     }
 
-    std::shared_ptr<ParticleState> local_particle;
+    // Add the particle to the bank - the particle will be copied into a
+    // recycled particle state if the bank is in pooled mode
+    bank.push( local_bank.top() );
+    bank.splice( split_particle_bank );
 
-    local_bank.pop( local_particle );
-
-    // If the particle wasn't terminated, add it to the bank
-    if( local_particle )
-    {
-      bank.push( local_particle );
-      bank.splice( split_particle_bank );
-    }
+    local_bank.pop();
   }
 }
 
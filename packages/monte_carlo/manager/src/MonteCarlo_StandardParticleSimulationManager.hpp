@@ -55,6 +55,10 @@ protected:
                                    ParticleBank& bank,
                                    const bool source_particle ) final override;
 
+  //! Simulate the current particle of each history using event-based tracking
+  void simulateUnresolvedParticles(
+     const std::vector<Details::EventBasedHistory*>& histories ) final override;
+
 private:
 
   // Add simulate particle function for particle type
@@ -73,6 +77,15 @@ private:
   SimulateParticleFunctionMap;
 
   SimulateParticleFunctionMap d_simulate_particle_function_map;
+
+  // The event-based simulation functions
+  typedef std::function<void(const std::vector<Details::EventBasedHistory*>&)>
+  SimulateParticlesFunction;
+
+  typedef std::map<ParticleType,SimulateParticlesFunction>
+  SimulateParticlesFunctionMap;
+
+  SimulateParticlesFunctionMap d_simulate_particles_function_map;
 };
   
 } // end MonteCarlo namespace
@@ -101,6 +101,55 @@ void StandardParticleSimulationManager<mode>::simulateUnresolvedParticle(
     unresolved_particle.setAsGone();
 }
 
+// Simulate the current particle of each history using event-based tracking
+/*! \details The particles will be grouped by type. Particle types that must
+ * be simulated with the "alternative" tracking method (forced collisions)
+ * will be simulated one particle at a time.
+ */
+template<ParticleModeType mode>
+void StandardParticleSimulationManager<mode>::simulateUnresolvedParticles(
+                   const std::vector<Details::EventBasedHistory*>& histories )
+{
+  // Group the histories by the type of their current particle
+  std::map<ParticleType,std::vector<Details::EventBasedHistory*> >
+    grouped_histories;
+
+  for( size_t i = 0; i < histories.size(); ++i )
+  {
+    grouped_histories[histories[i]->particle->getParticleType()].push_back(
+                                                                histories[i] );
+  }
+
+  std::map<ParticleType,std::vector<Details::EventBasedHistory*> >::const_iterator
+    history_group_it = grouped_histories.begin();
+
+  while( history_group_it != grouped_histories.end() )
+  {
+    SimulateParticlesFunctionMap::const_iterator simulation_function_it =
+      d_simulate_particles_function_map.find( history_group_it->first );
+
+    if( simulation_function_it != d_simulate_particles_function_map.end() )
+      simulation_function_it->second( history_group_it->second );
+    else
+    {
+      for( size_t i = 0; i < history_group_it->second.size(); ++i )
+      {
+        Details::EventBasedHistory& history = *history_group_it->second[i];
+
+        history.activate();
+
+        this->simulateUnresolvedParticle( *history.particle,
+                                          history.bank,
+                                          history.source_particle );
+
+        history.deactivate();
+      }
+    }
+
+    ++history_group_it;
+  }
+}
+
 // Add simulate particle function for particle type
 template<ParticleModeType mode>
 template<typename State>
@@ -128,6 +177,11 @@ void StandardParticleSimulationManager<mode>::addSimulateParticleFunction()
                        std::placeholders::_1,
                        std::placeholders::_2,
                        std::placeholders::_3 );
+
+    d_simulate_particles_function_map[particle_type] =
+      std::bind<void>( &ParticleSimulationManager::simulateParticlesEventBased<State>,
+                       std::ref( *this ),
+                       std::placeholders::_1 );
   }
 }
 
@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WorkStealingHistoryScheduler.cpp
+//! \author Alex Robinson
+//! \brief  Work stealing history scheduler class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+// FRENSIE Includes
+#include "MonteCarlo_WorkStealingHistoryScheduler.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+WorkStealingHistoryScheduler::WorkStealingHistoryScheduler(
+                                            const uint64_t batch_start_history,
+                                            const uint64_t batch_end_history,
+                                            const unsigned number_of_threads,
+                                            const uint64_t chunk_size )
+  : d_number_of_threads( number_of_threads ),
+    d_chunk_size( chunk_size ),
+    d_thread_history_ranges( createThreadHistoryRanges( number_of_threads ),
+                             ThreadHistoryRangesDeleter( number_of_threads ) )
+{
+  // Make sure that the history range is valid
+  testPrecondition( batch_start_history <= batch_end_history );
+  // Make sure that the number of threads is valid
+  testPrecondition( number_of_threads > 0 );
+  // Make sure that the chunk size is valid
+  testPrecondition( chunk_size > 0 );
+
+  const uint64_t number_of_histories = batch_end_history - batch_start_history;
+
+  // Divide the histories into equal ranges (like the static schedule)
+  for( unsigned i = 0; i < number_of_threads; ++i )
+  {
+    d_thread_history_ranges[i].start_history = batch_start_history +
+      (number_of_histories*i)/number_of_threads;
+
+    d_thread_history_ranges[i].end_history = batch_start_history +
+      (number_of_histories*(i+1))/number_of_threads;
+  }
+}
+
+// Destroy the ranges and free their memory
+void WorkStealingHistoryScheduler::ThreadHistoryRangesDeleter::operator()(
+                                            ThreadHistoryRange* ranges ) const
+{
+  for( unsigned i = 0; i < number_of_ranges; ++i )
+    ranges[i].~ThreadHistoryRange();
+
+  free( ranges );
+}
+
+// Create the (aligned) thread history range array
+/*! \details Operator new[] is not required to respect the extended alignment
+ * of the ranges before C++17 so the memory is allocated with posix_memalign.
+ */
+auto WorkStealingHistoryScheduler::createThreadHistoryRanges(
+                       const unsigned number_of_ranges ) -> ThreadHistoryRange*
+{
+  void* range_memory = NULL;
+
+  if( posix_memalign( &range_memory,
+                      alignof(ThreadHistoryRange),
+                      number_of_ranges*sizeof(ThreadHistoryRange) ) != 0 )
+    throw std::bad_alloc();
+
+  ThreadHistoryRange* ranges =
+    static_cast<ThreadHistoryRange*>( range_memory );
+
+  for( unsigned i = 0; i < number_of_ranges; ++i )
+    new (ranges + i) ThreadHistoryRange;
+
+  return ranges;
+}
+
+// Get the next range of histories for a thread
+/*! \details If the thread's own range is empty, histories will be stolen
+ * from another thread. False will be returned once there are no histories
+ * left to simulate.
+ */
+bool WorkStealingHistoryScheduler::getNextHistoryRange(
+                                                const unsigned thread_id,
+                                                uint64_t& range_start_history,
+                                                uint64_t& range_end_history )
+{
+  // Make sure that the thread id is valid
+  testPrecondition( thread_id < d_number_of_threads );
+
+  ThreadHistoryRange& thread_range = d_thread_history_ranges[thread_id];
+
+  while( true )
+  {
+    {
+      std::lock_guard<std::mutex> lock( thread_range.mutex );
+
+      if( thread_range.start_history < thread_range.end_history )
+      {
+        range_start_history = thread_range.start_history;
+        range_end_history = std::min( thread_range.start_history + d_chunk_size,
+                                      thread_range.end_history );
+
+        thread_range.start_history = range_end_history;
+
+        return true;
+      }
+    }
+
+    if( !this->stealHistories( thread_id ) )
+      return false;
+  }
+}
+
+// Steal histories from another thread
+/*! \details The other threads are visited in order, starting with the next
+ * thread. The back half of the first nonempty range that is found will be
+ * moved to the thief's range.
+ */
+bool WorkStealingHistoryScheduler::stealHistories(
+                                              const unsigned thief_thread_id )
+{
+  for( unsigned i = 1; i < d_number_of_threads; ++i )
+  {
+    ThreadHistoryRange& victim_range =
+      d_thread_history_ranges[(thief_thread_id + i) % d_number_of_threads];
+
+    uint64_t stolen_start_history, stolen_end_history;
+
+    {
+      std::lock_guard<std::mutex> lock( victim_range.mutex );
+
+      if( victim_range.start_history >= victim_range.end_history )
+        continue;
+
+      const uint64_t remaining_histories =
+        victim_range.end_history - victim_range.start_history;
+
+      stolen_start_history =
+        victim_range.start_history + remaining_histories/2;
+      stolen_end_history = victim_range.end_history;
+
+      victim_range.end_history = stolen_start_history;
+    }
+
+    ThreadHistoryRange& thief_range = d_thread_history_ranges[thief_thread_id];
+
+    std::lock_guard<std::mutex> lock( thief_range.mutex );
+
+    thief_range.start_history = stolen_start_history;
+    thief_range.end_history = stolen_end_history;
+
+    return true;
+  }
+
+  return false;
+}
+
+// Return the number of threads
+unsigned WorkStealingHistoryScheduler::getNumberOfThreads() const
+{
+  return d_number_of_threads;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WorkStealingHistoryScheduler.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,104 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WorkStealingHistoryScheduler.hpp
+//! \author Alex Robinson
+//! \brief  Work stealing history scheduler class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_WORK_STEALING_HISTORY_SCHEDULER_HPP
+#define MONTE_CARLO_WORK_STEALING_HISTORY_SCHEDULER_HPP
+
+// Std Lib Includes
+#include <stdint.h>
+#include <memory>
+#include <mutex>
+
+namespace MonteCarlo{
+
+//! The work stealing history scheduler class
+/*! \details The histories in a batch are initially divided into equal
+ * contiguous ranges, one for each thread. Each thread takes chunks of
+ * histories from the front of its own range. Once a thread's range is empty
+ * it will steal the back half of the remaining range of another thread.
+ * The histories that are simulated do not depend on the thread that
+ * simulates them since every history uses its own random number stream.
+ */
+class WorkStealingHistoryScheduler
+{
+
+public:
+
+  //! Constructor
+  WorkStealingHistoryScheduler( const uint64_t batch_start_history,
+                                const uint64_t batch_end_history,
+                                const unsigned number_of_threads,
+                                const uint64_t chunk_size );
+
+  //! Destructor
+  ~WorkStealingHistoryScheduler()
+  { /* ... */ }
+
+  //! Get the next range of histories for a thread
+  bool getNextHistoryRange( const unsigned thread_id,
+                            uint64_t& range_start_history,
+                            uint64_t& range_end_history );
+
+  //! Return the number of threads
+  unsigned getNumberOfThreads() const;
+
+private:
+
+  // The history range owned by a thread (padded to avoid false sharing)
+  struct alignas(64) ThreadHistoryRange
+  {
+    // The range mutex
+    std::mutex mutex;
+
+    // The next history in the range
+    uint64_t start_history;
+
+    // The end of the range (not included)
+    uint64_t end_history;
+  };
+
+  // The thread history range array deleter
+  struct ThreadHistoryRangesDeleter
+  {
+    // Constructor
+    ThreadHistoryRangesDeleter( const unsigned number_of_ranges = 0 )
+      : number_of_ranges( number_of_ranges )
+    { /* ... */ }
+
+    // Destroy the ranges and free their memory
+    void operator()( ThreadHistoryRange* ranges ) const;
+
+    // The number of ranges
+    unsigned number_of_ranges;
+  };
+
+  // Create the (aligned) thread history range array
+  static ThreadHistoryRange* createThreadHistoryRanges(
+                                            const unsigned number_of_ranges );
+
+  // Steal histories from another thread
+  bool stealHistories( const unsigned thief_thread_id );
+
+  // The number of threads
+  unsigned d_number_of_threads;
+
+  // The chunk size
+  uint64_t d_chunk_size;
+
+  // The history range of each thread
+  std::unique_ptr<ThreadHistoryRange[],ThreadHistoryRangesDeleter>
+  d_thread_history_ranges;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_WORK_STEALING_HISTORY_SCHEDULER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WorkStealingHistoryScheduler.hpp
+//---------------------------------------------------------------------------//
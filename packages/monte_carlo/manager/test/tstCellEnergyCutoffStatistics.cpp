@@ -0,0 +1,173 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCellEnergyCutoffStatistics.cpp
+//! \author Alex Robinson
+//! \brief  Cell energy cutoff statistics unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_CellEnergyCutoffStatistics.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+int threads;
+
+Geometry::Model::CellIdSet cells( {1, 2, 5} );
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the statistics are initially empty
+FRENSIE_UNIT_TEST( CellEnergyCutoffStatistics, constructor )
+{
+  MonteCarlo::CellEnergyCutoffStatistics statistics( cells );
+
+  for( auto&& cell : cells )
+  {
+    FRENSIE_CHECK_EQUAL( statistics.getNumberOfCellEnergyCutoffTerminations( cell ), 0 );
+    FRENSIE_CHECK_EQUAL( statistics.getNumberOfRangeRejectionTerminations( cell ), 0 );
+    FRENSIE_CHECK_EQUAL( statistics.getEstimatedNumberOfAvoidedSubtracks( cell ), 0.0 );
+    FRENSIE_CHECK_EQUAL( statistics.getEstimatedTimeSaved( cell ), 0.0 );
+  }
+
+  FRENSIE_CHECK_EQUAL( statistics.getMeanSubtrackTime(), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that terminations can be recorded
+FRENSIE_UNIT_TEST( CellEnergyCutoffStatistics, recordTerminations )
+{
+  MonteCarlo::CellEnergyCutoffStatistics statistics( cells );
+
+  statistics.recordCellEnergyCutoffTermination( 2, 10.0 );
+  statistics.recordCellEnergyCutoffTermination( 2, 5.0 );
+  statistics.recordRangeRejectionTermination( 2, 2.5 );
+  statistics.recordRangeRejectionTermination( 5, 1.0 );
+
+  // Unknown cells are ignored
+  statistics.recordCellEnergyCutoffTermination( 3, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( statistics.getNumberOfCellEnergyCutoffTerminations( 1 ), 0 );
+  FRENSIE_CHECK_EQUAL( statistics.getNumberOfRangeRejectionTerminations( 1 ), 0 );
+  FRENSIE_CHECK_EQUAL( statistics.getNumberOfCellEnergyCutoffTerminations( 2 ), 2 );
+  FRENSIE_CHECK_EQUAL( statistics.getNumberOfRangeRejectionTerminations( 2 ), 1 );
+  FRENSIE_CHECK_EQUAL( statistics.getEstimatedNumberOfAvoidedSubtracks( 2 ), 17.5 );
+  FRENSIE_CHECK_EQUAL( statistics.getNumberOfCellEnergyCutoffTerminations( 3 ), 0 );
+  FRENSIE_CHECK_EQUAL( statistics.getNumberOfCellEnergyCutoffTerminations( 5 ), 0 );
+  FRENSIE_CHECK_EQUAL( statistics.getNumberOfRangeRejectionTerminations( 5 ), 1 );
+  FRENSIE_CHECK_EQUAL( statistics.getEstimatedNumberOfAvoidedSubtracks( 5 ), 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the time saved can be estimated
+FRENSIE_UNIT_TEST( CellEnergyCutoffStatistics, getEstimatedTimeSaved )
+{
+  MonteCarlo::CellEnergyCutoffStatistics statistics( cells );
+
+  statistics.recordSubtrackTime( 1e-6 );
+  statistics.recordSubtrackTime( 3e-6 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( statistics.getMeanSubtrackTime(), 2e-6, 1e-12 );
+
+  statistics.recordCellEnergyCutoffTermination( 1, 100.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( statistics.getEstimatedTimeSaved( 1 ),
+                                   2e-4,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( statistics.getEstimatedTimeSaved( 2 ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the statistics can be reset
+FRENSIE_UNIT_TEST( CellEnergyCutoffStatistics, resetData )
+{
+  MonteCarlo::CellEnergyCutoffStatistics statistics( cells );
+
+  statistics.recordSubtrackTime( 1e-6 );
+  statistics.recordCellEnergyCutoffTermination( 1, 100.0 );
+  statistics.recordRangeRejectionTermination( 1, 100.0 );
+
+  statistics.resetData();
+
+  FRENSIE_CHECK_EQUAL( statistics.getNumberOfCellEnergyCutoffTerminations( 1 ), 0 );
+  FRENSIE_CHECK_EQUAL( statistics.getNumberOfRangeRejectionTerminations( 1 ), 0 );
+  FRENSIE_CHECK_EQUAL( statistics.getEstimatedNumberOfAvoidedSubtracks( 1 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( statistics.getMeanSubtrackTime(), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the statistics can be recorded by multiple threads
+FRENSIE_UNIT_TEST( CellEnergyCutoffStatistics, record_threads )
+{
+  const unsigned number_of_threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  MonteCarlo::CellEnergyCutoffStatistics statistics( cells );
+
+  statistics.enableThreadSupport( number_of_threads );
+
+  #pragma omp parallel for num_threads( number_of_threads )
+  for( int i = 0; i < 1000; ++i )
+  {
+    statistics.recordCellEnergyCutoffTermination( 1, 1.0 );
+    statistics.recordRangeRejectionTermination( 5, 2.0 );
+    statistics.recordSubtrackTime( 1e-6 );
+  }
+
+  FRENSIE_CHECK_EQUAL( statistics.getNumberOfCellEnergyCutoffTerminations( 1 ), 1000 );
+  FRENSIE_CHECK_EQUAL( statistics.getNumberOfRangeRejectionTerminations( 5 ), 1000 );
+  FRENSIE_CHECK_EQUAL( statistics.getEstimatedNumberOfAvoidedSubtracks( 1 ), 1000.0 );
+  FRENSIE_CHECK_EQUAL( statistics.getEstimatedNumberOfAvoidedSubtracks( 5 ), 2000.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( statistics.getMeanSubtrackTime(), 1e-6, 1e-9 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a summary of the statistics can be printed
+FRENSIE_UNIT_TEST( CellEnergyCutoffStatistics, printSummary )
+{
+  MonteCarlo::CellEnergyCutoffStatistics statistics( cells );
+
+  statistics.recordCellEnergyCutoffTermination( 2, 10.0 );
+
+  std::ostringstream oss;
+
+  statistics.printSummary( oss );
+
+  FRENSIE_CHECK( oss.str().find( "Cell Energy Cutoff Summary" ) <
+                 oss.str().size() );
+  FRENSIE_CHECK( oss.str().find( "Cell 2:" ) < oss.str().size() );
+  FRENSIE_CHECK( oss.str().find( "Cell 1:" ) == std::string::npos );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set the number of threads to use
+  Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstCellEnergyCutoffStatistics.cpp
+//---------------------------------------------------------------------------//
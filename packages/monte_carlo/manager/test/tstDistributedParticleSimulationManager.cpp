@@ -691,6 +691,105 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_history_wall )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that a simulation can be run with overlapped rendezvous
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_overlapped_rendezvous )
+{
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler;
+
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( 100 );
+    properties->setMinNumberOfRendezvous( 4 );
+    properties->setOverlappedRendezvousModeOn();
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+  
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+  
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+  
+    event_handler.reset( new MonteCarlo::EventHandler( *properties ) );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+    factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim_overlapped",
+                                                              "xml",
+                                                              threads ) );
+  
+    manager = factory->getManager();
+    manager->useMultipleRendezvousFiles();
+  }
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  // The worker data is fully reduced at the end of the simulation
+  if( Utility::GlobalMPISession::rank() == 0 )
+  {
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 100 );
+    FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 5 );
+    FRENSIE_CHECK_EQUAL( event_handler->getNumberOfCommittedHistories(), 100 );
+  }
+  else
+  {
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 0 );
+    FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 0 );
+    FRENSIE_CHECK_EQUAL( event_handler->getNumberOfCommittedHistories(), 0 );
+  }
+
+  uint64_t rendezvous_number = manager->getNumberOfRendezvous();
+
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  Utility::broadcast( *comm, rendezvous_number, 0 );
+
+  // The archives written during an overlapped rendezvous cannot be used to
+  // restart the simulation
+  if( comm->size() > 1 )
+  {
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+    
+    FRENSIE_CHECK_THROW( factory.reset( new MonteCarlo::ParticleSimulationManagerFactory( "test_sim_overlapped_rendezvous_1.xml", (unsigned)threads ) ),
+                         std::runtime_error );
+  }
+
+  // The archive written by the final rendezvous can be used to restart the
+  // simulation
+  std::string archive_name( "test_sim_overlapped_rendezvous_" );
+  archive_name += Utility::toString( rendezvous_number - 1 );
+  archive_name += ".xml";
+
+  std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+  FRENSIE_CHECK_NO_THROW( factory.reset( new MonteCarlo::ParticleSimulationManagerFactory( archive_name, (unsigned)threads ) ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a simulation can be run
 FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_wall_time )
@@ -11,6 +11,7 @@
 #include <memory>
 #include <csignal>
 #include <functional>
+#include <cmath>
 
 // Boost Includes
 #include <boost/filesystem.hpp>
@@ -21,6 +22,7 @@
 #include "MonteCarlo_StandardParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardAdjointParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_CellTrackLengthFluxEstimator.hpp"
 #include "Data_ScatteringCenterPropertiesDatabase.hpp"
 #include "Geometry_InfiniteMediumModel.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
@@ -924,6 +926,304 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_history_wall )
   FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 2 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a simulation can be run using event-based transport
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_event_based )
+{
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( 5 );
+    properties->setEventBasedTransportModeOn();
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+    factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+    manager = factory->getManager();
+  }
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 5 );
+  FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the event-based tallies match the history-based tallies
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_event_based_history_based_equivalence )
+{
+  // Run the simulation and return the first and second moments of the
+  // cell track-length flux estimator
+  auto run_simulation = [&]( const bool event_based,
+                            std::vector<double>& first_moments,
+                            std::vector<double>& second_moments ){
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( 10 );
+
+    if( event_based )
+    {
+      properties->setEventBasedTransportModeOn();
+      properties->setEventBasedHistoryBatchSize( 3 );
+    }
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    std::shared_ptr<MonteCarlo::CellTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> > estimator(
+                 new MonteCarlo::CellTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>(
+                                  0u,
+                                  1.0,
+                                  std::vector<MonteCarlo::StandardCellEstimator::CellIdType>( {1} ),
+                                  std::vector<double>( {1.0} ) ) );
+
+    event_handler->addEstimator( estimator );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+      factory->getManager();
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    Utility::ArrayView<const double> first_moments_view =
+      estimator->getTotalBinDataFirstMoments();
+
+    Utility::ArrayView<const double> second_moments_view =
+      estimator->getTotalBinDataSecondMoments();
+
+    first_moments.assign( first_moments_view.begin(),
+                          first_moments_view.end() );
+    second_moments.assign( second_moments_view.begin(),
+                           second_moments_view.end() );
+  };
+
+  std::vector<double> history_based_first_moments,
+    history_based_second_moments;
+
+  run_simulation( false,
+                  history_based_first_moments,
+                  history_based_second_moments );
+
+  std::vector<double> event_based_first_moments,
+    event_based_second_moments;
+
+  run_simulation( true,
+                  event_based_first_moments,
+                  event_based_second_moments );
+
+  FRENSIE_REQUIRE( history_based_first_moments.size() > 0 );
+  FRENSIE_CHECK( history_based_first_moments.front() > 0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( event_based_first_moments,
+                                   history_based_first_moments,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( event_based_second_moments,
+                                   history_based_second_moments,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that electron range rejection does not change the photon tallies
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_electron_range_rejection_photon_tally )
+{
+  const uint64_t number_of_histories = 100;
+
+  // Run the simulation and return the first and second moments of the
+  // photon cell track-length flux estimator
+  auto run_simulation = [&]( const bool range_rejection,
+                            std::vector<double>& first_moments,
+                            std::vector<double>& second_moments,
+                            uint64_t& range_rejection_terminations ){
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_ELECTRON_MODE );
+    properties->setNumberOfHistories( number_of_histories );
+
+    if( range_rejection )
+      properties->setElectronRangeRejectionModeOn();
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardElectronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    std::shared_ptr<MonteCarlo::CellTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> > estimator(
+                 new MonteCarlo::CellTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>(
+                                  0u,
+                                  1.0,
+                                  std::vector<MonteCarlo::StandardCellEstimator::CellIdType>( {1} ),
+                                  std::vector<double>( {1.0} ) ) );
+
+    estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+    event_handler->addEstimator( estimator );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+      factory->getManager();
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    Utility::ArrayView<const double> first_moments_view =
+      estimator->getTotalBinDataFirstMoments();
+
+    Utility::ArrayView<const double> second_moments_view =
+      estimator->getTotalBinDataSecondMoments();
+
+    first_moments.assign( first_moments_view.begin(),
+                          first_moments_view.end() );
+    second_moments.assign( second_moments_view.begin(),
+                           second_moments_view.end() );
+
+    range_rejection_terminations =
+      manager->getCellEnergyCutoffStatistics().getNumberOfRangeRejectionTerminations( 1 );
+  };
+
+  std::vector<double> off_first_moments, off_second_moments;
+  uint64_t off_range_rejection_terminations;
+
+  run_simulation( false,
+                  off_first_moments,
+                  off_second_moments,
+                  off_range_rejection_terminations );
+
+  std::vector<double> on_first_moments, on_second_moments;
+  uint64_t on_range_rejection_terminations;
+
+  run_simulation( true,
+                  on_first_moments,
+                  on_second_moments,
+                  on_range_rejection_terminations );
+
+  FRENSIE_CHECK_EQUAL( off_range_rejection_terminations, 0 );
+  FRENSIE_CHECK( on_range_rejection_terminations > 0 );
+
+  FRENSIE_REQUIRE_EQUAL( off_first_moments.size(), 1 );
+  FRENSIE_REQUIRE_EQUAL( on_first_moments.size(), 1 );
+  FRENSIE_CHECK( off_first_moments.front() > 0.0 );
+
+  // The photon flux means must agree to within three standard deviations
+  auto calculate_mean_and_variance = [number_of_histories](
+                                         const double first_moment,
+                                         const double second_moment,
+                                         double& mean,
+                                         double& variance ){
+    mean = first_moment/number_of_histories;
+    variance = (second_moment/number_of_histories - mean*mean)/
+      (number_of_histories - 1);
+  };
+
+  double off_mean, off_variance, on_mean, on_variance;
+
+  calculate_mean_and_variance( off_first_moments.front(),
+                               off_second_moments.front(),
+                               off_mean,
+                               off_variance );
+  calculate_mean_and_variance( on_first_moments.front(),
+                               on_second_moments.front(),
+                               on_mean,
+                               on_variance );
+
+  FRENSIE_CHECK( std::fabs( on_mean - off_mean ) <=
+                 3.0*std::sqrt( on_variance + off_variance ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a simulation can be run
 FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_wall_time )
@@ -1264,6 +1564,108 @@ FRENSIE_DATA_UNIT_TEST_INST( ParticleSimulationManager, restart_basic )
 #endif
 }
 
+//---------------------------------------------------------------------------//
+// Check that a particle simulation can be restarted from an incremental
+// rendezvous archive
+FRENSIE_DATA_UNIT_TEST_DECL( ParticleSimulationManager, restart_incremental )
+{
+  FETCH_FROM_TABLE( std::string, archive_type );
+  FETCH_FROM_TABLE( uint32_t, source_id );
+
+  uint64_t next_history;
+  uint64_t rendezvous_number;
+  uint64_t source_trials;
+
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setSimulationWallTime( 0.25 );
+    properties->setMaxRendezvousBatchSize( 10 );
+    properties->setIncrementalRendezvousModeOn();
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     source_id,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim_inc",
+                                                              archive_type,
+                                                              threads ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+      factory->getManager();
+    manager->useMultipleRendezvousFiles();
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    next_history = manager->getNextHistory();
+    rendezvous_number = manager->getNumberOfRendezvous();
+    source_trials = manager->getSource().getNumberOfTrials();
+  }
+
+  FRENSIE_CHECK( boost::filesystem::exists( "test_sim_inc_rendezvous_base." + archive_type ) );
+
+  std::string archive_name( "test_sim_inc_rendezvous_" );
+  archive_name += Utility::toString( rendezvous_number - 1 );
+  archive_name += ".";
+  archive_name += archive_type;
+
+  FRENSIE_REQUIRE( boost::filesystem::exists( archive_name ) );
+
+  std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+  FRENSIE_REQUIRE_NO_THROW( factory.reset( new MonteCarlo::ParticleSimulationManagerFactory( archive_name, (unsigned)threads ) ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+    factory->getManager();
+
+  FRENSIE_CHECK_EQUAL( manager->getNextHistory(), next_history );
+  FRENSIE_CHECK_EQUAL( manager->getSource().getNumberOfTrials(),
+                       source_trials );
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  FRENSIE_CHECK( manager->getNextHistory() > next_history );
+  FRENSIE_CHECK( manager->getNumberOfRendezvous() > rendezvous_number );
+}
+
+FRENSIE_DATA_UNIT_TEST_INST( ParticleSimulationManager, restart_incremental )
+{
+  COLUMNS()         << "archive_type" << "source_id" ;
+  NEW_ROW( "xml" )  <<    "xml"       <<    0;
+  NEW_ROW( "txt" )  <<    "txt"       <<    1;
+  NEW_ROW( "bin" )  <<    "bin"       <<    2;
+#ifdef HAVE_FRENSIE_HDF5
+  NEW_ROW( "h5fa" ) <<    "h5fa"      <<    3;
+#endif
+}
+
 //---------------------------------------------------------------------------//
 // Check that a particle simulation manager can be restarted
 FRENSIE_DATA_UNIT_TEST_DECL( ParticleSimulationManager, restart_add_histories )
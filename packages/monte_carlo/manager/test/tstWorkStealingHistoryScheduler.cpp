@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstWorkStealingHistoryScheduler.cpp
+//! \author Alex Robinson
+//! \brief  Work stealing history scheduler unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_WorkStealingHistoryScheduler.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+int threads;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a thread receives chunks of its own range first
+FRENSIE_UNIT_TEST( WorkStealingHistoryScheduler, getNextHistoryRange_own )
+{
+  MonteCarlo::WorkStealingHistoryScheduler scheduler( 10, 30, 2, 4 );
+
+  FRENSIE_CHECK_EQUAL( scheduler.getNumberOfThreads(), 2 );
+
+  uint64_t range_start, range_end;
+
+  FRENSIE_REQUIRE( scheduler.getNextHistoryRange( 0, range_start, range_end ) );
+  FRENSIE_CHECK_EQUAL( range_start, 10 );
+  FRENSIE_CHECK_EQUAL( range_end, 14 );
+
+  FRENSIE_REQUIRE( scheduler.getNextHistoryRange( 0, range_start, range_end ) );
+  FRENSIE_CHECK_EQUAL( range_start, 14 );
+  FRENSIE_CHECK_EQUAL( range_end, 18 );
+
+  FRENSIE_REQUIRE( scheduler.getNextHistoryRange( 0, range_start, range_end ) );
+  FRENSIE_CHECK_EQUAL( range_start, 18 );
+  FRENSIE_CHECK_EQUAL( range_end, 20 );
+
+  FRENSIE_REQUIRE( scheduler.getNextHistoryRange( 1, range_start, range_end ) );
+  FRENSIE_CHECK_EQUAL( range_start, 20 );
+  FRENSIE_CHECK_EQUAL( range_end, 24 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an idle thread will steal histories from another thread
+FRENSIE_UNIT_TEST( WorkStealingHistoryScheduler, getNextHistoryRange_steal )
+{
+  MonteCarlo::WorkStealingHistoryScheduler scheduler( 0, 20, 2, 4 );
+
+  uint64_t range_start, range_end;
+
+  // Exhaust the range of thread 1
+  FRENSIE_REQUIRE( scheduler.getNextHistoryRange( 1, range_start, range_end ) );
+  FRENSIE_REQUIRE( scheduler.getNextHistoryRange( 1, range_start, range_end ) );
+  FRENSIE_REQUIRE( scheduler.getNextHistoryRange( 1, range_start, range_end ) );
+  FRENSIE_CHECK_EQUAL( range_start, 18 );
+  FRENSIE_CHECK_EQUAL( range_end, 20 );
+
+  // Thread 1 will steal the back half of the range of thread 0
+  FRENSIE_REQUIRE( scheduler.getNextHistoryRange( 1, range_start, range_end ) );
+  FRENSIE_CHECK_EQUAL( range_start, 5 );
+  FRENSIE_CHECK_EQUAL( range_end, 9 );
+
+  FRENSIE_REQUIRE( scheduler.getNextHistoryRange( 1, range_start, range_end ) );
+  FRENSIE_CHECK_EQUAL( range_start, 9 );
+  FRENSIE_CHECK_EQUAL( range_end, 10 );
+
+  // Thread 0 still owns the front half of its range
+  FRENSIE_REQUIRE( scheduler.getNextHistoryRange( 0, range_start, range_end ) );
+  FRENSIE_CHECK_EQUAL( range_start, 0 );
+  FRENSIE_CHECK_EQUAL( range_end, 4 );
+
+  FRENSIE_REQUIRE( scheduler.getNextHistoryRange( 0, range_start, range_end ) );
+  FRENSIE_CHECK_EQUAL( range_start, 4 );
+  FRENSIE_CHECK_EQUAL( range_end, 5 );
+
+  // All histories have been scheduled
+  FRENSIE_CHECK( !scheduler.getNextHistoryRange( 0, range_start, range_end ) );
+  FRENSIE_CHECK( !scheduler.getNextHistoryRange( 1, range_start, range_end ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that every history is scheduled exactly once
+FRENSIE_UNIT_TEST( WorkStealingHistoryScheduler, getNextHistoryRange_threads )
+{
+  const unsigned number_of_threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  MonteCarlo::WorkStealingHistoryScheduler
+    scheduler( 0, 10000, number_of_threads, 7 );
+
+  std::vector<int> history_counts( 10000, 0 );
+
+  #pragma omp parallel num_threads( number_of_threads )
+  {
+    uint64_t range_start, range_end;
+
+    while( scheduler.getNextHistoryRange( Utility::OpenMPProperties::getThreadId(),
+                                          range_start,
+                                          range_end ) )
+    {
+      // Each history will only be written by a single thread
+      for( uint64_t history = range_start; history < range_end; ++history )
+        ++history_counts[history];
+    }
+  }
+
+  for( size_t i = 0; i < history_counts.size(); ++i )
+    FRENSIE_CHECK_EQUAL( history_counts[i], 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set the number of threads to use
+  Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstWorkStealingHistoryScheduler.cpp
+//---------------------------------------------------------------------------//
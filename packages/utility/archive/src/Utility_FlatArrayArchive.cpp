@@ -0,0 +1,456 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatArrayArchive.cpp
+//! \author Alex Robinson
+//! \brief  The flat array archive class definitions
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <fstream>
+#include <cstring>
+
+// System Includes
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Utility_FlatArrayArchive.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+namespace Details{
+
+// The flat array archive magic string
+const char s_flat_array_archive_magic[8] = {'F','R','N','S','F','L','A','T'};
+
+// The flat array archive version
+const uint32_t s_flat_array_archive_version = 1;
+
+// Round a number of bytes up to the array value alignment
+inline uint64_t alignFlatArrayOffset( const uint64_t offset )
+{
+  return (offset + sizeof(double) - 1)/sizeof(double)*sizeof(double);
+}
+
+} // end Details namespace
+
+// Constructor
+FlatArrayOArchive::FlatArrayOArchive()
+  : d_arrays()
+{ /* ... */ }
+
+// Add an array (the values will be copied)
+/*! \details If an array with the same name has already been added it will
+ * be replaced.
+ */
+void FlatArrayOArchive::addArray(
+                              const std::string& name,
+                              const Utility::ArrayView<const double>& values )
+{
+  // Make sure that the name is valid
+  testPrecondition( name.size() > 0 );
+
+  d_arrays[name].assign( values.begin(), values.end() );
+}
+
+// Add an array (the values will be copied)
+void FlatArrayOArchive::addArray( const std::string& name,
+                                  const std::vector<double>& values )
+{
+  // Make sure that the name is valid
+  testPrecondition( name.size() > 0 );
+
+  d_arrays[name] = values;
+}
+
+// Add a table of arrays (the values will be copied)
+void FlatArrayOArchive::addTable(
+                        const std::string& name,
+                        const std::map<double,std::vector<double> >& table )
+{
+  // Make sure that the name is valid
+  testPrecondition( name.size() > 0 );
+
+  std::vector<double>& grid = d_arrays[name+"_grid"];
+  std::vector<double>& offsets = d_arrays[name+"_offsets"];
+  std::vector<double>& values = d_arrays[name+"_values"];
+
+  grid.clear();
+  offsets.assign( 1, 0.0 );
+  values.clear();
+
+  for( auto&& row : table )
+  {
+    grid.push_back( row.first );
+    values.insert( values.end(), row.second.begin(), row.second.end() );
+    offsets.push_back( values.size() );
+  }
+}
+
+// Check if an array has been added
+bool FlatArrayOArchive::hasArray( const std::string& name ) const
+{
+  return d_arrays.find( name ) != d_arrays.end();
+}
+
+// Return the number of arrays that have been added
+size_t FlatArrayOArchive::getNumberOfArrays() const
+{
+  return d_arrays.size();
+}
+
+// Write the archive
+void FlatArrayOArchive::write(
+                         const boost::filesystem::path& archive_name_with_path,
+                         const bool overwrite ) const
+{
+  TEST_FOR_EXCEPTION( !overwrite &&
+                      boost::filesystem::exists( archive_name_with_path ),
+                      std::runtime_error,
+                      "Cannot write the flat array archive "
+                      << archive_name_with_path.string() <<
+                      " because the file already exists!" );
+
+  // Calculate the size of the header and the table of contents
+  uint64_t data_offset = sizeof(Details::s_flat_array_archive_magic) +
+    2*sizeof(uint32_t);
+
+  for( auto&& array : d_arrays )
+    data_offset += sizeof(uint32_t) + array.first.size() + 2*sizeof(uint64_t);
+
+  data_offset = Details::alignFlatArrayOffset( data_offset );
+
+  std::ofstream archive( archive_name_with_path.string(),
+                         std::ofstream::binary | std::ofstream::trunc );
+
+  TEST_FOR_EXCEPTION( !archive.good(),
+                      std::runtime_error,
+                      "Cannot write the flat array archive "
+                      << archive_name_with_path.string() <<
+                      " because the file could not be opened!" );
+
+  // Write the header
+  const uint32_t version = Details::s_flat_array_archive_version;
+  const uint32_t number_of_arrays = d_arrays.size();
+
+  archive.write( Details::s_flat_array_archive_magic,
+                 sizeof(Details::s_flat_array_archive_magic) );
+  archive.write( reinterpret_cast<const char*>( &version ), sizeof(version) );
+  archive.write( reinterpret_cast<const char*>( &number_of_arrays ),
+                 sizeof(number_of_arrays) );
+
+  // Write the table of contents
+  uint64_t array_offset = data_offset;
+
+  for( auto&& array : d_arrays )
+  {
+    const uint32_t name_size = array.first.size();
+    const uint64_t array_size = array.second.size();
+
+    archive.write( reinterpret_cast<const char*>( &name_size ),
+                   sizeof(name_size) );
+    archive.write( array.first.data(), name_size );
+    archive.write( reinterpret_cast<const char*>( &array_offset ),
+                   sizeof(array_offset) );
+    archive.write( reinterpret_cast<const char*>( &array_size ),
+                   sizeof(array_size) );
+
+    array_offset += array_size*sizeof(double);
+  }
+
+  // Pad the table of contents so that the arrays are aligned
+  const std::vector<char> padding( data_offset - archive.tellp(), '\0' );
+
+  archive.write( padding.data(), padding.size() );
+
+  // Write the arrays
+  for( auto&& array : d_arrays )
+  {
+    archive.write( reinterpret_cast<const char*>( array.second.data() ),
+                   array.second.size()*sizeof(double) );
+  }
+
+  TEST_FOR_EXCEPTION( !archive.good(),
+                      std::runtime_error,
+                      "Unable to write the flat array archive "
+                      << archive_name_with_path.string() << "!" );
+}
+
+// Constructor
+FlatArrayIArchive::FlatArrayIArchive(
+                        const boost::filesystem::path& archive_name_with_path )
+  : d_base_address( NULL ),
+    d_number_of_bytes( 0 ),
+    d_table_of_contents()
+{
+  TEST_FOR_EXCEPTION( !boost::filesystem::exists( archive_name_with_path ),
+                      std::runtime_error,
+                      "Cannot map the flat array archive "
+                      << archive_name_with_path.string() <<
+                      " because the file does not exist!" );
+
+  const int file_descriptor =
+    ::open( archive_name_with_path.string().c_str(), O_RDONLY );
+
+  TEST_FOR_EXCEPTION( file_descriptor < 0,
+                      std::runtime_error,
+                      "Cannot map the flat array archive "
+                      << archive_name_with_path.string() <<
+                      " because the file could not be opened!" );
+
+  struct stat file_status;
+
+  if( ::fstat( file_descriptor, &file_status ) != 0 ||
+      file_status.st_size <= 0 )
+  {
+    ::close( file_descriptor );
+
+    THROW_EXCEPTION( std::runtime_error,
+                     "Cannot map the flat array archive "
+                     << archive_name_with_path.string() <<
+                     " because the file is empty!" );
+  }
+
+  d_number_of_bytes = file_status.st_size;
+
+  void* base_address = ::mmap( NULL,
+                               d_number_of_bytes,
+                               PROT_READ,
+                               MAP_SHARED,
+                               file_descriptor,
+                               0 );
+
+  // The mapping stays valid after the file has been closed
+  ::close( file_descriptor );
+
+  TEST_FOR_EXCEPTION( base_address == MAP_FAILED,
+                      std::runtime_error,
+                      "Cannot map the flat array archive "
+                      << archive_name_with_path.string() << "!" );
+
+  d_base_address = static_cast<const unsigned char*>( base_address );
+
+  try{
+    this->parseTableOfContents( archive_name_with_path );
+  }
+  catch( ... )
+  {
+    this->unmap();
+
+    throw;
+  }
+}
+
+// Destructor
+FlatArrayIArchive::~FlatArrayIArchive()
+{
+  this->unmap();
+}
+
+// Release the mapped memory
+void FlatArrayIArchive::unmap()
+{
+  if( d_base_address )
+  {
+    ::munmap( const_cast<unsigned char*>( d_base_address ), d_number_of_bytes );
+
+    d_base_address = NULL;
+  }
+}
+
+// Parse the header and the table of contents
+void FlatArrayIArchive::parseTableOfContents(
+                        const boost::filesystem::path& archive_name_with_path )
+{
+  size_t position = 0;
+
+  // Copy the next block of bytes (the table of contents is not aligned)
+  auto read_bytes = [this, &position]( void* destination, const size_t size ){
+    if( position + size > d_number_of_bytes )
+      return false;
+
+    std::memcpy( destination, d_base_address + position, size );
+    position += size;
+
+    return true;
+  };
+
+  char magic[sizeof(Details::s_flat_array_archive_magic)];
+  uint32_t version = 0, number_of_arrays = 0;
+
+  TEST_FOR_EXCEPTION( !read_bytes( magic, sizeof(magic) ) ||
+                      std::memcmp( magic,
+                                   Details::s_flat_array_archive_magic,
+                                   sizeof(magic) ) != 0,
+                      std::runtime_error,
+                      "The file " << archive_name_with_path.string() <<
+                      " is not a flat array archive!" );
+
+  TEST_FOR_EXCEPTION( !read_bytes( &version, sizeof(version) ) ||
+                      version != Details::s_flat_array_archive_version,
+                      std::runtime_error,
+                      "The flat array archive "
+                      << archive_name_with_path.string() <<
+                      " has an unsupported version (" << version << " != "
+                      << Details::s_flat_array_archive_version << ")!" );
+
+  TEST_FOR_EXCEPTION( !read_bytes( &number_of_arrays,
+                                   sizeof(number_of_arrays) ),
+                      std::runtime_error,
+                      "The flat array archive "
+                      << archive_name_with_path.string() <<
+                      " has an invalid header!" );
+
+  for( uint32_t i = 0; i < number_of_arrays; ++i )
+  {
+    uint32_t name_size;
+    uint64_t array_offset, array_size;
+
+    bool valid_entry = read_bytes( &name_size, sizeof(name_size) ) &&
+      position + name_size <= d_number_of_bytes;
+
+    std::string name;
+
+    if( valid_entry )
+    {
+      name.assign( reinterpret_cast<const char*>( d_base_address + position ),
+                   name_size );
+      position += name_size;
+
+      valid_entry = read_bytes( &array_offset, sizeof(array_offset) ) &&
+        read_bytes( &array_size, sizeof(array_size) ) &&
+        array_offset % sizeof(double) == 0 &&
+        array_offset <= d_number_of_bytes &&
+        array_size <= (d_number_of_bytes - array_offset)/sizeof(double);
+    }
+
+    TEST_FOR_EXCEPTION( !valid_entry,
+                        std::runtime_error,
+                        "The flat array archive "
+                        << archive_name_with_path.string() <<
+                        " has an invalid table of contents entry (" << i
+                        << ")!" );
+
+    d_table_of_contents[name] = std::make_pair( array_offset, array_size );
+  }
+}
+
+// Return the archive file version
+unsigned FlatArrayIArchive::getVersion()
+{
+  return Details::s_flat_array_archive_version;
+}
+
+// Return the archive file extension
+const std::string& FlatArrayIArchive::getExtension()
+{
+  static const std::string extension( ".frfa" );
+
+  return extension;
+}
+
+// Check if an array is stored in the archive
+bool FlatArrayIArchive::hasArray( const std::string& name ) const
+{
+  return d_table_of_contents.find( name ) != d_table_of_contents.end();
+}
+
+// Return a view of a stored array
+Utility::ArrayView<const double> FlatArrayIArchive::getArray(
+                                               const std::string& name ) const
+{
+  auto array_it = d_table_of_contents.find( name );
+
+  TEST_FOR_EXCEPTION( array_it == d_table_of_contents.end(),
+                      std::runtime_error,
+                      "The array " << name << " is not stored in the flat "
+                      "array archive!" );
+
+  const double* array_start = reinterpret_cast<const double*>(
+                                    d_base_address + array_it->second.first );
+
+  return Utility::ArrayView<const double>( array_start,
+                                           array_it->second.second );
+}
+
+// Check if a table of arrays is stored in the archive
+bool FlatArrayIArchive::hasTable( const std::string& name ) const
+{
+  return this->hasArray( name+"_grid" ) &&
+    this->hasArray( name+"_offsets" ) &&
+    this->hasArray( name+"_values" );
+}
+
+// Return views of the arrays in a stored table
+std::map<double,Utility::ArrayView<const double> >
+FlatArrayIArchive::getTable( const std::string& name ) const
+{
+  Utility::ArrayView<const double> grid = this->getArray( name+"_grid" );
+  Utility::ArrayView<const double> offsets = this->getArray( name+"_offsets" );
+  Utility::ArrayView<const double> values = this->getArray( name+"_values" );
+
+  TEST_FOR_EXCEPTION( offsets.size() != grid.size() + 1 ||
+                      offsets.back() != values.size(),
+                      std::runtime_error,
+                      "The table " << name << " stored in the flat array "
+                      "archive is invalid!" );
+
+  std::map<double,Utility::ArrayView<const double> > table;
+
+  for( size_t i = 0; i < grid.size(); ++i )
+  {
+    const size_t row_start = offsets[i];
+    const size_t row_end = offsets[i+1];
+
+    TEST_FOR_EXCEPTION( row_start > row_end,
+                        std::runtime_error,
+                        "The table " << name << " stored in the flat array "
+                        "archive is invalid!" );
+
+    table.emplace_hint( table.end(),
+                        grid[i],
+                        Utility::ArrayView<const double>(
+                                            values.data() + row_start,
+                                            values.data() + row_end ) );
+  }
+
+  return table;
+}
+
+// Return the names of the stored arrays
+std::vector<std::string> FlatArrayIArchive::getArrayNames() const
+{
+  std::vector<std::string> names;
+  names.reserve( d_table_of_contents.size() );
+
+  for( auto&& entry : d_table_of_contents )
+    names.push_back( entry.first );
+
+  return names;
+}
+
+// Return the number of stored arrays
+size_t FlatArrayIArchive::getNumberOfArrays() const
+{
+  return d_table_of_contents.size();
+}
+
+// Return the size of the mapped file (bytes)
+size_t FlatArrayIArchive::getNumberOfBytes() const
+{
+  return d_number_of_bytes;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatArrayArchive.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,157 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatArrayArchive.hpp
+//! \author Alex Robinson
+//! \brief  The flat array archive class declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_FLAT_ARRAY_ARCHIVE_HPP
+#define UTILITY_FLAT_ARRAY_ARCHIVE_HPP
+
+// Std Lib Includes
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <cstdint>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "Utility_ArrayView.hpp"
+
+namespace Utility{
+
+/*! The flat array output archive
+ *
+ * Named arrays of doubles are collected and written to a flat, versioned
+ * binary file (.frfa) that can be memory-mapped by the
+ * Utility::FlatArrayIArchive. The file starts with a header (magic string,
+ * version and number of arrays), which is followed by the table of contents
+ * (name, offset and size of each array) and the 8-byte aligned array blocks.
+ * All values are stored in the native byte order. Tables of arrays (e.g.
+ * secondary distributions tabulated on an incoming energy grid) are stored as
+ * three arrays: the grid (name_grid), the row offsets (name_offsets) and the
+ * concatenated row values (name_values).
+ *  \ingroup archive
+ */
+class FlatArrayOArchive
+{
+
+public:
+
+  //! Constructor
+  FlatArrayOArchive();
+
+  //! Destructor
+  ~FlatArrayOArchive()
+  { /* ... */ }
+
+  //! Add an array (the values will be copied)
+  void addArray( const std::string& name,
+                 const Utility::ArrayView<const double>& values );
+
+  //! Add an array (the values will be copied)
+  void addArray( const std::string& name, const std::vector<double>& values );
+
+  //! Add a table of arrays (the values will be copied)
+  void addTable( const std::string& name,
+                 const std::map<double,std::vector<double> >& table );
+
+  //! Check if an array has been added
+  bool hasArray( const std::string& name ) const;
+
+  //! Return the number of arrays that have been added
+  size_t getNumberOfArrays() const;
+
+  //! Write the archive
+  void write( const boost::filesystem::path& archive_name_with_path,
+              const bool overwrite = true ) const;
+
+private:
+
+  // The arrays
+  std::map<std::string,std::vector<double> > d_arrays;
+};
+
+/*! The flat array input archive
+ *
+ * The archive file written by a Utility::FlatArrayOArchive is memory-mapped
+ * (read-only) and the stored arrays are exposed as views into the mapped
+ * memory - no values are copied or deserialized. Pages are loaded by the
+ * operating system on demand and are shared by all processes that map the
+ * same file. The views are only valid for the lifetime of the archive.
+ *  \ingroup archive
+ */
+class FlatArrayIArchive
+{
+
+public:
+
+  //! Constructor
+  FlatArrayIArchive( const boost::filesystem::path& archive_name_with_path );
+
+  //! Destructor
+  ~FlatArrayIArchive();
+
+  //! Return the archive file version
+  static unsigned getVersion();
+
+  //! Return the archive file extension
+  static const std::string& getExtension();
+
+  //! Check if an array is stored in the archive
+  bool hasArray( const std::string& name ) const;
+
+  //! Return a view of a stored array
+  Utility::ArrayView<const double> getArray( const std::string& name ) const;
+
+  //! Check if a table of arrays is stored in the archive
+  bool hasTable( const std::string& name ) const;
+
+  //! Return views of the arrays in a stored table
+  std::map<double,Utility::ArrayView<const double> >
+  getTable( const std::string& name ) const;
+
+  //! Return the names of the stored arrays
+  std::vector<std::string> getArrayNames() const;
+
+  //! Return the number of stored arrays
+  size_t getNumberOfArrays() const;
+
+  //! Return the size of the mapped file (bytes)
+  size_t getNumberOfBytes() const;
+
+private:
+
+  // Copy constructor
+  FlatArrayIArchive( const FlatArrayIArchive& other ) = delete;
+
+  // Assignment operator
+  FlatArrayIArchive& operator=( const FlatArrayIArchive& other ) = delete;
+
+  // Parse the header and the table of contents
+  void parseTableOfContents( const boost::filesystem::path& archive_name_with_path );
+
+  // Release the mapped memory
+  void unmap();
+
+  // The base address of the mapped file
+  const unsigned char* d_base_address;
+
+  // The size of the mapped file (bytes)
+  size_t d_number_of_bytes;
+
+  // The table of contents (name -> (offset, size))
+  std::map<std::string,std::pair<uint64_t,uint64_t> > d_table_of_contents;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_FLAT_ARRAY_ARCHIVE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatArrayArchive.hpp
+//---------------------------------------------------------------------------//
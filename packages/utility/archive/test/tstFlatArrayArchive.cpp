@@ -0,0 +1,145 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstFlatArrayArchive.cpp
+//! \author Alex Robinson
+//! \brief  Flat array archive unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <fstream>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Utility_FlatArrayArchive.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that arrays can be added to an output archive
+FRENSIE_UNIT_TEST( FlatArrayOArchive, addArray )
+{
+  Utility::FlatArrayOArchive archive;
+
+  FRENSIE_CHECK_EQUAL( archive.getNumberOfArrays(), 0 );
+  FRENSIE_CHECK( !archive.hasArray( "grid" ) );
+
+  archive.addArray( "grid", std::vector<double>( {1.0, 2.0, 3.0} ) );
+
+  FRENSIE_CHECK_EQUAL( archive.getNumberOfArrays(), 1 );
+  FRENSIE_CHECK( archive.hasArray( "grid" ) );
+
+  // Arrays with the same name are replaced
+  std::vector<double> values( {4.0, 5.0} );
+
+  archive.addArray( "grid", Utility::arrayViewOfConst( values ) );
+
+  FRENSIE_CHECK_EQUAL( archive.getNumberOfArrays(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the archived arrays can be mapped
+FRENSIE_UNIT_TEST( FlatArrayIArchive, getArray )
+{
+  std::string archive_name( "test_flat_array_archive.frfa" );
+
+  {
+    Utility::FlatArrayOArchive archive;
+
+    archive.addArray( "energy_grid", std::vector<double>( {1e-3, 1.0, 20.0} ) );
+    archive.addArray( "cross_section", std::vector<double>( {10.0, 5.0, 1.0} ) );
+    archive.addArray( "empty", std::vector<double>() );
+    archive.addArray( "a", std::vector<double>( {-1.0} ) );
+
+    archive.write( archive_name );
+
+    FRENSIE_CHECK_THROW( archive.write( archive_name, false ),
+                         std::runtime_error );
+  }
+
+  Utility::FlatArrayIArchive archive( archive_name );
+
+  FRENSIE_CHECK_EQUAL( archive.getNumberOfArrays(), 4 );
+  FRENSIE_CHECK_EQUAL( archive.getArrayNames(),
+                       std::vector<std::string>( {"a", "cross_section", "empty", "energy_grid"} ) );
+  FRENSIE_CHECK( archive.hasArray( "energy_grid" ) );
+  FRENSIE_CHECK( !archive.hasArray( "photon_energy_grid" ) );
+
+  Utility::ArrayView<const double> energy_grid =
+    archive.getArray( "energy_grid" );
+
+  FRENSIE_CHECK_EQUAL( energy_grid,
+                       std::vector<double>( {1e-3, 1.0, 20.0} ) );
+  FRENSIE_CHECK_EQUAL( reinterpret_cast<size_t>( energy_grid.data() ) % sizeof(double), 0 );
+  FRENSIE_CHECK_EQUAL( archive.getArray( "cross_section" ),
+                       std::vector<double>( {10.0, 5.0, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( archive.getArray( "a" ), std::vector<double>( {-1.0} ) );
+  FRENSIE_CHECK( archive.getArray( "empty" ).empty() );
+
+  FRENSIE_CHECK_THROW( archive.getArray( "photon_energy_grid" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that archived tables of arrays can be mapped
+FRENSIE_UNIT_TEST( FlatArrayIArchive, getTable )
+{
+  std::string archive_name( "test_flat_array_archive_table.frfa" );
+
+  {
+    std::map<double,std::vector<double> > table;
+    table[1.0] = std::vector<double>( {0.1, 0.2} );
+    table[2.0] = std::vector<double>( {0.3} );
+    table[3.0] = std::vector<double>( {0.4, 0.5, 0.6} );
+
+    Utility::FlatArrayOArchive archive;
+
+    archive.addTable( "pdf", table );
+
+    FRENSIE_CHECK_EQUAL( archive.getNumberOfArrays(), 3 );
+
+    archive.write( archive_name );
+  }
+
+  Utility::FlatArrayIArchive archive( archive_name );
+
+  FRENSIE_CHECK( archive.hasTable( "pdf" ) );
+  FRENSIE_CHECK( !archive.hasTable( "cdf" ) );
+  FRENSIE_CHECK_EQUAL( archive.getArray( "pdf_grid" ),
+                       std::vector<double>( {1.0, 2.0, 3.0} ) );
+
+  std::map<double,Utility::ArrayView<const double> > table =
+    archive.getTable( "pdf" );
+
+  FRENSIE_REQUIRE_EQUAL( table.size(), 3 );
+  FRENSIE_CHECK_EQUAL( table[1.0], std::vector<double>( {0.1, 0.2} ) );
+  FRENSIE_CHECK_EQUAL( table[2.0], std::vector<double>( {0.3} ) );
+  FRENSIE_CHECK_EQUAL( table[3.0], std::vector<double>( {0.4, 0.5, 0.6} ) );
+  FRENSIE_CHECK_THROW( archive.getTable( "cdf" ), std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid archives are rejected
+FRENSIE_UNIT_TEST( FlatArrayIArchive, constructor_invalid )
+{
+  FRENSIE_CHECK_THROW( Utility::FlatArrayIArchive archive( "dummy.frfa" ),
+                       std::runtime_error );
+
+  std::string archive_name( "test_invalid_flat_array_archive.frfa" );
+
+  {
+    std::ofstream file( archive_name );
+
+    file << "This is not a flat array archive";
+  }
+
+  FRENSIE_CHECK_THROW( Utility::FlatArrayIArchive archive( archive_name ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// end tstFlatArrayArchive.cpp
+//---------------------------------------------------------------------------//
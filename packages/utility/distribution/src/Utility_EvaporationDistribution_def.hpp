@@ -10,6 +10,9 @@
 #ifndef UTILITY_EVAPORATION_DISTRIBUTION_DEF_HPP
 #define UTILITY_EVAPORATION_DISTRIBUTION_DEF_HPP
 
+// Std Lib Includes
+#include <array>
+
 // FRENSIE Includes
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_PhysicalConstants.hpp"
@@ -210,7 +213,7 @@ UnitAwareEvaporationDistribution<IndependentUnit,DependentUnit>::sampleAndRecord
   testPrecondition( incident_energy > IQT::zero() );
   testPrecondition( nuclear_temperature > IQT::zero() );
 
-  double random_number_1, random_number_2;
+  std::array<double,2> random_numbers;
   IndepQuantity sample;
 
   double argument = 1.0 - exp( -(incident_energy - restriction_energy)
@@ -222,11 +225,11 @@ UnitAwareEvaporationDistribution<IndependentUnit,DependentUnit>::sampleAndRecord
     // Increment the trials counter
     ++trials;
 
-    random_number_1 = RandomNumberGenerator::getRandomNumber<double>();
-    random_number_2 = RandomNumberGenerator::getRandomNumber<double>();
+    RandomNumberGenerator::fillRandomNumbers(
+                                      ArrayView<double>( random_numbers ) );
 
     sample = - nuclear_temperature
-      * log( (1.0 - argument * random_number_1) * (1.0 - argument * random_number_2) );
+      * log( (1.0 - argument * random_numbers[0]) * (1.0 - argument * random_numbers[1]) );
 
     if( sample <= (incident_energy - restriction_energy) )
       break;
@@ -13,6 +13,9 @@
 // Boost Includes
 #include <boost/units/cmath.hpp>
 
+// Std Lib Includes
+#include <array>
+
 // FRENSIE Includes
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_PhysicalConstants.hpp"
@@ -215,7 +218,7 @@ UnitAwareMaxwellFissionDistribution<IndependentUnit,DependentUnit>::sampleAndRec
   testPrecondition( incident_energy > IQT::zero() );
   testPrecondition( nuclear_temperature > IQT::zero() );
 
-  double random_number_1, random_number_2, random_number_3;
+  std::array<double,3> random_numbers;
   double term_1, term_2, arg;
   IndepQuantity sample;
 
@@ -225,15 +228,14 @@ UnitAwareMaxwellFissionDistribution<IndependentUnit,DependentUnit>::sampleAndRec
     // Increment the trial counter
     ++trials;
 
-    random_number_1 = RandomNumberGenerator::getRandomNumber<double>();
-    random_number_2 = RandomNumberGenerator::getRandomNumber<double>();
-    random_number_3 = RandomNumberGenerator::getRandomNumber<double>();
+    RandomNumberGenerator::fillRandomNumbers(
+                                      ArrayView<double>( random_numbers ) );
 
-    term_1 = log(random_number_1);
+    term_1 = log(random_numbers[0]);
 
-    arg = cos( PhysicalConstants::pi * random_number_3 * 0.5 );
+    arg = cos( PhysicalConstants::pi * random_numbers[2] * 0.5 );
 
-    term_2 = log(random_number_2)*arg*arg;
+    term_2 = log(random_numbers[1])*arg*arg;
 
     sample = -nuclear_temperature * ( term_1 + term_2 );
 
@@ -9,6 +9,9 @@
 #ifndef UTILITY_NORMAL_DISTRIBUTION_DEF_HPP
 #define UTILITY_NORMAL_DISTRIBUTION_DEF_HPP
 
+// Std Lib Includes
+#include <array>
+
 // FRENSIE Includes
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_PhysicalConstants.hpp"
@@ -197,7 +200,7 @@ UnitAwareNormalDistribution<IndependentUnit,DependentUnit>::sampleAndRecordTrial
 				    const IndepQuantity min_independent_value,
 			            const IndepQuantity max_independent_value )
 {
-  double random_number_1, random_number_2;
+  std::array<double,2> random_numbers;
   double x, y;
   IndepQuantity sample;
 
@@ -209,11 +212,11 @@ UnitAwareNormalDistribution<IndependentUnit,DependentUnit>::sampleAndRecordTrial
     {
       ++trials;
 
-      random_number_1 = RandomNumberGenerator::getRandomNumber<double>();
-      random_number_2 = RandomNumberGenerator::getRandomNumber<double>();
+      RandomNumberGenerator::fillRandomNumbers(
+                                      ArrayView<double>( random_numbers ) );
 
-      x = -log( random_number_1 );
-      y = -log( random_number_2 );
+      x = -log( random_numbers[0] );
+      y = -log( random_numbers[1] );
 
       if( 0.5*(x - 1)*(x - 1) <= y )
       	break;
@@ -0,0 +1,182 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PackedTabularBasicBivariateDistribution.hpp
+//! \author Alex Robinson
+//! \brief  The packed tabular basic bivariate distribution class decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_PACKED_TABULAR_BASIC_BIVARIATE_DISTRIBUTION_HPP
+#define UTILITY_PACKED_TABULAR_BASIC_BIVARIATE_DISTRIBUTION_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// FRENSIE Includes
+#include "Utility_PackedTabularBasicBivariateDistributionBase.hpp"
+#include "Utility_TwoDGridPolicy.hpp"
+#include "Utility_ArrayView.hpp"
+
+namespace Utility{
+
+/*! The packed tabular basic bivariate distribution
+ *
+ * \details This is a sampling-only, structure-of-arrays representation of a
+ * Utility::InterpolatedFullyTabularBasicBivariateDistribution with
+ * tabular (lin-lin sampled) secondary distributions. The secondary grids,
+ * PDFs, CDFs and PDF slopes of every primary grid point are stored
+ * back-to-back in four contiguous arrays and an offset table records where
+ * the data of each primary grid point starts. Secondary distributions are
+ * sampled inline (no virtual calls or std::function objects) and the
+ * TwoDGridPolicy sampling routine is selected at compile time. Only the
+ * Utility::UnitBase, Utility::Correlated and Utility::UnitBaseCorrelated
+ * grid policies are supported. For the same data and random numbers, the
+ * samples are identical to the samples of the interpolated fully tabular
+ * distribution constructed from the secondary grids and dependent values.
+ * Sampling between explicit secondary limits is also supported (e.g. the
+ * bremsstrahlung photon energy limits).
+ * \ingroup bivariate_distributions
+ */
+template<typename _TwoDGridPolicy>
+class PackedTabularBasicBivariateDistribution : public PackedTabularBasicBivariateDistributionBase
+{
+
+public:
+
+  //! The two-dimensional grid policy
+  typedef _TwoDGridPolicy TwoDGridPolicy;
+
+  //! The two-dimensional interpolation policy
+  typedef typename TwoDGridPolicy::TwoDInterpPolicy TwoDInterpPolicy;
+
+  //! Constructor
+  PackedTabularBasicBivariateDistribution(
+          const std::vector<double>& primary_indep_grid,
+          const std::vector<std::vector<double> >& secondary_indep_grids,
+          const std::vector<std::vector<double> >& dependent_values );
+
+  //! Destructor
+  virtual ~PackedTabularBasicBivariateDistribution()
+  { /* ... */ }
+
+  //! Return the number of primary grid points
+  size_t getNumberOfPrimaryGridPoints() const;
+
+  //! Return the primary grid
+  Utility::ArrayView<const double> getPrimaryGrid() const;
+
+  //! Return the upper bound of the primary independent variable
+  double getUpperBoundOfPrimaryIndepVar() const override;
+
+  //! Return the lower bound of the primary independent variable
+  double getLowerBoundOfPrimaryIndepVar() const override;
+
+  //! Return the secondary grid at a primary grid point
+  Utility::ArrayView<const double>
+  getSecondaryGrid( const size_t primary_grid_index ) const;
+
+  //! Return the secondary PDF at a primary grid point
+  Utility::ArrayView<const double>
+  getSecondaryPDF( const size_t primary_grid_index ) const;
+
+  //! Return the (unnormalized) secondary CDF at a primary grid point
+  Utility::ArrayView<const double>
+  getSecondaryCDF( const size_t primary_grid_index ) const;
+
+  //! Return the upper bound of the secondary indep var at a primary grid point
+  double getUpperBoundOfSecondaryIndepVar(
+                                       const size_t primary_grid_index ) const;
+
+  //! Return the lower bound of the secondary indep var at a primary grid point
+  double getLowerBoundOfSecondaryIndepVar(
+                                       const size_t primary_grid_index ) const;
+
+  //! Return the upper bound of the conditional distribution
+  double getUpperBoundOfSecondaryConditionalIndepVar(
+                                 const double primary_indep_var_value ) const;
+
+  //! Return the lower bound of the conditional distribution
+  double getLowerBoundOfSecondaryConditionalIndepVar(
+                                 const double primary_indep_var_value ) const;
+
+  //! Return a random sample from the secondary conditional PDF
+  double sampleSecondaryConditional(
+                        const double primary_indep_var_value ) const override;
+
+  //! Return a random sample from the secondary conditional PDF in the limits
+  double sampleSecondaryConditional(
+            const double primary_indep_var_value,
+            const double min_secondary_indep_var_value,
+            const double max_secondary_indep_var_value ) const override;
+
+  //! Return a random sample from the secondary conditional PDF at the CDF val
+  double sampleSecondaryConditionalWithRandomNumber(
+                             const double primary_indep_var_value,
+                             const double random_number ) const override;
+
+  //! Return a random sample from the secondary conditional PDF at the CDF val
+  double sampleSecondaryConditionalWithRandomNumber(
+            const double primary_indep_var_value,
+            const double random_number,
+            const double min_secondary_indep_var_value,
+            const double max_secondary_indep_var_value ) const override;
+
+  //! Return a sample from the secondary distribution at a primary grid point
+  double sampleSecondaryDistributionWithRandomNumber(
+                                      const size_t primary_grid_index,
+                                      const double random_number ) const;
+
+private:
+
+  // Find the bin boundary indices
+  void findBinBoundaries( const double primary_indep_var_value,
+                          size_t& lower_bin_index,
+                          size_t& upper_bin_index ) const;
+
+  // Sample from the distribution using the desired secondary sampling functor
+  template<typename SampleFunctor>
+  double sampleImpl( const double primary_indep_var_value,
+                     const SampleFunctor& sample_functor ) const;
+
+  // Sample from the distribution in the secondary limits
+  template<typename SampleFunctor>
+  double sampleImpl( const double primary_indep_var_value,
+                     const SampleFunctor& sample_functor,
+                     const double min_secondary_indep_var_value,
+                     const double max_secondary_indep_var_value ) const;
+
+  // The primary grid
+  std::vector<double> d_primary_grid;
+
+  // The secondary data offsets (the data of primary grid point i is in
+  // [d_offsets[i],d_offsets[i+1]))
+  std::vector<size_t> d_offsets;
+
+  // The packed secondary grids
+  std::vector<double> d_secondary_grids;
+
+  // The packed secondary PDFs
+  std::vector<double> d_pdfs;
+
+  // The packed (unnormalized) secondary CDFs
+  std::vector<double> d_cdfs;
+
+  // The packed secondary PDF slopes
+  std::vector<double> d_slopes;
+};
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_PackedTabularBasicBivariateDistribution_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end UTILITY_PACKED_TABULAR_BASIC_BIVARIATE_DISTRIBUTION_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_PackedTabularBasicBivariateDistribution.hpp
+//---------------------------------------------------------------------------//
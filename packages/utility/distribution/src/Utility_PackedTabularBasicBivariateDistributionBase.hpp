@@ -0,0 +1,70 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PackedTabularBasicBivariateDistributionBase.hpp
+//! \author Alex Robinson
+//! \brief  The packed tabular basic bivariate distribution base class decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_PACKED_TABULAR_BASIC_BIVARIATE_DISTRIBUTION_BASE_HPP
+#define UTILITY_PACKED_TABULAR_BASIC_BIVARIATE_DISTRIBUTION_BASE_HPP
+
+namespace Utility{
+
+/*! The packed tabular basic bivariate distribution base class
+ *
+ * \details This is the sampling interface of the
+ * Utility::PackedTabularBasicBivariateDistribution. It allows classes that
+ * are not templated on the TwoDGridPolicy to store a packed distribution.
+ * Only a single virtual call is made per sample.
+ * \ingroup bivariate_distributions
+ */
+class PackedTabularBasicBivariateDistributionBase
+{
+
+public:
+
+  //! Constructor
+  PackedTabularBasicBivariateDistributionBase()
+  { /* ... */ }
+
+  //! Destructor
+  virtual ~PackedTabularBasicBivariateDistributionBase()
+  { /* ... */ }
+
+  //! Return the upper bound of the primary independent variable
+  virtual double getUpperBoundOfPrimaryIndepVar() const = 0;
+
+  //! Return the lower bound of the primary independent variable
+  virtual double getLowerBoundOfPrimaryIndepVar() const = 0;
+
+  //! Return a random sample from the secondary conditional PDF
+  virtual double sampleSecondaryConditional(
+                            const double primary_indep_var_value ) const = 0;
+
+  //! Return a random sample from the secondary conditional PDF in the limits
+  virtual double sampleSecondaryConditional(
+                const double primary_indep_var_value,
+                const double min_secondary_indep_var_value,
+                const double max_secondary_indep_var_value ) const = 0;
+
+  //! Return a random sample from the secondary conditional PDF at the CDF val
+  virtual double sampleSecondaryConditionalWithRandomNumber(
+                                 const double primary_indep_var_value,
+                                 const double random_number ) const = 0;
+
+  //! Return a random sample from the secondary conditional PDF at the CDF val
+  virtual double sampleSecondaryConditionalWithRandomNumber(
+                const double primary_indep_var_value,
+                const double random_number,
+                const double min_secondary_indep_var_value,
+                const double max_secondary_indep_var_value ) const = 0;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_PACKED_TABULAR_BASIC_BIVARIATE_DISTRIBUTION_BASE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_PackedTabularBasicBivariateDistributionBase.hpp
+//---------------------------------------------------------------------------//
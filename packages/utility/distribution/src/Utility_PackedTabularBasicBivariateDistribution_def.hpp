@@ -0,0 +1,822 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PackedTabularBasicBivariateDistribution_def.hpp
+//! \author Alex Robinson
+//! \brief  The packed tabular basic bivariate distribution class def.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_PACKED_TABULAR_BASIC_BIVARIATE_DISTRIBUTION_DEF_HPP
+#define UTILITY_PACKED_TABULAR_BASIC_BIVARIATE_DISTRIBUTION_DEF_HPP
+
+// Std Lib Includes
+#include <algorithm>
+#include <type_traits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Utility_BasicBivariateDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+namespace Details{
+
+//! Calculate the packed intermediate grid lower limit
+template<typename TwoDInterpPolicy, typename Distribution>
+inline double calculatePackedIntermediateGridLowerLimit(
+                                         const Distribution& distribution,
+                                         const double primary_indep_var_value,
+                                         const size_t lower_bin_index )
+{
+  const double lower_primary_value =
+    distribution.getPrimaryGrid()[lower_bin_index];
+  const double upper_primary_value =
+    distribution.getPrimaryGrid()[lower_bin_index+1];
+
+  if( primary_indep_var_value == lower_primary_value )
+    return distribution.getLowerBoundOfSecondaryIndepVar( lower_bin_index );
+  else if( primary_indep_var_value == upper_primary_value )
+    return distribution.getLowerBoundOfSecondaryIndepVar( lower_bin_index+1 );
+  else
+  {
+    return TwoDInterpPolicy::calculateIntermediateGridLimit(
+           lower_primary_value,
+           upper_primary_value,
+           primary_indep_var_value,
+           distribution.getLowerBoundOfSecondaryIndepVar( lower_bin_index ),
+           distribution.getLowerBoundOfSecondaryIndepVar( lower_bin_index+1 ) );
+  }
+}
+
+//! Calculate the packed intermediate grid upper limit
+template<typename TwoDInterpPolicy, typename Distribution>
+inline double calculatePackedIntermediateGridUpperLimit(
+                                         const Distribution& distribution,
+                                         const double primary_indep_var_value,
+                                         const size_t lower_bin_index )
+{
+  const double lower_primary_value =
+    distribution.getPrimaryGrid()[lower_bin_index];
+  const double upper_primary_value =
+    distribution.getPrimaryGrid()[lower_bin_index+1];
+
+  if( primary_indep_var_value == lower_primary_value )
+    return distribution.getUpperBoundOfSecondaryIndepVar( lower_bin_index );
+  else if( primary_indep_var_value == upper_primary_value )
+    return distribution.getUpperBoundOfSecondaryIndepVar( lower_bin_index+1 );
+  else
+  {
+    return TwoDInterpPolicy::calculateIntermediateGridLimit(
+           lower_primary_value,
+           upper_primary_value,
+           primary_indep_var_value,
+           distribution.getUpperBoundOfSecondaryIndepVar( lower_bin_index ),
+           distribution.getUpperBoundOfSecondaryIndepVar( lower_bin_index+1 ) );
+  }
+}
+
+/*! The packed TwoDGridPolicy sampling kernel
+ *
+ * \details The bounds functors return the intermediate secondary limits at a
+ * primary value. They are only called by the kernels that scale the sample.
+ */
+template<typename TwoDGridPolicy>
+struct PackedTwoDGridPolicySamplingKernel;
+
+/*! \brief Partial specialization of the
+ * Utility::Details::PackedTwoDGridPolicySamplingKernel for Utility::UnitBase
+ *
+ * \details This kernel mirrors Utility::UnitBase::sampleDetailed.
+ */
+template<typename TwoDInterpPolicy>
+struct PackedTwoDGridPolicySamplingKernel<Utility::UnitBase<TwoDInterpPolicy> >
+{
+  //! Sample between bin boundaries using the desired sampling functor
+  template<typename Distribution,
+           typename SampleFunctor,
+           typename MinBoundsFunctor,
+           typename MaxBoundsFunctor>
+  static inline double sample(
+                      const Distribution& distribution,
+                      const SampleFunctor& sample_functor,
+                      const MinBoundsFunctor& min_secondary_indep_var_functor,
+                      const MaxBoundsFunctor& max_secondary_indep_var_functor,
+                      const double primary_indep_var_value,
+                      const size_t lower_bin_index )
+  {
+    const double min_secondary_indep_var_value =
+      min_secondary_indep_var_functor( primary_indep_var_value );
+
+    const double max_secondary_indep_var_value =
+      max_secondary_indep_var_functor( primary_indep_var_value );
+
+    // Make sure the secondary limits are valid
+    testPrecondition( max_secondary_indep_var_value >=
+                      min_secondary_indep_var_value );
+
+    // Sample the bin boundary that will be used
+    size_t sampled_bin_index = lower_bin_index;
+
+    {
+      const double processed_lower_primary_value =
+        TwoDInterpPolicy::processFirstIndepVar(
+                              distribution.getPrimaryGrid()[lower_bin_index] );
+
+      const double interpolation_fraction =
+        (TwoDInterpPolicy::processFirstIndepVar( primary_indep_var_value ) -
+         processed_lower_primary_value)/
+        (TwoDInterpPolicy::processFirstIndepVar(
+                         distribution.getPrimaryGrid()[lower_bin_index+1] ) -
+         processed_lower_primary_value);
+
+      if( Utility::RandomNumberGenerator::getRandomNumber<double>() <
+          interpolation_fraction )
+        ++sampled_bin_index;
+    }
+
+    // Calculate the intermediate grid length
+    const double intermediate_grid_length =
+      TwoDInterpPolicy::ZYInterpPolicy::calculateUnitBaseGridLength(
+                                               min_secondary_indep_var_value,
+                                               max_secondary_indep_var_value );
+
+    // Calculate the unit base variable on the sampled bin boundary
+    const double sampled_min_secondary_indep_var_value =
+      distribution.getLowerBoundOfSecondaryIndepVar( sampled_bin_index );
+
+    const double grid_length =
+      TwoDInterpPolicy::ZYInterpPolicy::calculateUnitBaseGridLength(
+        sampled_min_secondary_indep_var_value,
+        distribution.getUpperBoundOfSecondaryIndepVar( sampled_bin_index ) );
+
+    const double eta =
+      TwoDInterpPolicy::ZYInterpPolicy::calculateUnitBaseIndepVar(
+                                      sample_functor( sampled_bin_index ),
+                                      sampled_min_secondary_indep_var_value,
+                                      grid_length );
+
+    // Scale the sample so that it preserves the intermediate limits
+    return TwoDInterpPolicy::ZYInterpPolicy::calculateIndepVar(
+                                                 eta,
+                                                 min_secondary_indep_var_value,
+                                                 intermediate_grid_length );
+  }
+};
+
+/*! \brief Partial specialization of the
+ * Utility::Details::PackedTwoDGridPolicySamplingKernel for Utility::Correlated
+ *
+ * \details This kernel mirrors Utility::Correlated::sampleDetailed.
+ */
+template<typename TwoDInterpPolicy>
+struct PackedTwoDGridPolicySamplingKernel<Utility::Correlated<TwoDInterpPolicy> >
+{
+  //! Sample between bin boundaries using the desired sampling functor
+  template<typename Distribution,
+           typename SampleFunctor,
+           typename MinBoundsFunctor,
+           typename MaxBoundsFunctor>
+  static inline double sample(
+                      const Distribution& distribution,
+                      const SampleFunctor& sample_functor,
+                      const MinBoundsFunctor& min_secondary_indep_var_functor,
+                      const MaxBoundsFunctor& max_secondary_indep_var_functor,
+                      const double primary_indep_var_value,
+                      const size_t lower_bin_index )
+  {
+    const double lower_primary_value =
+      distribution.getPrimaryGrid()[lower_bin_index];
+    const double upper_primary_value =
+      distribution.getPrimaryGrid()[lower_bin_index+1];
+
+    // Check for a primary value on a bin boundary
+    if( primary_indep_var_value == upper_primary_value )
+      return sample_functor( lower_bin_index+1 );
+    else if( primary_indep_var_value == lower_primary_value )
+      return sample_functor( lower_bin_index );
+    else
+    {
+      const double lower_sample = sample_functor( lower_bin_index );
+      const double upper_sample = sample_functor( lower_bin_index+1 );
+
+      // No interpolation is performed when the samples are equal (avoids
+      // log interpolation errors when both samples are zero)
+      if( lower_sample == upper_sample )
+        return lower_sample;
+      else
+      {
+        return TwoDInterpPolicy::YXInterpPolicy::interpolate(
+                                                      lower_primary_value,
+                                                      upper_primary_value,
+                                                      primary_indep_var_value,
+                                                      lower_sample,
+                                                      upper_sample );
+      }
+    }
+  }
+};
+
+/*! \brief Partial specialization of the
+ * Utility::Details::PackedTwoDGridPolicySamplingKernel for
+ * Utility::UnitBaseCorrelated
+ *
+ * \details This kernel mirrors Utility::UnitBaseCorrelated::sampleDetailed.
+ */
+template<typename TwoDInterpPolicy>
+struct PackedTwoDGridPolicySamplingKernel<Utility::UnitBaseCorrelated<TwoDInterpPolicy> >
+{
+  //! Sample between bin boundaries using the desired sampling functor
+  template<typename Distribution,
+           typename SampleFunctor,
+           typename MinBoundsFunctor,
+           typename MaxBoundsFunctor>
+  static inline double sample(
+                      const Distribution& distribution,
+                      const SampleFunctor& sample_functor,
+                      const MinBoundsFunctor& min_secondary_indep_var_functor,
+                      const MaxBoundsFunctor& max_secondary_indep_var_functor,
+                      const double primary_indep_var_value,
+                      const size_t lower_bin_index )
+  {
+    // Check for a primary value on a bin boundary
+    if( primary_indep_var_value ==
+        distribution.getPrimaryGrid()[lower_bin_index+1] )
+      return sample_functor( lower_bin_index+1 );
+    else if( primary_indep_var_value ==
+             distribution.getPrimaryGrid()[lower_bin_index] )
+      return sample_functor( lower_bin_index );
+
+    const double min_secondary_indep_var_value =
+      min_secondary_indep_var_functor( primary_indep_var_value );
+
+    const double max_secondary_indep_var_value =
+      max_secondary_indep_var_functor( primary_indep_var_value );
+
+    // Make sure the secondary limits are valid
+    testPrecondition( max_secondary_indep_var_value >=
+                      min_secondary_indep_var_value );
+
+    if( min_secondary_indep_var_value == max_secondary_indep_var_value )
+      return min_secondary_indep_var_value;
+
+    const double intermediate_grid_length =
+      TwoDInterpPolicy::ZYInterpPolicy::calculateUnitBaseGridLength(
+                                               min_secondary_indep_var_value,
+                                               max_secondary_indep_var_value );
+
+    // Calculate the unit base variables corresponding to the lower and upper
+    // samples
+    double eta_0, eta_1;
+
+    {
+      const double min_secondary_indep_var_value_0 =
+        distribution.getLowerBoundOfSecondaryIndepVar( lower_bin_index );
+
+      const double grid_length_0 =
+        TwoDInterpPolicy::ZYInterpPolicy::calculateUnitBaseGridLength(
+          min_secondary_indep_var_value_0,
+          distribution.getUpperBoundOfSecondaryIndepVar( lower_bin_index ) );
+
+      eta_0 = TwoDInterpPolicy::ZYInterpPolicy::calculateUnitBaseIndepVar(
+                                              sample_functor( lower_bin_index ),
+                                              min_secondary_indep_var_value_0,
+                                              grid_length_0 );
+    }
+
+    {
+      const double min_secondary_indep_var_value_1 =
+        distribution.getLowerBoundOfSecondaryIndepVar( lower_bin_index+1 );
+
+      const double grid_length_1 =
+        TwoDInterpPolicy::ZYInterpPolicy::calculateUnitBaseGridLength(
+          min_secondary_indep_var_value_1,
+          distribution.getUpperBoundOfSecondaryIndepVar( lower_bin_index+1 ) );
+
+      eta_1 = TwoDInterpPolicy::ZYInterpPolicy::calculateUnitBaseIndepVar(
+                                            sample_functor( lower_bin_index+1 ),
+                                            min_secondary_indep_var_value_1,
+                                            grid_length_1 );
+    }
+
+    // Interpolate between the lower and upper unit base variables (both will
+    // be equal when the random number is zero)
+    double eta;
+
+    if( eta_0 == eta_1 )
+      eta = eta_0;
+    else
+    {
+      eta = TwoDInterpPolicy::YXInterpPolicy::interpolate(
+                             distribution.getPrimaryGrid()[lower_bin_index],
+                             distribution.getPrimaryGrid()[lower_bin_index+1],
+                             primary_indep_var_value,
+                             eta_0,
+                             eta_1 );
+    }
+
+    // Scale the sample so that it preserves the intermediate limits
+    return TwoDInterpPolicy::ZYInterpPolicy::calculateIndepVar(
+                                                 eta,
+                                                 min_secondary_indep_var_value,
+                                                 intermediate_grid_length );
+  }
+};
+
+} // end Details namespace
+
+// Constructor
+/*! \details The secondary distributions will be sampled in the same way as
+ * a Utility::TabularDistribution constructed from the secondary grid and
+ * the dependent values (the dependent values do not need to be normalized).
+ */
+template<typename _TwoDGridPolicy>
+PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::PackedTabularBasicBivariateDistribution(
+          const std::vector<double>& primary_indep_grid,
+          const std::vector<std::vector<double> >& secondary_indep_grids,
+          const std::vector<std::vector<double> >& dependent_values )
+  : d_primary_grid( primary_indep_grid ),
+    d_offsets( 1, 0 ),
+    d_secondary_grids(),
+    d_pdfs(),
+    d_cdfs(),
+    d_slopes()
+{
+  TEST_FOR_EXCEPTION( primary_indep_grid.size() < 2,
+                      Utility::BadBivariateDistributionParameter,
+                      "The packed tabular basic bivariate distribution "
+                      "cannot be constructed because the primary grid has "
+                      "fewer than two points!" );
+
+  TEST_FOR_EXCEPTION( !Sort::isSortedAscending( primary_indep_grid.begin(),
+                                                primary_indep_grid.end() ),
+                      Utility::BadBivariateDistributionParameter,
+                      "The packed tabular basic bivariate distribution "
+                      "cannot be constructed because the primary grid is not "
+                      "sorted!" );
+
+  TEST_FOR_EXCEPTION( primary_indep_grid.size() != secondary_indep_grids.size(),
+                      Utility::BadBivariateDistributionParameter,
+                      "The packed tabular basic bivariate distribution "
+                      "cannot be constructed because the number of primary "
+                      "grid points (" << primary_indep_grid.size() << ") does "
+                      "not match the number of secondary indep grids ("
+                      << secondary_indep_grids.size() << ")!" );
+
+  TEST_FOR_EXCEPTION( primary_indep_grid.size() != dependent_values.size(),
+                      Utility::BadBivariateDistributionParameter,
+                      "The packed tabular basic bivariate distribution "
+                      "cannot be constructed because the number of primary "
+                      "grid points (" << primary_indep_grid.size() << ") does "
+                      "not match the number of dependent value grids ("
+                      << dependent_values.size() << ")!" );
+
+  // Calculate the offsets
+  d_offsets.resize( primary_indep_grid.size()+1 );
+
+  for( size_t i = 0; i < primary_indep_grid.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( secondary_indep_grids[i].size() < 2 ||
+                        secondary_indep_grids[i].size() !=
+                        dependent_values[i].size(),
+                        Utility::BadBivariateDistributionParameter,
+                        "The packed tabular basic bivariate distribution "
+                        "cannot be constructed because the secondary data at "
+                        "primary grid index " << i << " is invalid!" );
+
+    TEST_FOR_EXCEPTION( !Sort::isSortedAscending(
+                                           secondary_indep_grids[i].begin(),
+                                           secondary_indep_grids[i].end() ),
+                        Utility::BadBivariateDistributionParameter,
+                        "The packed tabular basic bivariate distribution "
+                        "cannot be constructed because the secondary grid at "
+                        "primary grid index " << i << " is not sorted!" );
+
+    d_offsets[i+1] = d_offsets[i] + secondary_indep_grids[i].size();
+  }
+
+  // Pack the secondary data
+  d_secondary_grids.resize( d_offsets.back() );
+  d_pdfs.resize( d_offsets.back() );
+  d_cdfs.resize( d_offsets.back() );
+  d_slopes.resize( d_offsets.back() );
+
+  for( size_t i = 0; i < primary_indep_grid.size(); ++i )
+  {
+    const size_t offset = d_offsets[i];
+    const size_t size = secondary_indep_grids[i].size();
+
+    double* grid = d_secondary_grids.data() + offset;
+    double* pdf = d_pdfs.data() + offset;
+    double* cdf = d_cdfs.data() + offset;
+    double* slope = d_slopes.data() + offset;
+
+    std::copy( secondary_indep_grids[i].begin(),
+               secondary_indep_grids[i].end(),
+               grid );
+
+    std::copy( dependent_values[i].begin(), dependent_values[i].end(), pdf );
+
+    // The CDF and slopes are calculated in the same way as
+    // Utility::DataProcessor::calculateContinuousCDF and
+    // Utility::DataProcessor::calculateSlopes
+    cdf[0] = 0.0;
+
+    for( size_t j = 1; j < size; ++j )
+    {
+      cdf[j] = cdf[j-1] + pdf[j-1]*(grid[j] - grid[j-1]) +
+        0.5*(pdf[j] - pdf[j-1])*(grid[j] - grid[j-1]);
+
+      slope[j-1] = (pdf[j] - pdf[j-1])/(grid[j] - grid[j-1]);
+    }
+
+    slope[size-1] = 0.0;
+
+    TEST_FOR_EXCEPTION( !(cdf[size-1] > 0.0),
+                        Utility::BadBivariateDistributionParameter,
+                        "The packed tabular basic bivariate distribution "
+                        "cannot be constructed because the secondary PDF at "
+                        "primary grid index " << i << " cannot be "
+                        "normalized!" );
+  }
+}
+
+// Return the number of primary grid points
+template<typename _TwoDGridPolicy>
+inline size_t PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::getNumberOfPrimaryGridPoints() const
+{
+  return d_primary_grid.size();
+}
+
+// Return the primary grid
+template<typename _TwoDGridPolicy>
+inline Utility::ArrayView<const double>
+PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::getPrimaryGrid() const
+{
+  return Utility::arrayViewOfConst( d_primary_grid );
+}
+
+// Return the upper bound of the primary independent variable
+template<typename _TwoDGridPolicy>
+inline double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::getUpperBoundOfPrimaryIndepVar() const
+{
+  return d_primary_grid.back();
+}
+
+// Return the lower bound of the primary independent variable
+template<typename _TwoDGridPolicy>
+inline double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::getLowerBoundOfPrimaryIndepVar() const
+{
+  return d_primary_grid.front();
+}
+
+// Return the secondary grid at a primary grid point
+template<typename _TwoDGridPolicy>
+inline Utility::ArrayView<const double>
+PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::getSecondaryGrid(
+                                       const size_t primary_grid_index ) const
+{
+  // Make sure the primary grid index is valid
+  testPrecondition( primary_grid_index < d_primary_grid.size() );
+
+  return Utility::ArrayView<const double>(
+                d_secondary_grids.data() + d_offsets[primary_grid_index],
+                d_offsets[primary_grid_index+1] - d_offsets[primary_grid_index] );
+}
+
+// Return the secondary PDF at a primary grid point
+template<typename _TwoDGridPolicy>
+inline Utility::ArrayView<const double>
+PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::getSecondaryPDF(
+                                       const size_t primary_grid_index ) const
+{
+  // Make sure the primary grid index is valid
+  testPrecondition( primary_grid_index < d_primary_grid.size() );
+
+  return Utility::ArrayView<const double>(
+                d_pdfs.data() + d_offsets[primary_grid_index],
+                d_offsets[primary_grid_index+1] - d_offsets[primary_grid_index] );
+}
+
+// Return the (unnormalized) secondary CDF at a primary grid point
+template<typename _TwoDGridPolicy>
+inline Utility::ArrayView<const double>
+PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::getSecondaryCDF(
+                                       const size_t primary_grid_index ) const
+{
+  // Make sure the primary grid index is valid
+  testPrecondition( primary_grid_index < d_primary_grid.size() );
+
+  return Utility::ArrayView<const double>(
+                d_cdfs.data() + d_offsets[primary_grid_index],
+                d_offsets[primary_grid_index+1] - d_offsets[primary_grid_index] );
+}
+
+// Return the upper bound of the secondary indep var at a primary grid point
+template<typename _TwoDGridPolicy>
+inline double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::getUpperBoundOfSecondaryIndepVar(
+                                       const size_t primary_grid_index ) const
+{
+  // Make sure the primary grid index is valid
+  testPrecondition( primary_grid_index < d_primary_grid.size() );
+
+  return d_secondary_grids[d_offsets[primary_grid_index+1]-1];
+}
+
+// Return the lower bound of the secondary indep var at a primary grid point
+template<typename _TwoDGridPolicy>
+inline double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::getLowerBoundOfSecondaryIndepVar(
+                                       const size_t primary_grid_index ) const
+{
+  // Make sure the primary grid index is valid
+  testPrecondition( primary_grid_index < d_primary_grid.size() );
+
+  return d_secondary_grids[d_offsets[primary_grid_index]];
+}
+
+// Return the upper bound of the conditional distribution
+/*! \details Zero will be returned if the primary value is outside of the
+ * primary grid limits (the packed distribution cannot be extended).
+ */
+template<typename _TwoDGridPolicy>
+double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::getUpperBoundOfSecondaryConditionalIndepVar(
+                                  const double primary_indep_var_value ) const
+{
+  size_t lower_bin_index, upper_bin_index;
+
+  this->findBinBoundaries( primary_indep_var_value,
+                           lower_bin_index,
+                           upper_bin_index );
+
+  if( lower_bin_index == upper_bin_index )
+    return 0.0;
+  else
+  {
+    return Details::calculatePackedIntermediateGridUpperLimit<TwoDInterpPolicy>(
+                                                      *this,
+                                                      primary_indep_var_value,
+                                                      lower_bin_index );
+  }
+}
+
+// Return the lower bound of the conditional distribution
+/*! \details Zero will be returned if the primary value is outside of the
+ * primary grid limits (the packed distribution cannot be extended).
+ */
+template<typename _TwoDGridPolicy>
+double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::getLowerBoundOfSecondaryConditionalIndepVar(
+                                  const double primary_indep_var_value ) const
+{
+  size_t lower_bin_index, upper_bin_index;
+
+  this->findBinBoundaries( primary_indep_var_value,
+                           lower_bin_index,
+                           upper_bin_index );
+
+  if( lower_bin_index == upper_bin_index )
+    return 0.0;
+  else
+  {
+    return Details::calculatePackedIntermediateGridLowerLimit<TwoDInterpPolicy>(
+                                                      *this,
+                                                      primary_indep_var_value,
+                                                      lower_bin_index );
+  }
+}
+
+// Return a random sample from the secondary conditional PDF
+/*! \details If the primary value provided is outside of the primary grid
+ * limits the appropriate limiting secondary distribution will be used to
+ * create the sample. The random numbers are requested in the same order as
+ * Utility::InterpolatedFullyTabularBasicBivariateDistribution.
+ */
+template<typename _TwoDGridPolicy>
+inline double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::sampleSecondaryConditional(
+                                  const double primary_indep_var_value ) const
+{
+  if( std::is_same<TwoDGridPolicy,UnitBase<TwoDInterpPolicy> >::value )
+  {
+    return this->sampleImpl( primary_indep_var_value,
+                             [this]( const size_t primary_grid_index ){
+                               return this->sampleSecondaryDistributionWithRandomNumber( primary_grid_index, Utility::RandomNumberGenerator::getRandomNumber<double>() ); } );
+  }
+  else
+  {
+    return this->sampleSecondaryConditionalWithRandomNumber(
+                    primary_indep_var_value,
+                    Utility::RandomNumberGenerator::getRandomNumber<double>() );
+  }
+}
+
+// Return a random sample from the secondary conditional PDF at the CDF val
+/*! \details With the Utility::UnitBase grid policy an additional random
+ * number will be used to select the bin boundary that is sampled.
+ */
+template<typename _TwoDGridPolicy>
+inline double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::sampleSecondaryConditionalWithRandomNumber(
+                                      const double primary_indep_var_value,
+                                      const double random_number ) const
+{
+  return this->sampleImpl( primary_indep_var_value,
+                           [this,random_number]( const size_t primary_grid_index ){
+                             return this->sampleSecondaryDistributionWithRandomNumber( primary_grid_index, random_number ); } );
+}
+
+// Return a random sample from the secondary conditional PDF in the limits
+/*! \details The secondary limits replace the intermediate grid limits that
+ * would be calculated from the secondary grids. This mirrors the
+ * Utility::InterpolatedFullyTabularBasicBivariateDistribution sampling
+ * methods that take the secondary limit functors.
+ */
+template<typename _TwoDGridPolicy>
+inline double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::sampleSecondaryConditional(
+                            const double primary_indep_var_value,
+                            const double min_secondary_indep_var_value,
+                            const double max_secondary_indep_var_value ) const
+{
+  if( std::is_same<TwoDGridPolicy,UnitBase<TwoDInterpPolicy> >::value )
+  {
+    return this->sampleImpl( primary_indep_var_value,
+                             [this]( const size_t primary_grid_index ){
+                               return this->sampleSecondaryDistributionWithRandomNumber( primary_grid_index, Utility::RandomNumberGenerator::getRandomNumber<double>() ); },
+                             min_secondary_indep_var_value,
+                             max_secondary_indep_var_value );
+  }
+  else
+  {
+    return this->sampleSecondaryConditionalWithRandomNumber(
+                    primary_indep_var_value,
+                    Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                    min_secondary_indep_var_value,
+                    max_secondary_indep_var_value );
+  }
+}
+
+// Return a random sample from the secondary conditional PDF at the CDF val
+/*! \details The secondary limits replace the intermediate grid limits that
+ * would be calculated from the secondary grids.
+ */
+template<typename _TwoDGridPolicy>
+inline double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::sampleSecondaryConditionalWithRandomNumber(
+                            const double primary_indep_var_value,
+                            const double random_number,
+                            const double min_secondary_indep_var_value,
+                            const double max_secondary_indep_var_value ) const
+{
+  return this->sampleImpl( primary_indep_var_value,
+                           [this,random_number]( const size_t primary_grid_index ){
+                             return this->sampleSecondaryDistributionWithRandomNumber( primary_grid_index, random_number ); },
+                           min_secondary_indep_var_value,
+                           max_secondary_indep_var_value );
+}
+
+// Return a sample from the secondary distribution at a primary grid point
+/*! \details This mirrors Utility::TabularDistribution::sampleWithRandomNumber
+ * (lin-lin sampling of the tabulated PDF).
+ */
+template<typename _TwoDGridPolicy>
+inline double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::sampleSecondaryDistributionWithRandomNumber(
+                                           const size_t primary_grid_index,
+                                           const double random_number ) const
+{
+  // Make sure the primary grid index is valid
+  testPrecondition( primary_grid_index < d_primary_grid.size() );
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number <= 1.0 );
+
+  const double* cdf_start = d_cdfs.data() + d_offsets[primary_grid_index];
+  const double* cdf_end = d_cdfs.data() + d_offsets[primary_grid_index+1];
+
+  // Scale the random number
+  const double scaled_random_number = random_number*(*(cdf_end-1));
+
+  const size_t bin_index = d_offsets[primary_grid_index] +
+    std::distance( cdf_start, Search::binaryLowerBound( cdf_start,
+                                                        cdf_end,
+                                                        scaled_random_number ) );
+
+  const double cdf_diff = scaled_random_number - d_cdfs[bin_index];
+  const double pdf_value = d_pdfs[bin_index];
+  const double slope = d_slopes[bin_index];
+
+  // x = x0 + [sqrt(pdf(x0)^2 + 2m[cdf(x)-cdf(x0)]) - pdf(x0)]/m
+  if( slope != 0.0 )
+  {
+    return d_secondary_grids[bin_index] +
+      (std::sqrt( pdf_value*pdf_value + 2.0*slope*cdf_diff ) - pdf_value)/slope;
+  }
+  // x = x0 + [cdf(x)-cdf(x0)]/pdf(x0) => L'Hopital's rule
+  else
+    return d_secondary_grids[bin_index] + cdf_diff/pdf_value;
+}
+
+// Find the bin boundary indices
+/*! \details The lower and upper boundary indices will only be equal when the
+ * primary_independent_var_value is outside of the primary grid limits.
+ */
+template<typename _TwoDGridPolicy>
+inline void PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::findBinBoundaries(
+                                         const double primary_indep_var_value,
+                                         size_t& lower_bin_index,
+                                         size_t& upper_bin_index ) const
+{
+  if( primary_indep_var_value < d_primary_grid.front() )
+  {
+    lower_bin_index = 0;
+    upper_bin_index = 0;
+  }
+  else if( primary_indep_var_value > d_primary_grid.back() )
+  {
+    lower_bin_index = d_primary_grid.size()-1;
+    upper_bin_index = lower_bin_index;
+  }
+  else if( primary_indep_var_value == d_primary_grid.back() )
+  {
+    upper_bin_index = d_primary_grid.size()-1;
+    lower_bin_index = upper_bin_index-1;
+  }
+  else
+  {
+    lower_bin_index = std::distance(
+                  d_primary_grid.begin(),
+                  Search::binaryLowerBound( d_primary_grid.begin(),
+                                            d_primary_grid.end(),
+                                            primary_indep_var_value ) );
+    upper_bin_index = lower_bin_index+1;
+  }
+}
+
+// Sample from the distribution using the desired secondary sampling functor
+template<typename _TwoDGridPolicy>
+template<typename SampleFunctor>
+inline double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::sampleImpl(
+                                    const double primary_indep_var_value,
+                                    const SampleFunctor& sample_functor ) const
+{
+  size_t lower_bin_index, upper_bin_index;
+
+  this->findBinBoundaries( primary_indep_var_value,
+                           lower_bin_index,
+                           upper_bin_index );
+
+  if( lower_bin_index != upper_bin_index )
+  {
+    return Details::PackedTwoDGridPolicySamplingKernel<TwoDGridPolicy>::sample(
+        *this,
+        sample_functor,
+        [this,lower_bin_index]( const double primary_value ){
+          return Details::calculatePackedIntermediateGridLowerLimit<TwoDInterpPolicy>( *this, primary_value, lower_bin_index ); },
+        [this,lower_bin_index]( const double primary_value ){
+          return Details::calculatePackedIntermediateGridUpperLimit<TwoDInterpPolicy>( *this, primary_value, lower_bin_index ); },
+        primary_indep_var_value,
+        lower_bin_index );
+  }
+  // Primary value is outside of the primary grid limits
+  else
+    return sample_functor( lower_bin_index );
+}
+
+// Sample from the distribution in the secondary limits
+template<typename _TwoDGridPolicy>
+template<typename SampleFunctor>
+inline double PackedTabularBasicBivariateDistribution<_TwoDGridPolicy>::sampleImpl(
+                            const double primary_indep_var_value,
+                            const SampleFunctor& sample_functor,
+                            const double min_secondary_indep_var_value,
+                            const double max_secondary_indep_var_value ) const
+{
+  size_t lower_bin_index, upper_bin_index;
+
+  this->findBinBoundaries( primary_indep_var_value,
+                           lower_bin_index,
+                           upper_bin_index );
+
+  if( lower_bin_index != upper_bin_index )
+  {
+    return Details::PackedTwoDGridPolicySamplingKernel<TwoDGridPolicy>::sample(
+        *this,
+        sample_functor,
+        [min_secondary_indep_var_value]( const double ){
+          return min_secondary_indep_var_value; },
+        [max_secondary_indep_var_value]( const double ){
+          return max_secondary_indep_var_value; },
+        primary_indep_var_value,
+        lower_bin_index );
+  }
+  // Primary value is outside of the primary grid limits
+  else
+    return sample_functor( lower_bin_index );
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_PACKED_TABULAR_BASIC_BIVARIATE_DISTRIBUTION_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_PackedTabularBasicBivariateDistribution_def.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,341 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPackedTabularBasicBivariateDistribution.cpp
+//! \author Alex Robinson
+//! \brief  The packed tabular basic bivariate distribution unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <functional>
+
+// FRENSIE Includes
+#include "Utility_PackedTabularBasicBivariateDistribution.hpp"
+#include "Utility_InterpolatedFullyTabularBasicBivariateDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef std::tuple<Utility::UnitBase<Utility::LinLinLin>,
+                   Utility::Correlated<Utility::LinLinLin>,
+                   Utility::UnitBaseCorrelated<Utility::LinLinLin>,
+                   Utility::UnitBase<Utility::LogLogLog>,
+                   Utility::Correlated<Utility::LogLogLog>,
+                   Utility::UnitBaseCorrelated<Utility::LogLogLog>
+                  > TestTwoDGridPolicies;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::vector<double> primary_grid( {1.0, 2.0, 4.0} );
+
+std::vector<std::vector<double> > secondary_grids( {{1.0, 10.0},
+                                                    {2.5, 5.0, 7.5},
+                                                    {1.0, 10.0}} );
+
+std::vector<std::vector<double> > dependent_values( {{0.1, 0.1},
+                                                     {0.1, 1.0, 0.5},
+                                                     {1.0, 1.0}} );
+
+std::vector<double> primary_values( {0.5, 1.0, 1.5, 2.0, 3.0, 4.0, 5.0} );
+
+std::vector<double> random_numbers( {0.0, 0.25, 0.5, 0.75, 1.0-1e-15} );
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the packed data can be returned
+FRENSIE_UNIT_TEST_TEMPLATE( PackedTabularBasicBivariateDistribution,
+                            getPackedData,
+                            TestTwoDGridPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, TwoDGridPolicy );
+
+  Utility::PackedTabularBasicBivariateDistribution<TwoDGridPolicy>
+    distribution( primary_grid, secondary_grids, dependent_values );
+
+  FRENSIE_CHECK_EQUAL( distribution.getNumberOfPrimaryGridPoints(), 3 );
+  FRENSIE_CHECK_EQUAL( distribution.getPrimaryGrid(), primary_grid );
+  FRENSIE_CHECK_EQUAL( distribution.getLowerBoundOfPrimaryIndepVar(), 1.0 );
+  FRENSIE_CHECK_EQUAL( distribution.getUpperBoundOfPrimaryIndepVar(), 4.0 );
+
+  FRENSIE_CHECK_EQUAL( distribution.getSecondaryGrid( 1 ),
+                       secondary_grids[1] );
+  FRENSIE_CHECK_EQUAL( distribution.getSecondaryPDF( 1 ),
+                       dependent_values[1] );
+  FRENSIE_CHECK_FLOATING_EQUALITY( distribution.getSecondaryCDF( 1 ),
+                                   std::vector<double>( {0.0, 1.375, 3.25} ),
+                                   1e-15 );
+
+  FRENSIE_CHECK_EQUAL( distribution.getLowerBoundOfSecondaryIndepVar( 1 ), 2.5 );
+  FRENSIE_CHECK_EQUAL( distribution.getUpperBoundOfSecondaryIndepVar( 1 ), 7.5 );
+  FRENSIE_CHECK_EQUAL( distribution.getSecondaryGrid( 2 ),
+                       secondary_grids[2] );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid data will be rejected
+FRENSIE_UNIT_TEST( PackedTabularBasicBivariateDistribution, constructor_bad )
+{
+  typedef Utility::PackedTabularBasicBivariateDistribution<Utility::Correlated<Utility::LinLinLin> > DistributionType;
+
+  // Unsorted primary grid
+  FRENSIE_CHECK_THROW( DistributionType( std::vector<double>( {2.0, 1.0, 4.0} ),
+                                         secondary_grids,
+                                         dependent_values ),
+                       Utility::BadBivariateDistributionParameter );
+
+  // Missing secondary grid
+  FRENSIE_CHECK_THROW( DistributionType( std::vector<double>( {1.0, 2.0} ),
+                                         secondary_grids,
+                                         dependent_values ),
+                       Utility::BadBivariateDistributionParameter );
+
+  // Secondary grid and dependent values mismatch
+  std::vector<std::vector<double> > bad_dependent_values = dependent_values;
+  bad_dependent_values[1].pop_back();
+
+  FRENSIE_CHECK_THROW( DistributionType( primary_grid,
+                                         secondary_grids,
+                                         bad_dependent_values ),
+                       Utility::BadBivariateDistributionParameter );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the conditional bounds match the interpolated distribution
+FRENSIE_UNIT_TEST_TEMPLATE( PackedTabularBasicBivariateDistribution,
+                            getBoundsOfSecondaryConditionalIndepVar,
+                            TestTwoDGridPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, TwoDGridPolicy );
+
+  Utility::PackedTabularBasicBivariateDistribution<TwoDGridPolicy>
+    distribution( primary_grid, secondary_grids, dependent_values );
+
+  Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy>
+    reference_distribution( primary_grid, secondary_grids, dependent_values );
+
+  for( double primary_value : primary_values )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+           distribution.getLowerBoundOfSecondaryConditionalIndepVar( primary_value ),
+           reference_distribution.getLowerBoundOfSecondaryConditionalIndepVar( primary_value ),
+           1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+           distribution.getUpperBoundOfSecondaryConditionalIndepVar( primary_value ),
+           reference_distribution.getUpperBoundOfSecondaryConditionalIndepVar( primary_value ),
+           1e-15 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the secondary distributions can be sampled
+FRENSIE_UNIT_TEST( PackedTabularBasicBivariateDistribution,
+                   sampleSecondaryDistributionWithRandomNumber )
+{
+  Utility::PackedTabularBasicBivariateDistribution<Utility::Correlated<Utility::LinLinLin> >
+    distribution( primary_grid, secondary_grids, dependent_values );
+
+  for( size_t i = 0; i < primary_grid.size(); ++i )
+  {
+    Utility::TabularDistribution<Utility::LinLin>
+      reference_distribution( secondary_grids[i], dependent_values[i] );
+
+    for( double random_number : random_numbers )
+    {
+      FRENSIE_CHECK_FLOATING_EQUALITY(
+         distribution.sampleSecondaryDistributionWithRandomNumber( i, random_number ),
+         reference_distribution.sampleWithRandomNumber( random_number ),
+         1e-15 );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the samples match the interpolated distribution samples
+FRENSIE_UNIT_TEST_TEMPLATE( PackedTabularBasicBivariateDistribution,
+                            sampleSecondaryConditionalWithRandomNumber,
+                            TestTwoDGridPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, TwoDGridPolicy );
+
+  Utility::PackedTabularBasicBivariateDistribution<TwoDGridPolicy>
+    distribution( primary_grid, secondary_grids, dependent_values );
+
+  Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy>
+    reference_distribution( primary_grid, secondary_grids, dependent_values );
+
+  // The packed distribution always samples the limiting secondary
+  // distributions beyond the primary grid
+  reference_distribution.extendBeyondPrimaryIndepLimits();
+
+  // The unit-base policy uses a random number to select the bin boundary
+  std::vector<double> fake_stream( {0.1, 0.9} );
+
+  for( double primary_value : primary_values )
+  {
+    for( double random_number : random_numbers )
+    {
+      Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+      double reference_sample = reference_distribution.sampleSecondaryConditionalWithRandomNumber( primary_value, random_number );
+      double reference_sample_2 = reference_distribution.sampleSecondaryConditionalWithRandomNumber( primary_value, random_number );
+
+      Utility::RandomNumberGenerator::unsetFakeStream();
+
+      Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+      FRENSIE_CHECK_FLOATING_EQUALITY( distribution.sampleSecondaryConditionalWithRandomNumber( primary_value, random_number ),
+                                       reference_sample,
+                                       1e-15 );
+      FRENSIE_CHECK_FLOATING_EQUALITY( distribution.sampleSecondaryConditionalWithRandomNumber( primary_value, random_number ),
+                                       reference_sample_2,
+                                       1e-15 );
+
+      Utility::RandomNumberGenerator::unsetFakeStream();
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the samples match the interpolated distribution samples
+FRENSIE_UNIT_TEST_TEMPLATE( PackedTabularBasicBivariateDistribution,
+                            sampleSecondaryConditional,
+                            TestTwoDGridPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, TwoDGridPolicy );
+
+  Utility::PackedTabularBasicBivariateDistribution<TwoDGridPolicy>
+    distribution( primary_grid, secondary_grids, dependent_values );
+
+  Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy>
+    reference_distribution( primary_grid, secondary_grids, dependent_values );
+
+  // The packed distribution always samples the limiting secondary
+  // distributions beyond the primary grid
+  reference_distribution.extendBeyondPrimaryIndepLimits();
+
+  std::vector<double> fake_stream( {0.1, 0.0, 0.9, 0.5, 0.4, 1.0-1e-15} );
+
+  for( double primary_value : primary_values )
+  {
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    std::vector<double> reference_samples( 3 );
+
+    for( size_t i = 0; i < reference_samples.size(); ++i )
+    {
+      reference_samples[i] =
+        reference_distribution.sampleSecondaryConditional( primary_value );
+    }
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    for( size_t i = 0; i < reference_samples.size(); ++i )
+    {
+      FRENSIE_CHECK_FLOATING_EQUALITY(
+                   distribution.sampleSecondaryConditional( primary_value ),
+                   reference_samples[i],
+                   1e-15 );
+    }
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the samples in the secondary limits match the interpolated
+// distribution samples
+FRENSIE_UNIT_TEST_TEMPLATE( PackedTabularBasicBivariateDistribution,
+                            sampleSecondaryConditional_limits,
+                            TestTwoDGridPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, TwoDGridPolicy );
+
+  Utility::PackedTabularBasicBivariateDistribution<TwoDGridPolicy>
+    distribution( primary_grid, secondary_grids, dependent_values );
+
+  Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy>
+    reference_distribution( primary_grid, secondary_grids, dependent_values );
+
+  // The limits used by the bremsstrahlung distribution
+  std::function<double(double)> min_functor =
+    []( const double ){ return 1e-3; };
+  std::function<double(double)> max_functor =
+    []( const double primary_value ){ return 3.0*primary_value; };
+
+  std::vector<double> fake_stream( {0.1, 0.0, 0.9, 0.5, 0.4, 1.0-1e-15} );
+
+  for( double primary_value : {1.0, 1.5, 2.0, 3.0, 4.0} )
+  {
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    std::vector<double> reference_samples( 3 );
+
+    for( size_t i = 0; i < reference_samples.size(); ++i )
+    {
+      reference_samples[i] =
+        reference_distribution.sampleSecondaryConditional( primary_value,
+                                                           min_functor,
+                                                           max_functor );
+    }
+
+    double reference_sample =
+      reference_distribution.sampleSecondaryConditionalWithRandomNumber(
+                                                                primary_value,
+                                                                0.25,
+                                                                min_functor,
+                                                                max_functor );
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    for( size_t i = 0; i < reference_samples.size(); ++i )
+    {
+      FRENSIE_CHECK_FLOATING_EQUALITY(
+                   distribution.sampleSecondaryConditional(
+                                                 primary_value,
+                                                 min_functor( primary_value ),
+                                                 max_functor( primary_value ) ),
+                   reference_samples[i],
+                   1e-15 );
+    }
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                   distribution.sampleSecondaryConditionalWithRandomNumber(
+                                                 primary_value,
+                                                 0.25,
+                                                 min_functor( primary_value ),
+                                                 max_functor( primary_value ) ),
+                   reference_sample,
+                   1e-15 );
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstPackedTabularBasicBivariateDistribution.cpp
+//---------------------------------------------------------------------------//
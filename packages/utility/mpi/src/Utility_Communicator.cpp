@@ -80,6 +80,12 @@ public:
   std::shared_ptr<const Communicator> split( int color, int key ) const override
   { return s_null_comm; }
 
+  /*! \brief Split the communicator into disjoint communicators each of
+   * which contains the processes that can share memory
+   */
+  std::shared_ptr<const Communicator> splitByNode() const override
+  { return s_null_comm; }
+
   //! Create a timer
   std::shared_ptr<Timer> createTimer() const override
   { return OpenMPProperties::createTimer(); }
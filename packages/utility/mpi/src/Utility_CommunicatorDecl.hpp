@@ -181,6 +181,12 @@ public:
    */
   virtual std::shared_ptr<const Communicator> split( int color, int key ) const = 0;
 
+  /*! \brief Split the communicator into disjoint communicators each of
+   * which contains the processes that can share memory (i.e. the processes
+   * on a node)
+   */
+  virtual std::shared_ptr<const Communicator> splitByNode() const = 0;
+
   //! Create a timer
   virtual std::shared_ptr<Timer> createTimer() const = 0;
 
@@ -9,6 +9,7 @@
 // FRENSIE Includes
 #include "Utility_MPICommunicator.hpp"
 #include "Utility_GlobalMPISession.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 
 namespace Utility{
 
@@ -139,6 +140,36 @@ MPICommunicator::split( int MPI_ENABLED_PARAMETER(color),
 #endif // end HAVE_FRENSIE_MPI
 }
 
+// Split the communicator into disjoint communicators each of which contains
+// the processes that can share memory
+/*! \details The MPI-3 shared memory split type is used. The rank ordering
+ * of the original communicator is preserved in each node communicator.
+ */
+std::shared_ptr<const Communicator> MPICommunicator::splitByNode() const
+{
+#ifdef HAVE_FRENSIE_MPI
+  MPI_Comm raw_node_comm;
+
+  int return_value = MPI_Comm_split_type( (MPI_Comm)d_comm,
+                                          MPI_COMM_TYPE_SHARED,
+                                          d_comm.rank(),
+                                          MPI_INFO_NULL,
+                                          &raw_node_comm );
+
+  TEST_FOR_EXCEPTION( return_value != MPI_SUCCESS,
+                      std::runtime_error,
+                      "Unable to split the communicator by node (MPI error "
+                      "code " << return_value << ")!" );
+
+  boost::mpi::communicator node_comm( raw_node_comm,
+                                      boost::mpi::comm_take_ownership );
+
+  return std::shared_ptr<const Communicator>( new MPICommunicator( node_comm ) );
+#else
+  return Communicator::getNull();
+#endif // end HAVE_FRENSIE_MPI
+}
+
 // Create a timer
 std::shared_ptr<Timer> MPICommunicator::createTimer() const
 {
@@ -73,6 +73,11 @@ public:
    */
   std::shared_ptr<const Communicator> split( int color, int key ) const override;
 
+  /*! \brief Split the communicator into disjoint communicators each of
+   * which contains the processes that can share memory
+   */
+  std::shared_ptr<const Communicator> splitByNode() const override;
+
   //! Create a timer
   std::shared_ptr<Timer> createTimer() const override;
 
@@ -208,6 +213,9 @@ private:
   //! The communicator base class is a friend
   friend class Communicator;
 
+  //! The node shared memory window class is a friend
+  friend class NodeSharedMemoryWindow;
+
   // Constructor
   MPICommunicator();
 
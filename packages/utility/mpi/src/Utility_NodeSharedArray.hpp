@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_NodeSharedArray.hpp
+//! \author Alex Robinson
+//! \brief  The node shared array class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_NODE_SHARED_ARRAY_HPP
+#define UTILITY_NODE_SHARED_ARRAY_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+#include <functional>
+#include <type_traits>
+
+// FRENSIE Includes
+#include "Utility_NodeSharedMemoryWindow.hpp"
+#include "Utility_ArrayView.hpp"
+
+namespace Utility{
+
+/*! The node shared array class
+ *
+ * An immutable array that is built once per node by the node root process
+ * and that every other process on the node reads directly (no copy is made).
+ * This can be used to store large read-only tables (e.g. cross sections)
+ * once per node instead of once per process. Only trivially copyable types
+ * can be stored. The constructors are collective operations over the node
+ * communicator (see Utility::Communicator::splitByNode).
+ *  \ingroup mpi
+ */
+template<typename T>
+class NodeSharedArray
+{
+  // Only trivially copyable types can be placed in shared memory
+  static_assert( std::is_trivially_copyable<T>::value,
+                 "Only trivially copyable types can be stored in a node "
+                 "shared array!" );
+
+public:
+
+  //! The value type
+  typedef T value_type;
+
+  //! The const iterator type
+  typedef const T* const_iterator;
+
+  //! The fill function type
+  typedef std::function<void(T*,size_t)> FillFunction;
+
+  //! Constructor (only the node root values will be used)
+  NodeSharedArray( const std::shared_ptr<const Communicator>& node_comm,
+                   const std::vector<T>& node_root_values );
+
+  //! Constructor (only the node root will call the fill function)
+  NodeSharedArray( const std::shared_ptr<const Communicator>& node_comm,
+                   const size_t size,
+                   const FillFunction& node_root_fill_function );
+
+  //! Destructor
+  ~NodeSharedArray()
+  { /* ... */ }
+
+  //! Check if the array is shared by multiple processes
+  bool isShared() const;
+
+  //! Get the size of the array
+  size_t size() const;
+
+  //! Check if the array is empty
+  bool empty() const;
+
+  //! Get the array data
+  const T* data() const;
+
+  //! Get an element of the array
+  const T& operator[]( const size_t index ) const;
+
+  //! Get an iterator to the beginning of the array
+  const_iterator begin() const;
+
+  //! Get an iterator to the end of the array
+  const_iterator end() const;
+
+  //! Get a view of the array
+  Utility::ArrayView<const T> view() const;
+
+private:
+
+  // Fill the array (only called by the node root)
+  void fill( const std::shared_ptr<const Communicator>& node_comm,
+             const FillFunction& node_root_fill_function );
+
+  // The node shared memory window
+  std::unique_ptr<NodeSharedMemoryWindow> d_window;
+
+  // The number of elements
+  size_t d_size;
+};
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_NodeSharedArray_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end UTILITY_NODE_SHARED_ARRAY_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_NodeSharedArray.hpp
+//---------------------------------------------------------------------------//
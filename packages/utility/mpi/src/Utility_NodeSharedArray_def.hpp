@@ -0,0 +1,147 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_NodeSharedArray_def.hpp
+//! \author Alex Robinson
+//! \brief  The node shared array class template definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_NODE_SHARED_ARRAY_DEF_HPP
+#define UTILITY_NODE_SHARED_ARRAY_DEF_HPP
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Constructor (only the node root values will be used)
+/*! \details The values passed in by processes other than the node root are
+ * ignored (an empty vector can be passed in).
+ */
+template<typename T>
+NodeSharedArray<T>::NodeSharedArray(
+                         const std::shared_ptr<const Communicator>& node_comm,
+                         const std::vector<T>& node_root_values )
+  : d_window(),
+    d_size( node_root_values.size() )
+{
+  // Make sure that the node communicator is valid
+  testPrecondition( node_comm.get() );
+  testPrecondition( node_comm->isValid() );
+
+  this->fill( node_comm,
+              [&node_root_values]( T* values, size_t size ){
+                std::copy( node_root_values.begin(),
+                           node_root_values.begin()+size,
+                           values ); } );
+}
+
+// Constructor (only the node root will call the fill function)
+/*! \details The size passed in by processes other than the node root is
+ * ignored. The fill function will be passed the address of the shared array
+ * and its size.
+ */
+template<typename T>
+NodeSharedArray<T>::NodeSharedArray(
+                         const std::shared_ptr<const Communicator>& node_comm,
+                         const size_t size,
+                         const FillFunction& node_root_fill_function )
+  : d_window(),
+    d_size( size )
+{
+  // Make sure that the node communicator is valid
+  testPrecondition( node_comm.get() );
+  testPrecondition( node_comm->isValid() );
+
+  this->fill( node_comm, node_root_fill_function );
+}
+
+// Fill the array (only called by the node root)
+template<typename T>
+void NodeSharedArray<T>::fill(
+                         const std::shared_ptr<const Communicator>& node_comm,
+                         const FillFunction& node_root_fill_function )
+{
+  d_window.reset( new NodeSharedMemoryWindow( node_comm, d_size*sizeof(T) ) );
+
+  d_size = d_window->getNumberOfBytes()/sizeof(T);
+
+  if( d_window->isNodeRoot() )
+  {
+    node_root_fill_function( static_cast<T*>( d_window->getBaseAddress() ),
+                             d_size );
+  }
+
+  // Wait for the node root to finish filling the array
+  d_window->synchronize();
+}
+
+// Check if the array is shared by multiple processes
+template<typename T>
+inline bool NodeSharedArray<T>::isShared() const
+{
+  return d_window->isShared();
+}
+
+// Get the size of the array
+template<typename T>
+inline size_t NodeSharedArray<T>::size() const
+{
+  return d_size;
+}
+
+// Check if the array is empty
+template<typename T>
+inline bool NodeSharedArray<T>::empty() const
+{
+  return d_size == 0;
+}
+
+// Get the array data
+template<typename T>
+inline const T* NodeSharedArray<T>::data() const
+{
+  return static_cast<const T*>( d_window->getBaseAddress() );
+}
+
+// Get an element of the array
+template<typename T>
+inline const T& NodeSharedArray<T>::operator[]( const size_t index ) const
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_size );
+
+  return this->data()[index];
+}
+
+// Get an iterator to the beginning of the array
+template<typename T>
+inline auto NodeSharedArray<T>::begin() const -> const_iterator
+{
+  return this->data();
+}
+
+// Get an iterator to the end of the array
+template<typename T>
+inline auto NodeSharedArray<T>::end() const -> const_iterator
+{
+  return this->data() + d_size;
+}
+
+// Get a view of the array
+template<typename T>
+inline Utility::ArrayView<const T> NodeSharedArray<T>::view() const
+{
+  return Utility::ArrayView<const T>( this->begin(), this->end() );
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_NODE_SHARED_ARRAY_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_NodeSharedArray_def.hpp
+//---------------------------------------------------------------------------//
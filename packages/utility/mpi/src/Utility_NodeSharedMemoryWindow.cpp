@@ -0,0 +1,169 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_NodeSharedMemoryWindow.cpp
+//! \author Alex Robinson
+//! \brief  The node shared memory window class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "Utility_NodeSharedMemoryWindow.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Constructor
+/*! \details Only the number of bytes requested by the node root process
+ * (rank 0 of the node communicator) will be used. When an mpi node
+ * communicator is used an MPI-3 shared memory window will be created. The
+ * memory will be allocated by the node root process and the other processes
+ * will attach to it.
+ */
+NodeSharedMemoryWindow::NodeSharedMemoryWindow(
+                          const std::shared_ptr<const Communicator>& node_comm,
+                          const size_t number_of_bytes )
+  : d_node_comm( node_comm ),
+    d_number_of_bytes( number_of_bytes ),
+    d_base_address( NULL ),
+    d_shared( false ),
+    d_local_memory()
+{
+  // Make sure that the node communicator is valid
+  testPrecondition( node_comm.get() );
+  testPrecondition( node_comm->isValid() );
+
+  // Only the size requested by the node root is used
+  Utility::broadcast( *d_node_comm, d_number_of_bytes, 0 );
+
+#ifdef HAVE_FRENSIE_MPI
+  d_window = MPI_WIN_NULL;
+
+  const MPICommunicator* mpi_node_comm =
+    dynamic_cast<const MPICommunicator*>( d_node_comm.get() );
+
+  if( mpi_node_comm )
+  {
+    MPI_Aint local_number_of_bytes =
+      (d_node_comm->rank() == 0 ? d_number_of_bytes : 0);
+
+    int return_value =
+      MPI_Win_allocate_shared( local_number_of_bytes,
+                               1,
+                               MPI_INFO_NULL,
+                               (MPI_Comm)mpi_node_comm->d_comm,
+                               &d_base_address,
+                               &d_window );
+
+    TEST_FOR_EXCEPTION( return_value != MPI_SUCCESS,
+                        std::runtime_error,
+                        "Unable to allocate a node shared memory window of "
+                        << d_number_of_bytes << " bytes (MPI error code "
+                        << return_value << ")!" );
+
+    // Attach to the memory allocated by the node root
+    MPI_Aint root_number_of_bytes;
+    int root_displacement_unit;
+
+    return_value = MPI_Win_shared_query( d_window,
+                                         0,
+                                         &root_number_of_bytes,
+                                         &root_displacement_unit,
+                                         &d_base_address );
+
+    TEST_FOR_EXCEPTION( return_value != MPI_SUCCESS,
+                        std::runtime_error,
+                        "Unable to attach to the node shared memory window "
+                        "(MPI error code " << return_value << ")!" );
+
+    // Start a passive target epoch for the lifetime of the window
+    MPI_Win_lock_all( MPI_MODE_NOCHECK, d_window );
+
+    d_shared = (d_node_comm->size() > 1);
+
+    return;
+  }
+#endif // end HAVE_FRENSIE_MPI
+
+  d_local_memory.resize( d_number_of_bytes );
+
+  d_base_address = d_local_memory.data();
+}
+
+// Destructor
+NodeSharedMemoryWindow::~NodeSharedMemoryWindow()
+{
+#ifdef HAVE_FRENSIE_MPI
+  if( d_window != MPI_WIN_NULL )
+  {
+    MPI_Win_unlock_all( d_window );
+    MPI_Win_free( &d_window );
+  }
+#endif // end HAVE_FRENSIE_MPI
+}
+
+// Get the node communicator
+const Communicator& NodeSharedMemoryWindow::getNodeCommunicator() const
+{
+  return *d_node_comm;
+}
+
+// Check if this process is the node root process
+bool NodeSharedMemoryWindow::isNodeRoot() const
+{
+  return d_node_comm->rank() == 0;
+}
+
+// Check if the memory is shared by multiple processes
+bool NodeSharedMemoryWindow::isShared() const
+{
+  return d_shared;
+}
+
+// Get the size of the memory block (bytes)
+size_t NodeSharedMemoryWindow::getNumberOfBytes() const
+{
+  return d_number_of_bytes;
+}
+
+// Get the base address of the memory block
+void* NodeSharedMemoryWindow::getBaseAddress()
+{
+  return d_base_address;
+}
+
+// Get the base address of the memory block
+const void* NodeSharedMemoryWindow::getBaseAddress() const
+{
+  return d_base_address;
+}
+
+// Wait for all processes in the node communicator to reach this point
+/*! \details This must be called after the memory has been written (usually
+ * by the node root process) and before any other process reads it. All
+ * writes made before this call will be visible to every process after this
+ * call.
+ */
+void NodeSharedMemoryWindow::synchronize() const
+{
+#ifdef HAVE_FRENSIE_MPI
+  if( d_window != MPI_WIN_NULL )
+  {
+    MPI_Win_sync( d_window );
+
+    d_node_comm->barrier();
+
+    MPI_Win_sync( d_window );
+
+    return;
+  }
+#endif // end HAVE_FRENSIE_MPI
+
+  d_node_comm->barrier();
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_NodeSharedMemoryWindow.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_NodeSharedMemoryWindow.hpp
+//! \author Alex Robinson
+//! \brief  The node shared memory window class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_NODE_SHARED_MEMORY_WINDOW_HPP
+#define UTILITY_NODE_SHARED_MEMORY_WINDOW_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+
+// FRENSIE Includes
+#include "Utility_Communicator.hpp"
+
+namespace Utility{
+
+/*! The node shared memory window class
+ *
+ * A block of memory that is allocated once per node by the root process of
+ * a node communicator (see Utility::Communicator::splitByNode) and that
+ * every other process in the node communicator can access directly. When
+ * MPI is not used (or the communicator is not an mpi communicator) the
+ * memory is simply allocated locally. The memory will be released when the
+ * window is destroyed. The constructor and destructor are collective
+ * operations.
+ *  \ingroup mpi
+ */
+class NodeSharedMemoryWindow
+{
+
+public:
+
+  //! Constructor
+  NodeSharedMemoryWindow( const std::shared_ptr<const Communicator>& node_comm,
+                          const size_t number_of_bytes );
+
+  //! Destructor
+  ~NodeSharedMemoryWindow();
+
+  //! Get the node communicator
+  const Communicator& getNodeCommunicator() const;
+
+  //! Check if this process is the node root process
+  bool isNodeRoot() const;
+
+  //! Check if the memory is shared by multiple processes
+  bool isShared() const;
+
+  //! Get the size of the memory block (bytes)
+  size_t getNumberOfBytes() const;
+
+  //! Get the base address of the memory block
+  void* getBaseAddress();
+
+  //! Get the base address of the memory block
+  const void* getBaseAddress() const;
+
+  //! Wait for all processes in the node communicator to reach this point
+  void synchronize() const;
+
+private:
+
+  // Copy constructor
+  NodeSharedMemoryWindow( const NodeSharedMemoryWindow& other ) = delete;
+
+  // Assignment operator
+  NodeSharedMemoryWindow& operator=( const NodeSharedMemoryWindow& other ) = delete;
+
+  // The node communicator
+  std::shared_ptr<const Communicator> d_node_comm;
+
+  // The size of the memory block (bytes)
+  size_t d_number_of_bytes;
+
+  // The base address of the memory block
+  void* d_base_address;
+
+  // Records if the memory is shared by multiple processes
+  bool d_shared;
+
+  // The local memory block (only used if the memory can't be shared)
+  std::vector<unsigned char> d_local_memory;
+
+#ifdef HAVE_FRENSIE_MPI
+  // The mpi window
+  MPI_Win d_window;
+#endif // end HAVE_FRENSIE_MPI
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_NODE_SHARED_MEMORY_WINDOW_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_NodeSharedMemoryWindow.hpp
+//---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 
 // FRENSIE Includes
 #include "Utility_MPICommunicator.hpp"
+#include "Utility_Communicator.hpp"
 #include "Utility_GlobalMPISession.hpp"
 #include "Utility_Tuple.hpp"
 #include "Utility_Array.hpp"
@@ -200,6 +201,38 @@ FRENSIE_UNIT_TEST( MPICommunicator, split )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that a mpi communicator can be split by node
+FRENSIE_UNIT_TEST( MPICommunicator, splitByNode )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    comm->splitByNode();
+
+  FRENSIE_REQUIRE( node_comm.get() != NULL );
+  FRENSIE_REQUIRE( node_comm->isValid() );
+  FRENSIE_CHECK( node_comm->isMPIUsed() );
+  FRENSIE_CHECK( node_comm->size() >= 1 );
+  FRENSIE_CHECK( node_comm->size() <= comm->size() );
+  FRENSIE_CHECK( node_comm->rank() <= comm->rank() );
+
+  // Every process on a node must be counted exactly once
+  int node_root = (node_comm->rank() == 0 ? 1 : 0);
+  int number_of_node_roots = 0;
+
+  Utility::allReduce( *comm, node_root, number_of_node_roots, std::plus<int>() );
+
+  int node_size = (node_comm->rank() == 0 ? node_comm->size() : 0);
+  int total_node_size = 0;
+
+  Utility::allReduce( *comm, node_size, total_node_size, std::plus<int>() );
+
+  FRENSIE_CHECK( number_of_node_roots >= 1 );
+  FRENSIE_CHECK_EQUAL( total_node_size, comm->size() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a timer can be created
 FRENSIE_UNIT_TEST( MPICommunicator, createTimer )
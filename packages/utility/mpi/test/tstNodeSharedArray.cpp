@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNodeSharedArray.cpp
+//! \author Alex Robinson
+//! \brief  Node shared array unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <numeric>
+
+// FRENSIE Includes
+#include "Utility_NodeSharedArray.hpp"
+#include "Utility_Communicator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef std::tuple<int, unsigned long, float, double> TestTypes;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that a node shared memory window can be created
+FRENSIE_UNIT_TEST( NodeSharedMemoryWindow, constructor )
+{
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitByNode();
+
+  // Only the node root size will be used
+  Utility::NodeSharedMemoryWindow
+    window( node_comm, (node_comm->rank() == 0 ? 64 : 0) );
+
+  FRENSIE_CHECK_EQUAL( window.getNumberOfBytes(), 64 );
+  FRENSIE_CHECK( window.getBaseAddress() != NULL );
+  FRENSIE_CHECK_EQUAL( window.isNodeRoot(), node_comm->rank() == 0 );
+  FRENSIE_CHECK_EQUAL( window.getNodeCommunicator().size(),
+                       node_comm->size() );
+
+  if( node_comm->size() > 1 )
+  {
+    FRENSIE_CHECK( window.isShared() );
+  }
+  else
+  {
+    FRENSIE_CHECK( !window.isShared() );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the node root values are visible to every process on the node
+FRENSIE_UNIT_TEST_TEMPLATE( NodeSharedArray, constructor_values, TestTypes )
+{
+  FETCH_TEMPLATE_PARAM( 0, T );
+
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitByNode();
+
+  std::vector<T> values;
+
+  if( node_comm->rank() == 0 )
+  {
+    values.resize( 100 );
+
+    std::iota( values.begin(), values.end(), T(1) );
+  }
+
+  Utility::NodeSharedArray<T> shared_array( node_comm, values );
+
+  FRENSIE_REQUIRE_EQUAL( shared_array.size(), 100 );
+  FRENSIE_CHECK( !shared_array.empty() );
+  FRENSIE_CHECK_EQUAL( shared_array[0], T(1) );
+  FRENSIE_CHECK_EQUAL( shared_array[99], T(100) );
+  FRENSIE_CHECK_EQUAL( shared_array.end() - shared_array.begin(), 100 );
+  FRENSIE_CHECK_EQUAL( std::accumulate( shared_array.begin(), shared_array.end(), T(0) ),
+                       T(5050) );
+  FRENSIE_CHECK_EQUAL( shared_array.view().size(), 100 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that only the node root fills the array
+FRENSIE_UNIT_TEST( NodeSharedArray, constructor_fill_function )
+{
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitByNode();
+
+  int number_of_fill_calls = 0;
+
+  Utility::NodeSharedArray<double> shared_array(
+       node_comm,
+       (node_comm->rank() == 0 ? 10 : 0),
+       [&number_of_fill_calls]( double* values, size_t size ){
+         for( size_t i = 0; i < size; ++i )
+           values[i] = 0.5*i;
+
+         ++number_of_fill_calls; } );
+
+  FRENSIE_CHECK_EQUAL( number_of_fill_calls,
+                       (node_comm->rank() == 0 ? 1 : 0) );
+  FRENSIE_REQUIRE_EQUAL( shared_array.size(), 10 );
+  FRENSIE_CHECK_EQUAL( shared_array[0], 0.0 );
+  FRENSIE_CHECK_EQUAL( shared_array[9], 4.5 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an empty array can be created
+FRENSIE_UNIT_TEST( NodeSharedArray, constructor_empty )
+{
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitByNode();
+
+  Utility::NodeSharedArray<double> shared_array( node_comm,
+                                                 std::vector<double>() );
+
+  FRENSIE_CHECK( shared_array.empty() );
+  FRENSIE_CHECK_EQUAL( shared_array.size(), 0 );
+  FRENSIE_CHECK( shared_array.begin() == shared_array.end() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstNodeSharedArray.cpp
+//---------------------------------------------------------------------------//
@@ -90,6 +90,23 @@ FRENSIE_UNIT_TEST( SerialCommunicator, split )
   FRENSIE_CHECK_EQUAL( new_comm->size(), 1 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a serial communicator can be split by node
+FRENSIE_UNIT_TEST( SerialCommunicator, splitByNode )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::SerialCommunicator::get();
+
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    comm->splitByNode();
+
+  FRENSIE_REQUIRE( node_comm.get() != NULL );
+  FRENSIE_REQUIRE( node_comm->isValid() );
+  FRENSIE_CHECK( *node_comm == *comm );
+  FRENSIE_CHECK_EQUAL( node_comm->rank(), 0 );
+  FRENSIE_CHECK_EQUAL( node_comm->size(), 1 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a timer can be created
 FRENSIE_UNIT_TEST( SerialCommunicator, createTimer )
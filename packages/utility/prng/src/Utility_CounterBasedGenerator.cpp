@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_CounterBasedGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Definition of a counter-based pseudo-random number generator that
+//!         can be used to create reproducible parallel random number streams.
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "Utility_CounterBasedGenerator.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+namespace Details{
+
+// Multiply two 32-bit words and return the high and low words of the result
+inline void philoxMultiply( const uint32_t a,
+                            const uint32_t b,
+                            uint32_t& high,
+                            uint32_t& low )
+{
+  const uint64_t product = ((uint64_t)a)*b;
+
+  high = (uint32_t)(product >> 32);
+  low = (uint32_t)product;
+}
+
+} // end Details namespace
+
+// Constructor
+CounterBasedGenerator::CounterBasedGenerator()
+  : d_history( 0ULL ),
+    d_block( 0ULL ),
+    d_block_outputs(),
+    d_block_output_index( 2u ),
+    d_state( 0ULL )
+{ /* ... */ }
+
+// Initialize the generator for the desired history
+/*! \details The first history number is assumed to be 0. Unlike the
+ * LinearCongruentialGenerator no exponentiation is required to skip to the
+ * desired history.
+ */
+void CounterBasedGenerator::changeHistory(
+                                      const unsigned long long history_number )
+{
+  d_history = history_number;
+  d_block = 0ULL;
+  d_block_output_index = 2u;
+}
+
+// Initialize the generator for the next history
+void CounterBasedGenerator::nextHistory()
+{
+  this->changeHistory( d_history + 1ULL );
+}
+
+// Fill the array with random numbers for the current history
+/*! \details The random numbers will be identical to the ones returned by
+ * successive calls to getRandomNumber.
+ */
+void CounterBasedGenerator::fillRandomNumbers(
+                                       double* random_numbers,
+                                       const size_t number_of_random_numbers )
+{
+  // Make sure the array is valid
+  testPrecondition( number_of_random_numbers == 0 || random_numbers );
+
+  size_t i = 0;
+
+  // Use the remaining outputs of the current block first
+  for( ; i < number_of_random_numbers && d_block_output_index < 2u; ++i )
+    random_numbers[i] = this->getRandomNumber();
+
+  // Use complete blocks
+  for( ; i + 2 <= number_of_random_numbers; i += 2 )
+  {
+    this->generateBlock();
+
+    random_numbers[i] = (d_block_outputs[0] >> 11)*1.1102230246251565e-16;
+    random_numbers[i+1] = (d_block_outputs[1] >> 11)*1.1102230246251565e-16;
+
+    d_state = d_block_outputs[1];
+    d_block_output_index = 2u;
+  }
+
+  // Generate the remaining random number
+  for( ; i < number_of_random_numbers; ++i )
+    random_numbers[i] = this->getRandomNumber();
+}
+
+// Generate the next block of outputs
+void CounterBasedGenerator::generateBlock()
+{
+  uint32_t counter[4] = {(uint32_t)d_block,
+                         (uint32_t)(d_block >> 32),
+                         (uint32_t)d_history,
+                         (uint32_t)(d_history >> 32)};
+
+  uint32_t key_0 = s_key_0;
+  uint32_t key_1 = s_key_1;
+
+  for( unsigned round = 0u; round < 10u; ++round )
+  {
+    // Bump the key (Weyl sequence)
+    if( round > 0u )
+    {
+      key_0 += 0x9E3779B9U;
+      key_1 += 0xBB67AE85U;
+    }
+
+    uint32_t high_0, low_0, high_1, low_1;
+
+    Details::philoxMultiply( 0xD2511F53U, counter[0], high_0, low_0 );
+    Details::philoxMultiply( 0xCD9E8D57U, counter[2], high_1, low_1 );
+
+    counter[0] = high_1 ^ counter[1] ^ key_0;
+    counter[1] = low_1;
+    counter[2] = high_0 ^ counter[3] ^ key_1;
+    counter[3] = low_0;
+  }
+
+  d_block_outputs[0] = (((uint64_t)counter[1]) << 32) | counter[0];
+  d_block_outputs[1] = (((uint64_t)counter[3]) << 32) | counter[2];
+
+  d_block_output_index = 0u;
+
+  ++d_block;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_CounterBasedGenerator.cpp
+//---------------------------------------------------------------------------//
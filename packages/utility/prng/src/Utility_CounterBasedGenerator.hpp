@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_CounterBasedGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Declaration of a counter-based pseudo-random number generator that
+//!         can be used to create reproducible parallel random number streams.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_COUNTER_BASED_GENERATOR_HPP
+#define UTILITY_COUNTER_BASED_GENERATOR_HPP
+
+// Std Lib Includes
+#include <stdint.h>
+#include <stddef.h>
+
+namespace Utility{
+
+//! A counter-based pseudo-random number generator (Philox4x32-10)
+/*! \details The random numbers are generated by applying a keyed bijection
+ * (10 rounds of the Philox4x32 function) to a 128-bit counter. The upper
+ * 64 bits of the counter store the history number and the lower 64 bits
+ * store the block number within the history. Changing histories (or skipping
+ * ahead to any history) is therefore an O(1) operation. Each block of the
+ * bijection provides two 64-bit outputs. The class has no virtual methods
+ * so that random numbers can be generated without any dispatch overhead.
+ */
+class CounterBasedGenerator
+{
+
+public:
+
+  //! Constructor
+  CounterBasedGenerator();
+
+  //! Destructor
+  ~CounterBasedGenerator()
+  { /* ... */ }
+
+  //! Return a random number for the current history
+  double getRandomNumber();
+
+  //! Fill the array with random numbers for the current history
+  void fillRandomNumbers( double* random_numbers,
+                          const size_t number_of_random_numbers );
+
+  //! Return the state of the random number (the last 64-bit output)
+  unsigned long long getGeneratorState() const;
+
+  //! Initialize the generator for the desired history
+  void changeHistory( const unsigned long long history_number );
+
+  //! Initialize the generator for the next history
+  void nextHistory();
+
+private:
+
+  // Generate the next block of outputs
+  void generateBlock();
+
+  // The Philox key (lower 32 bits of the LCG initial seed)
+  static const uint32_t s_key_0 = 0xE460913DU;
+
+  // The Philox key (upper 32 bits of the LCG initial seed)
+  static const uint32_t s_key_1 = 0x00001158U;
+
+  // The current history
+  uint64_t d_history;
+
+  // The block counter for the current history
+  uint64_t d_block;
+
+  // The outputs of the current block
+  uint64_t d_block_outputs[2];
+
+  // The index of the next unused output in the current block
+  unsigned d_block_output_index;
+
+  // The last output (generator state)
+  uint64_t d_state;
+};
+
+// Return a random number for the current history
+inline double CounterBasedGenerator::getRandomNumber()
+{
+  if( d_block_output_index > 1u )
+    this->generateBlock();
+
+  d_state = d_block_outputs[d_block_output_index];
+
+  ++d_block_output_index;
+
+  // Return the uniform random number from the upper 53 bits (bits*2^-53)
+  return (d_state >> 11)*1.1102230246251565e-16;
+}
+
+// Return the state of the random number (the last 64-bit output)
+inline unsigned long long CounterBasedGenerator::getGeneratorState() const
+{
+  return d_state;
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_COUNTER_BASED_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_CounterBasedGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -91,20 +91,57 @@ void LinearCongruentialGenerator::nextHistory()
   ++d_history;
 }
 
-// Return a random number for the current history
-double LinearCongruentialGenerator::getRandomNumber()
+// Fill the array with random numbers for the current history
+/*! \details The random numbers will be identical to the ones returned by
+ * successive calls to getRandomNumber. Four independent lanes of the
+ * generator are advanced together (using the multiplier raised to the fourth
+ * power) so that the loop can be vectorized. This method is not virtual -
+ * derived classes will not be consulted.
+ */
+void LinearCongruentialGenerator::fillRandomNumbers(
+                                       double* random_numbers,
+                                       const size_t number_of_random_numbers )
 {
-  // Advance the generator state
-  advanceState();
+  // Make sure the array is valid
+  testPrecondition( number_of_random_numbers == 0 || random_numbers );
 
-  // Return the uniform random number (state*2^-64)
-  return d_state*5.4210108624275222e-20;
-}
+  const unsigned long long multiplier_2 =
+    LinearCongruentialGenerator::multiplier*
+    LinearCongruentialGenerator::multiplier;
 
-// Return the state of the random number
-unsigned long long LinearCongruentialGenerator::getGeneratorState() const
-{
-  return d_state;
+  const unsigned long long multiplier_3 =
+    multiplier_2*LinearCongruentialGenerator::multiplier;
+
+  const unsigned long long multiplier_4 = multiplier_2*multiplier_2;
+
+  size_t i = 0;
+
+  if( number_of_random_numbers >= 4 )
+  {
+    unsigned long long lane_states[4] =
+      {d_state*LinearCongruentialGenerator::multiplier,
+       d_state*multiplier_2,
+       d_state*multiplier_3,
+       d_state*multiplier_4};
+
+    for( ; i + 4 <= number_of_random_numbers; i += 4 )
+    {
+      for( unsigned j = 0; j < 4; ++j )
+      {
+        // Return the uniform random number (state*2^-64)
+        random_numbers[i+j] = lane_states[j]*5.4210108624275222e-20;
+      }
+
+      d_state = lane_states[3];
+
+      for( unsigned j = 0; j < 4; ++j )
+        lane_states[j] *= multiplier_4;
+    }
+  }
+
+  // Generate the remaining random numbers
+  for( ; i < number_of_random_numbers; ++i )
+    random_numbers[i] = this->LinearCongruentialGenerator::getRandomNumber();
 }
 
 } // end Utility namespace
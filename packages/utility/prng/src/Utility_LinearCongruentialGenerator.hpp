@@ -10,6 +10,9 @@
 #ifndef UTILITY_LINEAR_CONGRUENTIAL_GENERATOR_HPP
 #define UTILITY_LINEAR_CONGRUENTIAL_GENERATOR_HPP
 
+// Std Lib Includes
+#include <stddef.h>
+
 namespace Utility{
 
 //! A linear congruential pseudo-random number generator (LCG)
@@ -31,6 +34,10 @@ public:
   //! Return a random number for the current history
   virtual double getRandomNumber();
 
+  //! Fill the array with random numbers for the current history
+  void fillRandomNumbers( double* random_numbers,
+                          const size_t number_of_random_numbers );
+
   //! Return the state of the random number
   virtual unsigned long long getGeneratorState() const;
 
@@ -72,6 +79,26 @@ inline void LinearCongruentialGenerator::advanceState()
   d_state *= LinearCongruentialGenerator::multiplier;
 }
 
+// Return a random number for the current history
+/*! \details This method is defined inline so that calls made through an
+ * object of known type (e.g. by the Utility::RandomNumberGenerator) can be
+ * devirtualized and inlined.
+ */
+inline double LinearCongruentialGenerator::getRandomNumber()
+{
+  // Advance the generator state
+  this->advanceState();
+
+  // Return the uniform random number (state*2^-64)
+  return d_state*5.4210108624275222e-20;
+}
+
+// Return the state of the random number
+inline unsigned long long LinearCongruentialGenerator::getGeneratorState() const
+{
+  return d_state;
+}
+
 } // end Utility namespace
 
 #endif // end UTILITY_LINEAR_CONGRUENTIAL_GENERATOR_HPP
@@ -6,6 +6,10 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <new>
+#include <stdlib.h>
+
 // FRENSIE Includes
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_FakeGenerator.hpp"
@@ -13,75 +17,209 @@
 
 namespace Utility{
 
-// Initialize the stored generator pointer
-boost::ptr_vector<LinearCongruentialGenerator>
-RandomNumberGenerator::generator( 1 );
+// Initialize static member data
+RandomNumberGeneratorType RandomNumberGenerator::s_generator_type =
+  LINEAR_CONGRUENTIAL_GENERATOR;
+
+thread_local RandomNumberGenerator::Stream*
+RandomNumberGenerator::s_thread_stream = NULL;
+
+thread_local RandomNumberGenerator::StreamOwner
+RandomNumberGenerator::s_thread_stream_owner;
 
 // Constructor
 RandomNumberGenerator::RandomNumberGenerator()
 { /* ... */ }
 
-//! Check if the streams have been created
+// Constructor
+RandomNumberGenerator::Stream::Stream( const RandomNumberGeneratorType type )
+  : generator_type( type ),
+    linear_congruential_generator(),
+    counter_based_generator(),
+    fake_generator()
+{ /* ... */ }
+
+// Destroy the stream and free its memory
+void RandomNumberGenerator::StreamDeleter::operator()( Stream* stream ) const
+{
+  stream->~Stream();
+
+  free( stream );
+}
+
+// Destructor (frees the stream when the thread exits)
+RandomNumberGenerator::StreamOwner::~StreamOwner()
+{
+  if( stream.get() == s_thread_stream )
+    s_thread_stream = NULL;
+}
+
+// Check if the streams have been created
+/*! \details Only the threads of a team of the requested size are checked.
+ * Streams that were created by other threads (e.g. a std::thread) are not
+ * counted.
+ */
 bool RandomNumberGenerator::hasStreams()
 {
-  // Check that there are enough streams
-  if( generator.size() < OpenMPProperties::getRequestedNumberOfThreads() )
-    return false;
+  unsigned number_of_streams = 0u;
 
-  // Check that each stream has been initialized
-  for( unsigned i = 0u; i < generator.size(); ++i )
+  #pragma omp parallel num_threads(OpenMPProperties::getRequestedNumberOfThreads()) reduction(+:number_of_streams)
   {
-    if( generator.is_null(i) )
-      return false;
+    if( s_thread_stream )
+      ++number_of_streams;
   }
 
-  return true;
+  return number_of_streams == OpenMPProperties::getRequestedNumberOfThreads();
 }
 
 // Create the number of random number streams required
 /*! \details The number of streams that are created will be determined by
- * the number of threads requested at run time
+ * the number of threads requested at run time. The stream of each thread
+ * that has already been created will be reset (using the current generator
+ * type).
  */
 void RandomNumberGenerator::createStreams()
 {
 #pragma omp parallel num_threads(OpenMPProperties::getRequestedNumberOfThreads())
   {
-    #pragma omp master
+    if( s_thread_stream )
     {
-      generator.resize( OpenMPProperties::getRequestedNumberOfThreads() );
-    }
+      s_thread_stream->~Stream();
 
-    #pragma omp barrier
-
-    generator.replace( OpenMPProperties::getThreadId(),
-		       new LinearCongruentialGenerator() );
+      new (s_thread_stream) Stream( s_generator_type );
+    }
+    else
+      RandomNumberGenerator::createStream();
   }
 
   // Make sure the streams have been created
-  testPostcondition( !generator.is_null( OpenMPProperties::getThreadId() ));
+  testPostcondition( s_thread_stream != NULL );
+}
+
+// Create the stream of the calling thread
+/*! \details Each stream is allocated on its own cache line(s) by the thread
+ * that will use it so that the streams of different threads never share a
+ * cache line. The stream is owned by the thread and will be freed when the
+ * thread exits.
+ */
+RandomNumberGenerator::Stream& RandomNumberGenerator::createStream()
+{
+  // Make sure the stream has not been created already
+  testPrecondition( s_thread_stream == NULL );
+
+  void* stream_memory = NULL;
+
+  if( posix_memalign( &stream_memory, alignof(Stream), sizeof(Stream) ) != 0 )
+    throw std::bad_alloc();
+
+  s_thread_stream = new (stream_memory) Stream( s_generator_type );
+
+  s_thread_stream_owner.stream.reset( s_thread_stream );
+
+  return *s_thread_stream;
+}
+
+// Set the generator type that will be used by the streams
+/*! \details The generator type must be set before the streams are created
+ * (the existing streams will be reset by the next call to createStreams).
+ */
+void RandomNumberGenerator::setGeneratorType(
+                                         const RandomNumberGeneratorType type )
+{
+  s_generator_type = type;
+}
+
+// Return the generator type that will be used by the streams
+RandomNumberGeneratorType RandomNumberGenerator::getGeneratorType()
+{
+  return s_generator_type;
 }
 
 // Initialize the generator for the desired history
 void RandomNumberGenerator::initialize(
 				      const unsigned long long history_number )
 {
-  // Make sure the generator has been set up correctly
-  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
-  // Make sure the streams have been created
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
+  Stream& stream = RandomNumberGenerator::getStream();
 
-  generator[OpenMPProperties::getThreadId()].changeHistory(history_number);
+  if( stream.fake_generator )
+    stream.fake_generator->changeHistory( history_number );
+  else if( stream.generator_type == COUNTER_BASED_GENERATOR )
+    stream.counter_based_generator.changeHistory( history_number );
+  else
+    stream.linear_congruential_generator.changeHistory( history_number );
 }
 
 // Initialize the generator for the next history
 void RandomNumberGenerator::initializeNextHistory()
 {
-  // Make sure the generator has been set up correctly
-  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
-  // Make sure the streams have been created
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
+  Stream& stream = RandomNumberGenerator::getStream();
+
+  if( stream.fake_generator )
+    stream.fake_generator->nextHistory();
+  else if( stream.generator_type == COUNTER_BASED_GENERATOR )
+    stream.counter_based_generator.nextHistory();
+  else
+    stream.linear_congruential_generator.nextHistory();
+}
+
+// Save the state of the stream of the calling thread
+/*! \details Only the state of the generator that is used by the stream will
+ * be saved. This can be used to interleave several histories on one thread
+ * without changing the random numbers that each history uses (e.g. with
+ * event-based transport). The state of a fake stream is not saved.
+ */
+void RandomNumberGenerator::saveStreamState( StreamState& state )
+{
+  const Stream& stream = RandomNumberGenerator::getStream();
+
+  if( stream.generator_type == COUNTER_BASED_GENERATOR )
+    state.counter_based_generator = stream.counter_based_generator;
+  else
+    state.linear_congruential_generator = stream.linear_congruential_generator;
+}
+
+// Restore a saved state to the stream of the calling thread
+/*! \details The state must have been saved from a stream that uses the
+ * same generator type. A fake stream will not be changed.
+ */
+void RandomNumberGenerator::restoreStreamState( const StreamState& state )
+{
+  Stream& stream = RandomNumberGenerator::getStream();
 
-  generator[OpenMPProperties::getThreadId()].nextHistory();
+  if( stream.generator_type == COUNTER_BASED_GENERATOR )
+    stream.counter_based_generator = state.counter_based_generator;
+  else
+    stream.linear_congruential_generator = state.linear_congruential_generator;
+}
+
+// Fill the array with random numbers in interval [0,1)
+/*! \details The array will be filled with the same random numbers that
+ * would be returned by successive calls to getRandomNumber<double>() so
+ * the stream for each history remains reproducible. Generating a block of
+ * random numbers at once allows the generators to use a vectorizable
+ * algorithm.
+ */
+void RandomNumberGenerator::fillRandomNumbers(
+                                     const ArrayView<double>& random_numbers )
+{
+  Stream& stream = RandomNumberGenerator::getStream();
+
+  if( stream.fake_generator )
+  {
+    for( size_t i = 0; i < random_numbers.size(); ++i )
+      random_numbers[i] = stream.fake_generator->getRandomNumber();
+  }
+  else if( stream.generator_type == COUNTER_BASED_GENERATOR )
+  {
+    stream.counter_based_generator.fillRandomNumbers( random_numbers.data(),
+                                                      random_numbers.size() );
+  }
+  else
+  {
+    stream.linear_congruential_generator.fillRandomNumbers(
+                                                       random_numbers.data(),
+                                                       random_numbers.size() );
+  }
 }
 
 // Set a fake stream for the generator
@@ -96,16 +234,17 @@ void RandomNumberGenerator::setFakeStream(
 
   if( thread_id == OpenMPProperties::getThreadId() )
   {
-    generator.replace( OpenMPProperties::getThreadId(),
-		       new FakeGenerator( fake_stream ) );
+    RandomNumberGenerator::getStream().fake_generator.reset(
+                                            new FakeGenerator( fake_stream ) );
   }
 
   // Make sure the generator has been created
-  testPostcondition( !generator.is_null( OpenMPProperties::getThreadId() ));
+  testPostcondition( s_thread_stream != NULL );
 }
 
 // Unset the fake stream
-/*! \details The default thread is the master (id = 0)
+/*! \details The default thread is the master (id = 0). The stream of the
+ * thread will be reset.
  */
 void RandomNumberGenerator::unsetFakeStream( const unsigned thread_id )
 {
@@ -114,12 +253,15 @@ void RandomNumberGenerator::unsetFakeStream( const unsigned thread_id )
 
   if( thread_id == OpenMPProperties::getThreadId() )
   {
-    generator.replace( OpenMPProperties::getThreadId(),
-		       new LinearCongruentialGenerator() );
+    Stream& stream = RandomNumberGenerator::getStream();
+
+    stream.~Stream();
+
+    new (&stream) Stream( s_generator_type );
   }
 
   // Make sure that the generator has been created
-  testPostcondition(!generator.is_null( OpenMPProperties::getThreadId() ) );
+  testPostcondition( s_thread_stream != NULL );
 }
 
 } // end Utility namespace
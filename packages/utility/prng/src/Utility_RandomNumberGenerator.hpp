@@ -11,36 +11,65 @@
 
 // Std Lib Includes
 #include <vector>
-
-// Boost Includes
-#include <boost/ptr_container/ptr_vector.hpp>
-#include <boost/scoped_ptr.hpp>
+#include <memory>
 
 // FRENSIE includes
 #include "Utility_LinearCongruentialGenerator.hpp"
+#include "Utility_CounterBasedGenerator.hpp"
+#include "Utility_RandomNumberGeneratorType.hpp"
 #include "Utility_OpenMPProperties.hpp"
+#include "Utility_ArrayView.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace Utility{
 
-//! Struct that is used to obtain random numbers
+/*! Struct that is used to obtain random numbers
+ * \details Each thread has its own random number stream, which is stored
+ * in a cache-line aligned block that is only accessed through a thread_local
+ * handle. Random numbers from the linear congruential generator or the
+ * counter-based generator are obtained through non-virtual inline calls.
+ * The virtual generator interface is only used when a fake stream has been
+ * set.
+ */
 class RandomNumberGenerator
 {
 
 public:
 
+  //! The saved state of a random number stream
+  struct StreamState
+  {
+    //! The linear congruential generator state
+    LinearCongruentialGenerator linear_congruential_generator;
+
+    //! The counter-based generator state
+    CounterBasedGenerator counter_based_generator;
+  };
+
   //! Check if the streams have been created
   static bool hasStreams();
 
   //! Create the number of random number streams required
   static void createStreams();
 
+  //! Set the generator type that will be used by the streams
+  static void setGeneratorType( const RandomNumberGeneratorType type );
+
+  //! Return the generator type that will be used by the streams
+  static RandomNumberGeneratorType getGeneratorType();
+
   //! Initialize the generator for the desired history
   static void initialize( const unsigned long long history_number = 0ULL );
 
   //! Initialize the generator for the next history
   static void initializeNextHistory();
 
+  //! Save the state of the stream of the calling thread
+  static void saveStreamState( StreamState& state );
+
+  //! Restore a saved state to the stream of the calling thread
+  static void restoreStreamState( const StreamState& state );
+
   //! Set a fake stream for the generator
   static void setFakeStream( const std::vector<double>& fake_stream,
 			     const unsigned thread_id = 0u );
@@ -52,6 +81,9 @@ public:
   template<typename ScalarType>
   static ScalarType getRandomNumber();
 
+  //! Fill the array with random numbers in interval [0,1)
+  static void fillRandomNumbers( const ArrayView<double>& random_numbers );
+
   //! Destructor
   ~RandomNumberGenerator()
   { /* ... */ }
@@ -61,33 +93,99 @@ private:
   // Constructor
   RandomNumberGenerator();
 
-  // Pointer to generator
-  static boost::ptr_vector<LinearCongruentialGenerator> generator;
+#if !defined SWIG
+
+  // The random number stream of a thread
+  struct alignas(64) Stream
+  {
+    // Constructor
+    Stream( const RandomNumberGeneratorType type );
+
+    // The generator type used by the stream
+    RandomNumberGeneratorType generator_type;
+
+    // The linear congruential generator
+    LinearCongruentialGenerator linear_congruential_generator;
+
+    // The counter-based generator
+    CounterBasedGenerator counter_based_generator;
+
+    // The fake generator (only set when a fake stream is used)
+    std::unique_ptr<LinearCongruentialGenerator> fake_generator;
+  };
+
+  // The stream deleter
+  struct StreamDeleter
+  {
+    // Destroy the stream and free its memory
+    void operator()( Stream* stream ) const;
+  };
+
+  // The owner of the stream of a thread
+  struct StreamOwner
+  {
+    // Destructor (frees the stream when the thread exits)
+    ~StreamOwner();
+
+    // The stream
+    std::unique_ptr<Stream,StreamDeleter> stream;
+  };
+
+  // Return the stream of the calling thread
+  static Stream& getStream();
+
+  // Create the stream of the calling thread
+  static Stream& createStream();
+
+  // The generator type that will be used by newly created streams
+  static RandomNumberGeneratorType s_generator_type;
+
+  // The stream of the calling thread
+  static thread_local Stream* s_thread_stream;
+
+  // The owner of the stream of the calling thread (only accessed when the
+  // stream is created so that the stream handle stays trivial)
+  static thread_local StreamOwner s_thread_stream_owner;
+
+#endif // end !defined SWIG
 };
 
+#if !defined SWIG
+
+// Return the stream of the calling thread
+/*! \details The stream will be created the first time that a thread
+ * requests it.
+ */
+inline RandomNumberGenerator::Stream& RandomNumberGenerator::getStream()
+{
+  if( s_thread_stream )
+    return *s_thread_stream;
+  else
+    return RandomNumberGenerator::createStream();
+}
+
+#endif // end !defined SWIG
+
 // Return a random number in interval [0,1)
 template<typename ScalarType>
 inline ScalarType RandomNumberGenerator::getRandomNumber()
 {
-  // Make sure the generator has been set up correctly
-  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
-  // Make sure that the generator has been initialized
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
-
   return static_cast<ScalarType>(
-	     generator[OpenMPProperties::getThreadId()].getRandomNumber() );
+                     RandomNumberGenerator::getRandomNumber<double>() );
 }
 
 // Return a random double in interval [0,1)
 template<>
 inline double RandomNumberGenerator::getRandomNumber<double>()
 {
-  // Make sure the generator has been set up correctly
-  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
-  // Make sure that the generator has been initialized
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
-
-  return generator[OpenMPProperties::getThreadId()].getRandomNumber();
+  Stream& stream = RandomNumberGenerator::getStream();
+
+  if( stream.fake_generator )
+    return stream.fake_generator->getRandomNumber();
+  else if( stream.generator_type == COUNTER_BASED_GENERATOR )
+    return stream.counter_based_generator.getRandomNumber();
+  else
+    return stream.linear_congruential_generator.getRandomNumber();
 }
 
 // Return a random long long unsigned integer in [0,2^64)
@@ -95,14 +193,26 @@ template<>
 inline unsigned long long
 RandomNumberGenerator::getRandomNumber<unsigned long long>()
 {
-  // Make sure the generator has been set up correctly
-  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
-  // Make sure that the generator has been initialized
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
-
-  generator[OpenMPProperties::getThreadId()].getRandomNumber();
-
-  return generator[OpenMPProperties::getThreadId()].getGeneratorState();
+  Stream& stream = RandomNumberGenerator::getStream();
+
+  if( stream.fake_generator )
+  {
+    stream.fake_generator->getRandomNumber();
+
+    return stream.fake_generator->getGeneratorState();
+  }
+  else if( stream.generator_type == COUNTER_BASED_GENERATOR )
+  {
+    stream.counter_based_generator.getRandomNumber();
+
+    return stream.counter_based_generator.getGeneratorState();
+  }
+  else
+  {
+    stream.linear_congruential_generator.getRandomNumber();
+
+    return stream.linear_congruential_generator.getGeneratorState();
+  }
 }
 
 } // end Utility namespace
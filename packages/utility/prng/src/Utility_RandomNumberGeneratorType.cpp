@@ -0,0 +1,44 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_RandomNumberGeneratorType.cpp
+//! \author Alex Robinson
+//! \brief  Random number generator type helper function definitions
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "Utility_RandomNumberGeneratorType.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace Utility{
+
+// Convert a Utility::RandomNumberGeneratorType to a string
+std::string ToStringTraits<RandomNumberGeneratorType>::toString(
+                                         const RandomNumberGeneratorType type )
+{
+  switch( type )
+  {
+  case LINEAR_CONGRUENTIAL_GENERATOR: return "Linear Congruential Generator";
+  case COUNTER_BASED_GENERATOR: return "Counter-Based Generator";
+  default:
+    THROW_EXCEPTION( std::logic_error,
+                     "Unknown random number generator type encountered!" );
+  }
+}
+
+// Place the Utility::RandomNumberGeneratorType in a stream
+void ToStringTraits<RandomNumberGeneratorType>::toStream(
+                                         std::ostream& os,
+                                         const RandomNumberGeneratorType type )
+{
+  os << ToStringTraits<RandomNumberGeneratorType>::toString( type );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_RandomNumberGeneratorType.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,113 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCounterBasedGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Counter-based generator class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+
+// FRENSIE Includes
+#include "Utility_CounterBasedGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a random number in the interval [0,1) can be obtained
+FRENSIE_UNIT_TEST( CounterBasedGenerator, getRandomNumber )
+{
+  Utility::CounterBasedGenerator generator;
+
+  for( unsigned i = 0; i < 10; ++i )
+  {
+    double random_number = generator.getRandomNumber();
+
+    FRENSIE_CHECK_GREATER_OR_EQUAL( random_number, 0.0 );
+    FRENSIE_CHECK_LESS( random_number, 1.0 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator can be initialized to a new history
+FRENSIE_UNIT_TEST( CounterBasedGenerator, changeHistory )
+{
+  Utility::CounterBasedGenerator generator;
+
+  generator.changeHistory( 10 );
+
+  double random_number_1 = generator.getRandomNumber();
+  double random_number_2 = generator.getRandomNumber();
+  double random_number_3 = generator.getRandomNumber();
+
+  FRENSIE_CHECK( random_number_1 != random_number_2 );
+  FRENSIE_CHECK( random_number_2 != random_number_3 );
+
+  // Skip to a different history and then back again
+  generator.changeHistory( 1000000000000ULL );
+
+  FRENSIE_CHECK( generator.getRandomNumber() != random_number_1 );
+
+  generator.changeHistory( 10 );
+
+  FRENSIE_CHECK_EQUAL( generator.getRandomNumber(), random_number_1 );
+  FRENSIE_CHECK_EQUAL( generator.getRandomNumber(), random_number_2 );
+  FRENSIE_CHECK_EQUAL( generator.getRandomNumber(), random_number_3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator can be initialized to the next history
+FRENSIE_UNIT_TEST( CounterBasedGenerator, nextHistory )
+{
+  Utility::CounterBasedGenerator generator;
+
+  generator.changeHistory( 11 );
+
+  double random_number = generator.getRandomNumber();
+  unsigned long long state = generator.getGeneratorState();
+
+  generator.changeHistory( 10 );
+  generator.getRandomNumber();
+  generator.nextHistory();
+
+  FRENSIE_CHECK_EQUAL( generator.getRandomNumber(), random_number );
+  FRENSIE_CHECK_EQUAL( generator.getGeneratorState(), state );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an array can be filled with random numbers
+FRENSIE_UNIT_TEST( CounterBasedGenerator, fillRandomNumbers )
+{
+  Utility::CounterBasedGenerator generator, reference_generator;
+
+  generator.changeHistory( 10 );
+  reference_generator.changeHistory( 10 );
+
+  // Fill arrays of different sizes (to check the partial block handling)
+  for( size_t size = 0; size < 6; ++size )
+  {
+    std::vector<double> random_numbers( size );
+
+    generator.fillRandomNumbers( random_numbers.data(),
+                                 random_numbers.size() );
+
+    for( size_t i = 0; i < size; ++i )
+    {
+      FRENSIE_CHECK_EQUAL( random_numbers[i],
+                           reference_generator.getRandomNumber() );
+    }
+
+    FRENSIE_CHECK_EQUAL( generator.getGeneratorState(),
+                         reference_generator.getGeneratorState() );
+  }
+
+  FRENSIE_CHECK_EQUAL( generator.getRandomNumber(),
+                       reference_generator.getRandomNumber() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstCounterBasedGenerator.cpp
+//---------------------------------------------------------------------------//
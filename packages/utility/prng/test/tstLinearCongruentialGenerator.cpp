@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <vector>
 
 // FRENSIE Includes
 #include "Utility_LinearCongruentialGenerator.hpp"
@@ -27,6 +28,33 @@ FRENSIE_UNIT_TEST( LinearCongruentialGenerator, getRandomNumber )
   FRENSIE_CHECK_LESS( random_number, 1.0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that an array can be filled with random numbers
+FRENSIE_UNIT_TEST( LinearCongruentialGenerator, fillRandomNumbers )
+{
+  Utility::LinearCongruentialGenerator lcg, reference_lcg;
+
+  lcg.changeHistory( 10 );
+  reference_lcg.changeHistory( 10 );
+
+  // Fill arrays of different sizes (to check the remainder handling)
+  for( size_t size = 0; size < 11; ++size )
+  {
+    std::vector<double> random_numbers( size );
+
+    lcg.fillRandomNumbers( random_numbers.data(), random_numbers.size() );
+
+    for( size_t i = 0; i < size; ++i )
+    {
+      FRENSIE_CHECK_EQUAL( random_numbers[i],
+                           reference_lcg.getRandomNumber() );
+    }
+
+    FRENSIE_CHECK_EQUAL( lcg.getGeneratorState(),
+                         reference_lcg.getGeneratorState() );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // end tstLinearCongruentialGenerator.cpp
 //---------------------------------------------------------------------------//
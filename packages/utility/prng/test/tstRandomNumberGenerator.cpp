@@ -81,6 +81,95 @@ FRENSIE_UNIT_TEST_TEMPLATE( RandomNumberGenerator, setFakeStream,
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check that an array can be filled with random numbers
+FRENSIE_UNIT_TEST( RandomNumberGenerator, fillRandomNumbers )
+{
+  std::vector<double> random_numbers( 7 );
+
+  Utility::RandomNumberGenerator::initialize( 3 );
+  Utility::RandomNumberGenerator::fillRandomNumbers(
+                               Utility::ArrayView<double>( random_numbers ) );
+
+  // The same random numbers must be returned by getRandomNumber
+  Utility::RandomNumberGenerator::initialize( 3 );
+
+  for( size_t i = 0; i < random_numbers.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( random_numbers[i],
+                         Utility::RandomNumberGenerator::getRandomNumber<double>() );
+  }
+
+  // Check that the fake stream is used
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.2;
+  fake_stream[1] = 0.4;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  Utility::RandomNumberGenerator::fillRandomNumbers(
+                          Utility::ArrayView<double>( random_numbers.data(),
+                                                      3 ) );
+
+  FRENSIE_CHECK_EQUAL( random_numbers[0], 0.2 );
+  FRENSIE_CHECK_EQUAL( random_numbers[1], 0.4 );
+  FRENSIE_CHECK_EQUAL( random_numbers[2], 0.2 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the state of the stream can be saved and restored
+FRENSIE_UNIT_TEST( RandomNumberGenerator, saveRestoreStreamState )
+{
+  // The streams of two histories will be interleaved
+  Utility::RandomNumberGenerator::StreamState history_1_state,
+    history_2_state;
+
+  Utility::RandomNumberGenerator::initialize( 1 );
+  Utility::RandomNumberGenerator::saveStreamState( history_1_state );
+
+  Utility::RandomNumberGenerator::initialize( 2 );
+  Utility::RandomNumberGenerator::saveStreamState( history_2_state );
+
+  std::vector<double> history_1_random_numbers, history_2_random_numbers;
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    Utility::RandomNumberGenerator::restoreStreamState( history_1_state );
+
+    history_1_random_numbers.push_back(
+                   Utility::RandomNumberGenerator::getRandomNumber<double>() );
+
+    Utility::RandomNumberGenerator::saveStreamState( history_1_state );
+
+    Utility::RandomNumberGenerator::restoreStreamState( history_2_state );
+
+    history_2_random_numbers.push_back(
+                   Utility::RandomNumberGenerator::getRandomNumber<double>() );
+
+    Utility::RandomNumberGenerator::saveStreamState( history_2_state );
+  }
+
+  // Each history must get the same random numbers that it would get if it
+  // was not interleaved
+  Utility::RandomNumberGenerator::initialize( 1 );
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( history_1_random_numbers[i],
+                         Utility::RandomNumberGenerator::getRandomNumber<double>() );
+  }
+
+  Utility::RandomNumberGenerator::initialize( 2 );
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( history_2_random_numbers[i],
+                         Utility::RandomNumberGenerator::getRandomNumber<double>() );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that the random number generator can be initialized to a new history
 FRENSIE_UNIT_TEST( RandomNumberGenerator, initialize_history )
@@ -133,6 +222,58 @@ FRENSIE_UNIT_TEST( RandomNumberGenerator, initialize_history )
   FRENSIE_CHECK_EQUAL( all_random_numbers.size(), random_set.size() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the generator type can be set
+FRENSIE_UNIT_TEST( RandomNumberGenerator, setGeneratorType )
+{
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getGeneratorType(),
+                       Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+
+  Utility::RandomNumberGenerator::setGeneratorType(
+                                            Utility::COUNTER_BASED_GENERATOR );
+
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getGeneratorType(),
+                       Utility::COUNTER_BASED_GENERATOR );
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  // The streams must be reproducible for each history
+  std::vector<double> first_random_numbers(
+                Utility::OpenMPProperties::getRequestedNumberOfThreads() ),
+    second_random_numbers( first_random_numbers.size() );
+
+  #pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  {
+    unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
+    Utility::RandomNumberGenerator::initialize( 100 + thread_id );
+
+    first_random_numbers[thread_id] =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+    Utility::RandomNumberGenerator::initialize( 1000 );
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+    Utility::RandomNumberGenerator::initialize( 99 + thread_id );
+    Utility::RandomNumberGenerator::initializeNextHistory();
+
+    second_random_numbers[thread_id] =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  FRENSIE_CHECK_EQUAL( first_random_numbers, second_random_numbers );
+
+  if( first_random_numbers.size() > 1 )
+  {
+    FRENSIE_CHECK( first_random_numbers[0] != first_random_numbers[1] );
+  }
+
+  // Reset the streams
+  Utility::RandomNumberGenerator::setGeneratorType(
+                                      Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+
+  Utility::RandomNumberGenerator::createStreams();
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
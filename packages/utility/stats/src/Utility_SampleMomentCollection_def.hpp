@@ -187,6 +187,10 @@ protected:
   void addRawScore( const T& raw_score )
   { /* ... */ }
 
+  //! Merge the current scores of another collection with this collection
+  void mergeCollections( const SampleMomentCollection& other_collection )
+  { /* ... */ }
+
 private:
 
   // Make all moment collections friend
@@ -328,6 +332,24 @@ void SampleMomentCollection<T,N,Ns...>::addRawScore( const T& raw_score )
     d_current_scores[i] += processed_score;
 }
 
+// Merge the current scores of another collection with this collection
+/*! \details The collections must have the same size. The current scores
+ * of the other collection will be added to the current scores of this
+ * collection (element-wise).
+ */
+template<typename T, size_t N, size_t... Ns>
+void SampleMomentCollection<T,N,Ns...>::mergeCollections(
+                               const SampleMomentCollection& other_collection )
+{
+  // Make sure that the collections have the same size
+  testPrecondition( other_collection.size() == this->size() );
+
+  SampleMomentCollection<T,Ns...>::mergeCollections( other_collection );
+
+  for( size_t i = 0; i < d_current_scores.size(); ++i )
+    d_current_scores[i] += other_collection.d_current_scores[i];
+}
+
 // Save the collection data to an archive
 template<typename T, size_t N, size_t... Ns>
 template<class Archive>
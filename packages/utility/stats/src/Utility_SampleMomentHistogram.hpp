@@ -18,6 +18,7 @@
 
 // FRENSIE Includes
 #include "Utility_Vector.hpp"
+#include "Utility_ArrayView.hpp"
 #include "Utility_SerializationHelpers.hpp"
 
 namespace Utility{
@@ -79,6 +80,11 @@ public:
   //! Merge histograms
   void mergeHistograms( const SampleMomentHistogram& histogram );
 
+  //! Set the histogram values and the number of scores (e.g. after a reduction)
+  void setHistogramValues(
+                   const Utility::ArrayView<const HistogramValueType>& values,
+                   const uint64_t number_of_scores );
+
   //! Get the number of scores
   uint64_t getNumberOfScores() const;
 
@@ -176,6 +176,20 @@ void SampleMomentHistogram<T>::mergeHistograms( const SampleMomentHistogram<T>&
   d_number_of_scores += histogram.d_number_of_scores;
 }
 
+// Set the histogram values and the number of scores (e.g. after a reduction)
+template<typename T>
+void SampleMomentHistogram<T>::setHistogramValues(
+                   const Utility::ArrayView<const HistogramValueType>& values,
+                   const uint64_t number_of_scores )
+{
+  // Make sure that the values are valid
+  testPrecondition( values.size() == d_histogram_values.size() );
+
+  std::copy( values.begin(), values.end(), d_histogram_values.begin() );
+
+  d_number_of_scores = number_of_scores;
+}
+
 // Get the number of scores
 template<typename T>
 uint64_t SampleMomentHistogram<T>::getNumberOfScores() const
@@ -462,6 +462,27 @@ FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentHistogram,
                        2.0*Utility::QuantityTraits<HistogramValueType>::one() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the histogram values can be set
+FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentHistogram,
+                            setHistogramValues,
+                            TestingTypes )
+{
+  FETCH_TEMPLATE_PARAM( 0, T );
+  typedef typename Utility::SampleMomentHistogram<T>::HistogramValueType HistogramValueType;
+
+  Utility::SampleMomentHistogram<T> histogram( std::make_shared<std::vector<T> >( std::vector<T>({Utility::QuantityTraits<T>::zero(), Utility::QuantityTraits<T>::one(), Utility::QuantityTraits<T>::one()*2.0}) ) );
+
+  histogram.addRawScore( Utility::QuantityTraits<T>::one()*0.5 );
+
+  std::vector<HistogramValueType> values( {2.0*Utility::QuantityTraits<HistogramValueType>::one(), 3.0*Utility::QuantityTraits<HistogramValueType>::one()} );
+
+  histogram.setHistogramValues( Utility::arrayViewOfConst( values ), 5 );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), 5 );
+  FRENSIE_CHECK_EQUAL( histogram.getHistogramValues(), values );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a histogram can be archived
 FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentHistogram, archive, TestingTypes )
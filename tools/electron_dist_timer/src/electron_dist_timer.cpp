@@ -0,0 +1,202 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   electron_dist_timer.cpp
+//! \author Alex Robinson
+//! \brief  Main function for timing the electron bivariate distributions
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+
+// FRENSIE Includes
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_InterpolatedFullyTabularBasicBivariateDistribution.hpp"
+#include "Utility_PackedTabularBasicBivariateDistribution.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+// Return the elapsed wall time of a sampling loop
+template<typename SampleFunctor>
+double timeSampling( const std::vector<double>& primary_values,
+                     const SampleFunctor& sample,
+                     double& mean )
+{
+  Utility::RandomNumberGenerator::initialize( 0 );
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Prevent the compiler from optimizing away the sampling
+  double sum = 0.0;
+
+  timer->start();
+
+  for( size_t i = 0; i < primary_values.size(); ++i )
+    sum += sample( primary_values[i] );
+
+  timer->stop();
+
+  mean = sum/primary_values.size();
+
+  return timer->elapsed().count();
+}
+
+// Distribution timing function
+/*! \details The interpolated fully tabular distribution is constructed in
+ * the same way as the native electron scattering distribution factories
+ * (lin-lin tabular secondary distributions) and is sampled through the
+ * base class interface. Both distributions use the same random numbers, so
+ * the sample means should match.
+ */
+template<typename TwoDGridPolicy>
+void timeDistribution( const std::string& name,
+                       const std::map<double,std::vector<double> >& secondary_grids,
+                       const std::map<double,std::vector<double> >& pdfs,
+                       const int trial_size )
+{
+  std::vector<double> primary_grid;
+  std::vector<std::vector<double> > packed_secondary_grids, packed_pdfs;
+  std::vector<std::shared_ptr<const Utility::TabularUnivariateDistribution> >
+    secondary_distributions;
+
+  for( auto&& secondary_grid : secondary_grids )
+  {
+    primary_grid.push_back( secondary_grid.first );
+    packed_secondary_grids.push_back( secondary_grid.second );
+    packed_pdfs.push_back( pdfs.find( secondary_grid.first )->second );
+
+    secondary_distributions.emplace_back(
+       new Utility::TabularDistribution<Utility::LinLin>( packed_secondary_grids.back(),
+                                                          packed_pdfs.back() ) );
+  }
+
+  std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>
+    distribution( new Utility::InterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy>(
+                                                   primary_grid,
+                                                   secondary_distributions ) );
+
+  Utility::PackedTabularBasicBivariateDistribution<TwoDGridPolicy>
+    packed_distribution( primary_grid, packed_secondary_grids, packed_pdfs );
+
+  // Create the primary values (log uniform over the primary grid)
+  std::vector<double> primary_values( trial_size );
+
+  Utility::RandomNumberGenerator::initialize( 1 );
+
+  for( size_t i = 0; i < primary_values.size(); ++i )
+  {
+    primary_values[i] = primary_grid.front()*
+      std::pow( primary_grid.back()/primary_grid.front(),
+                Utility::RandomNumberGenerator::getRandomNumber<double>() );
+  }
+
+  double mean, packed_mean;
+
+  double time = timeSampling( primary_values,
+                              [&distribution]( const double primary_value ){
+                                return distribution->sampleSecondaryConditional( primary_value ); },
+                              mean );
+
+  double packed_time = timeSampling( primary_values,
+                                     [&packed_distribution]( const double primary_value ){
+                                       return packed_distribution.sampleSecondaryConditional( primary_value ); },
+                                     packed_mean );
+
+  if( time < 1.0e-15 || packed_time < 1.0e-15 )
+  {
+    std::cerr << "Timing information not accurate enough for the "
+              << name << " distribution." << std::endl;
+  }
+  else
+  {
+    std::cout << "  " << name << " (" << TwoDGridPolicy::name() << ", "
+              << primary_grid.size() << " primary grid points):" << std::endl
+              << "    Interpolated:\tTime = " << time << " seconds => "
+              << trial_size/time/1e6 << " (mean = " << mean << ")"
+              << std::endl
+              << "    Packed:\t\tTime = " << packed_time << " seconds => "
+              << trial_size/packed_time/1e6 << " (mean = " << packed_mean
+              << ")" << std::endl
+              << "    Speedup:\t\t" << time/packed_time << std::endl;
+  }
+}
+
+// Time the distributions with every supported grid policy
+template<typename TwoDInterpPolicy>
+void timeGridPolicies( const std::string& name,
+                       const std::map<double,std::vector<double> >& secondary_grids,
+                       const std::map<double,std::vector<double> >& pdfs,
+                       const int trial_size )
+{
+  timeDistribution<Utility::UnitBase<TwoDInterpPolicy> >(
+                                  name, secondary_grids, pdfs, trial_size );
+
+  timeDistribution<Utility::Correlated<TwoDInterpPolicy> >(
+                                  name, secondary_grids, pdfs, trial_size );
+
+  timeDistribution<Utility::UnitBaseCorrelated<TwoDInterpPolicy> >(
+                                  name, secondary_grids, pdfs, trial_size );
+}
+
+// Main timing function
+int main( int argc, char** argv )
+{
+  // The native epr file must be passed in as the first argument (e.g.
+  // packages/test_files/native/test_epr_14_native.xml) and the number of
+  // samples can be passed in as the optional second argument
+  if( argc < 2 )
+  {
+    std::cerr << "Usage: " << argv[0] << " native_epr_file [trial_size]"
+              << std::endl;
+
+    return 1;
+  }
+
+  int trial_size = 1000000;
+
+  if( argc > 2 )
+    trial_size = std::atoi( argv[2] );
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  Data::ElectronPhotonRelaxationDataContainer data_container( argv[1] );
+
+  std::cout << "Timing electron distributions for Z = "
+            << data_container.getAtomicNumber() << " (" << trial_size
+            << " samples, NOTE: MS = Million Samples Per Second)" << std::endl;
+
+  timeGridPolicies<Utility::LogLogLog>(
+                            "Bremsstrahlung photon energy",
+                            data_container.getBremsstrahlungPhotonEnergy(),
+                            data_container.getBremsstrahlungPhotonPDF(),
+                            trial_size );
+
+  const unsigned subshell = *data_container.getSubshells().begin();
+
+  timeGridPolicies<Utility::LogLogLog>(
+                   "Electroionization recoil energy (first subshell)",
+                   data_container.getElectroionizationRecoilEnergy( subshell ),
+                   data_container.getElectroionizationRecoilPDF( subshell ),
+                   trial_size );
+
+  // The scattering angle cosines cannot be processed with log interpolation
+  timeGridPolicies<Utility::LinLinLin>(
+                                   "Cutoff elastic angle",
+                                   data_container.getCutoffElasticAngles(),
+                                   data_container.getCutoffElasticPDF(),
+                                   trial_size );
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end electron_dist_timer.cpp
+//---------------------------------------------------------------------------//
@@ -8,17 +8,12 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <cstdlib>
 #include <time.h>
 
-// Boost Scoped Pointer
-#include <boost/scoped_ptr.hpp>
-#include <boost/shared_ptr.hpp>
-
-// Trilinos Includes
-#include <Teuchos_RCP.hpp>
-
 // FRENSIE Includes
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
 
 // Time macro
 #define TIME() (clock()/((double)CLOCKS_PER_SEC))
@@ -26,8 +21,13 @@
 // Generator timing function
 void timeGenerator( const int trial_size, const int histories = 1 )
 {
-  // Raw generator
+  // Raw generators
   Utility::LinearCongruentialGenerator generator;
+  Utility::CounterBasedGenerator counter_based_generator;
+
+  Utility::RandomNumberGenerator::setGeneratorType(
+                                      Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+  Utility::RandomNumberGenerator::createStreams();
 
   double time1 = TIME();
 
@@ -54,8 +54,37 @@ void timeGenerator( const int trial_size, const int histories = 1 )
 
   double time3 = TIME();
 
+  Utility::RandomNumberGenerator::setGeneratorType(
+                                            Utility::COUNTER_BASED_GENERATOR );
+  Utility::RandomNumberGenerator::createStreams();
+
+  double time4 = TIME();
+
+  // Wrapped counter-based double generator timing
+  for( int i = 0; i < histories; ++i )
+  {
+    Utility::RandomNumberGenerator::initialize( i );
+
+    for( int j = 0; j < trial_size/histories; ++j )
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  double time5 = TIME();
+
+  // Raw counter-based double generator timing
+  for( int i = 0; i < histories; ++i )
+  {
+    for( int j = 0; j < trial_size/histories; ++j )
+      counter_based_generator.getRandomNumber();
+
+    counter_based_generator.nextHistory();
+  }
+
+  double time6 = TIME();
+
   // Check for valid time intervals
-  if( time2 - time1 < 1.0e-15 || time3 - time2 < 1.0e-15 )
+  if( time2 - time1 < 1.0e-15 || time3 - time2 < 1.0e-15 ||
+      time5 - time4 < 1.0e-15 || time6 - time5 < 1.0e-15 )
   {
     std::cerr << "Timing information not accurate enough for this generator."
 	      << std::endl;
@@ -65,29 +94,88 @@ void timeGenerator( const int trial_size, const int histories = 1 )
     // Calculate the generation speed (Millions/sec)
     double mdbls_per_sec_wrapped = trial_size/(time2-time1)/1e6;
     double mdbls_per_sec_raw = trial_size/(time3-time2)/1e6;
+    double mdbls_per_sec_wrapped_cbg = trial_size/(time5-time4)/1e6;
+    double mdbls_per_sec_raw_cbg = trial_size/(time6-time5)/1e6;
 
     // Print the last double generated
     std::cout << "Last random number generated: "
 	      << generator.getRandomNumber() << " "
+              << counter_based_generator.getRandomNumber() << " "
 	      << Utility::RandomNumberGenerator::getRandomNumber<double>()
 	      << std::endl
 	      << "Random numbers per history: " << trial_size/histories
 	      << std::endl
 	      << "User + System time information (NOTE: MRS = Million Random "
 	      << "Numbers Per Second)\n" << std::endl
-	      << "  Wrapped Double generator:\tTime = " << time2-time1
+	      << "  Wrapped Double generator:\t\tTime = " << time2-time1
 	      << " seconds " << "=> " << mdbls_per_sec_wrapped
 	      << std::endl
-	      << "  Raw Double generator:\t\tTime = " << time3-time2
+	      << "  Raw Double generator:\t\t\tTime = " << time3-time2
 	      << " seconds " << "=> " << mdbls_per_sec_raw
+	      << std::endl
+              << "  Wrapped Counter-Based generator:\tTime = " << time5-time4
+	      << " seconds " << "=> " << mdbls_per_sec_wrapped_cbg
+	      << std::endl
+	      << "  Raw Counter-Based generator:\t\tTime = " << time6-time5
+	      << " seconds " << "=> " << mdbls_per_sec_raw_cbg
 	      << std::endl << std::endl;
   }
 }
 
+// Multi-threaded generator timing function
+/*! \details The histories will be distributed over the threads and the
+ * wall time will be used to calculate the throughput.
+ */
+void timeParallelGenerator( const Utility::RandomNumberGeneratorType type,
+                            const int trial_size,
+                            const int histories )
+{
+  Utility::RandomNumberGenerator::setGeneratorType( type );
+  Utility::RandomNumberGenerator::createStreams();
 
-// Main itming function
-int main()
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
+  // Prevent the compiler from optimizing away the random number generation
+  double sum = 0.0;
+
+  #pragma omp parallel for num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() ) reduction( +:sum )
+  for( int i = 0; i < histories; ++i )
+  {
+    Utility::RandomNumberGenerator::initialize( i );
+
+    for( int j = 0; j < trial_size/histories; ++j )
+      sum += Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  timer->stop();
+
+  double wall_time = timer->elapsed().count();
+
+  if( wall_time < 1.0e-15 )
+  {
+    std::cerr << "Timing information not accurate enough for this generator."
+	      << std::endl;
+  }
+  else
+  {
+    std::cout << "  " << type << " ("
+              << Utility::OpenMPProperties::getRequestedNumberOfThreads()
+              << " threads):\tWall Time = " << wall_time
+              << " seconds => " << trial_size/wall_time/1e6
+              << " (mean = " << sum/trial_size << ")" << std::endl;
+  }
+}
+
+// Main timing function
+int main( int argc, char** argv )
 {
+  // The number of threads can be passed in as the only argument
+  if( argc > 1 && Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( std::atoi( argv[1] ) );
+
   Utility::RandomNumberGenerator::createStreams();
 
   Utility::RandomNumberGenerator::initialize();
@@ -106,6 +194,21 @@ int main()
   std::cout << "Timing generator for 1000 histories" << std::endl;
   timeGenerator( trial_size, 1000 );
 
+  // Multi-threaded throughput (MRS)
+  int parallel_trial_size =
+    trial_size*Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  std::cout << "Multi-threaded throughput for 10000 histories "
+            << "(NOTE: MRS = Million Random Numbers Per Second)" << std::endl;
+
+  timeParallelGenerator( Utility::LINEAR_CONGRUENTIAL_GENERATOR,
+                         parallel_trial_size,
+                         10000 );
+
+  timeParallelGenerator( Utility::COUNTER_BASED_GENERATOR,
+                         parallel_trial_size,
+                         10000 );
+
   return 0;
 }
 